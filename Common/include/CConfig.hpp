@@ -142,6 +142,8 @@ private:
   unsigned long Bc_Eval_Freq;      /*!< \brief Evaluation frequency for Engine and Actuator disk markers. */
   su2double Damp_Res_Restric,     /*!< \brief Damping factor for the residual restriction. */
   Damp_Correc_Prolong;            /*!< \brief Damping factor for the correction prolongation. */
+  unsigned short MG_LineAgglomeration; /*!< \brief Number of points agglomerated along the linelets, 0 disables. */
+  bool MG_AgglomerationStatistics;     /*!< \brief Print the agglomeration statistics of the grid levels. */
   su2double Position_Plane;    /*!< \brief Position of the Near-Field (y coordinate 2D, and z coordinate 3D). */
   su2double WeightCd;          /*!< \brief Weight of the drag coefficient. */
   su2double dCD_dCL;           /*!< \brief Fixed Cl mode derivate . */
@@ -602,6 +604,7 @@ private:
 
   bool AD_Mode;                         /*!< \brief Algorithmic Differentiation support. */
   bool AD_Preaccumulation;              /*!< \brief Enable or disable preaccumulation in the AD mode. */
+  bool AD_ExternalFlux;                 /*!< \brief Use hand-written adjoints (external functions) for edge flux kernels. */
   CHECK_TAPE_TYPE AD_CheckTapeType;           /*!< \brief Type of tape that is checked in a tape debug run. */
   CHECK_TAPE_VARIABLES AD_CheckTapeVariables; /*!< \brief Type of variables that are checked in a tape debug run. */
   STRUCT_COMPRESS Kind_Material_Compress;  /*!< \brief Determines if the material is compressible or incompressible (structural analysis). */
@@ -633,6 +636,7 @@ private:
   su2double Linear_Solver_Smoother_Relaxation;   /*!< \brief Relaxation factor for iterative linear smoothers. */
   unsigned long Linear_Solver_Iter;              /*!< \brief Max iterations of the linear solver for the implicit formulation. */
   unsigned long Deform_Linear_Solver_Iter;       /*!< \brief Max iterations of the linear solver for the implicit formulation. */
+  bool Deform_MatrixFree;                        /*!< \brief Apply the mesh deformation operator element by element (no matrix). */
   unsigned long Linear_Solver_Restart_Frequency; /*!< \brief Restart frequency of the linear solver for the implicit formulation. */
   unsigned long Linear_Solver_Prec_Threads;      /*!< \brief Number of threads per rank for ILU and LU_SGS preconditioners. */
   unsigned short Linear_Solver_ILU_n;            /*!< \brief ILU fill=in level. */
@@ -803,6 +807,7 @@ private:
   unsigned short nCFL_AdaptParam;     /*!< \brief Number of CFL parameters provided in config. */
   bool CFL_Adapt;        /*!< \brief Use adaptive CFL number. */
   bool HB_Precondition;  /*!< \brief Flag to turn on harmonic balance source term preconditioning */
+  unsigned short nHB_InstanceGroups; /*!< \brief Number of rank groups that iterate the harmonic balance instances concurrently. */
   su2double RefArea,     /*!< \brief Reference area for coefficient computation. */
   RefElemLength,         /*!< \brief Reference element length for computing the slope limiting epsilon. */
   RefSharpEdges,         /*!< \brief Reference coefficient for detecting sharp edges. */
@@ -837,12 +842,15 @@ private:
   SurfAdjCoeff_FileName,         /*!< \brief Output file with the adjoint variables on the surface. */
   SurfSens_FileName,             /*!< \brief Output file for the sensitivity on the surface (discrete adjoint). */
   VolSens_FileName,              /*!< \brief Output file for the sensitivity in the volume (discrete adjoint). */
+  Profiling_FileName,            /*!< \brief Output files (CSV and JSON) of the region timers. */
   ObjFunc_Hess_FileName;         /*!< \brief Hessian approximation obtained by the Sobolev smoothing solver. */
   bool Multizone_Adapt_FileName; /*!< \brief Append zone number to solution and restart file names. */
 
   bool
   Wrt_Performance,           /*!< \brief Write the performance summary at the end of a calculation.  */
   Wrt_AD_Statistics,         /*!< \brief Write the tape statistics (discrete adjoint).  */
+  Profiling,                 /*!< \brief Time the instrumented code regions and write a report.  */
+  Profiling_HWCounters,      /*!< \brief Read hardware counters in the instrumented code regions.  */
   Wrt_MeshQuality,           /*!< \brief Write the mesh quality statistics to the visualization files.  */
   Wrt_MultiGrid,             /*!< \brief Write the coarse grids to the visualization files.  */
   Wrt_Projected_Sensitivity, /*!< \brief Write projected sensitivities (dJ/dx) on surfaces to ASCII file. */
@@ -954,6 +962,7 @@ private:
   string RefGeom_FEMFileName;           /*!< \brief File name for reference geometry. */
   unsigned short RefGeom_FileFormat;    /*!< \brief Mesh input format. */
   STRUCT_2DFORM Kind_2DElasForm;        /*!< \brief Kind of bidimensional elasticity solver. */
+  bool FEA_BatchedAssembly;             /*!< \brief Batched (SIMD) assembly of the structural element terms. */
   unsigned short nIterFSI_Ramp;         /*!< \brief Number of FSI subiterations during which a ramp is applied. */
   unsigned short iInst;                 /*!< \brief Current instance value */
   su2double AitkenStatRelax;      /*!< \brief Aitken's relaxation factor (if set as static) */
@@ -1054,6 +1063,7 @@ private:
   INTERFACE_INTERPOLATOR Kind_Interpolation; /*!< \brief type of interpolation to use for FSI applications. */
   bool ConservativeInterpolation;            /*!< \brief Conservative approach for non matching mesh interpolation. */
   unsigned short NumNearestNeighbors;        /*!< \brief Number of neighbors used for Nearest Neighbor interpolation. */
+  bool DistributedDonorSearch;               /*!< \brief Search the nearest neighbor donors without gathering them. */
   RADIAL_BASIS Kind_RadialBasisFunction;     /*!< \brief type of radial basis function to use for radial basis FSI. */
   bool RadialBasisFunction_PolynomialOption; /*!< \brief Option of whether to include polynomial terms in Radial Basis Function Interpolation or not. */
   su2double RadialBasisFunction_Parameter;   /*!< \brief Radial basis function parameter (radius). */
@@ -1071,6 +1081,12 @@ private:
   su2double ParMETIS_tolerance;     /*!< \brief Load balancing tolerance for ParMETIS. */
   long ParMETIS_pointWgt;           /*!< \brief Load balancing weight given to points. */
   long ParMETIS_edgeWgt;            /*!< \brief Load balancing weight given to edges. */
+  long ParMETIS_boundaryWgt;        /*!< \brief Load balancing weight given to boundary points. */
+  bool ParMETIS_readWgts;           /*!< \brief Read measured point weights for the partitioning. */
+  bool ParMETIS_writeWgts;          /*!< \brief Write measured point weights at the end of the simulation. */
+  string ParMETIS_wgtsFileName;     /*!< \brief File with the measured point weights. */
+  bool ParMETIS_nodeAware;          /*!< \brief Map the partitions to ranks such that neighbors share a node. */
+  bool SharedMemoryHaloComms;       /*!< \brief Exchange halos with ranks of the same node via shared memory. */
   unsigned short DirectDiff;        /*!< \brief Direct Differentation mode. */
   bool DiscreteAdjoint,                /*!< \brief AD-based discrete adjoint mode. */
   DiscreteAdjointDebug;                /*!< \brief Discrete adjoint debug mode using tags. */
@@ -1173,6 +1189,7 @@ private:
   unsigned short sizeMatMulPadding;          /*!< \brief The matrix size in the vectorization direction padded to a multiple of 8. Computed from byteAlignmentMatMul. */
   bool Compute_Entropy;                      /*!< \brief Whether or not to compute the entropy in the fluid model. */
   bool Use_Lumped_MassMatrix_DGFEM;          /*!< \brief Whether or not to use the lumped mass matrix for DGFEM. */
+  unsigned short sumFactorizationPoly_DGFEM; /*!< \brief Minimum polynomial degree of tensor-product elements for which sum factorization is used, 0 disables it. */
   bool Jacobian_Spatial_Discretization_Only; /*!< \brief Flag to know if only the exact Jacobian of the spatial discretization must be computed. */
   bool Compute_Average;                      /*!< \brief Whether or not to compute averages for unsteady simulations in FV or DG solver. */
   unsigned short Comm_Level;                 /*!< \brief Level of MPI communications to be performed. */
@@ -1186,6 +1203,12 @@ private:
   Restart_Iter;                  /*!< \brief Determines the restart iteration in the multizone problem */
   su2double Time_Step;           /*!< \brief Determines the time step for the multizone problem */
   su2double Max_Time;            /*!< \brief Determines the maximum time for the time-domain problems */
+  unsigned short nParareal_Slabs;    /*!< \brief Number of time slabs of the Parareal driver. */
+  unsigned short nParareal_Iter;     /*!< \brief Maximum number of Parareal iterations. */
+  unsigned short Parareal_Coarsening; /*!< \brief Time step ratio of the coarse Parareal propagator. */
+  unsigned long nParareal_CoarseInnerIter; /*!< \brief Inner iterations of the coarse Parareal propagator. */
+  su2double Parareal_Tol;            /*!< \brief Convergence tolerance of the Parareal iterations. */
+  unsigned short iParareal_Slab = 0; /*!< \brief Time slab of this rank. */
 
   unsigned long HistoryWrtFreq[3],    /*!< \brief Array containing history writing frequencies for timer iter, outer iter, inner iter */
                 ScreenWrtFreq[3];     /*!< \brief Array containing screen writing frequencies for timer iter, outer iter, inner iter */
@@ -1243,6 +1266,8 @@ private:
   *Supercatalytic_Wall_Composition,         /*!< \brief Supercatalytic wall mass fractions [dimensionless]. */
   pnorm_heat;                               /*!< \brief pnorm for heat-flux. */
   bool frozen,                              /*!< \brief Flag for determining if mixture is frozen. */
+  chemistry_split,                          /*!< \brief Flag for the operator split integration of the chemistry. */
+  tabulate_thermochemistry,                 /*!< \brief Flag for the tabulation of the temperature dependent thermochemistry. */
   ionization,                               /*!< \brief Flag for determining if free electron gas is in the mixture. */
   vt_transfer_res_limit,                    /*!< \brief Flag for determining if residual limiting for source term VT-transfer is used. */
   monoatomic,                               /*!< \brief Flag for monoatomic mixture. */
@@ -1251,6 +1276,7 @@ private:
   *Wall_Catalytic;                          /*!< \brief Pointer to catalytic walls. */
   TRANSCOEFFMODEL   Kind_TransCoeffModel;   /*!< \brief Transport coefficient Model for NEMO solver. */
   su2double CatalyticEfficiency;            /*!< \brief Wall catalytic efficiency. */
+  unsigned long Chemistry_MaxSubSteps;      /*!< \brief Maximum number of sub-steps of the split chemistry integration. */
   su2double *Inlet_MassFrac;                /*!< \brief Specified Mass fraction vectors for NEMO inlet boundaries. */
   su2double Inlet_Temperature_ve;           /*!< \brief Specified Tve for supersonic inlet boundaries (NEMO solver). */
 
@@ -2273,6 +2299,11 @@ public:
    */
   STRUCT_2DFORM GetElas2D_Formulation() const { return Kind_2DElasForm; }
 
+  /*!
+   * \brief Check if the structural element terms are assembled for batches of elements of the same type.
+   */
+  bool GetFEA_BatchedAssembly() const { return FEA_BatchedAssembly; }
+
   /*!
    * \brief Decide whether it's necessary to read a reference geometry.
    * \return <code>TRUE</code> if it's necessary to read a reference geometry, <code>FALSE</code> otherwise.
@@ -3261,6 +3292,24 @@ public:
    */
   bool GetWrt_AD_Statistics(void) const { return Wrt_AD_Statistics; }
 
+  /*!
+   * \brief Get information about timing the instrumented code regions (per rank and thread).
+   * \return <code>TRUE</code> means that a profiling report will be written at the end of the calculation.
+   */
+  bool GetProfiling(void) const { return Profiling; }
+
+  /*!
+   * \brief Get information about reading hardware counters (cycles, instructions, cache misses) in the timed regions.
+   * \return <code>TRUE</code> means that a roofline-style summary will be printed at the end of the calculation.
+   */
+  bool GetProfiling_HWCounters(void) const { return Profiling_HWCounters; }
+
+  /*!
+   * \brief Get the name of the profiling report files.
+   * \return Name of the CSV and JSON files (w/o extension).
+   */
+  const string& GetProfiling_FileName(void) const { return Profiling_FileName; }
+
   /*!
    * \brief Get information about writing the mesh quality metrics to the visualization files.
    * \return <code>TRUE</code> means that the mesh quality metrics will be written to the visualization files.
@@ -4252,6 +4301,12 @@ public:
    */
   unsigned long GetDeform_Linear_Solver_Iter(void) const { return Deform_Linear_Solver_Iter; }
 
+  /*!
+   * \brief Get whether the mesh deformation uses a matrix-free (element by element) operator.
+   * \return <code>TRUE</code> if the stiffness matrix of the mesh deformation is not stored.
+   */
+  bool GetDeform_MatrixFree(void) const { return Deform_MatrixFree; }
+
   /*!
    * \brief Get the ILU fill-in level for the linear solver.
    * \return Fill in level of the ILU preconditioner for the linear solver.
@@ -5512,6 +5567,21 @@ public:
    */
   bool GetFrozen(void) const { return frozen; }
 
+  /*!
+   * \brief Indicates whether the chemical source terms are integrated in a separate (operator split) stage.
+   */
+  bool GetChemistry_Split(void) const { return chemistry_split; }
+
+  /*!
+   * \brief Get the maximum number of sub-steps of the split chemistry integration, per point.
+   */
+  unsigned long GetChemistry_MaxSubSteps(void) const { return Chemistry_MaxSubSteps; }
+
+  /*!
+   * \brief Indicates whether the temperature dependent properties of the SU2TCLib gas models are tabulated.
+   */
+  bool GetTabulate_ThermoChemistry(void) const { return tabulate_thermochemistry; }
+
   /*!
    * \brief Indicates whether electron gas is present in the gas mixture.
    */
@@ -5677,6 +5747,9 @@ public:
       historyFilename = GetUnsteady_FileName(historyFilename, GetRestart_Iter(), "");
     }
 
+    /*--- Each time slab of a Parareal run writes its own history. ---*/
+    if (iParareal_Slab > 0) historyFilename += "_slab" + std::to_string(iParareal_Slab);
+
     /*--- Add the correct file extension depending on the file format ---*/
     string hist_ext = ".csv";
     if (GetTabular_FileFormat() == TAB_OUTPUT::TAB_TECPLOT) hist_ext = ".dat";
@@ -6259,6 +6332,12 @@ public:
    */
   bool GetHB_Precondition(void) const { return HB_Precondition; }
 
+  /*!
+   * \brief Get the number of rank groups over which the harmonic balance instances are distributed.
+   * \return Number of instance groups, 1 iterates all instances on all ranks.
+   */
+  unsigned short GetnHB_InstanceGroups(void) const { return nHB_InstanceGroups; }
+
   /*!
    * \brief Get if we should update the motion origin.
    * \param[in] val_marker - Value of the marker in which we are interested.
@@ -6690,6 +6769,19 @@ public:
    */
   su2double GetDamp_Correc_Prolong(void) const { return Damp_Correc_Prolong; }
 
+  /*!
+   * \brief Get the number of points along the linelets (stretched mesh regions) agglomerated into each coarse
+   *        control volume (directional semi-coarsening).
+   * \return 0 if the agglomeration is isotropic everywhere.
+   */
+  unsigned short GetMG_LineAgglomeration(void) const { return MG_LineAgglomeration; }
+
+  /*!
+   * \brief Get whether the agglomeration statistics of the grid levels are printed.
+   * \return <code>TRUE</code> to print the number of children and the anisotropy of each grid level.
+   */
+  bool GetMG_AgglomerationStatistics(void) const { return MG_AgglomerationStatistics; }
+
   /*!
    * \brief Value of the position of the Near Field (y coordinate for 2D, and z coordinate for 3D).
    * \return Value of the Near Field position.
@@ -9332,6 +9424,12 @@ public:
    */
   bool GetUse_Lumped_MassMatrix_DGFEM(void) const { return Use_Lumped_MassMatrix_DGFEM; }
 
+  /*!
+   * \brief Get the minimum polynomial degree of quadrilaterals and hexahedra for which the volume terms
+   *        are computed with sum factorization instead of dense matrix products (0 means never).
+   */
+  unsigned short GetSumFactorizationPoly_DGFEM(void) const { return sumFactorizationPoly_DGFEM; }
+
   /*!
    * \brief Function to make available whether or not only the exact Jacobian
    *        of the spatial discretization must be computed.
@@ -9374,6 +9472,12 @@ public:
    */
   unsigned short GetNumNearestNeighbors(void) const { return NumNearestNeighbors; }
 
+  /*!
+   * \brief Distributed search of the nearest neighbor donors.
+   * \return <code>TRUE</code> if the donors are searched on the ranks that own them.
+   */
+  bool GetDistributedDonorSearch(void) const { return DistributedDonorSearch; }
+
   /*!
    * \brief Get the kind of inlet face interpolation function to use.
    */
@@ -9493,6 +9597,11 @@ public:
    */
   bool GetAD_Preaccumulation(void) const { return AD_Preaccumulation;}
 
+  /*!
+   * \brief Get if hand-written adjoints (registered as external functions) should replace the taped edge flux kernels.
+   */
+  bool GetAD_ExternalFlux(void) const { return AD_ExternalFlux;}
+
   /*!
    * \brief Get the heat equation.
    * \return YES if weakly coupled heat equation for inc. flow is enabled.
@@ -9630,6 +9739,45 @@ public:
    */
   su2double GetMax_Time(void) const { return Max_Time; }
 
+  /*!
+   * \brief Get the number of time slabs of the parallel-in-time (Parareal) driver.
+   * \return Number of time slabs, 1 when the driver is not used.
+   */
+  unsigned short GetnParareal_Slabs(void) const { return nParareal_Slabs; }
+
+  /*!
+   * \brief Get the maximum number of Parareal iterations.
+   */
+  unsigned short GetnParareal_Iter(void) const { return nParareal_Iter; }
+
+  /*!
+   * \brief Get the ratio between the time steps of the coarse and fine Parareal propagators.
+   */
+  unsigned short GetParareal_Coarsening(void) const { return Parareal_Coarsening; }
+
+  /*!
+   * \brief Get the number of inner iterations per time step of the coarse Parareal propagator.
+   * \return Inner iterations, 0 to use the ones of the fine propagator.
+   */
+  unsigned long GetnParareal_CoarseInnerIter(void) const { return nParareal_CoarseInnerIter; }
+
+  /*!
+   * \brief Get the relative change of the time slab initial states below which Parareal is converged.
+   */
+  su2double GetParareal_Tol(void) const { return Parareal_Tol; }
+
+  /*!
+   * \brief Set the time slab of this rank, it is appended to the history file name.
+   * \param[in] val_slab - Index of the time slab.
+   */
+  void SetiParareal_Slab(unsigned short val_slab) { iParareal_Slab = val_slab; }
+
+  /*!
+   * \brief Set the number of inner iterations.
+   * \param[in] val_iter - Number of inner iterations.
+   */
+  void SetnInner_Iter(unsigned long val_iter) { nInnerIter = val_iter; }
+
   /*!
    * \brief Get the level of MPI communications to be performed.
    * \return Level of MPI communications.
@@ -9950,6 +10098,36 @@ public:
    */
   long GetParMETIS_EdgeWeight() const { return ParMETIS_edgeWgt; }
 
+  /*!
+   * \brief Get the ParMETIS load balancing weight for points on boundary markers.
+   */
+  long GetParMETIS_BoundaryWeight() const { return ParMETIS_boundaryWgt; }
+
+  /*!
+   * \brief Check if the partitioning should use the point weights measured by a previous run.
+   */
+  bool GetParMETIS_ReadWeights() const { return ParMETIS_readWgts; }
+
+  /*!
+   * \brief Check if the point weights measured in this run should be written for future partitionings.
+   */
+  bool GetParMETIS_WriteWeights() const { return ParMETIS_writeWgts; }
+
+  /*!
+   * \brief Get the name of the file with the measured point weights.
+   */
+  const string& GetParMETIS_WeightsFileName() const { return ParMETIS_wgtsFileName; }
+
+  /*!
+   * \brief Check if the partitions should be mapped to ranks to minimize the cut between nodes.
+   */
+  bool GetParMETIS_NodeAware() const { return ParMETIS_nodeAware; }
+
+  /*!
+   * \brief Check if halos are exchanged with the ranks of the same node through shared memory.
+   */
+  bool GetSharedMemoryHaloComms() const { return SharedMemoryHaloComms; }
+
   /*!
    * \brief Find the marker index (if any) that is part of a given interface pair.
    * \param[in] iInterface - Number of the interface pair being tested, starting at 0.
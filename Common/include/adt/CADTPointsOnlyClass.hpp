@@ -69,6 +69,34 @@ class CADTPointsOnlyClass : public CADTBaseClass {
     DetermineNearestNode_impl(FrontLeaves[iThread], FrontLeavesNew[iThread], coor, dist, pointID, rankID);
   }
 
+  /*!
+   * \brief Function, which determines the nNodes nearest nodes in the ADT for the given coordinate.
+   * \note Ties are broken by point ID, so the result does not depend on the order of the points in the ADT.
+   * \param[in]  coor    Coordinate for which the nearest nodes in the ADT must be determined.
+   * \param[in]  nNodes  Number of nodes to determine, fewer if the ADT does not contain as many.
+   * \param[out] dist2   Squared distances to the nearest nodes, in increasing order.
+   * \param[out] pointID Local point IDs of the nearest nodes.
+   * \param[out] rankID  Ranks on which the nearest nodes are stored.
+   */
+  inline void DetermineNearestNodes(const su2double* coor, unsigned long nNodes, vector<su2double>& dist2,
+                                    vector<unsigned long>& pointID, vector<int>& rankID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNearestNodes_impl(FrontLeaves[iThread], FrontLeavesNew[iThread], coor, nNodes, dist2, pointID, rankID);
+  }
+
+  /*!
+   * \brief Function, which determines the nodes in the ADT within a distance of the given coordinate.
+   * \param[in]  coor    Coordinate around which the nodes must be determined.
+   * \param[in]  dist    Maximum distance of the nodes to the coordinate.
+   * \param[out] pointID Local point IDs of the nodes.
+   * \param[out] rankID  Ranks on which the nodes are stored.
+   */
+  inline void DetermineNodesWithinDistance(const su2double* coor, su2double dist, vector<unsigned long>& pointID,
+                                           vector<int>& rankID) {
+    const auto iThread = omp_get_thread_num();
+    DetermineNodesWithinDistance_impl(FrontLeaves[iThread], FrontLeavesNew[iThread], coor, dist, pointID, rankID);
+  }
+
   /*!
    * \brief Default constructor of the class, disabled.
    */
@@ -81,4 +109,50 @@ class CADTPointsOnlyClass : public CADTBaseClass {
    */
   void DetermineNearestNode_impl(vector<unsigned long>& frontLeaves, vector<unsigned long>& frontLeavesNew,
                                  const su2double* coor, su2double& dist, unsigned long& pointID, int& rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNearestNodes.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves, vector<unsigned long>& frontLeavesNew,
+                                  const su2double* coor, unsigned long nNodes, vector<su2double>& dist2,
+                                  vector<unsigned long>& pointID, vector<int>& rankID) const;
+
+  /*!
+   * \brief Implementation of DetermineNodesWithinDistance.
+   * \note Working variables (first two) passed explicitly for thread safety.
+   */
+  void DetermineNodesWithinDistance_impl(vector<unsigned long>& frontLeaves, vector<unsigned long>& frontLeavesNew,
+                                         const su2double* coor, su2double dist, vector<unsigned long>& pointID,
+                                         vector<int>& rankID) const;
+
+  /*!
+   * \brief Squared distance from a coordinate to a node of the ADT.
+   */
+  inline su2double SquaredDistance(const su2double* coor, unsigned long iNode) const {
+    const su2double* coorTarget = coorPoints.data() + nDimADT * iNode;
+    su2double dist = 0.0;
+    for (unsigned short l = 0; l < nDimADT; ++l) {
+      const su2double ds = coor[l] - coorTarget[l];
+      dist += ds * ds;
+    }
+    return dist;
+  }
+
+  /*!
+   * \brief Possible minimum squared distance from a coordinate to the nodes of a leaf of the ADT.
+   */
+  inline su2double PossibleMinSquaredDistance(const su2double* coor, unsigned long iLeaf) const {
+    su2double posDist = 0.0;
+    for (unsigned short l = 0; l < nDimADT; ++l) {
+      su2double ds = 0.0;
+      if (coor[l] < leaves[iLeaf].xMin[l])
+        ds = coor[l] - leaves[iLeaf].xMin[l];
+      else if (coor[l] > leaves[iLeaf].xMax[l])
+        ds = coor[l] - leaves[iLeaf].xMax[l];
+
+      posDist += ds * ds;
+    }
+    return posDist;
+  }
 };
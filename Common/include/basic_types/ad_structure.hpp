@@ -80,6 +80,13 @@ inline bool TapeActive() { return false; }
 template <typename Comm>
 inline void PrintStatistics(Comm communicator, bool printingRank) {}
 
+/*!
+ * \brief Memory used by the tape of this process, i.e. of the serial tape and of all OpenMP thread tapes.
+ * \note Differences of this value before and after recording parts of the program give their tape footprint.
+ * \return Used tape memory in bytes.
+ */
+inline double GetTapeMemoryUsed() { return 0.0; }
+
 /*!
  * \brief Registers the variable as an input. I.e. as a leaf of the computational graph.
  * \param[in] data - The variable to be registered as input.
@@ -377,6 +384,18 @@ using ExtFuncHelper = codi::ExternalFunctionHelper<su2double>;
 
 extern ExtFuncHelper FuncHelper;
 
+/*--- Helper for the small external functions of kernels (e.g. the edge fluxes), which each thread records
+ *    on its own in parallel loops, hence the plain helper made thread-private. The type is that of FuncHelper
+ *    without OpDiLib; what differs is the setup: Initialize disables the storage of the primal values of
+ *    FuncHelper (the linear solver passes its data as user data), this helper keeps CoDiPack's default of
+ *    storing the input and output primal values, which the hand-written kernel adjoints need. ---*/
+using LocalExtFuncHelper = codi::ExternalFunctionHelper<su2double>;
+
+extern LocalExtFuncHelper LocalFuncHelper;
+#ifdef HAVE_OPDI
+SU2_OMP(threadprivate(LocalFuncHelper))
+#endif
+
 extern bool PreaccActive;
 #ifdef HAVE_OPDI
 SU2_OMP(threadprivate(PreaccActive))
@@ -503,6 +522,20 @@ FORCEINLINE void PrintStatistics(Comm communicator, bool printingRank) {
   }
 }
 
+FORCEINLINE double GetTapeMemoryUsed() {
+  double memoryUsed = AD::getTape().getTapeValues().getUsedMemorySize();
+#ifdef HAVE_OPDI
+  // clang-format off
+  SU2_OMP_PARALLEL {
+    const double threadMemoryUsed = AD::getTape().getTapeValues().getUsedMemorySize();
+    SU2_OMP_ATOMIC
+    memoryUsed += threadMemoryUsed;
+  } END_SU2_OMP_PARALLEL
+  // clang-format on
+#endif
+  return memoryUsed;
+}
+
 FORCEINLINE void ClearAdjoints() { AD::getTape().clearAdjoints(); }
 
 FORCEINLINE void ComputeAdjoint() {
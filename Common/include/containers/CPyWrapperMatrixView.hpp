@@ -27,12 +27,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "../geometry/dual_grid/CVertex.hpp"
 #include "../parallelization/mpi_structure.hpp"
+#include "../linear_algebra/CSysVector.hpp"
 #include "C2DContainer.hpp"
 
 /*!
@@ -76,6 +81,33 @@
     for (const auto& val : vals) Set(row, j++, val);                                                             \
   }
 
+/*!
+ * \brief Python wrapper zero-copy interface
+ * The accessors in this macro describe the raw (row-major, strided) storage of a view so that
+ * Python can map it without copies, e.g. via the NumPy array interface defined in pySU2.i.
+ * Halo (ghost) nodes are stored after the "domain_rows_" owned by this rank.
+ * Only available in primal builds, with AD the storage is not an array of doubles.
+ * Classes that use this macro must have member variables "data_", "domain_rows_", and
+ * a method "ByteStrides()".
+ */
+#define PY_WRAPPER_BUFFER_INTERFACE                                                                              \
+  /*! \brief Returns the number of rows owned by this rank (halos are stored after these). */                    \
+  unsigned long DomainRows() const { return domain_rows_; }                                                      \
+                                                                                                                 \
+  /*! \brief Returns whether zero-copy access to the storage is possible (false in AD builds). */                \
+  static bool IsBufferAvailable() { return std::is_same<su2double, passivedouble>::value; }                      \
+                                                                                                                 \
+  /*! \brief Returns the size in bytes of one entry of the matrix. */                                            \
+  static unsigned long ItemSize() { return sizeof(su2double); }                                                  \
+                                                                                                                 \
+  /*! \brief Returns the address of the first entry, the data is owned by the solver, not by the view. */        \
+  unsigned long long DataAddress() const {                                                                       \
+    if (!IsBufferAvailable()) {                                                                                  \
+      SU2_MPI::Error(name_ + " cannot be accessed without copies in AD builds.", CURRENT_FUNCTION);              \
+    }                                                                                                            \
+    return reinterpret_cast<std::uintptr_t>(data_);                                                              \
+  }
+
 /*!
  * \class CPyWrapperMatrixView
  * \ingroup PySU2
@@ -86,7 +118,7 @@ class CPyWrapperMatrixView {
  protected:
   static_assert(su2activematrix::IsRowMajor, "");
   su2double* data_ = nullptr;
-  unsigned long rows_ = 0, cols_ = 0;
+  unsigned long rows_ = 0, cols_ = 0, domain_rows_ = 0;
   std::string name_;
   bool read_only_ = false;
 
@@ -110,10 +142,39 @@ class CPyWrapperMatrixView {
    * \note "read_only" can be set to true to prevent the data from being modified.
    */
   CPyWrapperMatrixView(su2activematrix& mat, const std::string& name, bool read_only)
-      : data_(mat.data()), rows_(mat.rows()), cols_(mat.cols()), name_(name), read_only_(read_only) {}
+      : data_(mat.data()),
+        rows_(mat.rows()),
+        cols_(mat.cols()),
+        domain_rows_(mat.rows()),
+        name_(name),
+        read_only_(read_only) {}
 
-  /*--- Use the macro to generate the interface. ---*/
+  /*!
+   * \brief Construct the view of a matrix whose last rows are halos.
+   * \note "domain_rows" is the number of rows owned by this rank, usually nPointDomain.
+   */
+  CPyWrapperMatrixView(su2activematrix& mat, unsigned long domain_rows, const std::string& name, bool read_only)
+      : CPyWrapperMatrixView(mat, name, read_only) {
+    domain_rows_ = std::min(domain_rows, rows_);
+  }
+
+  /*!
+   * \brief Construct the view of a block vector, e.g. a residual, with one row per block.
+   */
+  CPyWrapperMatrixView(CSysVector<su2double>& vec, const std::string& name, bool read_only)
+      : data_(vec.GetBlock(0)),
+        rows_(vec.GetNBlk()),
+        cols_(vec.GetNVar()),
+        domain_rows_(vec.GetNBlkDomain()),
+        name_(name),
+        read_only_(read_only) {}
+
+  /*! \brief Returns the strides in bytes of the rows and columns. */
+  std::vector<unsigned long> ByteStrides() const { return {cols_ * sizeof(su2double), sizeof(su2double)}; }
+
+  /*--- Use the macros to generate the interface. ---*/
   PY_WRAPPER_MATRIX_INTERFACE
+  PY_WRAPPER_BUFFER_INTERFACE
 };
 
 /*!
@@ -177,7 +238,7 @@ class CPyWrapper3DMatrixView {
  protected:
   static_assert(su2activematrix::IsRowMajor, "");
   su2double* data_ = nullptr;
-  unsigned long rows_ = 0, cols_ = 0, dims_ = 0;
+  unsigned long rows_ = 0, cols_ = 0, dims_ = 0, domain_rows_ = 0;
   std::string name_;
   bool read_only_ = false;
 
@@ -205,12 +266,30 @@ class CPyWrapper3DMatrixView {
         rows_(mat.length()),
         cols_(mat.rows()),
         dims_(mat.cols()),
+        domain_rows_(mat.length()),
         name_(name),
         read_only_(read_only) {}
 
+  /*!
+   * \brief Construct the view of a matrix whose last rows are halos.
+   * \note "domain_rows" is the number of rows owned by this rank, usually nPointDomain.
+   */
+  CPyWrapper3DMatrixView(C3DDoubleMatrix& mat, unsigned long domain_rows, const std::string& name, bool read_only)
+      : CPyWrapper3DMatrixView(mat, name, read_only) {
+    domain_rows_ = std::min(domain_rows, rows_);
+  }
+
   /*! \brief Returns the shape of the matrix. */
   std::vector<unsigned long> Shape() const { return {rows_, cols_, dims_}; }
 
+  /*! \brief Returns the strides in bytes of the rows, columns, and dimensions. */
+  std::vector<unsigned long> ByteStrides() const {
+    return {cols_ * dims_ * sizeof(su2double), dims_ * sizeof(su2double), sizeof(su2double)};
+  }
+
+  /*--- Use the macro to generate the zero-copy interface. ---*/
+  PY_WRAPPER_BUFFER_INTERFACE
+
   /*! \brief Returns whether the data is read-only [true] or if it can be modified [false]. */
   bool IsReadOnly() const { return read_only_; }
 
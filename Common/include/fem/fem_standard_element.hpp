@@ -715,6 +715,17 @@ class CFEMStandardElement : public CFEMStandardElementBase {
                                             functions   in the integration points. As such second derivatives can be
                                             computed   using one call to the BLAS routines. */
 
+  unsigned short nDOFs1D = 0;        /*!< \brief Number of DOFs per direction of a tensor-product element (quadrilateral
+                                                 or hexahedron), 0 for the other elements. */
+  unsigned short nIntegration1D = 0; /*!< \brief Number of integration points per direction of a tensor-product
+                                                 element. */
+  vector<su2double> lagBasisInt1D;      /*!< \brief 1D Lagrangian basis functions in the 1D integration points,
+                                                    nIntegration1D x nDOFs1D in row major order. */
+  vector<su2double> derLagBasisInt1D;   /*!< \brief Derivatives of the 1D Lagrangian basis functions in the 1D
+                                                    integration points, nIntegration1D x nDOFs1D. */
+  vector<su2double> lagBasisInt1DTrans; /*!< \brief Transpose of lagBasisInt1D. */
+  vector<su2double> derLagBasisInt1DTrans; /*!< \brief Transpose of derLagBasisInt1D. */
+
   vector<unsigned short> connFace0; /*!< \brief Local connectivity of face 0 of the element. The numbering of the DOFs
                                        is such that the element is to the left of the face. */
   vector<unsigned short> connFace1; /*!< \brief Local connectivity of face 1 of the element. The numbering of the DOFs
@@ -992,7 +1003,63 @@ class CFEMStandardElement : public CFEMStandardElementBase {
   */
   passivedouble WorkEstimateMetis(CConfig* config);
 
+  /*!
+   * \brief Function, which indicates whether the basis functions and integration rule of this standard element
+            are tensor products of 1D ones, i.e. whether the sum factorization functions can be used.
+   * \return True for quadrilaterals and hexahedra.
+   */
+  inline bool GetTensorProduct(void) const { return nDOFs1D > 0; }
+
+  /*!
+   * \brief Function, which makes available the size of the work array needed by the sum factorization functions.
+   * \param[in] N - Number of columns (padded number of variables) of the data.
+   * \return The number of entries of the work array.
+   */
+  unsigned long GetSizeWorkSumFactorization(const unsigned short N) const;
+
+  /*!
+  * \brief Function, which interpolates data from the DOFs to the integration points of a tensor-product element
+           with sum factorization, i.e. by applying the 1D basis functions per direction. The result is the same
+           as the gemm with the first nInt (or nInt*(nDim+1)) rows of matBasisIntegration, at a cost of
+           O(p^(d+1)) instead of O(p^(2d)) per element.
+  * \param[in]  N           - Number of columns (padded number of variables) of the data.
+  * \param[in]  derivatives - Whether the parametric derivatives must be computed as well.
+  * \param[in]  dofData     - Data in the DOFs, nDOFs x N.
+  * \param[out] intData     - Data (and derivatives) in the integration points, stored as matBasisIntegration.
+  * \param[in]  work        - Work array, see GetSizeWorkSumFactorization.
+  */
+  void SumFactInterpolation(const unsigned short N, const bool derivatives, const su2double* dofData,
+                            su2double* intData, su2double* work) const;
+
+  /*!
+  * \brief Function, which integrates data in the integration points against the basis functions of a
+           tensor-product element with sum factorization. Same result as the gemm with lagBasisIntegrationTrans.
+  * \param[in]  N       - Number of columns (padded number of variables) of the data.
+  * \param[in]  intData - Data in the integration points, nInt x N.
+  * \param[out] dofData - Integrated data in the DOFs, nDOFs x N.
+  * \param[in]  work    - Work array, see GetSizeWorkSumFactorization.
+  */
+  void SumFactIntegration(const unsigned short N, const su2double* intData, su2double* dofData,
+                          su2double* work) const;
+
+  /*!
+  * \brief Function, which integrates data in the integration points against the parametric derivatives of the
+           basis functions of a tensor-product element with sum factorization. Same result as the gemm with
+           matDerBasisIntTrans.
+  * \param[in]  N       - Number of columns (padded number of variables) of the data.
+  * \param[in]  intData - Data in the integration points, (nInt*nDim) x N with the direction running fastest.
+  * \param[out] dofData - Integrated data in the DOFs, nDOFs x N.
+  * \param[in]  work    - Work array, see GetSizeWorkSumFactorization.
+  */
+  void SumFactDerIntegration(const unsigned short N, const su2double* intData, su2double* dofData,
+                             su2double* work) const;
+
  private:
+  /*!
+   * \brief Function, which creates the 1D data needed by the sum factorization functions.
+   */
+  void DataTensorProduct(void);
+
   /*!
   * \brief Function, which changes the given quadrilateral connectivity, such that the direction coincides
            with the direction corresponding to corner vertices vert0, vert1, vert2, vert3.
@@ -65,6 +65,8 @@ extern "C" {
 
 using namespace std;
 
+struct CNodeTopology;
+
 /*!
  * \class CGeometry
  * \brief Parent class for defining the geometry of the problem (complete geometry,
@@ -226,6 +228,24 @@ class CGeometry {
  protected:
   mutable CLineletInfo lineletInfo;
 
+  /*!
+   * \brief Get the node topology of the ranks of the communicator of this geometry.
+   * \note Collective call the first time, the topology is created from the current communicator (SU2_MPI::GetComm).
+   */
+  const CNodeTopology& GetNodeTopology();
+
+  /*!
+   * \brief Get the shared-memory node of each rank, nodes are numbered in the order of their lowest rank.
+   * \note Collective call the first time, see GetNodeTopology.
+   */
+  const vector<int>& GetNodeOfRanks();
+
+  /*!
+   * \brief Allocate the su2double point-to-point buffers in shared windows and get the buffers of the neighbors.
+   * \note Collective call for the ranks of a node.
+   */
+  void AllocateSharedP2PBuffers();
+
  public:
   /*--- Main geometric elements of the grid. ---*/
 
@@ -288,6 +308,26 @@ class CGeometry {
   SU2_MPI::Request* req_P2PSend{nullptr}; /*!< \brief Data structure for point-to-point send requests. */
   SU2_MPI::Request* req_P2PRecv{nullptr}; /*!< \brief Data structure for point-to-point recv requests. */
 
+  /*--- Data structures for point-to-point communications through shared memory. The su2double buffers are
+   * allocated in MPI-3 shared windows and ranks on the same node read their messages directly from the buffer
+   * of the sender, the MPI messages between them carry no data, they only signal that a buffer is ready. ---*/
+
+  bool sharedP2P{false}; /*!< \brief Whether su2double messages to ranks on the same node use shared memory. */
+  shared_ptr<const CNodeTopology> nodeTopology; /*!< \brief Node of each rank and node communicators, created by
+                                                     GetNodeTopology since drivers may split the ranks. */
+  vector<int> remoteOffset_P2PSend; /*!< \brief For each recv neighbor on the node, start (in points) of our message
+                                       in its send buffer, -1 for neighbors on other nodes. */
+  vector<int> remoteOffset_P2PRecv; /*!< \brief For each send neighbor on the node, start (in points) of our message
+                                       in its recv buffer (reverse comms), -1 for neighbors on other nodes. */
+  vector<const su2double*> remoteBufD_P2PSend; /*!< \brief Send buffers of the recv neighbors on the node. */
+  vector<const su2double*> remoteBufD_P2PRecv; /*!< \brief Recv buffers of the send neighbors on the node. */
+  SU2_MPI::Request* req_P2PAck{nullptr}; /*!< \brief Acknowledgments that the neighbors on the node copied our
+                                            messages, i.e. that the buffers can be reused. */
+#ifdef HAVE_MPI
+  MPI_Win winD_P2PSend{MPI_WIN_NULL}; /*!< \brief Shared window of the su2double send buffer. */
+  MPI_Win winD_P2PRecv{MPI_WIN_NULL}; /*!< \brief Shared window of the su2double recv buffer. */
+#endif
+
   /*--- Data structures for periodic communications. ---*/
 
   int maxCountPerPeriodicPoint{0}; /*!< \brief Maximum number of pieces of data sent per vertex in periodic comms. */
@@ -360,6 +400,43 @@ class CGeometry {
    */
   void AllocateP2PComms(unsigned short val_countPerPoint);
 
+  /*!
+   * \brief Wait for any of the point-to-point messages posted by PostP2PRecvs to arrive.
+   * \note Called by all threads, the result is the same for all. The su2double data of the message is accessed
+   *       with GetP2PRecvBufferD and the message must then be released with ReleaseP2PRecv.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return Rank that sent the message.
+   */
+  int WaitAnyP2PRecv(unsigned short commType, unsigned short countPerPoint, bool val_reverse) const;
+
+  /*!
+   * \brief Get the start of the su2double data of a message received by WaitAnyP2PRecv. Messages from ranks on the
+   *        same node that are exchanged through shared memory are read directly from the buffer of the sender.
+   * \param[in] source - Rank that sent the message.
+   * \param[in] countPerPoint - Number of variables per point.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   * \return Pointer to the data of the first point of the message.
+   */
+  const su2double* GetP2PRecvBufferD(int source, unsigned short countPerPoint, bool val_reverse) const;
+
+  /*!
+   * \brief Signal that the data of a message was unpacked, the sender can reuse its buffer (shared memory only).
+   * \note Called by all threads after they are done with the message.
+   * \param[in] commType - Enumerated type for the quantity to be communicated.
+   * \param[in] source - Rank that sent the message.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  void ReleaseP2PRecv(unsigned short commType, int source, bool val_reverse) const;
+
+  /*!
+   * \brief Start (in points) of the message from a rank in its shared-memory buffer, -1 if not on the node.
+   * \param[in] source - Rank that sent the message.
+   * \param[in] val_reverse - Boolean controlling forward or reverse communication between neighbors.
+   */
+  int GetP2PRemoteOffset(int source, bool val_reverse) const;
+
   /*!
    * \brief Routine to launch non-blocking recvs only for all point-to-point communication with neighboring partitions.
    * \note This routine is called by any class that has loaded data into the generic communication buffers.
@@ -866,6 +943,22 @@ class CGeometry {
    */
   inline virtual void SetColorGrid_Parallel(const CConfig* config) {}
 
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \return Partitioning weights of the points owned by this rank.
+   */
+  inline virtual vector<long> GetPointWeights(const CConfig* config) const { return {}; }
+
+  /*!
+   * \brief A virtual member.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] weights - Partitioning weights of the points owned by this rank.
+   * \param[in] scale - Factor applied to the weights before they are written.
+   */
+  inline virtual void WritePointWeights(const CConfig* config, const vector<long>& weights,
+                                        passivedouble scale) const {}
+
   /*!
    * \brief A virtual member.
    * \param[in] config - Definition of the particular problem.
@@ -81,6 +81,35 @@ class CMultiGridGeometry final : public CGeometry {
    */
   CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, unsigned short iMesh);
 
+  /*!
+   * \brief Agglomeration statistics of a grid level (over all ranks).
+   */
+  struct AgglomerationStatistics {
+    unsigned long maxChildren = 1; /*!< \brief Maximum number of fine control volumes of a coarse one. */
+    unsigned long nCV = 0;         /*!< \brief Number of control volumes with edges. */
+    unsigned long nStretched = 0;  /*!< \brief Number of stretched control volumes. */
+    su2double avgAspect = 0.0;     /*!< \brief Mean anisotropy of the control volumes. */
+    su2double maxAspect = 0.0;     /*!< \brief Maximum anisotropy of the control volumes. */
+  };
+
+  /*!
+   * \brief Compute the maximum number of children and the anisotropy of the control volumes of each grid level.
+   * \note The anisotropy of a control volume is the ratio of its largest and smallest edge weights, as used to
+   *       build the linelets, stretched control volumes are those that would be added to a linelet.
+   * \param[in] geometry - Geometry of all the grid levels.
+   * \param[in] nLevels - Number of coarse grid levels.
+   * \return Statistics of each grid level, from the finest.
+   */
+  static vector<AgglomerationStatistics> ComputeAgglomerationStatistics(const CGeometry* const* geometry,
+                                                                        unsigned short nLevels);
+
+  /*!
+   * \brief Print the statistics of ComputeAgglomerationStatistics (with MG_AGGLOMERATION_STATISTICS= YES).
+   * \param[in] geometry - Geometry of all the grid levels.
+   * \param[in] config - Definition of the particular problem.
+   */
+  static void PrintAgglomerationStatistics(const CGeometry* const* geometry, const CConfig* config);
+
   /*!
    * \brief Set boundary vertex.
    * \param[in] fine_grid - Geometrical definition of the problem.
@@ -493,6 +493,23 @@ class CPhysicalGeometry final : public CGeometry {
    */
   void SetColorGrid_Parallel(const CConfig* config) override;
 
+  /*!
+   * \brief Get the partitioning weights of the points owned by this rank, read from the file of measured weights
+   *        if PARMETIS_READ_WEIGHTS is set, otherwise evaluated with the cost model of SetColorGrid_Parallel.
+   * \param[in] config - Definition of the particular problem.
+   * \return Weights of the owned points.
+   */
+  vector<long> GetPointWeights(const CConfig* config) const override;
+
+  /*!
+   * \brief Write the partitioning weights of the owned points (keyed by global index) to the file of measured weights.
+   * \note Collective call, all ranks must participate.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] weights - Weights of the owned points.
+   * \param[in] scale - Factor applied to the weights, the measured load of this rank relative to the average.
+   */
+  void WritePointWeights(const CConfig* config, const vector<long>& weights, passivedouble scale) const override;
+
   /*!
    * \brief Set the domains for FEM grid partitioning using ParMETIS.
    * \param[in] config - Definition of the particular problem.
@@ -552,14 +552,16 @@ class CElement {
 template <unsigned short NGAUSS, unsigned short NNODE, unsigned short NDIM>
 class CElementWithKnownSizes : public CElement {
  private:
-  FORCEINLINE static su2double JacobianAdjoint(const su2double Jacobian[][1], su2double ad[][1]) {
+  template <class T>
+  FORCEINLINE static T JacobianAdjoint(const T Jacobian[][1], T ad[][1]) {
     /*--- Adjoint to Jacobian, we put 1.0 here so that ad/detJac is the inverse later ---*/
     ad[0][0] = 1.0;
     /*--- Determinant of Jacobian ---*/
     return Jacobian[0][0];
   }
 
-  FORCEINLINE static su2double JacobianAdjoint(const su2double Jacobian[][2], su2double ad[][2]) {
+  template <class T>
+  FORCEINLINE static T JacobianAdjoint(const T Jacobian[][2], T ad[][2]) {
     ad[0][0] = Jacobian[1][1];
     ad[0][1] = -Jacobian[0][1];
     ad[1][0] = -Jacobian[1][0];
@@ -568,7 +570,8 @@ class CElementWithKnownSizes : public CElement {
     return ad[0][0] * ad[1][1] - ad[0][1] * ad[1][0];
   }
 
-  FORCEINLINE static su2double JacobianAdjoint(const su2double Jacobian[][3], su2double ad[][3]) {
+  template <class T>
+  FORCEINLINE static T JacobianAdjoint(const T Jacobian[][3], T ad[][3]) {
     ad[0][0] = Jacobian[1][1] * Jacobian[2][2] - Jacobian[1][2] * Jacobian[2][1];
     ad[0][1] = Jacobian[0][2] * Jacobian[2][1] - Jacobian[0][1] * Jacobian[2][2];
     ad[0][2] = Jacobian[0][1] * Jacobian[1][2] - Jacobian[0][2] * Jacobian[1][1];
@@ -582,6 +585,46 @@ class CElementWithKnownSizes : public CElement {
     return Jacobian[0][0] * ad[0][0] + Jacobian[0][1] * ad[1][0] + Jacobian[0][2] * ad[2][0];
   }
 
+ public:
+  enum : unsigned short { nGaussBatch = NGAUSS };
+  enum : unsigned short { nNodeBatch = NNODE };
+  enum : unsigned short { nDimBatch = NDIM };
+
+  /*!
+   * \brief Compute the gradients of the shape functions w.r.t. the coordinates for a batch of elements of this
+   *        type, e.g. one element per SIMD lane, the state of the element object is not used or modified.
+   * \param[in] Coord - Nodal coordinates of the elements.
+   * \param[out] GradNi - Gradients of the shape functions at the Gauss points.
+   * \param[out] DetJac - Determinant of the Jacobian at the Gauss points.
+   */
+  template <class T>
+  void ComputeGradBatch(const T Coord[][NDIM], T GradNi[][NNODE][NDIM], T* DetJac) const {
+    static_assert(NDIM > 1, "ComputeGradBatch expects 2D or 3D elements");
+
+    for (unsigned short iGauss = 0; iGauss < NGAUSS; iGauss++) {
+      T Jacobian[NDIM][NDIM], ad[NDIM][NDIM];
+
+      for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+        for (unsigned short jDim = 0; jDim < NDIM; jDim++) Jacobian[iDim][jDim] = 0.0;
+
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++)
+        for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+          for (unsigned short jDim = 0; jDim < NDIM; jDim++)
+            Jacobian[iDim][jDim] += Coord[iNode][jDim] * dNiXj[iGauss][iNode][iDim];
+
+      const T detJac = JacobianAdjoint(Jacobian, ad);
+      DetJac[iGauss] = detJac;
+
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+        for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+          T GradNi_Xj = 0.0;
+          for (unsigned short jDim = 0; jDim < NDIM; jDim++) GradNi_Xj += ad[iDim][jDim] * dNiXj[iGauss][iNode][jDim];
+          GradNi[iGauss][iNode][iDim] = GradNi_Xj / detJac;
+        }
+      }
+    }
+  }
+
  protected:
   static_assert(NDIM == 1 || NDIM == 2 || NDIM == 3, "ComputeGrad_impl expects 1D, 2D or 3D");
 
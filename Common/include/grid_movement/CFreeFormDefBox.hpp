@@ -55,7 +55,6 @@ class CFreeFormDefBox : public CGridMovement {
       *cart_coord, *cart_coord_;           /*!< \brief Cartesian coordinates of a point. */
   su2double ObjFunc;                       /*!< \brief Objective function of the point inversion process. */
   su2double* Gradient;                     /*!< \brief Gradient of the point inversion process. */
-  su2double** Hessian;                     /*!< \brief Hessian of the point inversion process. */
   su2double MaxCoord[3];                   /*!< \brief Maximum coordinates of the FFDBox. */
   su2double MinCoord[3];                   /*!< \brief Minimum coordinates of the FFDBox. */
   string Tag;                              /*!< \brief Tag to identify the FFDBox. */
@@ -75,6 +74,38 @@ class CFreeFormDefBox : public CGridMovement {
 
   CFreeFormBlending** BlendingFunction;
 
+  mutable vector<su2double> BasisValues[3][3]; /*!< \brief Scratch for the 1D basis functions of each parametric
+                                                    direction (and their 1st and 2nd derivatives) at one point. */
+
+  /*!
+   * \brief Evaluate the 1D basis functions (and derivatives) of the three parametric directions at a point.
+   * \note Each basis function is evaluated once per point instead of once per control point of the lattice.
+   * \param[in] uvw - Parametric coordinates of the point.
+   * \param[in] nDeriv - Highest derivative order that is required (0, 1, or 2).
+   */
+  void SetBasisValues(const su2double* uvw, unsigned short nDeriv) const;
+
+  /*!
+   * \brief Evaluate the mapping X(u, v, w) and its first and second derivatives with a single pass over the lattice.
+   * \param[in] uvw - Parametric coordinates of the point.
+   * \param[out] xyz - Cartesian coordinates X(u, v, w).
+   * \param[out] dxyz - First derivatives, dxyz[iDim][iDiff] = dX_iDim / du_iDiff.
+   * \param[out] d2xyz - Second derivatives, d2xyz[iDim][iDiff][jDiff] = d^2X_iDim / du_iDiff du_jDiff.
+   */
+  void EvalMappingDerivatives(const su2double* uvw, su2double* xyz, su2double dxyz[][3],
+                              su2double d2xyz[][3][3]) const;
+
+  /*!
+   * \brief Compute the gradient and the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 from one evaluation
+   *        of the mapping, without heap allocations.
+   * \param[in] uvw - Current value of the parametric coordinates.
+   * \param[in] xyz - Cartesian coordinates of the target point.
+   * \param[out] gradient - Gradient of F.
+   * \param[out] hessian - Hessian of F.
+   */
+  void GetFFDGradientHessian(const su2double* uvw, const su2double* xyz, su2double* gradient,
+                             su2double hessian[][3]) const;
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -675,73 +706,6 @@ class CFreeFormDefBox : public CGridMovement {
    */
   void GetFFDHessian(su2double* uvw, su2double* xyz, su2double** val_Hessian);
 
-  /*!
-   * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)^2+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)^2
-   *        Input: val_t, val_diff (to identify the index of the Bernstein polynomail we differentiate), the i, j, k ,
-   * l, m, n E.G.: val_diff=2 => we differentiate w.r.t. w  (val_diff=0,1, or 2) Output: d [B_i^l*B_j^m *B_k^n] / d
-   * val_diff (val_u, val_v, val_w). \param[in] uvw - __________. \param[in] val_diff - __________. \param[in] ijk -
-   * __________. \param[in] lmn - Degree of the FFD box. \return __________.
-   */
-  su2double GetDerivative1(su2double* uvw, unsigned short val_diff, unsigned short* ijk, unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)^2+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)^2
-   *        Input: (u, v, w), dim , xyz=(x, y, z), l, m, n E.G.: dim=2 => we use the third coordinate of the control
-   * points, and the z-coordinate of xyz  (0<=dim<=2) Output: 2* ( (Sum_{i, j, k}^l, m, n P_{ijk}[dim] B_i^l[u] B_j^m[v]
-   * B_k^n[w]) - xyz[dim]). \param[in] uvw - __________. \param[in] dim - __________. \param[in] xyz - __________.
-   * \param[in] lmn - Degree of the FFD box.
-   * \return __________.
-   */
-  su2double GetDerivative2(su2double* uvw, unsigned short dim, const su2double* xyz, const unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the gradient of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)
-   * \param[in] uvw - Parametric coordiates of the point.
-   * \param[in] dim - Value of the coordinate to be differentiate.
-   * \param[in] diff_this - Diferentiation with respect this coordinate.
-   * \param[in] lmn - Degree of the FFD box.
-   * \return Sum_{i, j, k}^{l, m, n} [one of them with -1,
-   *        depending on diff_this=0,1 or 2] P_{ijk}[dim] * (B_i^l[u] B_j^m[v] B_k^n[w])--one of them diffrentiated;
-   *        which? diff_thiss will tell us ; E.G.: dim=2, diff_this=1 => we use the third coordinate of the control
-   *        points, and derivate de v-Bersntein polynomial (use m-1 when summing!!).
-   */
-  su2double GetDerivative3(su2double* uvw, unsigned short dim, unsigned short diff_this, unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)
-   *        Input: val_t, val_diff, val_diff2 (to identify the index of the Bernstein polynomials we differentiate), the
-   * i, j, k , l, m, n E.G.: val_diff=1, val_diff2=2  =>  we differentiate w.r.t. v and w  (val_diff=0,1, or 2) E.G.:
-   * val_diff=0, val_diff2=0 => we differentiate w.r.t. u two times Output: [d [B_i^l*B_j^m *B_k^n]/d val_diff *d
-   * [B_i^l*B_j^m *B_k^n]/d val_diff2] (val_u, val_v, val_w) . \param[in] uvw - __________. \param[in] val_diff -
-   * __________. \param[in] val_diff2 - __________. \param[in] ijk - __________. \param[in] lmn - Degree of the FFD box.
-   * \return __________.
-   */
-  su2double GetDerivative4(su2double* uvw, unsigned short val_diff, unsigned short val_diff2, unsigned short* ijk,
-                           unsigned short* lmn) const;
-
-  /*!
-   * \brief An auxiliary routine to help us compute the Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 =
-   *        (Sum_ijk^lmn P1_ijk Bi Bj Bk -x)^2+(Sum_ijk^lmn P2_ijk Bi Bj Bk -y)+(Sum_ijk^lmn P3_ijk Bi Bj Bk -z)
-   *        Input: (u, v, w), dim , diff_this, diff_this_also, xyz=(x, y, z), l, m, n
-   *        Output:
-   *        Sum_{i, j, k}^{l, m, n} [two of them with -1, depending on diff_this, diff_this_also=0,1 or 2]
-   *        P_{ijk}[dim] * (B_i^l[u] B_j^m[v] B_k^n[w])--one of them diffrentiated; which? diff_thiss will tell us ;
-   *        E.G.: dim=2, diff_this=1 => we use the third coordinate of the control points, and derivate de v-Bersntein
-   *        polynomial (use m-1 when summing!!).
-   * \param[in] uvw - __________.
-   * \param[in] dim - __________.
-   * \param[in] diff_this - __________.
-   * \param[in] diff_this_also - __________.
-   * \param[in] lmn - Degree of the FFD box.
-   * \return __________.
-   */
-  su2double GetDerivative5(su2double* uvw, unsigned short dim, unsigned short diff_this, unsigned short diff_this_also,
-                           unsigned short* lmn) const;
-
   /*!
    * \brief Euclidean norm of a vector.
    * \param[in] a - _______.
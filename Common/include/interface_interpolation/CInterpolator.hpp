@@ -101,6 +101,20 @@ class CInterpolator {
   };
   vector<vector<CDonorInfo> > targetVertices; /*! \brief Donor information per marker per vertex of the target. */
 
+  /*!
+   * \brief Sparse (point to point) communication pattern to transfer donor data to the ranks that need it.
+   */
+  struct CTransferPattern {
+    bool valid = false;                  /*!< \brief The pattern is built and every donor was found on its owner. */
+    vector<int> sendRank;                /*!< \brief Ranks that need donor data from this rank. */
+    vector<unsigned long> sendStart;     /*!< \brief Start of the vertices of each send rank in sendVertex. */
+    vector<unsigned long> sendVertex;    /*!< \brief Donor vertices (of the donor marker) to send, by rank. */
+    vector<int> recvRank;                /*!< \brief Ranks that own donors of the target vertices of this rank. */
+    vector<unsigned long> recvStart;     /*!< \brief Start of the data of each receive rank. */
+    vector<vector<unsigned long> > donorIndex; /*!< \brief Position in the received data of the donors of each target vertex. */
+  };
+  vector<CTransferPattern> transferPattern; /*! \brief Transfer pattern per interface (zone interface marker pair). */
+
   /*!
    * \brief Constructor of the class.
    * \param[in] geometry_container - Geometrical definition of the problem.
@@ -127,6 +141,13 @@ class CInterpolator {
    */
   virtual void SetTransferCoeff(const CConfig* const* config) = 0;
 
+  /*!
+   * \brief Build the sparse communication pattern of the donor data from the donors of the target vertices.
+   * \note Needs to be called after SetTransferCoeff, if it cannot be built CInterface gathers all donor data.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void SetTransferPattern(const CConfig* const* config);
+
   /*!
    * \brief Print information about the interpolation.
    */
@@ -32,7 +32,9 @@
  * \brief Nearest Neighbor(s) interpolation.
  * \note The closest k neighbors are used for IDW interpolation, the computational
  * cost of setting up the interpolation is O(N^2 log(k)), this can be improved
- * by using an ADT.
+ * by using an ADT. With DISTRIBUTED_DONOR_SEARCH the targets are sent to the ranks
+ * that may own their neighbors, which search them in an ADT of their donors, instead
+ * of gathering all donor points on all ranks.
  * \ingroup Interfaces
  */
 class CNearestNeighbor final : public CInterpolator {
@@ -46,8 +48,34 @@ class CNearestNeighbor final : public CInterpolator {
     unsigned pidx;
     int proc;
     DonorInfo(su2double d = 0.0, unsigned i = 0, int p = 0) : dist(d), pidx(i), proc(p) {}
+
+    /*! \brief Global index is used as tie-breaker to make sorted order independent of initial. */
+    bool operator<(const DonorInfo& other) const {
+      return (dist != other.dist) ? (dist < other.dist) : (pidx < other.pidx);
+    }
   };
 
+  /*!
+   * \brief Select the closest donors from a list of candidates and set the interpolation coefficients.
+   * \param[in] nDonor - Number of donors to select (fewer if there are not enough candidates).
+   * \param[in,out] donorInfo - Candidates (squared distance), on exit the selected donors are at the front.
+   * \param[out] targetVertex - Donor information of the target vertex.
+   * \return Distance to the closest donor.
+   */
+  static su2double SetTargetDonors(unsigned long nDonor, vector<DonorInfo>& donorInfo, CDonorInfo& targetVertex);
+
+  /*!
+   * \brief Find the donors of the target vertices of this rank by sending them to the ranks that own the
+   *        candidate donors, in two rounds. The ranks are found with a global ADT of a sample of the donors
+   *        of each rank. The first round goes to the rank of the closest sample, the second to all ranks with
+   *        samples that may be within the distance of the k-th donor found in the first.
+   * \param[in] markDonor - Index of the boundary on the donor domain.
+   * \param[in] markTarget - Index of the boundary on the target domain.
+   * \param[in] nDonor - Number of donors per target vertex.
+   * \param[in,out] numTarget - Number of target vertices (statistics).
+   */
+  void SetTransferCoeffDistributed(int markDonor, int markTarget, unsigned long nDonor, unsigned long& numTarget);
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -27,6 +27,8 @@
 #pragma once
 
 #include "CInterpolator.hpp"
+#include "../adt/CADTPointsOnlyClass.hpp"
+#include <memory>
 
 /*!
  * \brief Sliding mesh approach.
@@ -51,7 +53,40 @@ class CSlidingMesh final : public CInterpolator {
    */
   void SetTransferCoeff(const CConfig* const* config) override;
 
+ protected:
+  friend struct CSlidingMeshTest;
+
+  /*!
+   * \brief Find the donor vertex closest to a point.
+   * \note Between calls the interface only slides (e.g. rotor/stator) so the closest vertex of the previous call is a
+   *       good guess, a greedy walk over the donor surface graph starts from it. When there is no guess, or when the
+   *       walk stalls farther from the point than the length of the local edges (e.g. on a disconnected part of the
+   *       boundary), the closest vertex is found with an ADT of the donor vertices, built on first use.
+   *       The walk returns a local minimum of the distance, which on strongly curved boundaries may not be the
+   *       vertex found by an exhaustive search, the supermesh of the point is then built from a different donor.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] coord - Coordinates of the point.
+   * \param[in] donorCoord - Coordinates of the donor vertices.
+   * \param[in] linkedNodes - List of surface-connected donor vertices, for each vertex.
+   * \param[in] startLinkedNodes - Start of the list of each vertex in linkedNodes.
+   * \param[in] nLinkedNodes - Number of surface-connected vertices of each vertex.
+   * \param[in] nDonor - Number of donor vertices.
+   * \param[in] guess - Starting vertex of the walk, nDonor or larger to skip the walk.
+   * \param[in,out] tree - ADT of the donor vertices, built if it is needed and empty.
+   * \return Index of the closest donor vertex.
+   */
+  static unsigned long FindClosestDonor(unsigned short nDim, const su2double* coord, const su2activematrix& donorCoord,
+                                        const su2vector<unsigned long>& linkedNodes,
+                                        const su2vector<unsigned long>& startLinkedNodes,
+                                        const su2vector<unsigned long>& nLinkedNodes, unsigned long nDonor,
+                                        unsigned long guess, std::unique_ptr<CADTPointsOnlyClass>& tree);
+
  private:
+  /*! \brief Closest donor vertex of each target vertex (per marker) found by the previous call. */
+  vector<vector<unsigned long> > closestDonor;
+  /*! \brief Number of donor vertices (per marker) when closestDonor was stored, to detect changes of the boundary. */
+  vector<unsigned long> closestDonor_nVertex;
+
   /*!
    * \brief For 3-Dimensional grids, build the dual surface element
    * \param[in] map         - array containing the index of the boundary points connected to the node
@@ -168,6 +168,46 @@ class CSysMatrix {
   mutable vector<vector<ScalarType> >
       LineletVector; /*!< \brief Solution and RHS of the tri-diag system (working memory). */
 
+  /*!
+   * \brief Level of the aggregation-based algebraic multigrid (AMG) preconditioner. The finest level points
+   *        to the data of the matrix, the coarser levels own their (block CSR) operator.
+   */
+  struct AMGLevel {
+    unsigned long nPoint = 0;              /*!< \brief Number of (local) points of the level. */
+    const unsigned long* rowPtr = nullptr; /*!< \brief Pointers to the first block of each row. */
+    const unsigned long* colInd = nullptr; /*!< \brief Column index of each block. */
+    const ScalarType* values = nullptr;    /*!< \brief Blocks of the operator. */
+    const ScalarType* invDiag = nullptr;   /*!< \brief Inverse of the diagonal blocks (for the smoother). */
+
+    vector<unsigned long> parent;            /*!< \brief Aggregate (point of the next level) of each point. */
+    vector<unsigned long> childPtr, child;   /*!< \brief Points of each aggregate, transpose of "parent". */
+    vector<unsigned long> rowPtrData;        /*!< \brief Storage of the row pointers (coarse levels). */
+    vector<unsigned long> colIndData;        /*!< \brief Storage of the column indices (coarse levels). */
+    vector<ScalarType> valuesData;           /*!< \brief Storage of the blocks (coarse levels). */
+    vector<ScalarType> invDiagData;          /*!< \brief Storage of the inverse diagonal blocks (coarse levels). */
+    vector<ScalarType> denseLU;              /*!< \brief Dense LU factors, only used on the coarsest level. */
+    vector<unsigned long> pivot;             /*!< \brief Row permutation of the dense LU factorization. */
+    mutable vector<ScalarType> rhs, sol, res; /*!< \brief Working memory of the V-cycle. */
+  };
+  vector<AMGLevel> AMGLevels; /*!< \brief Multigrid hierarchy, built by BuildAMGPreconditioner. */
+
+  /*!
+   * \brief Aggregate the points of a level, and form the Galerkin (P^T A P) operator of the next level.
+   * \param[in,out] fine - Level to coarsen, its "parent" map is set.
+   * \param[out] coarse - Next level.
+   * \return False if the aggregation does not reduce the number of points enough to be worthwhile.
+   */
+  bool CoarsenAMGLevel(AMGLevel& fine, AMGLevel& coarse) const;
+
+  /*!
+   * \brief Apply a V-cycle of the AMG preconditioner starting at a given level, x = M^-1 b.
+   * \note Must be called by all threads.
+   * \param[in] iLevel - Level where the cycle starts.
+   * \param[in] b - Right hand side.
+   * \param[out] x - Approximate solution.
+   */
+  void AMGCycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const;
+
 #ifdef USE_MKL
   using gemm_t = typename mkl_jit_wrapper<ScalarType>::gemm_t;
   void* MatrixMatrixProductJitter;               /*!< \brief Jitter handle for MKL JIT based GEMM. */
@@ -960,6 +1000,22 @@ class CSysMatrix {
   void ComputeLineletPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                     CGeometry* geometry, const CConfig* config) const;
 
+  /*!
+   * \brief Build the aggregation-based algebraic multigrid preconditioner.
+   * \note The hierarchy is local to each rank, halo couplings are neglected as in ILU.
+   */
+  void BuildAMGPreconditioner();
+
+  /*!
+   * \brief Multiply CSysVector by the preconditioner (one V-cycle of aggregation-based algebraic multigrid).
+   * \param[in] vec - CSysVector to be multiplied by the preconditioner.
+   * \param[out] prod - Result of the product M^-1*vec.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod, CGeometry* geometry,
+                                const CConfig* config) const;
+
   /*!
    * \brief Compute the linear residual.
    * \param[in] sol - Solution (x).
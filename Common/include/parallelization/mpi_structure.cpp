@@ -43,6 +43,8 @@ CBaseMPIWrapper::Comm CBaseMPIWrapper::currentComm = 0;  // dummy value
 int CBaseMPIWrapper::MinRankError;
 bool CBaseMPIWrapper::winMinRankErrorInUse = false;
 CBaseMPIWrapper::Win CBaseMPIWrapper::winMinRankError;
+bool CBaseMPIWrapper::MeasureWaitTime = false;
+passivedouble CBaseMPIWrapper::WaitTime = 0.0;
 
 void CBaseMPIWrapper::Error(const std::string& ErrorMsg, const std::string& FunctionName) {
   /* Set MinRankError to Rank, as the error message is called on this rank. */
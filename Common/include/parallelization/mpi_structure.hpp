@@ -103,6 +103,18 @@ class CBaseMPIWrapper {
   static Comm currentComm;
   static bool winMinRankErrorInUse;
   static Win winMinRankError;
+  static bool MeasureWaitTime;
+  static passivedouble WaitTime;
+
+  /*!
+   * \brief Adds the lifetime of the object (a blocking call) to the wait time, if it is being measured.
+   */
+  struct CWaitTimer {
+    const passivedouble start = MeasureWaitTime ? MPI_Wtime() : 0.0;
+    ~CWaitTimer() {
+      if (MeasureWaitTime) WaitTime += MPI_Wtime() - start;
+    }
+  };
 
  public:
   static void CopyData(const void* sendbuf, void* recvbuf, int size, Datatype datatype, int recvshift = 0,
@@ -127,6 +139,18 @@ class CBaseMPIWrapper {
 
   static inline Comm GetComm() { return currentComm; }
 
+  /*!
+   * \brief Start or stop measuring the time spent in blocking calls (off by default, it costs two timer calls each).
+   */
+  static inline void SetMeasureWaitTime(bool measure) { MeasureWaitTime = measure; }
+
+  /*!
+   * \brief Get the wall time this rank spent blocked in waits, probes, and blocking point-to-point or collective
+   *        calls while the measurement was on.
+   * \note The difference to the elapsed time is the busy time of the rank, used to measure load imbalance.
+   */
+  static inline passivedouble GetWaitTime() { return WaitTime; }
+
   static inline void Init(int* argc, char*** argv) {
     MPI_Init(argc, argv);
     MPI_Comm_rank(currentComm, &Rank);
@@ -151,12 +175,21 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { MPI_Comm_size(comm, size); }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) {
+    MPI_Comm_split(comm, color, key, newcomm);
+  }
+
+  static inline void Comm_free(Comm* comm) { MPI_Comm_free(comm); }
+
   static inline void Finalize() {
     if (winMinRankErrorInUse) MPI_Win_free(&winMinRankError);
     MPI_Finalize();
   }
 
-  static inline void Barrier(Comm comm) { MPI_Barrier(comm); }
+  static inline void Barrier(Comm comm) {
+    CWaitTimer timer;
+    MPI_Barrier(comm);
+  }
 
   static inline void Abort(Comm comm, int error) { MPI_Abort(comm, error); }
 
@@ -173,7 +206,10 @@ class CBaseMPIWrapper {
     MPI_Irecv(buf, count, datatype, dest, tag, comm, request);
   }
 
-  static inline void Wait(Request* request, Status* status) { MPI_Wait(request, status); }
+  static inline void Wait(Request* request, Status* status) {
+    CWaitTimer timer;
+    MPI_Wait(request, status);
+  }
 
   static inline int Request_free(Request* request) { return MPI_Request_free(request); }
 
@@ -182,74 +218,92 @@ class CBaseMPIWrapper {
   }
 
   static inline void Waitall(int nrequests, Request* request, Status* status) {
+    CWaitTimer timer;
     MPI_Waitall(nrequests, request, status);
   }
 
-  static inline void Probe(int source, int tag, Comm comm, Status* status) { MPI_Probe(source, tag, comm, status); }
+  static inline void Probe(int source, int tag, Comm comm, Status* status) {
+    CWaitTimer timer;
+    MPI_Probe(source, tag, comm, status);
+  }
 
   static inline void Send(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm) {
+    CWaitTimer timer;
     MPI_Send(buf, count, datatype, dest, tag, comm);
   }
 
   static inline void Recv(void* buf, int count, Datatype datatype, int dest, int tag, Comm comm, Status* status) {
+    CWaitTimer timer;
     MPI_Recv(buf, count, datatype, dest, tag, comm, status);
   }
 
   static inline void Bcast(void* buf, int count, Datatype datatype, int root, Comm comm) {
+    CWaitTimer timer;
     MPI_Bcast(buf, count, datatype, root, comm);
   }
 
   static inline void Reduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, int root,
                             Comm comm) {
+    CWaitTimer timer;
     MPI_Reduce(sendbuf, recvbuf, count, datatype, op, root, comm);
   }
 
   static inline void Allreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm) {
+    CWaitTimer timer;
     MPI_Allreduce(sendbuf, recvbuf, count, datatype, op, comm);
   }
 
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
+    CWaitTimer timer;
     MPI_Gather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
   }
 
   static inline void Scatter(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                              Datatype recvtype, int root, Comm comm) {
+    CWaitTimer timer;
     MPI_Scatter(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, root, comm);
   }
 
   static inline void Allgather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                                Datatype recvtype, Comm comm) {
+    CWaitTimer timer;
     MPI_Allgather(sendbuf, sendcnt, sendtype, recvbuf, recvcnt, recvtype, comm);
   }
 
   static inline void Allgatherv(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf,
                                 const int* recvcounts, const int* displs, Datatype recvtype, Comm comm) {
+    CWaitTimer timer;
     MPI_Allgatherv(sendbuf, sendcount, sendtype, recvbuf, recvcounts, displs, recvtype, comm);
   }
 
   static inline void Alltoall(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount,
                               Datatype recvtype, Comm comm) {
+    CWaitTimer timer;
     MPI_Alltoall(sendbuf, sendcount, sendtype, recvbuf, recvcount, recvtype, comm);
   }
 
   static inline void Alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, Datatype sendtype,
                                void* recvbuf, const int* recvcounts, const int* recvdispls, Datatype recvtype,
                                Comm comm) {
+    CWaitTimer timer;
     MPI_Alltoallv(sendbuf, sendcounts, sdispls, sendtype, recvbuf, recvcounts, recvdispls, recvtype, comm);
   }
 
   static inline void Sendrecv(const void* sendbuf, int sendcnt, Datatype sendtype, int dest, int sendtag, void* recvbuf,
                               int recvcnt, Datatype recvtype, int source, int recvtag, Comm comm, Status* status) {
+    CWaitTimer timer;
     MPI_Sendrecv(sendbuf, sendcnt, sendtype, dest, sendtag, recvbuf, recvcnt, recvtype, source, recvtag, comm, status);
   }
 
   static inline void Reduce_scatter(const void* sendbuf, void* recvbuf, const int* recvcounts, Datatype datatype, Op op,
                                     Comm comm) {
+    CWaitTimer timer;
     MPI_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm);
   }
 
   static inline void Waitany(int nrequests, Request* request, int* index, Status* status) {
+    CWaitTimer timer;
     MPI_Waitany(nrequests, request, index, status);
   }
 
@@ -359,7 +413,10 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Finalize();
   }
 
-  static inline void Barrier(Comm comm) { AMPI_Barrier(convertComm(comm)); }
+  static inline void Barrier(Comm comm) {
+    CWaitTimer timer;
+    AMPI_Barrier(convertComm(comm));
+  }
 
   static inline void Abort(Comm comm, int error) { AMPI_Abort(convertComm(comm), error); }
 
@@ -376,7 +433,10 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
     AMPI_Irecv(buf, count, convertDatatype(datatype), dest, tag, convertComm(comm), request);
   }
 
-  static inline void Wait(SU2_MPI::Request* request, Status* status) { AMPI_Wait(request, status); }
+  static inline void Wait(SU2_MPI::Request* request, Status* status) {
+    CWaitTimer timer;
+    AMPI_Wait(request, status);
+  }
 
   static inline int Request_free(Request* request) { return AMPI_Request_free(request); }
 
@@ -385,60 +445,72 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
   }
 
   static inline void Waitall(int nrequests, Request* request, Status* status) {
+    CWaitTimer timer;
     AMPI_Waitall(nrequests, request, status);
   }
 
   static inline void Probe(int source, int tag, Comm comm, Status* status) {
+    CWaitTimer timer;
     AMPI_Probe(source, tag, convertComm(comm), status);
   }
 
   static inline void Send(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm) {
+    CWaitTimer timer;
     AMPI_Send(buf, count, convertDatatype(datatype), dest, tag, convertComm(comm));
   }
 
   static inline void Recv(void* buf, int count, Datatype datatype, int dest, int tag, Comm comm, Status* status) {
+    CWaitTimer timer;
     AMPI_Recv(buf, count, convertDatatype(datatype), dest, tag, convertComm(comm), status);
   }
 
   static inline void Bcast(void* buf, int count, Datatype datatype, int root, Comm comm) {
+    CWaitTimer timer;
     AMPI_Bcast(buf, count, convertDatatype(datatype), root, convertComm(comm));
   }
 
   static inline void Reduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, int root,
                             Comm comm) {
+    CWaitTimer timer;
     AMPI_Reduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), root, convertComm(comm));
   }
 
   static inline void Allreduce(const void* sendbuf, void* recvbuf, int count, Datatype datatype, Op op, Comm comm) {
+    CWaitTimer timer;
     AMPI_Allreduce(sendbuf, recvbuf, count, convertDatatype(datatype), convertOp(op), convertComm(comm));
   }
 
   static inline void Gather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                             Datatype recvtype, int root, Comm comm) {
+    CWaitTimer timer;
     AMPI_Gather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
                 convertComm(comm));
   }
 
   static inline void Scatter(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                              Datatype recvtype, int root, Comm comm) {
+    CWaitTimer timer;
     AMPI_Scatter(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype), root,
                  convertComm(comm));
   }
 
   static inline void Allgather(const void* sendbuf, int sendcnt, Datatype sendtype, void* recvbuf, int recvcnt,
                                Datatype recvtype, Comm comm) {
+    CWaitTimer timer;
     AMPI_Allgather(sendbuf, sendcnt, convertDatatype(sendtype), recvbuf, recvcnt, convertDatatype(recvtype),
                    convertComm(comm));
   }
 
   static inline void Allgatherv(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf,
                                 const int* recvcounts, const int* displs, Datatype recvtype, Comm comm) {
+    CWaitTimer timer;
     AMPI_Allgatherv(sendbuf, sendcount, convertDatatype(sendtype), recvbuf, recvcounts, displs,
                     convertDatatype(recvtype), convertComm(comm));
   }
 
   static inline void Alltoall(const void* sendbuf, int sendcount, Datatype sendtype, void* recvbuf, int recvcount,
                               Datatype recvtype, Comm comm) {
+    CWaitTimer timer;
     AMPI_Alltoall(sendbuf, sendcount, convertDatatype(sendtype), recvbuf, recvcount, convertDatatype(recvtype),
                   convertComm(comm));
   }
@@ -446,12 +518,14 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
   static inline void Alltoallv(const void* sendbuf, const int* sendcounts, const int* sdispls, Datatype sendtype,
                                void* recvbuf, const int* recvcounts, const int* recvdispls, Datatype recvtype,
                                Comm comm) {
+    CWaitTimer timer;
     AMPI_Alltoallv(sendbuf, sendcounts, sdispls, convertDatatype(sendtype), recvbuf, recvcounts, recvdispls,
                    convertDatatype(recvtype), comm);
   }
 
   static inline void Sendrecv(const void* sendbuf, int sendcnt, Datatype sendtype, int dest, int sendtag, void* recvbuf,
                               int recvcnt, Datatype recvtype, int source, int recvtag, Comm comm, Status* status) {
+    CWaitTimer timer;
     AMPI_Sendrecv(sendbuf, sendcnt, convertDatatype(sendtype), dest, sendtag, recvbuf, recvcnt,
                   convertDatatype(recvtype), source, recvtag, convertComm(comm), status);
   }
@@ -459,10 +533,12 @@ class CMediMPIWrapper : public CBaseMPIWrapper {
   static inline void Reduce_scatter(const void* sendbuf, void* recvbuf, const int* recvcounts, Datatype datatype, Op op,
                                     Comm comm) {
     if (datatype == MPI_DOUBLE) Error("Reduce_scatter not possible with MPI_DOUBLE", CURRENT_FUNCTION);
+    CWaitTimer timer;
     MPI_Reduce_scatter(sendbuf, recvbuf, recvcounts, datatype, op, comm);
   }
 
   static inline void Waitany(int nrequests, Request* request, int* index, Status* status) {
+    CWaitTimer timer;
     AMPI_Waitany(nrequests, request, index, status);
   }
 };
@@ -520,6 +596,10 @@ class CBaseMPIWrapper {
 
   static inline Comm GetComm() { return currentComm; }
 
+  static inline void SetMeasureWaitTime(bool) {}
+
+  static inline passivedouble GetWaitTime() { return 0.0; }
+
   static inline void Init(int* argc, char*** argv) {}
 
   static inline void Init_thread(int* argc, char*** argv, int required, int* provided) { *provided = required; }
@@ -532,6 +612,10 @@ class CBaseMPIWrapper {
 
   static inline void Comm_size(Comm comm, int* size) { *size = 1; }
 
+  static inline void Comm_split(Comm comm, int color, int key, Comm* newcomm) { *newcomm = comm; }
+
+  static inline void Comm_free(Comm* comm) {}
+
   static inline void Finalize() {}
 
   static inline void Isend(const void* buf, int count, Datatype datatype, int dest, int tag, Comm comm,
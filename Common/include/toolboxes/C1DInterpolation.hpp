@@ -27,6 +27,7 @@
 
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <vector>
 #include <algorithm>
@@ -170,6 +171,74 @@ class CLinearInterpolation final : public C1DInterpolation {
   su2double EvaluateSpline(su2double Point_Interp) const override;
 };
 
+/*!
+ * \brief Cubic Hermite interpolation of a function tabulated at uniformly spaced points, from its nodal values and
+ * derivatives. The lookup is O(1) and the derivative of the interpolant is returned with the value.
+ * \note The table is passive (its values do not carry derivatives when using AD), only the argument is active.
+ * \ingroup LookUpInterp
+ */
+class CHermiteTable {
+ private:
+  passivedouble xMin = 0, xMax = 0, invDx = 0;    /*!< \brief Range and inverse spacing of the table. */
+  std::vector<std::array<passivedouble, 2> > fdf; /*!< \brief Value and derivative at each node. */
+
+ public:
+  CHermiteTable() = default;
+
+  /*!
+   * \brief Build the table.
+   * \param[in] x0 - Lower bound of the range.
+   * \param[in] x1 - Upper bound of the range.
+   * \param[in] nPoints - Number of nodes (at least 2).
+   * \param[in] func - Function of x returning the value and derivative, f(x, &dfdx).
+   */
+  template <class F>
+  CHermiteTable(passivedouble x0, passivedouble x1, unsigned long nPoints, const F& func)
+      : xMin(x0), xMax(x1), invDx((nPoints - 1) / (x1 - x0)), fdf(nPoints) {
+    assert(nPoints > 1 && x1 > x0);
+    for (auto i = 0ul; i < nPoints; ++i) {
+      su2double dfdx = 0;
+      const su2double f = func(su2double(x0 + i / invDx), dfdx);
+      fdf[i] = {SU2_TYPE::GetValue(f), SU2_TYPE::GetValue(dfdx)};
+    }
+  }
+
+  /*!
+   * \brief Check if a point is covered by the table.
+   */
+  inline bool InRange(su2double x) const { return x >= xMin && x <= xMax; }
+
+  /*!
+   * \brief Interpolate the function and its derivative.
+   * \param[in] x - Point, must be in range.
+   * \param[out] dfdx - Derivative of the interpolant.
+   * \return Interpolated value.
+   */
+  inline su2double Evaluate(su2double x, su2double& dfdx) const {
+    const su2double s = (x - xMin) * invDx;
+    const auto i = std::min<long>(std::max<long>(SU2_TYPE::Int(s), 0), fdf.size() - 2);
+    const su2double t = s - i;
+
+    /*--- Coefficients of the cubic in the local coordinate (t in [0,1]). ---*/
+    const auto& a = fdf[i];
+    const auto& b = fdf[i + 1];
+    const passivedouble m0 = a[1] / invDx, m1 = b[1] / invDx;
+    const passivedouble c2 = 3 * (b[0] - a[0]) - 2 * m0 - m1;
+    const passivedouble c3 = 2 * (a[0] - b[0]) + m0 + m1;
+
+    dfdx = (m0 + t * (2 * c2 + 3 * t * c3)) * invDx;
+    return a[0] + t * (m0 + t * (c2 + t * c3));
+  }
+
+  /*!
+   * \brief Interpolate the function.
+   */
+  inline su2double operator()(su2double x) const {
+    su2double dfdx;
+    return Evaluate(x, dfdx);
+  }
+};
+
 /*!
  * \brief Corrects for interpolation type.
  * \param[in] Inlet_Interpolated - the interpolated data after spline evaluation.
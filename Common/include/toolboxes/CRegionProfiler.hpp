@@ -0,0 +1,188 @@
+/*!
+ * \file CRegionProfiler.hpp
+ * \brief Built-in hierarchical timers for named code regions.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "../parallelization/mpi_structure.hpp"
+#include "../parallelization/omp_structure.hpp"
+
+/*!
+ * \class CRegionProfiler
+ * \ingroup Toolboxes
+ * \brief Low overhead wall clock timers for named regions, usually created via SU2_ZONE_SCOPED_N.
+ * \details Each thread keeps its own tree of regions (a region nested in another becomes its child), so
+ * timing does not require synchronization. At the end, the trees of all threads and ranks are merged by
+ * path ("parent/child") and a CSV and a JSON report with min/avg/max times across ranks is written.
+ * When the profiler is not enabled the cost of a region is one branch.
+ * Optionally (Linux only, via perf_event_open) hardware counters are read when entering and leaving regions, this
+ * costs two system calls per region. Together with the FLOPs declared by kernels (AddFlops) they are used to print a
+ * roofline-style summary, the bytes moved to/from memory are estimated from the last level cache misses.
+ */
+class CRegionProfiler {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /*! \brief Hardware counters read for each region. */
+  enum COUNTER { CYCLES, INSTRUCTIONS, CACHE_REFERENCES, CACHE_MISSES, N_COUNTERS };
+  using CounterArray = std::array<unsigned long long, N_COUNTERS>;
+
+  /*!
+   * \brief RAII object that times a region while it is in scope.
+   */
+  class CScope {
+   private:
+    Clock::time_point start;
+    CounterArray counters;
+    bool active;
+
+   public:
+    explicit CScope(unsigned short region) : active(CRegionProfiler::Start(region)) {
+      if (active) {
+        CRegionProfiler::ReadCounters(counters);
+        start = Clock::now();
+      }
+    }
+    ~CScope() {
+      if (active) {
+        const passivedouble elapsed = std::chrono::duration<passivedouble>(Clock::now() - start).count();
+        CRegionProfiler::Stop(elapsed, counters);
+      }
+    }
+    CScope(const CScope&) = delete;
+    CScope& operator=(const CScope&) = delete;
+  };
+
+  /*!
+   * \brief Enable or disable the timers, must be called outside parallel regions.
+   * \note Enabling clears the timings recorded so far.
+   * \param[in] enable - Enable the timers.
+   * \param[in] counters - Also read hardware counters (ignored if not supported by the system).
+   */
+  static void Enable(bool enable, bool counters = false);
+
+  /*!
+   * \brief Check if the timers are enabled.
+   */
+  static inline bool IsEnabled() { return enabled; }
+
+  /*!
+   * \brief Get the index of a region name, registering it if needed (thread-safe).
+   * \param[in] name - Name of the region.
+   * \return Region index.
+   */
+  static unsigned short Register(const char* name);
+
+  /*!
+   * \brief Open a region on the calling thread (use CScope instead).
+   * \return True if the region is being timed.
+   */
+  static bool Start(unsigned short region);
+
+  /*!
+   * \brief Close the innermost region of the calling thread (use CScope instead).
+   * \param[in] elapsed - Time spent in the region.
+   * \param[in] start - Hardware counters when the region was opened.
+   */
+  static void Stop(passivedouble elapsed, const CounterArray& start);
+
+  /*!
+   * \brief Read the hardware counters of the calling thread (zeros if they are not enabled).
+   * \param[out] values - Counter values.
+   */
+  static void ReadCounters(CounterArray& values);
+
+  /*!
+   * \brief Declare floating point operations done by the calling thread in its current region (and its parents).
+   * \note For work shared by all threads it is simpler to declare the total on the master thread.
+   * \param[in] flops - Number of operations.
+   */
+  static inline void AddFlops(passivedouble flops) {
+    if (enabled) AddFlops_impl(flops);
+  }
+
+  /*!
+   * \brief Merge the timings of all threads and ranks and write "<filename>.csv" and "<filename>.json".
+   * \note Must be called by all ranks of comm, outside parallel regions, only the master rank of comm writes.
+   * \param[in] filename - Name of the report without extension.
+   * \param[in] comm - Ranks to merge, all the ranks when they are split into groups that share the report file.
+   */
+  static void WriteReport(const std::string& filename, SU2_Comm comm = SU2_MPI::GetComm());
+
+ private:
+  /*! \brief Node of the tree of regions of a thread. */
+  struct CNode {
+    unsigned short region;     /*!< \brief Index of the region name. */
+    int parent;                /*!< \brief Index of the parent node, -1 for top level regions. */
+    std::vector<int> children; /*!< \brief Indices of the child nodes. */
+    unsigned long calls = 0;   /*!< \brief Number of times the region was closed. */
+    passivedouble time = 0.0;  /*!< \brief Total (inclusive) time in the region. */
+    passivedouble flops = 0.0; /*!< \brief Declared floating point operations (inclusive). */
+    CounterArray counters{};   /*!< \brief Hardware counter increments (inclusive). */
+  };
+
+  /*! \brief Timing data of one thread, aligned to avoid false sharing. */
+  struct alignas(64) CThreadData {
+    std::vector<CNode> nodes;    /*!< \brief Tree of regions. */
+    std::vector<int> roots;      /*!< \brief Top level nodes. */
+    int current = -1;            /*!< \brief Innermost open node. */
+    std::vector<int> counterFds; /*!< \brief Group of hardware counters of the thread, the first is the leader. */
+    bool counterInit = false;    /*!< \brief Whether opening the counters was attempted. */
+  };
+
+  static bool enabled;                     /*!< \brief Whether the timers are on. */
+  static bool countersEnabled;             /*!< \brief Whether the hardware counters are read. */
+  static std::vector<std::string> names;   /*!< \brief Names of the registered regions. */
+  static std::vector<CThreadData> threads; /*!< \brief Timing data of each thread. */
+
+  /*!
+   * \brief Path of a node, names of its ancestors and its own name separated by "/".
+   * \param[in] data - Tree of the thread.
+   * \param[in] iNode - Index of the node.
+   */
+  static std::string NodePath(const CThreadData& data, int iNode);
+
+  /*!
+   * \brief Open the group of hardware counters for the calling thread.
+   * \return File descriptors of the counters (the leader first), empty on failure.
+   */
+  static std::vector<int> OpenCounters();
+
+  /*!
+   * \brief Close the hardware counters of all threads.
+   */
+  static void CloseCounters();
+
+  /*!
+   * \brief Add operations to the current node of the calling thread and its parents.
+   */
+  static void AddFlops_impl(passivedouble flops);
+};
@@ -34,6 +34,7 @@
 #include <malloc.h>
 #else
 #include <stdlib.h>
+#include <sys/resource.h>
 #endif
 
 #ifdef HAVE_CUDA
@@ -93,6 +94,25 @@ inline void aligned_free(T* ptr) noexcept {
 #endif
 }
 
+/*!
+ * \brief Peak resident set size (high-water mark of physical memory) of the calling process.
+ * \return Peak RSS in bytes, 0 if the platform does not provide it.
+ */
+inline double GetPeakResidentSetSize() noexcept {
+#if defined(_WIN32)
+  return 0.0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0) return 0.0;
+#if defined(__APPLE__)
+  return static_cast<double>(usage.ru_maxrss);
+#else
+  /*--- Linux and BSDs report kilobytes. ---*/
+  return static_cast<double>(usage.ru_maxrss) * 1024.0;
+#endif
+#endif
+}
+
 }  // namespace MemoryAllocation
 
 namespace GPUMemoryAllocation {
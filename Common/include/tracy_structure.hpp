@@ -32,11 +32,25 @@
 
 #pragma once
 
+#include "toolboxes/CRegionProfiler.hpp"
+
+/*--- Named zones are also timed by the built-in profiler (see CRegionProfiler, enabled with PROFILING= YES).
+ * The region index is registered once per call site, "name" must be a string literal. ---*/
+#define SU2_REGION_CONCAT_IMPL(a, b) a##b
+#define SU2_REGION_CONCAT(a, b) SU2_REGION_CONCAT_IMPL(a, b)
+#define SU2_REGION_TIMER(name)                                                                \
+  static const unsigned short SU2_REGION_CONCAT(su2_region_id_, __LINE__) =                   \
+      CRegionProfiler::Register(name);                                                        \
+  const CRegionProfiler::CScope SU2_REGION_CONCAT(su2_region_scope_, __LINE__)(               \
+      SU2_REGION_CONCAT(su2_region_id_, __LINE__))
+
 #ifdef HAVE_TRACY
 #include "tracy/Tracy.hpp"
 #define SU2_ZONE_SCOPED ZoneScoped
-#define SU2_ZONE_SCOPED_N(name) ZoneScopedN(name)
+#define SU2_ZONE_SCOPED_N(name) \
+  ZoneScopedN(name);            \
+  SU2_REGION_TIMER(name)
 #else
 #define SU2_ZONE_SCOPED
-#define SU2_ZONE_SCOPED_N(name)
+#define SU2_ZONE_SCOPED_N(name) SU2_REGION_TIMER(name)
 #endif
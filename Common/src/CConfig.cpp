@@ -1250,6 +1250,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("INLET_TEMPERATURE_VE", Inlet_Temperature_ve, 0.0);
   /* DESCRIPTION: Specify if mixture is frozen */
   addBoolOption("FROZEN_MIXTURE", frozen, false);
+  /* DESCRIPTION: Integrate the chemical source terms over each physical time step in a separate (operator split) stage */
+  addBoolOption("CHEMISTRY_OPERATOR_SPLIT", chemistry_split, false);
+  /* DESCRIPTION: Maximum number of implicit sub-steps of the split chemistry stage, per point */
+  addUnsignedLongOption("CHEMISTRY_MAX_SUBSTEPS", Chemistry_MaxSubSteps, 50);
+  /* DESCRIPTION: Evaluate the temperature dependent thermochemistry of SU2TCLib from tables (species energies and rates) */
+  addBoolOption("TABULATE_THERMOCHEMISTRY", tabulate_thermochemistry, false);
   /* DESCRIPTION: Specify if there is ionization */
   addBoolOption("IONIZATION", ionization, false);
   /* DESCRIPTION: Specify if there is VT transfer residual limiting */
@@ -1833,6 +1839,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("HB_PERIOD", HarmonicBalance_Period, -1.0);
   /* DESCRIPTION:  Turn on/off harmonic balance preconditioning */
   addBoolOption("HB_PRECONDITION", HB_Precondition, false);
+  /* DESCRIPTION: Number of rank groups over which the Harmonic Balance time instances are distributed */
+  addUnsignedShortOption("HB_INSTANCE_GROUPS", nHB_InstanceGroups, 1);
   /* DESCRIPTION: Starting direct solver iteration for the unsteady adjoint */
   addLongOption("UNST_ADJOINT_ITER", Unst_AdjointIter, 0);
   /* DESCRIPTION: Number of iterations to average the objective */
@@ -1951,6 +1959,12 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("MG_DAMP_RESTRICTION", Damp_Res_Restric, 0.75);
   /*!\brief MG_DAMP_PROLONGATION\n DESCRIPTION: Damping factor for the correction prolongation. DEFAULT 0.75 \ingroup Config*/
   addDoubleOption("MG_DAMP_PROLONGATION", Damp_Correc_Prolong, 0.75);
+  /*!\brief MG_LINE_AGGLOMERATION\n DESCRIPTION: Number of points along the mesh lines of stretched regions (linelets)
+   * agglomerated into each coarse control volume, 0 for isotropic agglomeration everywhere. DEFAULT 0 \ingroup Config*/
+  addUnsignedShortOption("MG_LINE_AGGLOMERATION", MG_LineAgglomeration, 0);
+  /*!\brief MG_AGGLOMERATION_STATISTICS\n DESCRIPTION: Print the number of children and the anisotropy of the
+   * control volumes of each grid level. DEFAULT NO \ingroup Config*/
+  addBoolOption("MG_AGGLOMERATION_STATISTICS", MG_AgglomerationStatistics, false);
 
   /*!\par CONFIG_CATEGORY: Spatial Discretization \ingroup Config*/
   /*--- Options related to the spatial discretization ---*/
@@ -2232,8 +2246,16 @@ void CConfig::SetConfig_Options() {
   addStringOption("VOLUME_SENS_FILENAME", VolSens_FileName, string("volume_sens"));
   /* DESCRIPTION: Output the performance summary to the console at the end of SU2_CFD  \ingroup Config*/
   addBoolOption("WRT_PERFORMANCE", Wrt_Performance, false);
-  /* DESCRIPTION: Output the tape statistics (discrete adjoint)  \ingroup Config*/
+  /* DESCRIPTION: Output the tape statistics, per-zone tape memory and peak memory (discrete adjoint)  \ingroup Config*/
   addBoolOption("WRT_AD_STATISTICS", Wrt_AD_Statistics, false);
+  /* DESCRIPTION: Time the main kernels (fluxes, gradients, linear solvers, communications, output, etc.)
+   *  and write a report with min/avg/max times across ranks at the end of SU2_CFD  \ingroup Config*/
+  addBoolOption("PROFILING", Profiling, false);
+  /* DESCRIPTION: Also read hardware counters in the profiled regions (Linux perf_event_open), and print a
+   *  roofline-style summary (bandwidth, FLOP rate, arithmetic intensity) at the end of SU2_CFD  \ingroup Config*/
+  addBoolOption("PROFILING_HW_COUNTERS", Profiling_HWCounters, false);
+  /* DESCRIPTION: Name of the profiling report files, CSV and JSON (w/o extension)  \ingroup Config*/
+  addStringOption("PROFILING_FILENAME", Profiling_FileName, string("profiling_regions"));
   /*!\brief MARKER_ANALYZE_AVERAGE
    *  \n DESCRIPTION: Output averaged flow values on specified analyze marker.
    *  Options: AREA, MASSFLUX
@@ -2432,6 +2454,8 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("DEFORM_LINEAR_SOLVER_ERROR", Deform_Linear_Solver_Error, 1E-14);
   /* DESCRIPTION: Maximum number of iterations of the linear solver for the implicit formulation */
   addUnsignedLongOption("DEFORM_LINEAR_SOLVER_ITER", Deform_Linear_Solver_Iter, 1000);
+  /* DESCRIPTION: Apply the stiffness operator of the mesh deformation element by element instead of storing the matrix */
+  addBoolOption("DEFORM_MATRIX_FREE", Deform_MatrixFree, false);
   /* DESCRIPTION: Type of mesh deformation */
   addEnumOption("DEFORM_KIND", Deform_Kind, Deform_Kind_Map, DEFORM_KIND::ELASTIC);
   /* DESCRIPTION: Use of data reduction methods for RBF interpolated mesh deformation. */
@@ -2461,6 +2485,8 @@ void CConfig::SetConfig_Options() {
 
   /* DESCRIPTION: Number of aligned bytes for the matrix multiplications. Multiple of 64. (128 by default) */
   addUnsignedShortOption("ALIGNED_BYTES_MATMUL", byteAlignmentMatMul, 128);
+  /* DESCRIPTION: Minimum polynomial degree of quadrilaterals and hexahedra for which the volume terms use sum factorization, 0 disables it (4 by default) */
+  addUnsignedShortOption("SUM_FACTORIZATION_POLY_DGFEM", sumFactorizationPoly_DGFEM, 4);
 
   /*!\par CONFIG_CATEGORY: FEA solver \ingroup Config*/
   /*--- Options related to the FEA solver ---*/
@@ -2540,6 +2566,8 @@ void CConfig::SetConfig_Options() {
   addEnumOption("NONLINEAR_FEM_SOLUTION_METHOD", Kind_SpaceIteScheme_FEA, Space_Ite_Map_FEA, STRUCT_SPACE_ITE::NEWTON);
   /* DESCRIPTION: Formulation for bidimensional elasticity solver */
   addEnumOption("FORMULATION_ELASTICITY_2D", Kind_2DElasForm, ElasForm_2D, STRUCT_2DFORM::PLANE_STRAIN);
+  /* DESCRIPTION: Assemble the stiffness matrix and nodal stress terms for batches of elements of the same type (SIMD) */
+  addBoolOption("FEA_BATCHED_ASSEMBLY", FEA_BatchedAssembly, false);
   /*  DESCRIPTION: Apply centrifugal forces
    *  Options: NO, YES \ingroup Config */
   addBoolOption("CENTRIFUGAL_FORCE", CentrifugalForce, false);
@@ -2618,6 +2646,16 @@ void CConfig::SetConfig_Options() {
   addDoubleOption("TIME_STEP", Time_Step, 0.0);
   /* DESCRIPTION: Total Physical Time for time-domain problems (s) */
   addDoubleOption("MAX_TIME", Max_Time, 1.0);
+  /* DESCRIPTION: Number of time slabs (groups of ranks) of the parallel-in-time (Parareal) driver, 1 disables it */
+  addUnsignedShortOption("PARAREAL_SLABS", nParareal_Slabs, 1);
+  /* DESCRIPTION: Maximum number of Parareal iterations (coarse corrections) */
+  addUnsignedShortOption("PARAREAL_ITER", nParareal_Iter, 5);
+  /* DESCRIPTION: Ratio between the time steps of the coarse and fine Parareal propagators */
+  addUnsignedShortOption("PARAREAL_COARSENING", Parareal_Coarsening, 4);
+  /* DESCRIPTION: Inner iterations per time step of the coarse Parareal propagator, 0 uses INNER_ITER */
+  addUnsignedLongOption("PARAREAL_COARSE_INNER_ITER", nParareal_CoarseInnerIter, 0);
+  /* DESCRIPTION: Relative change of the time slab initial states below which Parareal is converged */
+  addDoubleOption("PARAREAL_TOL", Parareal_Tol, 1e-6);
   /* DESCRIPTION: Determines if the special output is written out */
   addBoolOption("SPECIAL_OUTPUT", SpecialOutput, false);
 
@@ -2641,6 +2679,9 @@ void CConfig::SetConfig_Options() {
 
   addUnsignedShortOption("NUM_NEAREST_NEIGHBORS", NumNearestNeighbors, 1);
 
+  /*  DESCRIPTION: Search the nearest neighbor donors on the ranks that own them instead of gathering all donor points. */
+  addBoolOption("DISTRIBUTED_DONOR_SEARCH", DistributedDonorSearch, false);
+
   /*!\par KIND_INTERPOLATION \n
    * DESCRIPTION: Type of radial basis function to use for radial basis function interpolation. \n OPTIONS: see \link RadialBasis_Map \endlink
    * Sets Kind_RadialBasis \ingroup Config
@@ -2823,6 +2864,9 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: Preaccumulation in the AD mode. */
   addBoolOption("PREACC", AD_Preaccumulation, YES);
 
+  /* DESCRIPTION: Hand-written adjoints, instead of taping, for the inviscid part of the edge flux kernels. */
+  addBoolOption("AD_EXTERNAL_FLUX", AD_ExternalFlux, NO);
+
   /* DESCRIPTION: Specify the tape which is checked in a tape debug run. */
   addEnumOption("CHECK_TAPE_TYPE", AD_CheckTapeType, CheckTapeType_Map, CHECK_TAPE_TYPE::FULL_SOLVER);
 
@@ -2896,6 +2940,24 @@ void CConfig::SetConfig_Options() {
   /* DESCRIPTION: ParMETIS load balancing weight for edges (equiv. to neighbors) */
   addLongOption("PARMETIS_EDGE_WEIGHT", ParMETIS_edgeWgt, 1);
 
+  /* DESCRIPTION: ParMETIS load balancing weight added to points on boundary markers */
+  addLongOption("PARMETIS_BOUNDARY_WEIGHT", ParMETIS_boundaryWgt, 0);
+
+  /* DESCRIPTION: Use the point weights measured by a previous run for the partitioning */
+  addBoolOption("PARMETIS_READ_WEIGHTS", ParMETIS_readWgts, false);
+
+  /* DESCRIPTION: Write the point weights measured in this run at the end of the simulation */
+  addBoolOption("PARMETIS_WRITE_WEIGHTS", ParMETIS_writeWgts, false);
+
+  /* DESCRIPTION: File with the measured point weights (without extension) */
+  addStringOption("PARMETIS_WEIGHTS_FILENAME", ParMETIS_wgtsFileName, string("point_weights"));
+
+  /* DESCRIPTION: Map the partitions to ranks such that neighbor partitions share a node */
+  addBoolOption("PARMETIS_NODE_AWARE", ParMETIS_nodeAware, false);
+
+  /* DESCRIPTION: Exchange halos with the ranks of the same node through shared memory */
+  addBoolOption("SHARED_MEMORY_HALO_COMMS", SharedMemoryHaloComms, false);
+
   /*--- options that are used in the Hybrid RANS/LES Simulations  ---*/
   /*!\par CONFIG_CATEGORY:Hybrid_RANSLES Options\ingroup Config*/
 
@@ -4163,6 +4225,15 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
       SU2_MPI::Error("Catalytic wall recombination is not yet available for ionized flows in SU2_NEMO.", CURRENT_FUNCTION);
     }
 
+    if (chemistry_split && DiscreteAdjoint) {
+      SU2_MPI::Error("CHEMISTRY_OPERATOR_SPLIT is not compatible with the discrete adjoint.", CURRENT_FUNCTION);
+    }
+
+    if (chemistry_split && (!Time_Domain || TimeMarching != TIME_MARCHING::TIME_STEPPING)) {
+      SU2_MPI::Error("CHEMISTRY_OPERATOR_SPLIT integrates the chemistry over the physical time step, it requires\n"
+                     "TIME_DOMAIN= YES and TIME_MARCHING= TIME_STEPPING.", CURRENT_FUNCTION);
+    }
+
     if (!ideal_gas && !nemo) {
       if (Kind_Upwind_Flow != UPWIND::ROE && Kind_Upwind_Flow != UPWIND::HLLC && Kind_Centered_Flow != CENTERED::JST) {
         SU2_MPI::Error("Only ROE Upwind, HLLC Upwind scheme, and JST scheme can be used for Non-Ideal Compressible Fluids", CURRENT_FUNCTION);
@@ -4860,19 +4931,36 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (nLevels_TimeAccurateLTS  > 15) nLevels_TimeAccurateLTS = 15;
 
   /* Check that no time accurate local time stepping is specified for time
-     integration schemes other than ADER. */
-  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && nLevels_TimeAccurateLTS != 1) {
+     integration schemes other than ADER, or the explicit schemes of the
+     compressible finite volume flow solvers (multirate time stepping). */
+  const bool fvm_multirate = ((Kind_Solver == MAIN_SOLVER::EULER) ||
+                              (Kind_Solver == MAIN_SOLVER::NAVIER_STOKES)) &&
+                             (TimeMarching == TIME_MARCHING::TIME_STEPPING) &&
+                             ((Kind_TimeIntScheme_Flow == RUNGE_KUTTA_EXPLICIT) ||
+                              (Kind_TimeIntScheme_Flow == CLASSICAL_RK4_EXPLICIT) ||
+                              (Kind_TimeIntScheme_Flow == EULER_EXPLICIT));
+
+  if (Kind_TimeIntScheme_FEM_Flow != ADER_DG && !fvm_multirate && nLevels_TimeAccurateLTS != 1) {
 
     if (rank==MASTER_NODE) {
       cout << endl << "WARNING: "
            << nLevels_TimeAccurateLTS << " levels specified for time accurate local time stepping." << endl
-           << "Time accurate local time stepping is only possible for ADER, hence this option is not used." << endl
+           << "Time accurate local time stepping is only possible for ADER, or explicit time stepping of the" << endl
+           << "compressible finite volume flow solvers, hence this option is not used." << endl
            << endl;
     }
 
     nLevels_TimeAccurateLTS = 1;
   }
 
+  if (fvm_multirate && nLevels_TimeAccurateLTS != 1) {
+    if (Unst_CFL == 0.0)
+      SU2_MPI::Error("UNST_CFL_NUMBER must be specified for multirate explicit time stepping.", CURRENT_FUNCTION);
+    if (nMGLevels != 0)
+      SU2_MPI::Error("Multirate explicit time stepping (LEVELS_TIME_ACCURATE_LTS > 1) requires MGLEVEL= 0.",
+                     CURRENT_FUNCTION);
+  }
+
   if (Kind_TimeIntScheme_FEM_Flow == ADER_DG) {
 
     TimeMarching = TIME_MARCHING::TIME_STEPPING;  // Only time stepping for ADER.
@@ -5088,6 +5176,20 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
       }
   }
 
+  /*--- Options of parallel features that are not compiled in this build. ---*/
+
+#if !defined(HAVE_MPI) || defined(CODI_REVERSE_TYPE) || defined(CODI_FORWARD_TYPE)
+  if (SharedMemoryHaloComms) {
+    SU2_MPI::Error("SHARED_MEMORY_HALO_COMMS= YES is not available in AD builds (the messages must be recorded)\n"
+                   "or in builds without MPI.", CURRENT_FUNCTION);
+  }
+#endif
+#if !defined(HAVE_MPI) || !defined(HAVE_PARMETIS)
+  if (ParMETIS_nodeAware) {
+    SU2_MPI::Error("PARMETIS_NODE_AWARE= YES requires a build with MPI and ParMETIS.", CURRENT_FUNCTION);
+  }
+#endif
+
 #if defined CODI_REVERSE_TYPE
   AD_Mode = YES;
 
@@ -5438,6 +5540,17 @@ void CConfig::SetPostprocessing(SU2_COMPONENT val_software, unsigned short val_i
   if (isPastix(Kind_DiscAdj_Linear_Solver)) Kind_DiscAdj_Linear_Prec = LU_SGS;
   if (isPastix(Kind_Deform_Linear_Solver)) Kind_Deform_Linear_Solver_Prec = LU_SGS;
 
+  if (Deform_MatrixFree) {
+    if (isPastix(Kind_Deform_Linear_Solver))
+      SU2_MPI::Error("DEFORM_MATRIX_FREE requires an iterative DEFORM_LINEAR_SOLVER.", CURRENT_FUNCTION);
+    if (Kind_Deform_Linear_Solver_Prec != JACOBI)
+      SU2_MPI::Error("DEFORM_MATRIX_FREE only supports DEFORM_LINEAR_SOLVER_PREC= JACOBI (block Jacobi).",
+                     CURRENT_FUNCTION);
+    if (DiscreteAdjoint || DirectDiff != NO_DERIVATIVE)
+      SU2_MPI::Error("DEFORM_MATRIX_FREE is not compatible with the discrete adjoint or direct differentiation.",
+                     CURRENT_FUNCTION);
+  }
+
 
   if (DiscreteAdjoint) {
 #if !defined CODI_REVERSE_TYPE
@@ -7239,6 +7352,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "Using a linelet preconditioning."<< endl; break;
                 case LU_SGS:  cout << "Using a LU-SGS preconditioning."<< endl; break;
                 case JACOBI:  cout << "Using a Jacobi preconditioning."<< endl; break;
+                case AMG:     cout << "Using an algebraic multigrid preconditioning."<< endl; break;
               }
               break;
             case SMOOTHER:
@@ -7247,6 +7361,7 @@ void CConfig::SetOutput(SU2_COMPONENT val_software, unsigned short val_izone) {
                 case LINELET: cout << "A Linelet"; break;
                 case LU_SGS:  cout << "A LU-SGS"; break;
                 case JACOBI:  cout << "A Jacobi"; break;
+                case AMG:     cout << "An algebraic multigrid"; break;
               }
               cout << " method is used for smoothing the linear system." << endl;
               break;
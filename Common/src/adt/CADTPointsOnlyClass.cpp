@@ -29,6 +29,9 @@
 #include "../../include/parallelization/mpi_structure.hpp"
 #include "../../include/option_structure.hpp"
 
+#include <algorithm>
+#include <tuple>
+
 CADTPointsOnlyClass::CADTPointsOnlyClass(unsigned short nDim, unsigned long nPoints, const su2double* coor,
                                          const unsigned long* pointID, const bool globalTree) {
   /* Allocate some thread-safe working variables if required. */
@@ -237,3 +240,125 @@ void CADTPointsOnlyClass::DetermineNearestNode_impl(vector<unsigned long>& front
      Take the sqrt to obtain the correct value. */
   dist = sqrt(dist);
 }
+
+void CADTPointsOnlyClass::DetermineNearestNodes_impl(vector<unsigned long>& frontLeaves,
+                                                     vector<unsigned long>& frontLeavesNew, const su2double* coor,
+                                                     unsigned long nNodes, vector<su2double>& dist2,
+                                                     vector<unsigned long>& pointID, vector<int>& rankID) const {
+  dist2.clear();
+  pointID.clear();
+  rankID.clear();
+  if (isEmpty || nNodes == 0) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  /*--- The nearest nodes found so far are stored in a max-heap of (squared distance, point ID, node), i.e. the
+        top of the heap is the node that is replaced when a closer one is found. ---*/
+  using CCandidate = tuple<su2double, unsigned long, unsigned long>;
+  vector<CCandidate> nearest;
+  nearest.reserve(nNodes);
+
+  auto StoreNode = [&](unsigned long kk) {
+    /* A node can be visited as the central node of several leaves and as a terminal child. */
+    for (const auto& candidate : nearest)
+      if (get<2>(candidate) == kk) return;
+
+    const CCandidate candidate(SquaredDistance(coor, kk), localPointIDs[kk], kk);
+    if (nearest.size() < nNodes) {
+      nearest.push_back(candidate);
+      push_heap(nearest.begin(), nearest.end());
+    } else if (candidate < nearest.front()) {
+      pop_heap(nearest.begin(), nearest.end());
+      nearest.back() = candidate;
+      push_heap(nearest.begin(), nearest.end());
+    }
+  };
+
+  /*--- Traverse the tree as in DetermineNearestNode. A leaf is skipped if the nearest nodes have been found
+        and its possible minimum distance is larger than that of the farthest of them, leaves at the same
+        distance are kept as they may contain nodes with smaller point IDs. The central nodes of the leaves
+        are used to reduce the search radius quickly. ---*/
+  StoreNode(leaves[0].centralNodeID);
+
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for (;;) {
+    frontLeavesNew.clear();
+
+    for (const auto ll : frontLeaves) {
+      for (unsigned short mm = 0; mm < 2; ++mm) {
+        const unsigned long kk = leaves[ll].children[mm];
+        if (leaves[ll].childrenAreTerminal[mm]) {
+          StoreNode(kk);
+        } else if (nearest.size() < nNodes || PossibleMinSquaredDistance(coor, kk) <= get<0>(nearest.front())) {
+          frontLeavesNew.push_back(kk);
+          StoreNode(leaves[kk].centralNodeID);
+        }
+      }
+    }
+
+    frontLeaves = frontLeavesNew;
+    if (frontLeaves.empty()) break;
+  }
+
+  AD::EndPassive(wasActive);
+
+  /*--- Sort the nearest nodes and recompute the distances to get the correct dependency if we use AD. ---*/
+  sort_heap(nearest.begin(), nearest.end());
+
+  for (const auto& candidate : nearest) {
+    const auto kk = get<2>(candidate);
+    dist2.push_back(SquaredDistance(coor, kk));
+    pointID.push_back(localPointIDs[kk]);
+    rankID.push_back(ranksOfPoints[kk]);
+  }
+}
+
+void CADTPointsOnlyClass::DetermineNodesWithinDistance_impl(vector<unsigned long>& frontLeaves,
+                                                            vector<unsigned long>& frontLeavesNew,
+                                                            const su2double* coor, su2double dist,
+                                                            vector<unsigned long>& pointID,
+                                                            vector<int>& rankID) const {
+  pointID.clear();
+  rankID.clear();
+  if (isEmpty) return;
+
+  const bool wasActive = AD::BeginPassive();
+
+  const su2double dist2 = dist * dist;
+  vector<unsigned long> nodes;
+
+  /*--- Traverse the leaves that may contain nodes within the distance. ---*/
+  frontLeaves.clear();
+  frontLeaves.push_back(0);
+
+  for (;;) {
+    frontLeavesNew.clear();
+
+    for (const auto ll : frontLeaves) {
+      for (unsigned short mm = 0; mm < 2; ++mm) {
+        const unsigned long kk = leaves[ll].children[mm];
+        if (leaves[ll].childrenAreTerminal[mm]) {
+          if (SquaredDistance(coor, kk) <= dist2) nodes.push_back(kk);
+        } else if (PossibleMinSquaredDistance(coor, kk) <= dist2) {
+          frontLeavesNew.push_back(kk);
+        }
+      }
+    }
+
+    frontLeaves = frontLeavesNew;
+    if (frontLeaves.empty()) break;
+  }
+
+  AD::EndPassive(wasActive);
+
+  /*--- If the ADT contains a single point, both children of the root leaf are that point. ---*/
+  sort(nodes.begin(), nodes.end());
+  nodes.erase(unique(nodes.begin(), nodes.end()), nodes.end());
+
+  for (const auto kk : nodes) {
+    pointID.push_back(localPointIDs[kk]);
+    rankID.push_back(ranksOfPoints[kk]);
+  }
+}
@@ -48,6 +48,11 @@ SU2_OMP(threadprivate(PreaccHelper))
 
 ExtFuncHelper FuncHelper;
 
+LocalExtFuncHelper LocalFuncHelper;
+#ifdef HAVE_OPDI
+SU2_OMP(threadprivate(LocalFuncHelper))
+#endif
+
 #endif
 
 void Initialize() {
@@ -29,6 +29,35 @@
 #include "../../include/fem/fem_gauss_jacobi_quadrature.hpp"
 #include "../../include/linear_algebra/blas_structure.hpp"
 
+namespace {
+/*!
+ * \brief Apply the 1D matrix A (mOut x mIn, row major) in one direction of tensor-product data, i.e.
+ *        out(o,i,k,:) (+)= sum_m A(i,m) in(o,m,k,:), where every entry is a row of N values.
+ * \param[in]  stride - Distance (in rows) between consecutive entries of the input, to select one
+ *                      component of interleaved data.
+ */
+void ContractDirection(const su2double* A, const unsigned short mOut, const unsigned short mIn,
+                       const unsigned long nOuter, const unsigned long nInner, const unsigned short N,
+                       const unsigned short stride, const su2double* in, su2double* out, const bool add) {
+  for (unsigned long o = 0; o < nOuter; ++o) {
+    for (unsigned short i = 0; i < mOut; ++i) {
+      su2double* outRows = out + (o * mOut + i) * nInner * N;
+      if (!add)
+        for (unsigned long k = 0; k < nInner * N; ++k) outRows[k] = 0.0;
+
+      for (unsigned short m = 0; m < mIn; ++m) {
+        const su2double a = A[i * mIn + m];
+        for (unsigned long k = 0; k < nInner; ++k) {
+          const su2double* inRow = in + ((o * mIn + m) * nInner + k) * stride * N;
+          su2double* outRow = outRows + k * N;
+          for (unsigned short n = 0; n < N; ++n) outRow[n] += a * inRow[n];
+        }
+      }
+    }
+  }
+}
+}  // namespace
+
 /*----------------------------------------------------------------------------------*/
 /*          Public member functions of CFEMStandardElementBase.                     */
 /*----------------------------------------------------------------------------------*/
@@ -2062,6 +2091,130 @@ void CFEMStandardElement::Copy(const CFEMStandardElement& other) {
   matDerBasisSolDOFs = other.matDerBasisSolDOFs;
   matDerBasisOwnDOFs = other.matDerBasisOwnDOFs;
   mat2ndDerBasisInt = other.mat2ndDerBasisInt;
+
+  nDOFs1D = other.nDOFs1D;
+  nIntegration1D = other.nIntegration1D;
+  lagBasisInt1D = other.lagBasisInt1D;
+  derLagBasisInt1D = other.derLagBasisInt1D;
+  lagBasisInt1DTrans = other.lagBasisInt1DTrans;
+  derLagBasisInt1DTrans = other.derLagBasisInt1DTrans;
+}
+
+unsigned long CFEMStandardElement::GetSizeWorkSumFactorization(const unsigned short N) const {
+  const unsigned long P = nDOFs1D, M = nIntegration1D;
+  switch (VTK_Type) {
+    case QUADRILATERAL:
+      return 2 * M * P * N;
+    case HEXAHEDRON:
+      return (3 * M * M * P + 2 * M * P * P) * N;
+    default:
+      return 0;
+  }
+}
+
+void CFEMStandardElement::SumFactInterpolation(const unsigned short N, const bool derivatives,
+                                               const su2double* dofData, su2double* intData,
+                                               su2double* work) const {
+  const unsigned short P = nDOFs1D, M = nIntegration1D;
+  const su2double* B = lagBasisInt1D.data();
+  const su2double* D = derLagBasisInt1D.data();
+
+  /*--- The DOFs and integration points are numbered with the r-direction running fastest,
+        the 1D matrices are applied in the r-, s- and t-direction in turn. ---*/
+  if (VTK_Type == QUADRILATERAL) {
+    su2double* T = work;
+    su2double* Tr = T + M * P * N;
+
+    ContractDirection(B, M, P, P, 1, N, 1, dofData, T, false);
+    ContractDirection(B, M, P, 1, M, N, 1, T, intData, false);
+
+    if (derivatives) {
+      ContractDirection(D, M, P, P, 1, N, 1, dofData, Tr, false);
+      ContractDirection(B, M, P, 1, M, N, 1, Tr, intData + nIntegration * N, false);
+      ContractDirection(D, M, P, 1, M, N, 1, T, intData + 2 * nIntegration * N, false);
+    }
+  } else if (VTK_Type == HEXAHEDRON) {
+    su2double* T1 = work;
+    su2double* T1r = T1 + M * P * P * N;
+    su2double* T2 = T1r + M * P * P * N;
+    su2double* T2r = T2 + M * M * P * N;
+    su2double* T2s = T2r + M * M * P * N;
+
+    ContractDirection(B, M, P, P * P, 1, N, 1, dofData, T1, false);
+    ContractDirection(B, M, P, P, M, N, 1, T1, T2, false);
+    ContractDirection(B, M, P, 1, M * M, N, 1, T2, intData, false);
+
+    if (derivatives) {
+      ContractDirection(D, M, P, P * P, 1, N, 1, dofData, T1r, false);
+      ContractDirection(B, M, P, P, M, N, 1, T1r, T2r, false);
+      ContractDirection(D, M, P, P, M, N, 1, T1, T2s, false);
+
+      ContractDirection(B, M, P, 1, M * M, N, 1, T2r, intData + nIntegration * N, false);
+      ContractDirection(B, M, P, 1, M * M, N, 1, T2s, intData + 2 * nIntegration * N, false);
+      ContractDirection(D, M, P, 1, M * M, N, 1, T2, intData + 3 * nIntegration * N, false);
+    }
+  } else {
+    SU2_MPI::Error("Sum factorization is only possible for quadrilaterals and hexahedra.", CURRENT_FUNCTION);
+  }
+}
+
+void CFEMStandardElement::SumFactIntegration(const unsigned short N, const su2double* intData, su2double* dofData,
+                                             su2double* work) const {
+  const unsigned short P = nDOFs1D, M = nIntegration1D;
+  const su2double* Bt = lagBasisInt1DTrans.data();
+
+  if (VTK_Type == QUADRILATERAL) {
+    ContractDirection(Bt, P, M, M, 1, N, 1, intData, work, false);
+    ContractDirection(Bt, P, M, 1, P, N, 1, work, dofData, false);
+  } else if (VTK_Type == HEXAHEDRON) {
+    su2double* S1 = work;
+    su2double* S2 = S1 + M * M * P * N;
+
+    ContractDirection(Bt, P, M, M * M, 1, N, 1, intData, S1, false);
+    ContractDirection(Bt, P, M, M, P, N, 1, S1, S2, false);
+    ContractDirection(Bt, P, M, 1, P * P, N, 1, S2, dofData, false);
+  } else {
+    SU2_MPI::Error("Sum factorization is only possible for quadrilaterals and hexahedra.", CURRENT_FUNCTION);
+  }
+}
+
+void CFEMStandardElement::SumFactDerIntegration(const unsigned short N, const su2double* intData,
+                                                su2double* dofData, su2double* work) const {
+  const unsigned short P = nDOFs1D, M = nIntegration1D;
+  const su2double* Bt = lagBasisInt1DTrans.data();
+  const su2double* Dt = derLagBasisInt1DTrans.data();
+
+  /*--- The components of the input are interleaved, the first contraction (r-direction)
+        selects them with a stride equal to the number of dimensions. ---*/
+  if (VTK_Type == QUADRILATERAL) {
+    su2double* Ur = work;
+    su2double* Us = Ur + M * P * N;
+
+    ContractDirection(Dt, P, M, M, 1, N, 2, intData, Ur, false);
+    ContractDirection(Bt, P, M, M, 1, N, 2, intData + N, Us, false);
+
+    ContractDirection(Bt, P, M, 1, P, N, 1, Ur, dofData, false);
+    ContractDirection(Dt, P, M, 1, P, N, 1, Us, dofData, true);
+  } else if (VTK_Type == HEXAHEDRON) {
+    su2double* Ur = work;
+    su2double* Us = Ur + M * M * P * N;
+    su2double* Ut = Us + M * M * P * N;
+    su2double* Vrs = Ut + M * M * P * N;
+    su2double* Vt = Vrs + M * P * P * N;
+
+    ContractDirection(Dt, P, M, M * M, 1, N, 3, intData, Ur, false);
+    ContractDirection(Bt, P, M, M * M, 1, N, 3, intData + N, Us, false);
+    ContractDirection(Bt, P, M, M * M, 1, N, 3, intData + 2 * N, Ut, false);
+
+    ContractDirection(Bt, P, M, M, P, N, 1, Ur, Vrs, false);
+    ContractDirection(Dt, P, M, M, P, N, 1, Us, Vrs, true);
+    ContractDirection(Bt, P, M, M, P, N, 1, Ut, Vt, false);
+
+    ContractDirection(Bt, P, M, 1, P * P, N, 1, Vrs, dofData, false);
+    ContractDirection(Dt, P, M, 1, P * P, N, 1, Vt, dofData, true);
+  } else {
+    SU2_MPI::Error("Sum factorization is only possible for quadrilaterals and hexahedra.", CURRENT_FUNCTION);
+  }
 }
 
 void CFEMStandardElement::CreateBasisFunctionsAndMatrixDerivatives(
@@ -2221,6 +2374,9 @@ void CFEMStandardElement::DataStandardQuadrilateral() {
   /*--- Set the VTK_type(s) for this sub element. ---*/
   VTK_Type1 = QUADRILATERAL;
   VTK_Type2 = NONE;
+
+  /*--- Create the 1D data for the sum factorization. ---*/
+  DataTensorProduct();
 }
 
 void CFEMStandardElement::DataStandardTetrahedron() {
@@ -2445,6 +2601,33 @@ void CFEMStandardElement::DataStandardHexahedron() {
   /*--- Set the VTK_type(s) for this sub element. ---*/
   VTK_Type1 = HEXAHEDRON;
   VTK_Type2 = NONE;
+
+  /*--- Create the 1D data for the sum factorization. ---*/
+  DataTensorProduct();
+}
+
+void CFEMStandardElement::DataTensorProduct() {
+  /*--- The integration rule is the tensor product of the 1D Gauss-Legendre rule, see
+        IntegrationPointsQuadrilateral and IntegrationPointsHexahedron, hence the first
+        nIntegration1D points contain the 1D rule. The DOFs are the tensor product of
+        the equidistant 1D DOFs. ---*/
+  nIntegration1D = orderExact / 2 + 1;
+  const vector<su2double> GLPoints(rIntegration.begin(), rIntegration.begin() + nIntegration1D);
+
+  vector<su2double> rDOFs1D, matVandermondeInv1D;
+  LagrangianBasisFunctionAndDerivativesLine(nPoly, GLPoints, nDOFs1D, rDOFs1D, matVandermondeInv1D, lagBasisInt1D,
+                                            derLagBasisInt1D);
+
+  /*--- Store the transposes, used for the integration. ---*/
+  lagBasisInt1DTrans.resize(lagBasisInt1D.size());
+  derLagBasisInt1DTrans.resize(derLagBasisInt1D.size());
+
+  for (unsigned short i = 0; i < nIntegration1D; ++i) {
+    for (unsigned short j = 0; j < nDOFs1D; ++j) {
+      lagBasisInt1DTrans[j * nIntegration1D + i] = lagBasisInt1D[i * nDOFs1D + j];
+      derLagBasisInt1DTrans[j * nIntegration1D + i] = derLagBasisInt1D[i * nDOFs1D + j];
+    }
+  }
 }
 
 void CFEMStandardElement::SubConnTetrahedron() {
@@ -28,11 +28,71 @@
 #include <unordered_set>
 
 #include "../../include/geometry/CGeometry.hpp"
+#include "../../include/tracy_structure.hpp"
 #include "../../include/geometry/elements/CElement.hpp"
 #include "../../include/parallelization/omp_structure.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/toolboxes/ndflattener.hpp"
 
+/*--- Shared-memory point-to-point comms require a passive su2double, the AD tools must see the messages. ---*/
+#if defined(HAVE_MPI) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+#define SHARED_MEMORY_P2P
+#endif
+
+/*!
+ * \brief Node of each rank and communicators for node-aware communications, for the ranks of one communicator.
+ */
+struct CNodeTopology {
+  vector<int> nodeOfRank; /*!< \brief Node of each rank, nodes are numbered in the order of their lowest rank. */
+  vector<int> rankInNode; /*!< \brief Rank of each rank within the communicator of its node. */
+#ifdef HAVE_MPI
+  MPI_Comm nodeComm = MPI_COMM_NULL;   /*!< \brief Ranks of this node. */
+  MPI_Comm signalComm = MPI_COMM_NULL; /*!< \brief Duplicate of the global communicator for shared-memory signals. */
+#endif
+
+  CNodeTopology() : nodeOfRank(SU2_MPI::GetSize(), 0), rankInNode(SU2_MPI::GetSize(), 0) {
+#ifdef HAVE_MPI
+    const int size = SU2_MPI::GetSize(), rank = SU2_MPI::GetRank();
+
+    MPI_Comm_split_type(SU2_MPI::GetComm(), MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &nodeComm);
+    MPI_Comm_dup(SU2_MPI::GetComm(), &signalComm);
+
+    /*--- The lowest rank of each node identifies it, the split preserves the order of the ranks. ---*/
+
+    int leader = rank;
+    MPI_Bcast(&leader, 1, MPI_INT, 0, nodeComm);
+    vector<int> leaders(size);
+    MPI_Allgather(&leader, 1, MPI_INT, leaders.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    map<int, int> leaderToNode;
+    vector<int> nodeSize;
+    for (int iRank = 0; iRank < size; iRank++) {
+      const auto it = leaderToNode.emplace(leaders[iRank], static_cast<int>(nodeSize.size())).first;
+      if (it->second == static_cast<int>(nodeSize.size())) nodeSize.push_back(0);
+      nodeOfRank[iRank] = it->second;
+      rankInNode[iRank] = nodeSize[it->second]++;
+    }
+#endif
+  }
+
+  ~CNodeTopology() {
+#ifdef HAVE_MPI
+    MPI_Comm_free(&nodeComm);
+    MPI_Comm_free(&signalComm);
+#endif
+  }
+
+  CNodeTopology(const CNodeTopology&) = delete;
+  CNodeTopology& operator=(const CNodeTopology&) = delete;
+};
+
+const CNodeTopology& CGeometry::GetNodeTopology() {
+  if (!nodeTopology) nodeTopology = make_shared<const CNodeTopology>();
+  return *nodeTopology;
+}
+
+const vector<int>& CGeometry::GetNodeOfRanks() { return GetNodeTopology().nodeOfRank; }
+
 CGeometry::CGeometry() : size(SU2_MPI::GetSize()), rank(SU2_MPI::GetRank()) {}
 
 CGeometry::~CGeometry() {
@@ -94,6 +154,21 @@ CGeometry::~CGeometry() {
 
   /*--- Delete structures for MPI point-to-point communication. ---*/
 
+#ifdef SHARED_MEMORY_P2P
+  if (sharedP2P) {
+    /*--- Shared windows are freed collectively, after the neighbors have copied our last messages. ---*/
+    SU2_MPI::Waitall(max(nP2PSend, nP2PRecv), req_P2PAck, MPI_STATUSES_IGNORE);
+    for (auto* win : {&winD_P2PSend, &winD_P2PRecv}) {
+      if (*win == MPI_WIN_NULL) continue;
+      MPI_Win_unlock_all(*win);
+      MPI_Win_free(win);
+    }
+    bufD_P2PRecv = nullptr;
+    bufD_P2PSend = nullptr;
+  }
+#endif
+  delete[] req_P2PAck;
+
   delete[] bufD_P2PRecv;
   delete[] bufD_P2PSend;
 
@@ -329,6 +404,52 @@ void CGeometry::PreprocessP2PComms(CGeometry* geometry, CConfig* config) {
   /*--- In the future, some additional data structures could be created
    here to separate the interior and boundary nodes in order to help
    further overlap computation and communication. ---*/
+
+#ifdef SHARED_MEMORY_P2P
+  /*--- All ranks of a node must agree on using shared memory since the windows are allocated
+   collectively, whether a rank has neighbors on the node or not. ---*/
+
+  if (config->GetSharedMemoryHaloComms()) {
+    int nodeSize;
+    MPI_Comm_size(GetNodeTopology().nodeComm, &nodeSize);
+    sharedP2P = (nodeSize > 1);
+  }
+
+  if (sharedP2P) {
+    const auto& topology = GetNodeTopology();
+    remoteOffset_P2PSend.assign(nP2PRecv, -1);
+    remoteOffset_P2PRecv.assign(nP2PSend, -1);
+    remoteBufD_P2PSend.assign(nP2PRecv, nullptr);
+    remoteBufD_P2PRecv.assign(nP2PSend, nullptr);
+
+    /*--- Tell the neighbors on the node where their messages start in our buffers. ---*/
+
+    const auto onNode = [&](int iRank) { return topology.nodeOfRank[iRank] == topology.nodeOfRank[rank]; };
+    vector<SU2_MPI::Request> requests;
+    requests.reserve(2 * (nP2PSend + nP2PRecv));
+
+    for (iSend = 0; iSend < nP2PSend; iSend++) {
+      const auto dest = Neighbors_P2PSend[iSend];
+      if (!onNode(dest)) continue;
+      requests.emplace_back();
+      SU2_MPI::Isend(&nPoint_P2PSend[iSend], 1, MPI_INT, dest, 0, topology.signalComm, &requests.back());
+      requests.emplace_back();
+      SU2_MPI::Irecv(&remoteOffset_P2PRecv[iSend], 1, MPI_INT, dest, 1, topology.signalComm, &requests.back());
+    }
+    for (iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+      const auto source = Neighbors_P2PRecv[iRecv];
+      if (!onNode(source)) continue;
+      requests.emplace_back();
+      SU2_MPI::Isend(&nPoint_P2PRecv[iRecv], 1, MPI_INT, source, 1, topology.signalComm, &requests.back());
+      requests.emplace_back();
+      SU2_MPI::Irecv(&remoteOffset_P2PSend[iRecv], 1, MPI_INT, source, 0, topology.signalComm, &requests.back());
+    }
+    SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUS_IGNORE);
+
+    req_P2PAck = new SU2_MPI::Request[max(nP2PSend, nP2PRecv)];
+    for (int iMessage = 0; iMessage < max(nP2PSend, nP2PRecv); iMessage++) req_P2PAck[iMessage] = MPI_REQUEST_NULL;
+  }
+#endif
 }
 
 void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
@@ -348,11 +469,15 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
 
     /*-- Deallocate and reallocate our su2double cummunication memory. ---*/
 
-    delete[] bufD_P2PSend;
-    bufD_P2PSend = new su2double[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
+    if (sharedP2P) {
+      AllocateSharedP2PBuffers();
+    } else {
+      delete[] bufD_P2PSend;
+      bufD_P2PSend = new su2double[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
 
-    delete[] bufD_P2PRecv;
-    bufD_P2PRecv = new su2double[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+      delete[] bufD_P2PRecv;
+      bufD_P2PRecv = new su2double[maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]]();
+    }
 
     delete[] bufS_P2PSend;
     bufS_P2PSend = new unsigned short[maxCountPerPoint * nPoint_P2PSend[nP2PSend]]();
@@ -363,8 +488,69 @@ void CGeometry::AllocateP2PComms(unsigned short countPerPoint) {
   END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
+void CGeometry::AllocateSharedP2PBuffers() {
+#ifdef SHARED_MEMORY_P2P
+  const auto& topology = GetNodeTopology();
+
+  /*--- The windows are (re)allocated collectively by the ranks of the node, which is safe because all
+   ranks perform the same sequence of communications. The neighbors are done with the old buffers once
+   they acknowledge our last messages. ---*/
+
+  SU2_MPI::Waitall(max(nP2PSend, nP2PRecv), req_P2PAck, MPI_STATUSES_IGNORE);
+
+  /*--- Memory local to each rank (it is the one that writes to it). ---*/
+
+  MPI_Info info;
+  MPI_Info_create(&info);
+  MPI_Info_set(info, "alloc_shared_noncontig", "true");
+
+  auto allocate = [&](MPI_Win& win, su2double*& buf, unsigned long size) {
+    if (win != MPI_WIN_NULL) {
+      MPI_Win_unlock_all(win);
+      MPI_Win_free(&win);
+    }
+    MPI_Win_allocate_shared(size * sizeof(su2double), sizeof(su2double), info, topology.nodeComm, &buf, &win);
+    for (auto i = 0ul; i < size; i++) buf[i] = 0.0;
+    MPI_Win_lock_all(MPI_MODE_NOCHECK, win);
+  };
+  allocate(winD_P2PSend, bufD_P2PSend, maxCountPerPoint * nPoint_P2PSend[nP2PSend]);
+  allocate(winD_P2PRecv, bufD_P2PRecv, maxCountPerPoint * nPoint_P2PRecv[nP2PRecv]);
+
+  MPI_Info_free(&info);
+
+  /*--- Get the buffers of the neighbors on the node, they are reallocated at the same time as ours. ---*/
+
+  auto query = [&](MPI_Win win, int neighbor) {
+    MPI_Aint size;
+    int dispUnit;
+    su2double* buf = nullptr;
+    MPI_Win_shared_query(win, topology.rankInNode[neighbor], &size, &dispUnit, &buf);
+    return buf;
+  };
+  for (int iRecv = 0; iRecv < nP2PRecv; iRecv++) {
+    if (remoteOffset_P2PSend[iRecv] >= 0)
+      remoteBufD_P2PSend[iRecv] = query(winD_P2PSend, Neighbors_P2PRecv[iRecv]);
+  }
+  for (int iSend = 0; iSend < nP2PSend; iSend++) {
+    if (remoteOffset_P2PRecv[iSend] >= 0)
+      remoteBufD_P2PRecv[iSend] = query(winD_P2PRecv, Neighbors_P2PSend[iSend]);
+  }
+#endif
+}
+
 void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigned short commType,
                              unsigned short countPerPoint, bool val_reverse) const {
+  /*--- With shared memory, the neighbors on the node read our messages directly from the buffers,
+   we cannot load new data into them until they are done with the previous messages. ---*/
+
+  const bool shared = sharedP2P && (commType == COMM_TYPE_DOUBLE);
+
+#ifdef SHARED_MEMORY_P2P
+  if (shared) {
+    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitall(max(nP2PSend, nP2PRecv), req_P2PAck, MPI_STATUSES_IGNORE);)
+  }
+#endif
+
   /*--- Launch the non-blocking recv's first. Note that we have stored
    the counts and sources, so we can launch these before we even load
    the data and send from the neighbor ranks. ---*/
@@ -389,9 +575,10 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
 
       auto nPointP2P = nPoint_P2PSend[iRecv + 1] - nPoint_P2PSend[iRecv];
 
-      /*--- Total count can include multiple pieces of data per element. ---*/
+      /*--- Total count can include multiple pieces of data per element.
+       Messages through shared memory only signal that the data is ready. ---*/
 
-      auto count = countPerPoint * nPointP2P;
+      auto count = (shared && remoteOffset_P2PRecv[iRecv] >= 0) ? 0 : countPerPoint * nPointP2P;
 
       /*--- Get the rank from which we receive the message. Note again
        that we use the send rank as the source instead of the recv rank. ---*/
@@ -429,7 +616,7 @@ void CGeometry::PostP2PRecvs(CGeometry* geometry, const CConfig* config, unsigne
 
       /*--- Total count can include multiple pieces of data per element. ---*/
 
-      auto count = countPerPoint * nPointP2P;
+      auto count = (shared && remoteOffset_P2PSend[iRecv] >= 0) ? 0 : countPerPoint * nPointP2P;
 
       /*--- Get the rank from which we receive the message. ---*/
 
@@ -464,6 +651,19 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
    to reverse the direction of communications such that the normal
    send nodes become the recv nodes and vice-versa. ---*/
 
+  /*--- Messages to neighbors on the node only signal that the data is ready, they read it from shared memory. ---*/
+
+  const bool shared = sharedP2P && (commType == COMM_TYPE_DOUBLE);
+
+  auto sharedSend = [&](int remoteOffset, int dest) {
+    if (!shared || remoteOffset < 0) return false;
+#ifdef SHARED_MEMORY_P2P
+    MPI_Win_sync(val_reverse ? winD_P2PRecv : winD_P2PSend);
+    SU2_MPI::Irecv(nullptr, 0, MPI_DOUBLE, dest, 2, nodeTopology->signalComm, &req_P2PAck[val_iSend]);
+#endif
+    return true;
+  };
+
   SU2_OMP_MASTER
   if (val_reverse) {
     /*--- Compute our location in the buffer using the recv data
@@ -477,16 +677,16 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
 
     auto nPointP2P = nPoint_P2PRecv[val_iSend + 1] - nPoint_P2PRecv[val_iSend];
 
-    /*--- Total count can include multiple pieces of data per element. ---*/
-
-    auto count = countPerPoint * nPointP2P;
-
     /*--- Get the rank to which we send the message. Note again
      that we use the recv rank as the dest instead of the send rank. ---*/
 
     auto dest = Neighbors_P2PRecv[val_iSend];
     auto tag = rank + 1;
 
+    /*--- Total count can include multiple pieces of data per element. ---*/
+
+    auto count = sharedSend(shared ? remoteOffset_P2PSend[val_iSend] : -1, dest) ? 0 : countPerPoint * nPointP2P;
+
     /*--- Post non-blocking send for this proc. Note that we use the
      send buffer here too. This is important to make sure the arrays
      are the correct size. ---*/
@@ -515,15 +715,15 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
 
     auto nPointP2P = nPoint_P2PSend[val_iSend + 1] - nPoint_P2PSend[val_iSend];
 
-    /*--- Total count can include multiple pieces of data per element. ---*/
-
-    auto count = countPerPoint * nPointP2P;
-
     /*--- Get the rank to which we send the message. ---*/
 
     auto dest = Neighbors_P2PSend[val_iSend];
     auto tag = rank + 1;
 
+    /*--- Total count can include multiple pieces of data per element. ---*/
+
+    auto count = sharedSend(shared ? remoteOffset_P2PRecv[val_iSend] : -1, dest) ? 0 : countPerPoint * nPointP2P;
+
     /*--- Post non-blocking send for this proc. ---*/
 
     switch (commType) {
@@ -543,6 +743,65 @@ void CGeometry::PostP2PSends(CGeometry* geometry, const CConfig* config, unsigne
   END_SU2_OMP_MASTER
 }
 
+int CGeometry::WaitAnyP2PRecv(unsigned short commType, unsigned short countPerPoint, bool val_reverse) const {
+  /*--- Global so all threads can see the result of Waitany. ---*/
+  static int source;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    int ind;
+    SU2_MPI::Status status;
+    SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);
+    source = status.MPI_SOURCE;
+
+#ifdef SHARED_MEMORY_P2P
+    /*--- The message from a neighbor on the node was only a signal, make its writes to
+     the buffer that we are going to read visible. ---*/
+
+    if (sharedP2P && (commType == COMM_TYPE_DOUBLE) && (GetP2PRemoteOffset(source, val_reverse) >= 0)) {
+      MPI_Win_sync(val_reverse ? winD_P2PRecv : winD_P2PSend);
+    }
+#endif
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+
+  return source;
+}
+
+int CGeometry::GetP2PRemoteOffset(int source, bool val_reverse) const {
+  if (val_reverse) return remoteOffset_P2PRecv[P2PSend2Neighbor.at(source)];
+  return remoteOffset_P2PSend[P2PRecv2Neighbor.at(source)];
+}
+
+const su2double* CGeometry::GetP2PRecvBufferD(int source, unsigned short countPerPoint, bool val_reverse) const {
+  /*--- Messages through shared memory are read directly from the buffer of the sender. ---*/
+
+  if (sharedP2P) {
+    const auto remoteOffset = GetP2PRemoteOffset(source, val_reverse);
+    if (remoteOffset >= 0) {
+      const auto* remote = val_reverse ? remoteBufD_P2PRecv[P2PSend2Neighbor.at(source)]
+                                       : remoteBufD_P2PSend[P2PRecv2Neighbor.at(source)];
+      return remote + countPerPoint * remoteOffset;
+    }
+  }
+  if (val_reverse) return bufD_P2PSend + countPerPoint * nPoint_P2PSend[P2PSend2Neighbor.at(source)];
+  return bufD_P2PRecv + countPerPoint * nPoint_P2PRecv[P2PRecv2Neighbor.at(source)];
+}
+
+void CGeometry::ReleaseP2PRecv(unsigned short commType, int source, bool val_reverse) const {
+#ifdef SHARED_MEMORY_P2P
+  /*--- Let the neighbor on the node know that its buffer can be reused. ---*/
+
+  if (!sharedP2P || (commType != COMM_TYPE_DOUBLE) || (GetP2PRemoteOffset(source, val_reverse) < 0)) return;
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    SU2_MPI::Request ack;
+    SU2_MPI::Isend(nullptr, 0, MPI_DOUBLE, source, 2, nodeTopology->signalComm, &ack);
+    SU2_MPI::Request_free(&ack);
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+#endif
+}
+
 void CGeometry::GetCommCountAndType(const CConfig* config, MPI_QUANTITIES commType, unsigned short& COUNT_PER_POINT,
                                     unsigned short& MPI_TYPE) const {
   switch (commType) {
@@ -576,7 +835,7 @@ void CGeometry::GetCommCountAndType(const CConfig* config, MPI_QUANTITIES commTy
 }
 
 void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, MPI_QUANTITIES commType) const {
-  if (nP2PSend == 0) return;
+  SU2_ZONE_SCOPED_N("Geometry_InitiateComms");
 
   /*--- Local variables ---*/
 
@@ -599,6 +858,8 @@ void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, MPI_QU
 
   geometry->AllocateP2PComms(COUNT_PER_POINT);
 
+  if (nP2PSend == 0) return;
+
   /*--- Set some local pointers to make access simpler. ---*/
 
   su2double* bufDSend = geometry->bufD_P2PSend;
@@ -673,6 +934,8 @@ void CGeometry::InitiateComms(CGeometry* geometry, const CConfig* config, MPI_QU
 }
 
 void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QUANTITIES commType) {
+  SU2_ZONE_SCOPED_N("Geometry_CompleteComms");
+
   if (nP2PRecv == 0) return;
 
   /*--- Local variables ---*/
@@ -680,19 +943,12 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
   unsigned short iDim, COUNT_PER_POINT = 0, MPI_TYPE = 0;
   unsigned long iPoint, iRecv, nRecv, msg_offset, buf_offset;
 
-  int ind, source, iMessage, jRecv;
-
-  /*--- Global status so all threads can see the result of Waitany. ---*/
-  static SU2_MPI::Status status;
+  int source, iMessage, jRecv;
 
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
 
-  /*--- Set some local pointers to make access simpler. ---*/
-
-  const su2double* bufDRecv = geometry->bufD_P2PRecv;
-  const unsigned short* bufSRecv = geometry->bufS_P2PRecv;
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. Note that we
@@ -703,11 +959,7 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(nP2PRecv, req_P2PRecv, &ind, &status);)
-
-    /*--- Once we have recv'd a message, get the source rank. ---*/
-
-    source = status.MPI_SOURCE;
+    source = WaitAnyP2PRecv(MPI_TYPE, COUNT_PER_POINT, false);
 
     /*--- We know the offsets based on the source rank. ---*/
 
@@ -721,15 +973,20 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
 
     nRecv = nPoint_P2PRecv[jRecv + 1] - nPoint_P2PRecv[jRecv];
 
+    /*--- Set some local pointers to the start of the message to make access simpler. ---*/
+
+    const su2double* bufDRecv = GetP2PRecvBufferD(source, COUNT_PER_POINT, false);
+    const unsigned short* bufSRecv = geometry->bufS_P2PRecv + msg_offset * COUNT_PER_POINT;
+
     SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
     for (iRecv = 0; iRecv < nRecv; iRecv++) {
       /*--- Get the local index for this communicated data. ---*/
 
       iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
 
-      /*--- Compute the total offset in the recv buffer for this point. ---*/
+      /*--- Compute the offset in the message for this point. ---*/
 
-      buf_offset = (msg_offset + iRecv) * COUNT_PER_POINT;
+      buf_offset = iRecv * COUNT_PER_POINT;
 
       /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -757,6 +1014,8 @@ void CGeometry::CompleteComms(CGeometry* geometry, const CConfig* config, MPI_QU
       }
     }
     END_SU2_OMP_FOR
+
+    ReleaseP2PRecv(MPI_TYPE, source, false);
   }
 
   /*--- Verify that all non-blocking point-to-point sends have finished.
@@ -67,6 +67,26 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
 
   unsigned long Index_CoarseCV = 0;
 
+  /*--- For directional agglomeration (semi-coarsening) in stretched regions, the points of the linelets
+   (mesh lines normal to the walls, that stop when the mesh becomes isotropic) are agglomerated along
+   the lines, i.e. along the direction of strong coupling. ---*/
+
+  const auto lineSize = config->GetMG_LineAgglomeration();
+  const CLineletInfo* lineInfo = nullptr;
+  if (lineSize > 1) {
+    lineInfo = &fine_grid->GetLineletInfo(config);
+    if (lineInfo->lineletIdx.empty()) lineInfo = nullptr;
+  }
+
+  /*--- Interior points next to a seed that is on a linelet, are only agglomerated if they are on the same line. ---*/
+
+  auto OffLine = [&](unsigned long seed, unsigned long CVPoint) {
+    if (lineInfo == nullptr) return false;
+    const auto iLine = lineInfo->lineletIdx[seed];
+    return (iLine != CLineletInfo::NO_LINELET) && !fine_grid->nodes->GetBoundary(CVPoint) &&
+           (lineInfo->lineletIdx[CVPoint] != iLine);
+  };
+
   /*--- The first step is the boundary agglomeration. ---*/
 
   for (auto iMarker = 0u; iMarker < fine_grid->GetnMarker(); iMarker++) {
@@ -140,7 +160,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
           for (auto CVPoint : fine_grid->nodes->GetPoints(iPoint)) {
             /*--- The new point can be agglomerated ---*/
 
-            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
+            if (!OffLine(iPoint, CVPoint) && SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
               /*--- We set the value of the parent ---*/
 
               fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
@@ -162,7 +182,7 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
           for (auto CVPoint : Suitable_Indirect_Neighbors) {
             /*--- The new point can be agglomerated ---*/
 
-            if (SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
+            if (!OffLine(iPoint, CVPoint) && SetBoundAgglomeration(CVPoint, marker_seed, fine_grid, config)) {
               /*--- We set the value of the parent ---*/
 
               fine_grid->nodes->SetParent_CV(CVPoint, Index_CoarseCV);
@@ -205,6 +225,42 @@ CMultiGridGeometry::CMultiGridGeometry(CGeometry* fine_grid, CConfig* config, un
     }
   }
 
+  /*--- Agglomerate the interior points of the linelets, in groups of consecutive points. ---*/
+
+  if (lineInfo != nullptr) {
+    for (const auto& linelet : lineInfo->linelets) {
+      for (auto iLinePoint = 0ul; iLinePoint < linelet.size();) {
+        /*--- Extend the group while the points can be agglomerated. ---*/
+
+        auto end = iLinePoint;
+        while ((end < linelet.size()) && (end - iLinePoint < lineSize)) {
+          const auto iPoint = linelet[end];
+          if (fine_grid->nodes->GetAgglomerate(iPoint) || !fine_grid->nodes->GetDomain(iPoint) ||
+              !GeometricalCheck(iPoint, fine_grid, config))
+            break;
+          ++end;
+        }
+
+        /*--- Single points are left for the isotropic agglomeration. ---*/
+
+        if (end - iLinePoint > 1) {
+          unsigned short nChildren = 0;
+          for (auto jLinePoint = iLinePoint; jLinePoint < end; ++jLinePoint) {
+            const auto iPoint = linelet[jLinePoint];
+            fine_grid->nodes->SetParent_CV(iPoint, Index_CoarseCV);
+            if (fine_grid->nodes->GetAgglomerate_Indirect(iPoint))
+              nodes->SetAgglomerate_Indirect(Index_CoarseCV, true);
+            nodes->SetChildren_CV(Index_CoarseCV, nChildren, iPoint);
+            nChildren++;
+          }
+          nodes->SetnChildren_CV(Index_CoarseCV, nChildren);
+          Index_CoarseCV++;
+        }
+        iLinePoint = (end == iLinePoint) ? end + 1 : end;
+      }
+    }
+  }
+
   /*--- Update the queue with the results from the boundary agglomeration ---*/
 
   for (auto iPoint = 0ul; iPoint < fine_grid->GetnPoint(); iPoint++) {
@@ -1089,3 +1145,76 @@ void CMultiGridGeometry::FindNormal_Neighbor(const CConfig* config) {
     }
   }
 }
+
+vector<CMultiGridGeometry::AgglomerationStatistics> CMultiGridGeometry::ComputeAgglomerationStatistics(
+    const CGeometry* const* geometry, unsigned short nLevels) {
+  vector<AgglomerationStatistics> stats(nLevels + 1);
+
+  for (auto iMesh = 0u; iMesh <= nLevels; ++iMesh) {
+    const auto* geo = geometry[iMesh];
+    const auto nDim = geo->GetnDim();
+
+    /*--- Same edge weights as used to build the linelets. ---*/
+
+    unsigned long maxChildren = 1, nStretched = 0, nCV = 0;
+    su2double sumAspect = 0.0, maxAspect = 0.0;
+
+    for (auto iPoint = 0ul; iPoint < geo->GetnPointDomain(); ++iPoint) {
+      su2double maxWeight = 0.0, minWeight = std::numeric_limits<su2double>::max();
+      for (auto iNode = 0u; iNode < geo->nodes->GetnPoint(iPoint); iNode++) {
+        const auto jPoint = geo->nodes->GetPoint(iPoint, iNode);
+        const auto iEdge = geo->nodes->GetEdge(iPoint, iNode);
+        const su2double area = GeometryToolbox::Norm(nDim, geo->edges->GetNormal(iEdge));
+        const su2double weight =
+            0.5 * area * (1.0 / geo->nodes->GetVolume(iPoint) + 1.0 / geo->nodes->GetVolume(jPoint));
+        maxWeight = max(maxWeight, weight);
+        minWeight = min(minWeight, weight);
+      }
+      if (maxWeight == 0.0 || minWeight == 0.0) continue;
+
+      const su2double aspect = maxWeight / minWeight;
+      sumAspect += aspect;
+      maxAspect = max(maxAspect, aspect);
+      nStretched += (1.0 / aspect <= CLineletInfo::ALPHA_ISOTROPIC());
+      ++nCV;
+      if (iMesh > 0) maxChildren = max<unsigned long>(maxChildren, geo->nodes->GetnChildren_CV(iPoint));
+    }
+
+    auto& stat = stats[iMesh];
+    su2double globalSum;
+    SU2_MPI::Allreduce(&nCV, &stat.nCV, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&nStretched, &stat.nStretched, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&maxChildren, &stat.maxChildren, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&sumAspect, &globalSum, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    SU2_MPI::Allreduce(&maxAspect, &stat.maxAspect, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    stat.avgAspect = globalSum / max<unsigned long>(stat.nCV, 1);
+  }
+  return stats;
+}
+
+void CMultiGridGeometry::PrintAgglomerationStatistics(const CGeometry* const* geometry, const CConfig* config) {
+  const auto nLevels = config->GetnMGLevels();
+  if (nLevels == 0) return;
+
+  const auto stats = ComputeAgglomerationStatistics(geometry, nLevels);
+  if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+  PrintingToolbox::CTablePrinter StatTable(&std::cout);
+  StatTable.AddColumn("MG Level", 10);
+  StatTable.AddColumn("Max. Child.", 12);
+  StatTable.AddColumn("Avg. Aspect", 12);
+  StatTable.AddColumn("Max. Aspect", 12);
+  StatTable.AddColumn("Stretched", 10);
+  StatTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+
+  cout << "\nAnisotropy of the control volumes (ratio of max. and min. edge weights) of each grid level." << endl;
+  StatTable.PrintHeader();
+
+  for (auto iMesh = 0u; iMesh <= nLevels; ++iMesh) {
+    const auto& stat = stats[iMesh];
+    stringstream ss;
+    ss << std::setprecision(3) << 100.0 * stat.nStretched / max<unsigned long>(stat.nCV, 1) << "%";
+    StatTable << iMesh << stat.maxChildren << stat.avgAspect << stat.maxAspect << ss.str();
+  }
+  StatTable.PrintFooter();
+}
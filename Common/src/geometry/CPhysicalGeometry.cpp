@@ -7674,6 +7674,192 @@ void CPhysicalGeometry::SetBoundTecPlot(char mesh_filename[MAX_STRING_SIZE], boo
   Tecplot_File.close();
 }
 
+namespace {
+/*!
+ * \brief Whether the points of a marker get the partitioning weight of physical boundaries.
+ * \param[in] kindBC - Kind of boundary condition of the marker.
+ */
+bool IsWeightedBoundary(unsigned short kindBC) {
+  return kindBC != SEND_RECEIVE && kindBC != INTERNAL_BOUNDARY && kindBC != NEARFIELD_BOUNDARY &&
+         kindBC != PERIODIC_BOUNDARY;
+}
+
+/*!
+ * \brief Read the measured point weights (pairs of global index and weight) written by a previous run.
+ * \note The master reads the file and sends the weights to the ranks that own the points in a linear partitioning.
+ * \param[in] fileName - Name of the file.
+ * \param[in] partitioner - Linear partitioning of the global points.
+ * \param[in,out] weights - Weights of the points of this rank in the linear partitioning, those not in the file
+ *                 keep their value.
+ */
+template <class Weights>
+void ReadPointWeightsFile(const string& fileName, const CLinearPartitioner& partitioner, Weights& weights) {
+  const int size = SU2_MPI::GetSize(), rank = SU2_MPI::GetRank();
+
+  vector<int> nSend(size, 0), nRecv(size), sendDisp(size, 0), recvDisp(size, 0);
+  vector<long> sendBuf;
+
+  if (rank == MASTER_NODE) {
+    ifstream file(fileName);
+    if (!file.is_open()) {
+      SU2_MPI::Error("Unable to open the point weights file " + fileName, CURRENT_FUNCTION);
+    }
+    const auto nPointGlobal = partitioner.GetLastIndexOnRank(size - 1);
+
+    vector<vector<long> > rankWeights(size);
+    unsigned long iGlobal;
+    long weight;
+    while (file >> iGlobal >> weight) {
+      if (iGlobal >= nPointGlobal) continue;
+      const auto iRank = partitioner.GetRankContainingIndex(iGlobal);
+      rankWeights[iRank].push_back(iGlobal - partitioner.GetFirstIndexOnRank(iRank));
+      rankWeights[iRank].push_back(weight);
+    }
+    for (int iRank = 0; iRank < size; iRank++) {
+      nSend[iRank] = rankWeights[iRank].size();
+      sendDisp[iRank] = sendBuf.size();
+      sendBuf.insert(sendBuf.end(), rankWeights[iRank].begin(), rankWeights[iRank].end());
+    }
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 1; iRank < size; iRank++) recvDisp[iRank] = recvDisp[iRank - 1] + nRecv[iRank - 1];
+
+  vector<long> recvBuf(recvDisp[size - 1] + nRecv[size - 1]);
+  SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDisp.data(), MPI_LONG, recvBuf.data(), nRecv.data(),
+                     recvDisp.data(), MPI_LONG, SU2_MPI::GetComm());
+
+  for (auto i = 0ul; i < recvBuf.size(); i += 2) weights[recvBuf[i]] = max(recvBuf[i + 1], 1l);
+}
+
+#if defined(HAVE_MPI) && defined(HAVE_PARMETIS)
+/*!
+ * \brief Map the parts of a k-way partitioning to ranks such that strongly connected parts are placed on the same
+ *        node, which moves communication from the network to shared memory.
+ * \note The quotient graph (parts connected by the number of cut edges between them) is grouped greedily on the
+ *       master, each group grows by the part most connected to it until the node is full.
+ * \param[in] partitioner - Linear partitioning of the points on which the graph is distributed.
+ * \param[in] xadj, adjacency - Local part of the graph, with global indices.
+ * \param[in] part - Part of each local point.
+ * \param[in] nodeOfRank - Node of each rank.
+ * \param[in] comm - Communicator.
+ * \return Rank to which each part is assigned.
+ */
+vector<int> MapPartsToNodes(const CLinearPartitioner& partitioner, const vector<idx_t>& xadj,
+                            const vector<idx_t>& adjacency, const vector<idx_t>& part,
+                            const vector<int>& nodeOfRank, MPI_Comm comm) {
+  const int size = SU2_MPI::GetSize(), rank = SU2_MPI::GetRank();
+  const auto nPoint = part.size();
+  const auto firstIndex = partitioner.GetFirstIndexOnRank(rank);
+  const auto isLocal = [&](unsigned long iGlobal) { return iGlobal >= firstIndex && iGlobal < firstIndex + nPoint; };
+
+  /*--- Request the parts of the neighbors that are on other ranks. ---*/
+
+  vector<vector<unsigned long> > request(size);
+  for (const auto jGlobal : adjacency) {
+    if (!isLocal(jGlobal)) request[partitioner.GetRankContainingIndex(jGlobal)].push_back(jGlobal);
+  }
+  vector<int> nSend(size), nRecv(size), sendDisp(size, 0), recvDisp(size, 0);
+  vector<unsigned long> sendBuf;
+  for (int iRank = 0; iRank < size; iRank++) {
+    auto& points = request[iRank];
+    sort(points.begin(), points.end());
+    points.erase(unique(points.begin(), points.end()), points.end());
+    nSend[iRank] = points.size();
+    sendDisp[iRank] = sendBuf.size();
+    sendBuf.insert(sendBuf.end(), points.begin(), points.end());
+  }
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, comm);
+  for (int iRank = 1; iRank < size; iRank++) recvDisp[iRank] = recvDisp[iRank - 1] + nRecv[iRank - 1];
+
+  vector<unsigned long> recvBuf(recvDisp[size - 1] + nRecv[size - 1]);
+  SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG, recvBuf.data(), nRecv.data(),
+                     recvDisp.data(), MPI_UNSIGNED_LONG, comm);
+
+  vector<int> reply(recvBuf.size()), remotePart(sendBuf.size());
+  for (auto i = 0ul; i < recvBuf.size(); i++) reply[i] = part[recvBuf[i] - firstIndex];
+  SU2_MPI::Alltoallv(reply.data(), nRecv.data(), recvDisp.data(), MPI_INT, remotePart.data(), nSend.data(),
+                     sendDisp.data(), MPI_INT, comm);
+
+  const auto partOf = [&](unsigned long jGlobal) {
+    if (isLocal(jGlobal)) return int(part[jGlobal - firstIndex]);
+    const auto iRank = partitioner.GetRankContainingIndex(jGlobal);
+    const auto& points = request[iRank];
+    const auto pos = lower_bound(points.begin(), points.end(), jGlobal) - points.begin();
+    return remotePart[sendDisp[iRank] + pos];
+  };
+
+  /*--- Local contribution to the quotient graph, gathered on the master as (part, part, weight). ---*/
+
+  map<pair<int, int>, long> localEdges;
+  for (auto iPoint = 0ul; iPoint < nPoint; iPoint++) {
+    for (auto iEdge = xadj[iPoint]; iEdge < xadj[iPoint + 1]; iEdge++) {
+      const int jPart = partOf(adjacency[iEdge]);
+      if (jPart != part[iPoint]) localEdges[make_pair(int(part[iPoint]), jPart)]++;
+    }
+  }
+  vector<long> edges;
+  edges.reserve(3 * localEdges.size());
+  for (const auto& edge : localEdges) {
+    edges.insert(edges.end(), {edge.first.first, edge.first.second, edge.second});
+  }
+
+  fill(nSend.begin(), nSend.end(), 0);
+  fill(sendDisp.begin(), sendDisp.end(), 0);
+  nSend[MASTER_NODE] = edges.size();
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, comm);
+  for (int iRank = 1; iRank < size; iRank++) recvDisp[iRank] = recvDisp[iRank - 1] + nRecv[iRank - 1];
+
+  vector<long> allEdges(recvDisp[size - 1] + nRecv[size - 1]);
+  SU2_MPI::Alltoallv(edges.data(), nSend.data(), sendDisp.data(), MPI_LONG, allEdges.data(), nRecv.data(),
+                     recvDisp.data(), MPI_LONG, comm);
+
+  vector<int> partToRank(size);
+
+  if (rank == MASTER_NODE) {
+    vector<map<int, long> > graph(size);
+    for (auto i = 0ul; i < allEdges.size(); i += 3) graph[allEdges[i]][allEdges[i + 1]] += allEdges[i + 2];
+
+    const int nNode = *max_element(nodeOfRank.begin(), nodeOfRank.end()) + 1;
+    vector<vector<int> > ranksOfNode(nNode);
+    for (int iRank = 0; iRank < size; iRank++) ranksOfNode[nodeOfRank[iRank]].push_back(iRank);
+
+    /*--- Grow one group per node, starting from the lowest unassigned part. ---*/
+
+    vector<bool> assigned(size, false);
+    vector<long> gain(size);
+
+    for (int iNode = 0; iNode < nNode; iNode++) {
+      fill(gain.begin(), gain.end(), 0);
+      for (const auto iRank : ranksOfNode[iNode]) {
+        int best = -1;
+        for (int iPart = 0; iPart < size; iPart++) {
+          if (!assigned[iPart] && (best < 0 || gain[iPart] > gain[best])) best = iPart;
+        }
+        assigned[best] = true;
+        partToRank[best] = iRank;
+        for (const auto& neighbor : graph[best]) gain[neighbor.first] += neighbor.second;
+      }
+    }
+
+    long cutBefore = 0, cutAfter = 0;
+    for (int iPart = 0; iPart < size; iPart++) {
+      for (const auto& neighbor : graph[iPart]) {
+        const auto jPart = neighbor.first;
+        if (nodeOfRank[iPart] != nodeOfRank[jPart]) cutBefore += neighbor.second;
+        if (nodeOfRank[partToRank[iPart]] != nodeOfRank[partToRank[jPart]]) cutAfter += neighbor.second;
+      }
+    }
+    cout << "Node-aware mapping of the partitions: " << cutBefore / 2 << " -> " << cutAfter / 2
+         << " inter-node edge cuts." << endl;
+  }
+  SU2_MPI::Bcast(partToRank.data(), size, MPI_INT, MASTER_NODE, comm);
+
+  return partToRank;
+}
+#endif
+}  // namespace
+
 void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
   /*--- We need to have parallel support with MPI and have the ParMETIS
    library compiled and linked for parallel graph partitioning. ---*/
@@ -7719,12 +7905,64 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 
   const auto wp = config->GetParMETIS_PointWeight();
   const auto we = config->GetParMETIS_EdgeWeight();
+  const auto wb = config->GetParMETIS_BoundaryWeight();
 
   vector<idx_t> vwgt(nPoint);
   for (unsigned long iPoint = 0; iPoint < nPoint; ++iPoint) {
     vwgt[iPoint] = wp + we * (xadj[iPoint + 1] - xadj[iPoint]);
   }
 
+  /*--- Boundary conditions add work to the points of physical markers. At this stage the master
+   * owns all the markers, it lists their points per rank of the linear partitioning. ---*/
+
+  if (wb != 0) {
+    vector<int> nSend(size, 0), nRecv(size), sendDisp(size, 0), recvDisp(size, 0);
+    vector<unsigned long> sendBuf;
+
+    if (rank == MASTER_NODE) {
+      vector<vector<unsigned long> > rankPoints(size);
+      for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+        if (!IsWeightedBoundary(config->GetMarker_All_KindBC(iMarker))) continue;
+
+        for (unsigned long iElem = 0; iElem < nElem_Bound[iMarker]; iElem++) {
+          for (unsigned short iNode = 0; iNode < bound[iMarker][iElem]->GetnNodes(); iNode++) {
+            const auto iGlobal = bound[iMarker][iElem]->GetNode(iNode);
+            const auto iRank = pointPartitioner.GetRankContainingIndex(iGlobal);
+            rankPoints[iRank].push_back(iGlobal - pointPartitioner.GetFirstIndexOnRank(iRank));
+          }
+        }
+      }
+      for (int iRank = 0; iRank < size; iRank++) {
+        auto& points = rankPoints[iRank];
+        sort(points.begin(), points.end());
+        points.erase(unique(points.begin(), points.end()), points.end());
+        nSend[iRank] = points.size();
+        sendDisp[iRank] = sendBuf.size();
+        sendBuf.insert(sendBuf.end(), points.begin(), points.end());
+      }
+    }
+
+    SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, comm);
+    for (int iRank = 1; iRank < size; iRank++) recvDisp[iRank] = recvDisp[iRank - 1] + nRecv[iRank - 1];
+
+    vector<unsigned long> boundaryPoints(recvDisp[size - 1] + nRecv[size - 1]);
+    SU2_MPI::Alltoallv(sendBuf.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG, boundaryPoints.data(),
+                       nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, comm);
+
+    for (const auto iPoint : boundaryPoints) vwgt[iPoint] += wb;
+  }
+
+  /*--- Weights measured by a previous run (see CDriver::WritePointWeights) replace the model. ---*/
+
+  if (config->GetParMETIS_ReadWeights()) {
+    const auto fileName =
+        config->GetMultizone_FileName(config->GetParMETIS_WeightsFileName(), config->GetiZone(), ".dat");
+
+    if (rank == MASTER_NODE) cout << "Reading the point weights from " << fileName << "." << endl;
+
+    ReadPointWeightsFile(fileName, pointPartitioner, vwgt);
+  }
+
   /*--- Create some structures that ParMETIS needs to output the partitioning. ---*/
 
   idx_t edgecut;
@@ -7741,12 +7979,24 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
     cout << " graph partitioning complete (" << edgecut << " edge cuts)." << endl;
   }
 
+  /*--- With several ranks per node, place the parts that communicate the most on the same node. ---*/
+
+  vector<int> partToRank(size);
+  iota(partToRank.begin(), partToRank.end(), 0);
+
+  if (config->GetParMETIS_NodeAware()) {
+    const auto& nodeOfRanks = GetNodeOfRanks();
+    if (*max_element(nodeOfRanks.begin(), nodeOfRanks.end()) > 0) {
+      partToRank = MapPartsToNodes(pointPartitioner, xadj, adjacency, part, nodeOfRanks, comm);
+    }
+  }
+
   /*--- Store the results of the partitioning (note that this is local
    since each processor is calling ParMETIS in parallel and storing the
    results for its initial piece of the grid. ---*/
 
   for (unsigned long iPoint = 0; iPoint < nPoint; iPoint++) {
-    nodes->SetColor(iPoint, part[iPoint]);
+    nodes->SetColor(iPoint, partToRank[part[iPoint]]);
   }
 
   /*--- Force free the connectivity. ---*/
@@ -7757,6 +8007,121 @@ void CPhysicalGeometry::SetColorGrid_Parallel(const CConfig* config) {
 #endif
 }
 
+vector<long> CPhysicalGeometry::GetPointWeights(const CConfig* config) const {
+  /*--- Same model as SetColorGrid_Parallel, where the neighbors come from the element connectivity. ---*/
+
+  const auto wp = config->GetParMETIS_PointWeight();
+  const auto we = config->GetParMETIS_EdgeWeight();
+  const auto wb = config->GetParMETIS_BoundaryWeight();
+
+  vector<long> weights(nPointDomain);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    weights[iPoint] = wp + we * nodes->GetnPoint(iPoint);
+  }
+
+  /*--- The markers are those of SetColorGrid_Parallel, plus the send-receive markers which are skipped. ---*/
+
+  if (wb != 0) {
+    vector<bool> isBoundary(nPoint, false);
+    for (unsigned short iMarker = 0; iMarker < nMarker; iMarker++) {
+      if (!IsWeightedBoundary(config->GetMarker_All_KindBC(iMarker))) continue;
+      for (unsigned long iVertex = 0; iVertex < nVertex[iMarker]; iVertex++) {
+        isBoundary[vertex[iMarker][iVertex]->GetNode()] = true;
+      }
+    }
+    for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+      if (isBoundary[iPoint]) weights[iPoint] += wb;
+    }
+  }
+
+  if (!config->GetParMETIS_ReadWeights()) return weights;
+
+  /*--- The weights read from file are distributed with a linear partitioning, request those of the points
+   * owned by this rank from the ranks that have them. Points that are not in the file keep the model. ---*/
+
+  const auto fileName =
+      config->GetMultizone_FileName(config->GetParMETIS_WeightsFileName(), config->GetiZone(), ".dat");
+
+  CLinearPartitioner partitioner(Global_nPointDomain, 0);
+  vector<long> linearWeights(partitioner.GetSizeOnRank(rank), 0);
+  ReadPointWeightsFile(fileName, partitioner, linearWeights);
+
+  vector<int> nSend(size, 0), nRecv(size), sendDisp(size, 0), recvDisp(size, 0);
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    nSend[partitioner.GetRankContainingIndex(nodes->GetGlobalIndex(iPoint))]++;
+  }
+  for (int iRank = 1; iRank < size; iRank++) sendDisp[iRank] = sendDisp[iRank - 1] + nSend[iRank - 1];
+
+  vector<unsigned long> request(nPointDomain), requestPoint(nPointDomain);
+  auto position = sendDisp;
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    const auto iGlobal = nodes->GetGlobalIndex(iPoint);
+    const auto pos = position[partitioner.GetRankContainingIndex(iGlobal)]++;
+    request[pos] = iGlobal;
+    requestPoint[pos] = iPoint;
+  }
+
+  SU2_MPI::Alltoall(nSend.data(), 1, MPI_INT, nRecv.data(), 1, MPI_INT, SU2_MPI::GetComm());
+  for (int iRank = 1; iRank < size; iRank++) recvDisp[iRank] = recvDisp[iRank - 1] + nRecv[iRank - 1];
+
+  vector<unsigned long> recvRequest(recvDisp[size - 1] + nRecv[size - 1]);
+  SU2_MPI::Alltoallv(request.data(), nSend.data(), sendDisp.data(), MPI_UNSIGNED_LONG, recvRequest.data(),
+                     nRecv.data(), recvDisp.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+
+  const auto firstIndex = partitioner.GetFirstIndexOnRank(rank);
+  vector<long> reply(recvRequest.size()), replyWeights(nPointDomain);
+  for (auto i = 0ul; i < recvRequest.size(); i++) reply[i] = linearWeights[recvRequest[i] - firstIndex];
+
+  SU2_MPI::Alltoallv(reply.data(), nRecv.data(), recvDisp.data(), MPI_LONG, replyWeights.data(), nSend.data(),
+                     sendDisp.data(), MPI_LONG, SU2_MPI::GetComm());
+
+  for (unsigned long i = 0; i < nPointDomain; i++) {
+    if (replyWeights[i] > 0) weights[requestPoint[i]] = replyWeights[i];
+  }
+  return weights;
+}
+
+void CPhysicalGeometry::WritePointWeights(const CConfig* config, const vector<long>& weights,
+                                          passivedouble scale) const {
+  const auto fileName =
+      config->GetMultizone_FileName(config->GetParMETIS_WeightsFileName(), config->GetiZone(), ".dat");
+
+  stringstream buffer;
+  for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
+    buffer << nodes->GetGlobalIndex(iPoint) << "\t" << max(lround(weights[iPoint] * scale), 1l) << "\n";
+  }
+  const auto text = buffer.str();
+
+#ifdef HAVE_MPI
+  /*--- All ranks write their points at once, at the offset given by the sizes of the lower ranks. ---*/
+
+  unsigned long nBytes = text.size(), offset = 0;
+  vector<unsigned long> allBytes(size);
+  SU2_MPI::Allgather(&nBytes, 1, MPI_UNSIGNED_LONG, allBytes.data(), 1, MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+  for (int iRank = 0; iRank < rank; iRank++) offset += allBytes[iRank];
+
+  if (rank == MASTER_NODE) MPI_File_delete(fileName.c_str(), MPI_INFO_NULL);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  MPI_File fhw;
+  const int ierr =
+      MPI_File_open(SU2_MPI::GetComm(), fileName.c_str(), MPI_MODE_CREATE | MPI_MODE_WRONLY, MPI_INFO_NULL, &fhw);
+  if (ierr != MPI_SUCCESS) {
+    SU2_MPI::Error("Unable to open the point weights file " + fileName, CURRENT_FUNCTION);
+  }
+  MPI_File_write_at_all(fhw, offset, text.data(), int(nBytes), MPI_CHAR, MPI_STATUS_IGNORE);
+  MPI_File_close(&fhw);
+#else
+  ofstream file(fileName);
+  if (!file.is_open()) {
+    SU2_MPI::Error("Unable to open the point weights file " + fileName, CURRENT_FUNCTION);
+  }
+  file << text;
+#endif
+
+  if (rank == MASTER_NODE) cout << "Point weights written to " << fileName << "." << endl;
+}
+
 void CPhysicalGeometry::ComputeMeshQualityStatistics(const CConfig* config) {
   /*--- Resize our vectors for the 3 metrics: orthogonality, aspect
    ratio, and volume ratio. All are vertex-based for the dual CV. ---*/
@@ -811,86 +811,144 @@ su2double* CFreeFormDefBox::GetParametricCoord_Analytical(const su2double* cart_
   return ParamCoord;
 }
 
+void CFreeFormDefBox::SetBasisValues(const su2double* uvw, unsigned short nDeriv) const {
+  const unsigned short lmn[] = {lDegree, mDegree, nDegree};
+
+  for (unsigned short iDir = 0; iDir < 3; iDir++) {
+    for (unsigned short iDeriv = 0; iDeriv <= nDeriv; iDeriv++) {
+      auto& basis = BasisValues[iDir][iDeriv];
+      basis.resize(lmn[iDir] + 1);
+      for (unsigned short iDegree = 0; iDegree <= lmn[iDir]; iDegree++) {
+        if (iDeriv == 0)
+          basis[iDegree] = BlendingFunction[iDir]->GetBasis(iDegree, uvw[iDir]);
+        else
+          basis[iDegree] = BlendingFunction[iDir]->GetDerivative(iDegree, uvw[iDir], iDeriv);
+      }
+    }
+  }
+}
+
 su2double* CFreeFormDefBox::EvalCartesianCoord(su2double* ParamCoord) const {
   unsigned short iDim, iDegree, jDegree, kDegree;
 
+  SetBasisValues(ParamCoord, 0);
+  const auto& Bu = BasisValues[0][0];
+  const auto& Bv = BasisValues[1][0];
+  const auto& Bw = BasisValues[2][0];
+
   for (iDim = 0; iDim < nDim; iDim++) cart_coord[iDim] = 0.0;
 
   for (iDegree = 0; iDegree <= lDegree; iDegree++)
-    for (jDegree = 0; jDegree <= mDegree; jDegree++)
-      for (kDegree = 0; kDegree <= nDegree; kDegree++)
-        for (iDim = 0; iDim < nDim; iDim++) {
-          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim] *
-                              BlendingFunction[0]->GetBasis(iDegree, ParamCoord[0]) *
-                              BlendingFunction[1]->GetBasis(jDegree, ParamCoord[1]) *
-                              BlendingFunction[2]->GetBasis(kDegree, ParamCoord[2]);
-        }
+    for (jDegree = 0; jDegree <= mDegree; jDegree++) {
+      const su2double Buv = Bu[iDegree] * Bv[jDegree];
+      for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double weight = Buv * Bw[kDegree];
+        for (iDim = 0; iDim < nDim; iDim++)
+          cart_coord[iDim] += Coord_Control_Points[iDegree][jDegree][kDegree][iDim] * weight;
+      }
+    }
 
   return cart_coord;
 }
 
-su2double* CFreeFormDefBox::GetFFDGradient(su2double* val_coord, su2double* xyz) {
-  unsigned short iDim, jDim, lmn[3];
+void CFreeFormDefBox::EvalMappingDerivatives(const su2double* uvw, su2double* xyz, su2double dxyz[][3],
+                                             su2double d2xyz[][3][3]) const {
+  unsigned short iDim, iDiff, jDiff, iDegree, jDegree, kDegree;
 
-  /*--- Set the Degree of the spline ---*/
+  SetBasisValues(uvw, 2);
 
-  lmn[0] = lDegree;
-  lmn[1] = mDegree;
-  lmn[2] = nDegree;
+  for (iDim = 0; iDim < nDim; iDim++) {
+    xyz[iDim] = 0.0;
+    for (iDiff = 0; iDiff < 3; iDiff++) {
+      dxyz[iDim][iDiff] = 0.0;
+      for (jDiff = 0; jDiff < 3; jDiff++) d2xyz[iDim][iDiff][jDiff] = 0.0;
+    }
+  }
 
-  for (iDim = 0; iDim < nDim; iDim++) Gradient[iDim] = 0.0;
+  for (iDegree = 0; iDegree <= lDegree; iDegree++) {
+    const su2double Bu[] = {BasisValues[0][0][iDegree], BasisValues[0][1][iDegree], BasisValues[0][2][iDegree]};
 
-  for (iDim = 0; iDim < nDim; iDim++)
-    for (jDim = 0; jDim < nDim; jDim++)
-      Gradient[jDim] += GetDerivative2(val_coord, iDim, xyz, lmn) * GetDerivative3(val_coord, iDim, jDim, lmn);
+    for (jDegree = 0; jDegree <= mDegree; jDegree++) {
+      const su2double Bv[] = {BasisValues[1][0][jDegree], BasisValues[1][1][jDegree], BasisValues[1][2][jDegree]};
 
-  return Gradient;
-}
+      for (kDegree = 0; kDegree <= nDegree; kDegree++) {
+        const su2double Bw[] = {BasisValues[2][0][kDegree], BasisValues[2][1][kDegree], BasisValues[2][2][kDegree]};
 
-void CFreeFormDefBox::GetFFDHessian(su2double* uvw, su2double* xyz, su2double** val_Hessian) {
-  unsigned short iDim, jDim, lmn[3];
+        /*--- Weights of this control point in X and in its derivatives (upper triangle of the second ones). ---*/
 
-  /*--- Set the Degree of the spline ---*/
+        const su2double w = Bu[0] * Bv[0] * Bw[0];
+        const su2double dw[] = {Bu[1] * Bv[0] * Bw[0], Bu[0] * Bv[1] * Bw[0], Bu[0] * Bv[0] * Bw[1]};
+        const su2double d2w[3][3] = {{Bu[2] * Bv[0] * Bw[0], Bu[1] * Bv[1] * Bw[0], Bu[1] * Bv[0] * Bw[1]},
+                                     {0.0, Bu[0] * Bv[2] * Bw[0], Bu[0] * Bv[1] * Bw[1]},
+                                     {0.0, 0.0, Bu[0] * Bv[0] * Bw[2]}};
 
-  lmn[0] = lDegree;
-  lmn[1] = mDegree;
-  lmn[2] = nDegree;
+        const su2double* P = Coord_Control_Points[iDegree][jDegree][kDegree];
+
+        for (iDim = 0; iDim < nDim; iDim++) {
+          xyz[iDim] += P[iDim] * w;
+          for (iDiff = 0; iDiff < 3; iDiff++) {
+            dxyz[iDim][iDiff] += P[iDim] * dw[iDiff];
+            for (jDiff = iDiff; jDiff < 3; jDiff++) d2xyz[iDim][iDiff][jDiff] += P[iDim] * d2w[iDiff][jDiff];
+          }
+        }
+      }
+    }
+  }
+
+  /*--- The mapping is C^infinity, the second derivatives are symmetric. ---*/
 
   for (iDim = 0; iDim < nDim; iDim++)
-    for (jDim = 0; jDim < nDim; jDim++) val_Hessian[iDim][jDim] = 0.0;
+    for (iDiff = 1; iDiff < 3; iDiff++)
+      for (jDiff = 0; jDiff < iDiff; jDiff++) d2xyz[iDim][iDiff][jDiff] = d2xyz[iDim][jDiff][iDiff];
+}
+
+void CFreeFormDefBox::GetFFDGradientHessian(const su2double* uvw, const su2double* xyz, su2double* gradient,
+                                            su2double hessian[][3]) const {
+  unsigned short iDim, iDiff, jDiff;
+  su2double X[3] = {0.0}, dX[3][3], d2X[3][3][3];
 
-  /*--- Note that being all the functions linear combinations of polynomials, they are C^\infty,
-   and the Hessian will be symmetric; no need to compute the under-diagonal part, for example ---*/
+  EvalMappingDerivatives(uvw, X, dX, d2X);
+
+  for (iDiff = 0; iDiff < 3; iDiff++) {
+    gradient[iDiff] = 0.0;
+    for (jDiff = 0; jDiff < 3; jDiff++) hessian[iDiff][jDiff] = 0.0;
+  }
+
+  /*--- F = sum_dim (X_dim - xyz_dim)^2, hence dF/du_a = sum_dim 2 (X_dim - xyz_dim) dX_dim/du_a, and
+   d2F/du_a du_b = sum_dim 2 dX_dim/du_a dX_dim/du_b + 2 (X_dim - xyz_dim) d2X_dim/du_a du_b. ---*/
 
   for (iDim = 0; iDim < nDim; iDim++) {
-    val_Hessian[0][0] += 2.0 * GetDerivative3(uvw, iDim, 0, lmn) * GetDerivative3(uvw, iDim, 0, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 0, 0, lmn);
+    const su2double residual = 2.0 * (X[iDim] - xyz[iDim]);
+    for (iDiff = 0; iDiff < 3; iDiff++) {
+      gradient[iDiff] += residual * dX[iDim][iDiff];
+      for (jDiff = 0; jDiff < 3; jDiff++)
+        hessian[iDiff][jDiff] += 2.0 * dX[iDim][iDiff] * dX[iDim][jDiff] + residual * d2X[iDim][iDiff][jDiff];
+    }
+  }
+}
 
-    val_Hessian[1][1] += 2.0 * GetDerivative3(uvw, iDim, 1, lmn) * GetDerivative3(uvw, iDim, 1, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 1, 1, lmn);
+su2double* CFreeFormDefBox::GetFFDGradient(su2double* val_coord, su2double* xyz) {
+  su2double hessian[3][3];
 
-    val_Hessian[2][2] += 2.0 * GetDerivative3(uvw, iDim, 2, lmn) * GetDerivative3(uvw, iDim, 2, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 2, 2, lmn);
+  GetFFDGradientHessian(val_coord, xyz, Gradient, hessian);
 
-    val_Hessian[0][1] += 2.0 * GetDerivative3(uvw, iDim, 0, lmn) * GetDerivative3(uvw, iDim, 1, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 0, 1, lmn);
+  return Gradient;
+}
 
-    val_Hessian[0][2] += 2.0 * GetDerivative3(uvw, iDim, 0, lmn) * GetDerivative3(uvw, iDim, 2, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 0, 2, lmn);
+void CFreeFormDefBox::GetFFDHessian(su2double* uvw, su2double* xyz, su2double** val_Hessian) {
+  unsigned short iDim, jDim;
+  su2double gradient[3], hessian[3][3];
 
-    val_Hessian[1][2] += 2.0 * GetDerivative3(uvw, iDim, 1, lmn) * GetDerivative3(uvw, iDim, 2, lmn) +
-                         GetDerivative2(uvw, iDim, xyz, lmn) * GetDerivative5(uvw, iDim, 1, 2, lmn);
-  }
+  GetFFDGradientHessian(uvw, xyz, gradient, hessian);
 
-  val_Hessian[1][0] = val_Hessian[0][1];
-  val_Hessian[2][0] = val_Hessian[0][2];
-  val_Hessian[2][1] = val_Hessian[1][2];
+  for (iDim = 0; iDim < nDim; iDim++)
+    for (jDim = 0; jDim < nDim; jDim++) val_Hessian[iDim][jDim] = hessian[iDim][jDim];
 }
 
 su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, su2double* xyz,
                                                          const su2double* ParamCoordGuess, CConfig* config) {
-  su2double *IndepTerm, SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3],
-                        Temp[3] = {0.0, 0.0, 0.0};
+  su2double SOR_Factor = 1.0, MinNormError, NormError, Determinant, AdjHessian[3][3], Temp[3] = {0.0, 0.0, 0.0};
+  su2double IndepTerm[3] = {0.0, 0.0, 0.0}, Grad[3], Hessian[3][3];
   unsigned short iDim, jDim, RandonCounter;
   unsigned long iter;
 
@@ -898,15 +956,7 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   unsigned short it_max = config->GetnFFD_Iter();
   unsigned short Random_Trials = 500;
 
-  /*--- Allocate the Hessian ---*/
-
-  Hessian = new su2double*[nDim];
-  IndepTerm = new su2double[nDim];
-  for (iDim = 0; iDim < nDim; iDim++) {
-    Hessian[iDim] = new su2double[nDim];
-    ParamCoord[iDim] = ParamCoordGuess[iDim];
-    IndepTerm[iDim] = 0.0;
-  }
+  for (iDim = 0; iDim < nDim; iDim++) ParamCoord[iDim] = ParamCoordGuess[iDim];
 
   RandonCounter = 0;
   MinNormError = 1E6;
@@ -914,15 +964,12 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
   /*--- External iteration ---*/
 
   for (iter = 0; iter < (unsigned long)it_max * Random_Trials; iter++) {
-    /*--- The independent term of the solution of our system is -Gradient(sol_old) ---*/
-
-    Gradient = GetFFDGradient(ParamCoord, xyz);
+    /*--- Gradient and Hessian (the matrix of our system) from a single evaluation of the mapping,
+     the independent term of the solution of our system is -Gradient(sol_old) ---*/
 
-    for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = -Gradient[iDim];
+    GetFFDGradientHessian(ParamCoord, xyz, Grad, Hessian);
 
-    /*--- Hessian = The Matrix of our system, getHessian(sol_old,xyz,...) ---*/
-
-    GetFFDHessian(ParamCoord, xyz, Hessian);
+    for (iDim = 0; iDim < nDim; iDim++) IndepTerm[iDim] = -Grad[iDim];
 
     /*--- Adjoint to Hessian ---*/
 
@@ -1000,10 +1047,6 @@ su2double* CFreeFormDefBox::GetParametricCoord_Iterative(unsigned long iPoint, s
     }
   }
 
-  for (iDim = 0; iDim < nDim; iDim++) delete[] Hessian[iDim];
-  delete[] Hessian;
-  delete[] IndepTerm;
-
   /*--- The code has hit the max number of iterations ---*/
 
   if (iter == (unsigned long)it_max * Random_Trials) {
@@ -1055,96 +1098,3 @@ bool CFreeFormDefBox::CheckPointInsideFFD(const su2double* coord) const {
   }
   return true;
 }
-
-su2double CFreeFormDefBox::GetDerivative1(su2double* uvw, unsigned short val_diff, unsigned short* ijk,
-                                          unsigned short* lmn) const {
-  unsigned short iDim;
-  su2double value = 0.0;
-
-  value = BlendingFunction[val_diff]->GetDerivative(ijk[val_diff], uvw[val_diff], 1);
-  for (iDim = 0; iDim < nDim; iDim++)
-    if (iDim != val_diff) value *= BlendingFunction[iDim]->GetBasis(ijk[iDim], uvw[iDim]);
-
-  return value;
-}
-
-su2double CFreeFormDefBox::GetDerivative2(su2double* uvw, unsigned short dim, const su2double* xyz,
-                                          const unsigned short* lmn) const {
-  unsigned short iDegree, jDegree, kDegree;
-  su2double value = 0.0;
-
-  for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
-    for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
-      for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
-        value += Coord_Control_Points[iDegree][jDegree][kDegree][dim] * BlendingFunction[0]->GetBasis(iDegree, uvw[0]) *
-                 BlendingFunction[1]->GetBasis(jDegree, uvw[1]) * BlendingFunction[2]->GetBasis(kDegree, uvw[2]);
-      }
-
-  return 2.0 * (value - xyz[dim]);
-}
-
-su2double CFreeFormDefBox::GetDerivative3(su2double* uvw, unsigned short dim, unsigned short diff_this,
-                                          unsigned short* lmn) const {
-  unsigned short iDegree, jDegree, kDegree, iDim;
-  su2double value = 0;
-
-  auto* ijk = new unsigned short[nDim];
-
-  for (iDim = 0; iDim < nDim; iDim++) ijk[iDim] = 0;
-
-  for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
-    for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
-      for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
-        ijk[0] = iDegree;
-        ijk[1] = jDegree;
-        ijk[2] = kDegree;
-        value += Coord_Control_Points[iDegree][jDegree][kDegree][dim] * GetDerivative1(uvw, diff_this, ijk, lmn);
-      }
-
-  delete[] ijk;
-
-  return value;
-}
-
-su2double CFreeFormDefBox::GetDerivative4(su2double* uvw, unsigned short val_diff, unsigned short val_diff2,
-                                          unsigned short* ijk, unsigned short* lmn) const {
-  unsigned short iDim;
-  su2double value = 0.0;
-
-  if (val_diff == val_diff2) {
-    value = BlendingFunction[val_diff]->GetDerivative(ijk[val_diff], uvw[val_diff], 2);
-    for (iDim = 0; iDim < nDim; iDim++)
-      if (iDim != val_diff) value *= BlendingFunction[iDim]->GetBasis(ijk[iDim], uvw[iDim]);
-  } else {
-    value = BlendingFunction[val_diff]->GetDerivative(ijk[val_diff], uvw[val_diff], 1) *
-            BlendingFunction[val_diff2]->GetDerivative(ijk[val_diff2], uvw[val_diff2], 1);
-    for (iDim = 0; iDim < nDim; iDim++)
-      if ((iDim != val_diff) && (iDim != val_diff2)) value *= BlendingFunction[iDim]->GetBasis(ijk[iDim], uvw[iDim]);
-  }
-
-  return value;
-}
-
-su2double CFreeFormDefBox::GetDerivative5(su2double* uvw, unsigned short dim, unsigned short diff_this,
-                                          unsigned short diff_this_also, unsigned short* lmn) const {
-  unsigned short iDegree, jDegree, kDegree, iDim;
-  su2double value = 0.0;
-
-  auto* ijk = new unsigned short[nDim];
-
-  for (iDim = 0; iDim < nDim; iDim++) ijk[iDim] = 0;
-
-  for (iDegree = 0; iDegree <= lmn[0]; iDegree++)
-    for (jDegree = 0; jDegree <= lmn[1]; jDegree++)
-      for (kDegree = 0; kDegree <= lmn[2]; kDegree++) {
-        ijk[0] = iDegree;
-        ijk[1] = jDegree;
-        ijk[2] = kDegree;
-        value += Coord_Control_Points[iDegree][jDegree][kDegree][dim] *
-                 GetDerivative4(uvw, diff_this, diff_this_also, ijk, lmn);
-      }
-
-  delete[] ijk;
-
-  return value;
-}
@@ -28,6 +28,7 @@
 #include "../../include/interface_interpolation/CInterpolator.hpp"
 
 #include <set>
+#include <unordered_map>
 
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
@@ -59,6 +60,153 @@ bool CInterpolator::CheckZonesInterface(const CConfig* donor, const CConfig* tar
   return false;
 }
 
+void CInterpolator::SetTransferPattern(const CConfig* const* config) {
+  const unsigned short nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
+
+  transferPattern.clear();
+  transferPattern.resize(nMarkerInt);
+
+  for (auto iMarkerInt = 0u; iMarkerInt < nMarkerInt; iMarkerInt++) {
+    const auto markDonor = config[donorZone]->FindInterfaceMarker(iMarkerInt);
+    const auto markTarget = config[targetZone]->FindInterfaceMarker(iMarkerInt);
+
+    if (!CheckInterfaceBoundary(markDonor, markTarget)) continue;
+
+    auto& pattern = transferPattern[iMarkerInt];
+    bool consistent = true;
+
+    /*--- Donors (global index) needed by the target vertices of this rank, by owner rank. ---*/
+
+    vector<vector<unsigned long> > needed(size);
+
+    if (markTarget >= 0) {
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+        const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+        const auto& targetVertex = targetVertices[markTarget][iVertex];
+        for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); ++iDonor) {
+          const auto proc = targetVertex.processor[iDonor];
+          if (proc < 0 || proc >= size) {
+            consistent = false;
+            continue;
+          }
+          needed[proc].push_back(targetVertex.globalPoint[iDonor]);
+        }
+      }
+    }
+    for (auto& donors : needed) {
+      sort(donors.begin(), donors.end());
+      donors.erase(unique(donors.begin(), donors.end()), donors.end());
+    }
+
+    /*--- Let the owners know how many donors they need to send. ---*/
+
+    vector<int> nRecv(size), nSend(size);
+    for (int iRank = 0; iRank < size; ++iRank) nRecv[iRank] = needed[iRank].size();
+
+    SU2_MPI::Alltoall(nRecv.data(), 1, MPI_INT, nSend.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+    vector<int> recvSlot(size, -1);
+    pattern.recvStart.assign(1, 0);
+    pattern.sendStart.assign(1, 0);
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      if (nRecv[iRank] > 0) {
+        recvSlot[iRank] = pattern.recvRank.size();
+        pattern.recvRank.push_back(iRank);
+        pattern.recvStart.push_back(pattern.recvStart.back() + nRecv[iRank]);
+      }
+      if (nSend[iRank] > 0) {
+        pattern.sendRank.push_back(iRank);
+        pattern.sendStart.push_back(pattern.sendStart.back() + nSend[iRank]);
+      }
+    }
+
+    /*--- Send the list of donors to their owners (the rank itself is handled by copy). ---*/
+
+    vector<unsigned long> requested(pattern.sendStart.back());
+
+    for (auto iSend = 0ul; iSend < pattern.sendRank.size(); ++iSend) {
+      if (pattern.sendRank[iSend] == rank)
+        copy(needed[rank].begin(), needed[rank].end(), &requested[pattern.sendStart[iSend]]);
+    }
+#ifdef HAVE_MPI
+    vector<SU2_MPI::Request> requests;
+    requests.reserve(pattern.sendRank.size() + pattern.recvRank.size());
+
+    for (auto iSend = 0ul; iSend < pattern.sendRank.size(); ++iSend) {
+      const auto iRank = pattern.sendRank[iSend];
+      if (iRank == rank) continue;
+      requests.emplace_back();
+      SU2_MPI::Irecv(&requested[pattern.sendStart[iSend]], nSend[iRank], MPI_UNSIGNED_LONG, iRank, 0,
+                     SU2_MPI::GetComm(), &requests.back());
+    }
+    for (const auto iRank : pattern.recvRank) {
+      if (iRank == rank) continue;
+      requests.emplace_back();
+      SU2_MPI::Isend(needed[iRank].data(), nRecv[iRank], MPI_UNSIGNED_LONG, iRank, 0, SU2_MPI::GetComm(),
+                     &requests.back());
+    }
+    SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
+
+    /*--- Map the requested donors to the vertices of the donor marker. ---*/
+
+    unordered_map<unsigned long, unsigned long> globalToVertex;
+    if (markDonor >= 0) {
+      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+        if (donor_geometry->nodes->GetDomain(iPoint))
+          globalToVertex[donor_geometry->nodes->GetGlobalIndex(iPoint)] = iVertex;
+      }
+    }
+    pattern.sendVertex.resize(requested.size());
+
+    for (auto iSend = 0ul; iSend < requested.size(); ++iSend) {
+      const auto it = globalToVertex.find(requested[iSend]);
+      if (it == globalToVertex.end()) {
+        consistent = false;
+        break;
+      }
+      pattern.sendVertex[iSend] = it->second;
+    }
+
+    /*--- Position of each donor of the target vertices in the received data. ---*/
+
+    if (markTarget >= 0) {
+      pattern.donorIndex.resize(target_geometry->GetnVertex(markTarget));
+
+      for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
+        const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+        if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+        const auto& targetVertex = targetVertices[markTarget][iVertex];
+        pattern.donorIndex[iVertex].resize(targetVertex.nDonor());
+
+        for (auto iDonor = 0ul; iDonor < targetVertex.nDonor(); ++iDonor) {
+          const auto proc = targetVertex.processor[iDonor];
+          if (proc < 0 || proc >= size) continue;
+          const auto& donors = needed[proc];
+          const auto pos = lower_bound(donors.begin(), donors.end(), targetVertex.globalPoint[iDonor]) - donors.begin();
+          pattern.donorIndex[iVertex][iDonor] = pattern.recvStart[recvSlot[proc]] + pos;
+        }
+      }
+    }
+
+    /*--- Discard the pattern if any donor was not where it was expected. ---*/
+
+    int localValid = consistent, globalValid = 0;
+    SU2_MPI::Allreduce(&localValid, &globalValid, 1, MPI_INT, MPI_MIN, SU2_MPI::GetComm());
+
+    if (globalValid) {
+      pattern.valid = true;
+    } else {
+      pattern = CTransferPattern();
+    }
+  }
+}
+
 void CInterpolator::Determine_ArraySize(int markDonor, int markTarget, unsigned long nVertexDonor,
                                         unsigned short nDim) {
   /*--- Count donor vertices. ---*/
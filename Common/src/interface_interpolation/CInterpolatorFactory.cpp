@@ -80,6 +80,8 @@ CInterpolator* CreateInterpolator(CGeometry**** geometry_container, const CConfi
     }
   }
 
+  interpolator->SetTransferPattern(config);
+
   if (verbose) interpolator->PrintStatistics();
 
   return interpolator;
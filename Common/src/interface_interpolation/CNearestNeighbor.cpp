@@ -27,9 +27,37 @@
 
 #include "../../include/interface_interpolation/CNearestNeighbor.hpp"
 #include "../../include/CConfig.hpp"
+#include "../../include/adt/CADTPointsOnlyClass.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
 
+namespace {
+/*--- Send a variable amount of data to each rank, the received data is concatenated by source rank. ---*/
+template <class T>
+void ExchangeData(const vector<vector<T> >& sendData, SU2_MPI::Datatype type, vector<T>& recvData,
+                  vector<int>& recvStart) {
+  const int size = sendData.size();
+  vector<int> sendCount(size), recvCount(size), sendStart(size + 1, 0);
+
+  for (int iRank = 0; iRank < size; ++iRank) {
+    sendCount[iRank] = sendData[iRank].size();
+    sendStart[iRank + 1] = sendStart[iRank] + sendCount[iRank];
+  }
+  SU2_MPI::Alltoall(sendCount.data(), 1, MPI_INT, recvCount.data(), 1, MPI_INT, SU2_MPI::GetComm());
+
+  recvStart.assign(size + 1, 0);
+  for (int iRank = 0; iRank < size; ++iRank) recvStart[iRank + 1] = recvStart[iRank] + recvCount[iRank];
+
+  vector<T> sendBuffer(sendStart.back());
+  for (int iRank = 0; iRank < size; ++iRank)
+    copy(sendData[iRank].begin(), sendData[iRank].end(), sendBuffer.begin() + sendStart[iRank]);
+
+  recvData.resize(recvStart.back());
+  SU2_MPI::Alltoallv(sendBuffer.data(), sendCount.data(), sendStart.data(), type, recvData.data(), recvCount.data(),
+                     recvStart.data(), type, SU2_MPI::GetComm());
+}
+}  // namespace
+
 CNearestNeighbor::CNearestNeighbor(CGeometry**** geometry_container, const CConfig* const* config, unsigned int iZone,
                                    unsigned int jZone)
     : CInterpolator(geometry_container, config, iZone, jZone) {
@@ -45,9 +73,6 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
   /*--- Desired number of donor points. ---*/
   const auto nDonor = max<unsigned long>(config[donorZone]->GetNumNearestNeighbors(), 1);
 
-  /*--- Epsilon used to avoid division by zero. ---*/
-  const su2double eps = numeric_limits<passivedouble>::epsilon();
-
   const int nProcessor = size;
   const auto nMarkerInt = config[donorZone]->GetMarker_n_ZoneInterface() / 2;
   const auto nDim = donor_geometry->GetnDim();
@@ -77,6 +102,12 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
     if (markDonor != -1) nVertexDonor = donor_geometry->GetnVertex(markDonor);
     if (markTarget != -1) nVertexTarget = target_geometry->GetnVertex(markTarget);
 
+    if (config[donorZone]->GetDistributedDonorSearch()) {
+      if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
+      SetTransferCoeffDistributed(markDonor, markTarget, nDonor, totalTargetPoints);
+      continue;
+    }
+
     /*--- Sets MaxLocalVertex_Donor, Buffer_Receive_nVertex_Donor. ---*/
     Determine_ArraySize(markDonor, markTarget, nVertexDonor, nDim);
     if (nVertexTarget) targetVertices[markTarget].resize(nVertexTarget);
@@ -123,34 +154,13 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
           }
         }
 
-        /*--- Find k closest points. ---*/
-        partial_sort(donorInfo.begin(), donorInfo.begin() + nDonor, donorInfo.end(),
-                     [](const DonorInfo& a, const DonorInfo& b) {
-                       /*--- Global index is used as tie-breaker to make sorted order independent of initial. ---*/
-                       return (a.dist != b.dist) ? (a.dist < b.dist) : (a.pidx < b.pidx);
-                     });
+        /*--- Find k closest points and set the interpolation coefficients. ---*/
+        const su2double d = SetTargetDonors(nDonor, donorInfo, target_vertex);
 
         /*--- Update stats. ---*/
         numTarget += 1;
-        su2double d = sqrt(donorInfo[0].dist);
         avgDist += d;
         maxDist = max(maxDist, d);
-
-        /*--- Compute interpolation numerators and denominator. ---*/
-        su2double denom = 0.0;
-        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-          donorInfo[iDonor].dist = 1.0 / (donorInfo[iDonor].dist + eps);
-          denom += donorInfo[iDonor].dist;
-        }
-
-        /*--- Set interpolation coefficients. ---*/
-        target_vertex.resize(nDonor);
-
-        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
-          target_vertex.globalPoint[iDonor] = donorInfo[iDonor].pidx;
-          target_vertex.processor[iDonor] = donorInfo[iDonor].proc;
-          target_vertex.coefficient[iDonor] = donorInfo[iDonor].dist / denom;
-        }
       }
       END_SU2_OMP_FOR
       SU2_OMP_CRITICAL {
@@ -172,3 +182,208 @@ void CNearestNeighbor::SetTransferCoeff(const CConfig* const* config) {
   SU2_MPI::Allreduce(&tmp2, &MaxDistance, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
   AvgDistance /= totalTargetPoints;
 }
+
+su2double CNearestNeighbor::SetTargetDonors(unsigned long nDonor, vector<DonorInfo>& donorInfo,
+                                            CDonorInfo& targetVertex) {
+  /*--- Epsilon used to avoid division by zero. ---*/
+  const su2double eps = numeric_limits<passivedouble>::epsilon();
+
+  nDonor = min<unsigned long>(nDonor, donorInfo.size());
+
+  /*--- Find k closest points. ---*/
+  partial_sort(donorInfo.begin(), donorInfo.begin() + nDonor, donorInfo.end());
+
+  const su2double closest = sqrt(donorInfo[0].dist);
+
+  /*--- Compute interpolation numerators and denominator. ---*/
+  su2double denom = 0.0;
+  for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+    donorInfo[iDonor].dist = 1.0 / (donorInfo[iDonor].dist + eps);
+    denom += donorInfo[iDonor].dist;
+  }
+
+  /*--- Set interpolation coefficients. ---*/
+  targetVertex.resize(nDonor);
+
+  for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+    targetVertex.globalPoint[iDonor] = donorInfo[iDonor].pidx;
+    targetVertex.processor[iDonor] = donorInfo[iDonor].proc;
+    targetVertex.coefficient[iDonor] = donorInfo[iDonor].dist / denom;
+  }
+  return closest;
+}
+
+void CNearestNeighbor::SetTransferCoeffDistributed(int markDonor, int markTarget, unsigned long nDonor,
+                                                   unsigned long& numTarget) {
+  const auto nDim = donor_geometry->GetnDim();
+  const auto invalid = numeric_limits<unsigned long>::max();
+
+  /*--- Donor points owned by this rank. ---*/
+
+  vector<unsigned long> donorPoint;
+  vector<su2double> donorCoord;
+
+  if (markDonor != -1) {
+    for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); ++iVertex) {
+      const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      if (!donor_geometry->nodes->GetDomain(iPoint)) continue;
+
+      donorPoint.push_back(donor_geometry->nodes->GetGlobalIndex(iPoint));
+      for (auto iDim = 0u; iDim < nDim; ++iDim) donorCoord.push_back(donor_geometry->nodes->GetCoord(iPoint, iDim));
+    }
+  }
+
+  /*--- Local ADT of the donors, their IDs are the global indices to break ties as the global search. ---*/
+
+  CADTPointsOnlyClass donorTree(nDim, donorPoint.size(), donorCoord.data(), donorPoint.data(), false);
+
+  /*--- A global ADT of a sample of the donors of each rank finds the ranks that may have donors close to a
+   * target, every donor is within coverDist of a sample of its rank. The sample is a small fixed number of
+   * donors per rank, the memory does not depend on the size of the interface. ---*/
+
+  constexpr unsigned long maxSampleDonor = 32;
+  const auto nLocalDonor = donorPoint.size();
+  const auto stride = max<unsigned long>(roundUpDiv(nLocalDonor, maxSampleDonor), 1);
+
+  vector<unsigned long> sampleID;
+  vector<su2double> sampleCoord;
+  for (auto iDonor = 0ul; iDonor < nLocalDonor; iDonor += stride) {
+    sampleID.push_back(sampleID.size());
+    sampleCoord.insert(sampleCoord.end(), donorCoord.data() + iDonor * nDim, donorCoord.data() + (iDonor + 1) * nDim);
+  }
+
+  su2double coverDist = 0.0;
+  if (nLocalDonor > 0) {
+    CADTPointsOnlyClass localSampleTree(nDim, sampleID.size(), sampleCoord.data(), sampleID.data(), false);
+    for (auto iDonor = 0ul; iDonor < nLocalDonor; ++iDonor) {
+      su2double dist;
+      unsigned long sample;
+      int sampleRank;
+      localSampleTree.DetermineNearestNode(&donorCoord[iDonor * nDim], dist, sample, sampleRank);
+      coverDist = max(coverDist, dist);
+    }
+  }
+  su2double maxCoverDist = 0.0;
+  SU2_MPI::Allreduce(&coverDist, &maxCoverDist, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  CADTPointsOnlyClass sampleTree(nDim, sampleID.size(), sampleCoord.data(), sampleID.data(), true);
+  if (sampleTree.IsEmpty()) return;
+
+  /*--- Target points owned by this rank. ---*/
+
+  vector<unsigned long> targetVertex;
+  vector<const su2double*> targetCoord;
+
+  if (markTarget != -1) {
+    for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); ++iVertex) {
+      const auto iPoint = target_geometry->vertex[markTarget][iVertex]->GetNode();
+      if (!target_geometry->nodes->GetDomain(iPoint)) continue;
+
+      targetVertex.push_back(iVertex);
+      targetCoord.push_back(target_geometry->nodes->GetCoord(iPoint));
+    }
+  }
+  const auto nTarget = targetVertex.size();
+
+  vector<vector<DonorInfo> > candidates(nTarget);
+
+  /*--- Send the targets to the ranks in their query lists, each rank returns its k closest donors to each target
+   * (padded with invalid indices if it does not have enough) which are added to the candidates of the target. ---*/
+
+  auto SearchRound = [&](const vector<vector<unsigned long> >& query) {
+    vector<vector<su2double> > sendCoord(size);
+    for (int iRank = 0; iRank < size; ++iRank)
+      for (const auto iTarget : query[iRank])
+        sendCoord[iRank].insert(sendCoord[iRank].end(), targetCoord[iTarget], targetCoord[iTarget] + nDim);
+
+    vector<su2double> recvCoord;
+    vector<int> recvStart;
+    ExchangeData(sendCoord, MPI_DOUBLE, recvCoord, recvStart);
+
+    /*--- Closest local donors of the received targets. ---*/
+
+    vector<vector<su2double> > sendDist(size);
+    vector<vector<unsigned long> > sendPoint(size);
+    vector<su2double> dist2;
+    vector<unsigned long> point;
+    vector<int> pointRank;
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      for (auto iCoord = recvStart[iRank]; iCoord < recvStart[iRank + 1]; iCoord += nDim) {
+        donorTree.DetermineNearestNodes(&recvCoord[iCoord], nDonor, dist2, point, pointRank);
+
+        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor) {
+          sendDist[iRank].push_back(iDonor < point.size() ? dist2[iDonor] : su2double(0.0));
+          sendPoint[iRank].push_back(iDonor < point.size() ? point[iDonor] : invalid);
+        }
+      }
+    }
+
+    /*--- Return the results, they arrive in the order of the queries. ---*/
+
+    vector<su2double> recvDist;
+    vector<unsigned long> recvPoint;
+    ExchangeData(sendDist, MPI_DOUBLE, recvDist, recvStart);
+    ExchangeData(sendPoint, MPI_UNSIGNED_LONG, recvPoint, recvStart);
+
+    for (int iRank = 0; iRank < size; ++iRank) {
+      auto idx = recvStart[iRank];
+      for (const auto iTarget : query[iRank]) {
+        for (auto iDonor = 0ul; iDonor < nDonor; ++iDonor, ++idx) {
+          if (recvPoint[idx] != invalid) candidates[iTarget].emplace_back(recvDist[idx], recvPoint[idx], iRank);
+        }
+      }
+    }
+  };
+
+  /*--- First round, the rank of the closest sample. ---*/
+
+  vector<int> firstRank(nTarget);
+  vector<vector<unsigned long> > query(size);
+
+  for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget) {
+    su2double dist;
+    unsigned long sample;
+    sampleTree.DetermineNearestNode(targetCoord[iTarget], dist, sample, firstRank[iTarget]);
+    query[firstRank[iTarget]].push_back(iTarget);
+  }
+  SearchRound(query);
+
+  /*--- Second round, the other ranks that may have donors closer than the k-th candidate, i.e. with samples
+   * closer than that plus the cover distance (with a margin for round-off). This makes the result the same
+   * as that of the global search. ---*/
+
+  for (auto& targets : query) targets.clear();
+  vector<unsigned long> samples;
+  vector<int> sampleRanks;
+
+  for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget) {
+    auto& candidate = candidates[iTarget];
+
+    su2double radius = numeric_limits<passivedouble>::max();
+    if (candidate.size() >= nDonor) {
+      nth_element(candidate.begin(), candidate.begin() + nDonor - 1, candidate.end());
+      radius = (sqrt(candidate[nDonor - 1].dist) + maxCoverDist) * (1 + 1e-12);
+    }
+    sampleTree.DetermineNodesWithinDistance(targetCoord[iTarget], radius, samples, sampleRanks);
+
+    sort(sampleRanks.begin(), sampleRanks.end());
+    sampleRanks.erase(unique(sampleRanks.begin(), sampleRanks.end()), sampleRanks.end());
+
+    for (const auto iRank : sampleRanks)
+      if (iRank != firstRank[iTarget]) query[iRank].push_back(iTarget);
+  }
+  SearchRound(query);
+
+  /*--- Select the closest donors among the candidates. ---*/
+
+  for (auto iTarget = 0ul; iTarget < nTarget; ++iTarget) {
+    if (candidates[iTarget].empty()) continue;
+
+    const su2double d = SetTargetDonors(nDonor, candidates[iTarget], targetVertices[markTarget][targetVertex[iTarget]]);
+
+    numTarget += 1;
+    AvgDistance += d;
+    MaxDistance = max(MaxDistance, d);
+  }
+}
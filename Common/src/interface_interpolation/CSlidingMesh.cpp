@@ -29,6 +29,7 @@
 #include "../../include/CConfig.hpp"
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/geometry_toolbox.hpp"
+#include <unordered_map>
 
 CSlidingMesh::CSlidingMesh(CGeometry**** geometry_container, const CConfig* const* config, unsigned int iZone,
                            unsigned int jZone)
@@ -58,7 +59,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
   /* --- Geometrical variables --- */
 
-  su2double *Coord_i, *Coord_j, dist, mindist, *Normal;
+  su2double *Coord_i, *Normal;
   su2double Area, Area_old, tmp_Area;
   su2double LineIntersectionLength, *Direction, length;
 
@@ -101,6 +102,8 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   su2activematrix DonorPoint_Coord;
 
   targetVertices.resize(config[targetZone]->GetnMarker_All());
+  closestDonor.resize(config[targetZone]->GetnMarker_All());
+  closestDonor_nVertex.resize(config[targetZone]->GetnMarker_All(), 0);
 
   /* 1 - Variable pre-processing */
 
@@ -165,6 +168,22 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
     Donor_LinkedNodes = Buffer_Receive_LinkedNodes;
     Donor_Proc = Buffer_Receive_Proc;
 
+    /*--- Position of the target vertices in the reconstructed boundary, and the closest donors of the previous
+     call, which remain valid starting points while the donor boundary is the same. ---*/
+
+    unordered_map<unsigned long, unsigned long> Target_GlobalToIndex;
+    Target_GlobalToIndex.reserve(nGlobalVertex_Target);
+    for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
+      Target_GlobalToIndex.emplace(Target_GlobalPoint[jVertexTarget], jVertexTarget);
+
+    if (markTarget != -1) {
+      auto& guess = closestDonor[markTarget];
+      if (closestDonor_nVertex[markTarget] != nGlobalVertex_Donor || guess.size() != nVertexTarget)
+        guess.assign(nVertexTarget, nGlobalVertex_Donor);
+      closestDonor_nVertex[markTarget] = nGlobalVertex_Donor;
+    }
+    unique_ptr<CADTPointsOnlyClass> donorTree;
+
     /*--- Starts building the supermesh layer (2D or 3D) ---*/
     /* - For each target node, it first finds the closest donor point
      * - Then it creates the supermesh in the close proximity of the target point:
@@ -194,35 +213,19 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         if (target_geometry->nodes->GetDomain(target_iPoint)) {
           Coord_i = target_geometry->nodes->GetCoord(target_iPoint);
 
-          /*--- Brute force to find the closest donor_node ---*/
-
-          mindist = 1E6;
-          donor_StartIndex = 0;
+          /*--- Find the closest donor_node, starting from the one of the previous call ---*/
 
-          for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-            Coord_j = DonorPoint_Coord[donor_iPoint];
-
-            dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-            if (dist < mindist) {
-              mindist = dist;
-              donor_StartIndex = donor_iPoint;
-            }
-
-            if (dist == 0.0) {
-              donor_StartIndex = donor_iPoint;
-              break;
-            }
-          }
+          donor_StartIndex =
+              FindClosestDonor(nDim, Coord_i, DonorPoint_Coord, Donor_LinkedNodes, Donor_StartLinkedNodes,
+                               Donor_nLinkedNodes, nGlobalVertex_Donor, closestDonor[markTarget][iVertex], donorTree);
+          closestDonor[markTarget][iVertex] = donor_StartIndex;
 
           donor_iPoint = donor_StartIndex;
           donor_OldiPoint = donor_iPoint;
 
           /*--- Contruct information regarding the target cell ---*/
 
-          auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-          for (jVertexTarget = 0; jVertexTarget < nGlobalVertex_Target; jVertexTarget++)
-            if (dPoint == Target_GlobalPoint[jVertexTarget]) break;
+          jVertexTarget = Target_GlobalToIndex.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
           if (Target_nLinkedNodes[jVertexTarget] == 1) {
             target_segment[0] = Target_LinkedNodes[Target_StartLinkedNodes[jVertexTarget]];
@@ -447,10 +450,7 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
 
         for (iDim = 0; iDim < nDim; iDim++) Coord_i[iDim] = target_geometry->nodes->GetCoord(target_iPoint, iDim);
 
-        auto dPoint = target_geometry->nodes->GetGlobalIndex(target_iPoint);
-        for (target_iPoint = 0; target_iPoint < nGlobalVertex_Target; target_iPoint++) {
-          if (dPoint == Target_GlobalPoint[target_iPoint]) break;
-        }
+        target_iPoint = Target_GlobalToIndex.at(target_geometry->nodes->GetGlobalIndex(target_iPoint));
 
         /*--- Build local surface dual mesh for target element ---*/
 
@@ -464,26 +464,12 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
         nNode_target = Build_3D_surface_element(Target_LinkedNodes, Target_StartLinkedNodes, Target_nLinkedNodes,
                                                 TargetPoint_Coord, target_iPoint, target_element);
 
-        /*--- Brute force to find the closest donor_node ---*/
-
-        mindist = 1E6;
-        donor_StartIndex = 0;
-
-        for (donor_iPoint = 0; donor_iPoint < nGlobalVertex_Donor; donor_iPoint++) {
-          Coord_j = DonorPoint_Coord[donor_iPoint];
-
-          dist = GeometryToolbox::Distance(nDim, Coord_i, Coord_j);
-
-          if (dist < mindist) {
-            mindist = dist;
-            donor_StartIndex = donor_iPoint;
-          }
+        /*--- Find the closest donor_node, starting from the one of the previous call ---*/
 
-          if (dist == 0.0) {
-            donor_StartIndex = donor_iPoint;
-            break;
-          }
-        }
+        donor_StartIndex =
+            FindClosestDonor(nDim, Coord_i, DonorPoint_Coord, Donor_LinkedNodes, Donor_StartLinkedNodes,
+                             Donor_nLinkedNodes, nGlobalVertex_Donor, closestDonor[markTarget][iVertex], donorTree);
+        closestDonor[markTarget][iVertex] = donor_StartIndex;
 
         donor_iPoint = donor_StartIndex;
 
@@ -689,6 +675,67 @@ void CSlidingMesh::SetTransferCoeff(const CConfig* const* config) {
   delete[] storeProc;
 }
 
+unsigned long CSlidingMesh::FindClosestDonor(unsigned short nDim, const su2double* coord,
+                                             const su2activematrix& donorCoord,
+                                             const su2vector<unsigned long>& linkedNodes,
+                                             const su2vector<unsigned long>& startLinkedNodes,
+                                             const su2vector<unsigned long>& nLinkedNodes, unsigned long nDonor,
+                                             unsigned long guess, unique_ptr<CADTPointsOnlyClass>& tree) {
+  if (guess < nDonor) {
+    /*--- Greedy walk, move to the closest neighbor while it is closer to the point. ---*/
+
+    unsigned long iPoint = guess;
+    su2double dist = GeometryToolbox::Distance(nDim, coord, donorCoord[iPoint]);
+    bool moved = true;
+
+    while (moved && dist > 0.0) {
+      moved = false;
+      const auto* neighbors = &linkedNodes[startLinkedNodes[iPoint]];
+      for (auto iNeighbor = 0ul; iNeighbor < nLinkedNodes[iPoint]; iNeighbor++) {
+        const auto jPoint = neighbors[iNeighbor];
+        if (jPoint >= nDonor) continue;
+        const su2double jDist = GeometryToolbox::Distance(nDim, coord, donorCoord[jPoint]);
+        if (jDist < dist) {
+          dist = jDist;
+          iPoint = jPoint;
+          moved = true;
+        }
+      }
+    }
+
+    /*--- A local minimum is only accepted if the point is within reach of the edges around it, otherwise the
+     walk may be stuck on a disconnected part of the boundary (e.g. across a periodic gap). ---*/
+
+    su2double maxEdge = 0.0;
+    const auto* neighbors = &linkedNodes[startLinkedNodes[iPoint]];
+    for (auto iNeighbor = 0ul; iNeighbor < nLinkedNodes[iPoint]; iNeighbor++) {
+      if (neighbors[iNeighbor] >= nDonor) continue;
+      maxEdge = max(maxEdge, GeometryToolbox::Distance(nDim, donorCoord[iPoint], donorCoord[neighbors[iNeighbor]]));
+    }
+    if (dist <= maxEdge) return iPoint;
+  }
+
+  /*--- Search the ADT of the donor vertices. ---*/
+
+  if (nDonor == 0) return 0;
+
+  if (!tree) {
+    vector<su2double> coords(nDonor * nDim);
+    vector<unsigned long> ids(nDonor);
+    for (unsigned long iPoint = 0; iPoint < nDonor; iPoint++) {
+      for (unsigned short iDim = 0; iDim < nDim; iDim++) coords[iPoint * nDim + iDim] = donorCoord(iPoint, iDim);
+      ids[iPoint] = iPoint;
+    }
+    tree = make_unique<CADTPointsOnlyClass>(nDim, nDonor, coords.data(), ids.data(), false);
+  }
+
+  su2double dist;
+  unsigned long closest;
+  int rankID;
+  tree->DetermineNearestNode(coord, dist, closest, rankID);
+  return closest;
+}
+
 int CSlidingMesh::Build_3D_surface_element(const su2vector<unsigned long>& map,
                                            const su2vector<unsigned long>& startIndex,
                                            const su2vector<unsigned long>& nNeighbor, su2activematrix const& coord,
@@ -29,8 +29,10 @@
 
 #include "../../include/geometry/CGeometry.hpp"
 #include "../../include/toolboxes/allocation_toolbox.hpp"
+#include "../../include/tracy_structure.hpp"
 
 #include <cmath>
+#include <limits>
 
 template <class ScalarType>
 CSysMatrix<ScalarType>::CSysMatrix() : rank(SU2_MPI::GetRank()), size(SU2_MPI::GetSize()) {
@@ -119,7 +121,7 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
   }
 
   const bool ilu_needed = (prec == ILU);
-  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET);
+  const bool diag_needed = ilu_needed || (prec == JACOBI) || (prec == LINELET) || (prec == AMG);
 
   /*--- Basic dimensions. ---*/
   nVar = nvar;
@@ -250,7 +252,7 @@ void CSysMatrix<ScalarType>::Initialize(unsigned long npoint, unsigned long npoi
 template <class T>
 void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, const CConfig* config,
                                MPI_QUANTITIES commType) {
-  if (geometry->nP2PSend == 0) return;
+  SU2_ZONE_SCOPED_N("Matrix_InitiateComms");
 
   /*--- Local variables ---*/
 
@@ -279,6 +281,8 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, cons
 
   geometry->AllocateP2PComms(COUNT_PER_POINT);
 
+  if (geometry->nP2PSend == 0) return;
+
   /*--- Load the specified quantity from the solver into the generic
    communication buffer in the geometry class. ---*/
 
@@ -365,15 +369,17 @@ void CSysMatrixComms::Initiate(const CSysVector<T>& x, CGeometry* geometry, cons
 
 template <class T>
 void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CConfig* config, MPI_QUANTITIES commType) {
+  SU2_ZONE_SCOPED_N("Matrix_CompleteComms");
+
   if (geometry->nP2PRecv == 0) return;
 
   /*--- Local variables ---*/
 
   const unsigned short COUNT_PER_POINT = x.GetNVar();
 
-  /*--- Global status so all threads can see the result of Waitany. ---*/
-  static SU2_MPI::Status status;
-  int ind;
+  /*--- Create a boolean for reversing the order of comms. ---*/
+
+  const bool reverse = (commType == MPI_QUANTITIES::SOLUTION_MATRIXTRANS);
 
   /*--- Store the data that was communicated into the appropriate
    location within the local class data structures. ---*/
@@ -382,15 +388,15 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
     /*--- For efficiency, recv the messages dynamically based on
      the order they arrive. ---*/
 
-    SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
-
     /*--- Once we have recv'd a message, get the source rank. ---*/
 
-    const auto source = status.MPI_SOURCE;
+    const auto source = geometry->WaitAnyP2PRecv(COMM_TYPE_DOUBLE, COUNT_PER_POINT, reverse);
 
     switch (commType) {
       case MPI_QUANTITIES::SOLUTION_MATRIX: {
-        const su2double* bufDRecv = geometry->bufD_P2PRecv;
+        /*--- Start of this message in the recv buffer (or in the send buffer of a neighbor on the node). ---*/
+
+        const su2double* bufDRecv = geometry->GetP2PRecvBufferD(source, COUNT_PER_POINT, reverse);
 
         /*--- We know the offsets based on the source rank. ---*/
 
@@ -410,9 +416,9 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
 
           const auto iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
 
-          /*--- Compute the offset in the recv buffer for this point. ---*/
+          /*--- Compute the offset in the message for this point. ---*/
 
-          const auto buf_offset = (msg_offset + iRecv) * COUNT_PER_POINT;
+          const auto buf_offset = iRecv * COUNT_PER_POINT;
 
           /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -428,7 +434,7 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
          send buffer for the recv instead. Also, all of the offsets
          and counts are derived from the send data structures. ---*/
 
-        const su2double* bufDRecv = geometry->bufD_P2PSend;
+        const su2double* bufDRecv = geometry->GetP2PRecvBufferD(source, COUNT_PER_POINT, reverse);
 
         /*--- We know the offsets based on the source rank. ---*/
 
@@ -448,9 +454,9 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
 
           const auto iPoint = geometry->Local_Point_P2PSend[msg_offset + iRecv];
 
-          /*--- Compute the offset in the recv buffer for this point. ---*/
+          /*--- Compute the offset in the message for this point. ---*/
 
-          const auto buf_offset = (msg_offset + iRecv) * COUNT_PER_POINT;
+          const auto buf_offset = iRecv * COUNT_PER_POINT;
 
           /*--- Update receiving point. ---*/
 
@@ -465,6 +471,8 @@ void CSysMatrixComms::Complete(CSysVector<T>& x, CGeometry* geometry, const CCon
         SU2_MPI::Error("Unrecognized quantity for point-to-point MPI comms.", CURRENT_FUNCTION);
         break;
     }
+
+    geometry->ReleaseP2PRecv(COMM_TYPE_DOUBLE, source, reverse);
   }
 
   /*--- Verify that all non-blocking point-to-point sends have finished.
@@ -588,6 +596,8 @@ void CSysMatrix<ScalarType>::DeleteValsRowi(unsigned long i) {
 template <class ScalarType>
 void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                  CGeometry* geometry, const CConfig* config) const {
+  SU2_ZONE_SCOPED_N("MatrixVectorProduct");
+
   /*--- Some checks for consistency between CSysMatrix and the CSysVector<ScalarType>s ---*/
 #ifndef NDEBUG
   if ((nEqn != vec.GetNVar()) || (nVar != prod.GetNVar())) {
@@ -610,6 +620,10 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
   }
   END_SU2_OMP_FOR
 
+  SU2_OMP_MASTER
+  CRegionProfiler::AddFlops(2.0 * row_ptr[nPointDomain] * nVar * nEqn);
+  END_SU2_OMP_MASTER
+
   /*--- MPI Parallelization. ---*/
 
   CSysMatrixComms::Initiate(prod, geometry, config);
@@ -618,6 +632,8 @@ void CSysMatrix<ScalarType>::MatrixVectorProduct(const CSysVector<ScalarType>& v
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildJacobiPreconditioner() {
+  SU2_ZONE_SCOPED_N("Preconditioner_Build");
+
   /*--- Build Jacobi preconditioner (M = D), compute and store the inverses of the diagonal blocks. ---*/
   SU2_OMP_FOR_DYN(omp_heavy_size)
   for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++)
@@ -629,6 +645,8 @@ template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<ScalarType>& vec,
                                                          CSysVector<ScalarType>& prod, CGeometry* geometry,
                                                          const CConfig* config) const {
+  SU2_ZONE_SCOPED_N("Preconditioner_Jacobi");
+
   /*--- Apply Jacobi preconditioner, y = D^{-1} * x, the inverse of the diagonal is already known. ---*/
   SU2_OMP_BARRIER
   SU2_OMP_FOR_DYN(omp_heavy_size)
@@ -636,6 +654,10 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
     MatrixVectorProduct(&(invM[iPoint * nVar * nVar]), &vec[iPoint * nVar], &prod[iPoint * nVar]);
   END_SU2_OMP_FOR
 
+  SU2_OMP_MASTER
+  CRegionProfiler::AddFlops(2.0 * nPointDomain * nVar * nVar);
+  END_SU2_OMP_MASTER
+
   /*--- MPI Parallelization ---*/
   CSysMatrixComms::Initiate(prod, geometry, config);
   CSysMatrixComms::Complete(prod, geometry, config);
@@ -643,6 +665,8 @@ void CSysMatrix<ScalarType>::ComputeJacobiPreconditioner(const CSysVector<Scalar
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
+  SU2_ZONE_SCOPED_N("Preconditioner_Build");
+
   /*--- Copy block matrix to compute factorization in-place. ---*/
 
   if (ilu_fill_in == 0) {
@@ -741,6 +765,8 @@ void CSysMatrix<ScalarType>::BuildILUPreconditioner() {
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
                                                       CGeometry* geometry, const CConfig* config) const {
+  SU2_ZONE_SCOPED_N("Preconditioner_ILU");
+
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
@@ -788,6 +814,11 @@ void CSysMatrix<ScalarType>::ComputeILUPreconditioner(const CSysVector<ScalarTyp
   }
   END_SU2_OMP_FOR
 
+  /*--- Forward and backward sweeps, each block of the factors is used once. ---*/
+  SU2_OMP_MASTER
+  CRegionProfiler::AddFlops(2.0 * row_ptr_ilu[nPointDomain] * nVar * nVar);
+  END_SU2_OMP_MASTER
+
   /*--- MPI Parallelization ---*/
 
   CSysMatrixComms::Initiate(prod, geometry, config);
@@ -798,6 +829,8 @@ template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<ScalarType>& vec,
                                                          CSysVector<ScalarType>& prod, CGeometry* geometry,
                                                          const CConfig* config) const {
+  SU2_ZONE_SCOPED_N("Preconditioner_LU_SGS");
+
   /*--- First part of the symmetric iteration: (D+L).x* = b ---*/
 
   /*--- Coherent view of vectors. ---*/
@@ -861,6 +894,8 @@ void CSysMatrix<ScalarType>::ComputeLU_SGSPreconditioner(const CSysVector<Scalar
 
 template <class ScalarType>
 void CSysMatrix<ScalarType>::BuildLineletPreconditioner(const CGeometry* geometry, const CConfig* config) {
+  SU2_ZONE_SCOPED_N("Preconditioner_Build");
+
   BuildJacobiPreconditioner();
 
   /*--- Allocate working vectors if not done yet. ---*/
@@ -892,6 +927,8 @@ template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<ScalarType>& vec,
                                                           CSysVector<ScalarType>& prod, CGeometry* geometry,
                                                           const CConfig* config) const {
+  SU2_ZONE_SCOPED_N("Preconditioner_Linelet");
+
   /*--- Coherent view of vectors. ---*/
   SU2_OMP_BARRIER
 
@@ -993,6 +1030,360 @@ void CSysMatrix<ScalarType>::ComputeLineletPreconditioner(const CSysVector<Scala
   CSysMatrixComms::Complete(prod, geometry, config);
 }
 
+namespace {
+/*--- Parameters of the aggregation-based AMG preconditioner. ---*/
+constexpr unsigned long AMG_MAX_LEVELS = 20;     /*!< \brief Maximum number of levels. */
+constexpr unsigned long AMG_MIN_POINTS = 64;     /*!< \brief Levels with fewer points are not coarsened. */
+constexpr unsigned long AMG_MAX_DENSE = 1000;    /*!< \brief Max. number of unknowns for the direct coarse solver. */
+constexpr passivedouble AMG_MAX_RATIO = 0.8;     /*!< \brief Max. ratio of coarse to fine points for a new level. */
+constexpr passivedouble AMG_STRENGTH = 0.08;     /*!< \brief Threshold of the strength of connection. */
+constexpr passivedouble AMG_RELAX = 2.0 / 3.0;   /*!< \brief Relaxation factor of the block Jacobi smoother. */
+constexpr int AMG_SWEEPS = 2;                    /*!< \brief Pre and post smoothing sweeps. */
+constexpr int AMG_COARSE_SWEEPS = 20;            /*!< \brief Sweeps on the coarsest level if it is not factorized. */
+}  // namespace
+
+template <class ScalarType>
+bool CSysMatrix<ScalarType>::CoarsenAMGLevel(AMGLevel& fine, AMGLevel& coarse) const {
+  constexpr auto NONE = std::numeric_limits<unsigned long>::max();
+
+  const auto n = fine.nPoint;
+  const auto blkSize = nVar * nVar;
+
+  auto blockNorm = [&](unsigned long index) {
+    ScalarType norm = 0.0;
+    for (auto k = 0ul; k < blkSize; ++k) norm += pow(fine.values[index * blkSize + k], 2);
+    return sqrt(norm);
+  };
+
+  /*--- Strength of connection, blocks that are small relative to the diagonals are ignored
+   * when forming aggregates. Couplings to halo points (j >= n) are always ignored. ---*/
+
+  vector<ScalarType> diagNorm(n, 0.0);
+  for (auto i = 0ul; i < n; ++i)
+    for (auto index = fine.rowPtr[i]; index < fine.rowPtr[i + 1]; ++index)
+      if (fine.colInd[index] == i) diagNorm[i] = blockNorm(index);
+
+  auto isStrong = [&](unsigned long i, unsigned long index) {
+    const auto j = fine.colInd[index];
+    return (j < n) && (j != i) && (blockNorm(index) > AMG_STRENGTH * sqrt(diagNorm[i] * diagNorm[j]));
+  };
+
+  auto& parent = fine.parent;
+  parent.assign(n, NONE);
+  unsigned long nAggr = 0;
+
+  /*--- 1st pass, seed aggregates on points whose strong neighbors are all free. ---*/
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (parent[i] != NONE) continue;
+    bool allFree = true;
+    for (auto index = fine.rowPtr[i]; index < fine.rowPtr[i + 1] && allFree; ++index)
+      allFree = !isStrong(i, index) || (parent[fine.colInd[index]] == NONE);
+    if (!allFree) continue;
+
+    parent[i] = nAggr;
+    for (auto index = fine.rowPtr[i]; index < fine.rowPtr[i + 1]; ++index)
+      if (isStrong(i, index)) parent[fine.colInd[index]] = nAggr;
+    ++nAggr;
+  }
+
+  /*--- 2nd pass, points left join the seeded aggregate of their strongest neighbor. ---*/
+
+  const auto seeded = parent;
+  for (auto i = 0ul; i < n; ++i) {
+    if (parent[i] != NONE) continue;
+    ScalarType maxNorm = 0.0;
+    for (auto index = fine.rowPtr[i]; index < fine.rowPtr[i + 1]; ++index) {
+      const auto j = fine.colInd[index];
+      if (!isStrong(i, index) || seeded[j] == NONE) continue;
+      const auto norm = blockNorm(index);
+      if (norm > maxNorm) {
+        maxNorm = norm;
+        parent[i] = seeded[j];
+      }
+    }
+  }
+
+  /*--- 3rd pass, the remaining points form aggregates with their free strong neighbors. ---*/
+
+  for (auto i = 0ul; i < n; ++i) {
+    if (parent[i] != NONE) continue;
+    parent[i] = nAggr;
+    for (auto index = fine.rowPtr[i]; index < fine.rowPtr[i + 1]; ++index)
+      if (isStrong(i, index) && parent[fine.colInd[index]] == NONE) parent[fine.colInd[index]] = nAggr;
+    ++nAggr;
+  }
+
+  if (nAggr > AMG_MAX_RATIO * n) return false;
+
+  /*--- Transpose of the parent map, used by the restriction. ---*/
+
+  fine.childPtr.assign(nAggr + 1, 0);
+  for (auto i = 0ul; i < n; ++i) ++fine.childPtr[parent[i] + 1];
+  for (auto iAggr = 0ul; iAggr < nAggr; ++iAggr) fine.childPtr[iAggr + 1] += fine.childPtr[iAggr];
+
+  fine.child.resize(n);
+  vector<unsigned long> next(fine.childPtr.begin(), fine.childPtr.end() - 1);
+  for (auto i = 0ul; i < n; ++i) fine.child[next[parent[i]]++] = i;
+
+  /*--- Galerkin operator for piecewise constant prolongation (P^T A P), the coarse block (I,J) is
+   * the sum of the fine blocks (i,j) with i in aggregate I and j in aggregate J. ---*/
+
+  coarse.nPoint = nAggr;
+  coarse.rowPtrData.assign(1, 0);
+  coarse.rowPtrData.reserve(nAggr + 1);
+  coarse.colIndData.clear();
+  coarse.valuesData.clear();
+
+  vector<unsigned long> position(nAggr, NONE);
+
+  for (auto iAggr = 0ul; iAggr < nAggr; ++iAggr) {
+    const auto rowBegin = coarse.colIndData.size();
+
+    for (auto k = fine.childPtr[iAggr]; k < fine.childPtr[iAggr + 1]; ++k) {
+      const auto i = fine.child[k];
+      for (auto index = fine.rowPtr[i]; index < fine.rowPtr[i + 1]; ++index) {
+        const auto j = fine.colInd[index];
+        if (j >= n) continue;
+        const auto jAggr = parent[j];
+
+        if (position[jAggr] == NONE || position[jAggr] < rowBegin) {
+          position[jAggr] = coarse.colIndData.size();
+          coarse.colIndData.push_back(jAggr);
+          coarse.valuesData.resize(coarse.valuesData.size() + blkSize, 0.0);
+        }
+        auto* coarseBlock = &coarse.valuesData[position[jAggr] * blkSize];
+        const auto* fineBlock = &fine.values[index * blkSize];
+        for (auto iVar = 0ul; iVar < blkSize; ++iVar) coarseBlock[iVar] += fineBlock[iVar];
+      }
+    }
+    coarse.rowPtrData.push_back(coarse.colIndData.size());
+  }
+
+  /*--- Inverse of the diagonal blocks for the smoother. ---*/
+
+  coarse.invDiagData.resize(nAggr * blkSize);
+  for (auto iAggr = 0ul; iAggr < nAggr; ++iAggr) {
+    for (auto index = coarse.rowPtrData[iAggr]; index < coarse.rowPtrData[iAggr + 1]; ++index) {
+      if (coarse.colIndData[index] != iAggr) continue;
+      ScalarType block[MAXNVAR * MAXNVAR];
+      MatrixCopy(&coarse.valuesData[index * blkSize], block);
+      MatrixInverse(block, &coarse.invDiagData[iAggr * blkSize]);
+    }
+  }
+
+  coarse.rowPtr = coarse.rowPtrData.data();
+  coarse.colInd = coarse.colIndData.data();
+  coarse.values = coarse.valuesData.data();
+  coarse.invDiag = coarse.invDiagData.data();
+
+  return true;
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::BuildAMGPreconditioner() {
+  SU2_ZONE_SCOPED_N("Preconditioner_Build");
+
+  if (nVar != nEqn) SU2_MPI::Error("The AMG preconditioner requires square blocks.", CURRENT_FUNCTION);
+
+  /*--- The finest level is smoothed with the inverse of the diagonal blocks of the matrix. ---*/
+
+  BuildJacobiPreconditioner();
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS {
+    /*--- Reserving the levels keeps the references to them valid while the hierarchy grows. ---*/
+
+    AMGLevels.clear();
+    AMGLevels.reserve(AMG_MAX_LEVELS);
+    AMGLevels.emplace_back();
+
+    auto& finest = AMGLevels.front();
+    finest.nPoint = nPointDomain;
+    finest.rowPtr = row_ptr;
+    finest.colInd = col_ind;
+    finest.values = matrix;
+    finest.invDiag = invM;
+
+    while (AMGLevels.size() < AMG_MAX_LEVELS && AMGLevels.back().nPoint > AMG_MIN_POINTS) {
+      AMGLevel coarse;
+      if (!CoarsenAMGLevel(AMGLevels.back(), coarse)) break;
+      AMGLevels.push_back(std::move(coarse));
+    }
+
+    /*--- Working memory, the finest level uses the input and output of the preconditioner. ---*/
+
+    for (auto iLevel = 0ul; iLevel < AMGLevels.size(); ++iLevel) {
+      auto& level = AMGLevels[iLevel];
+      level.res.resize(level.nPoint * nVar);
+      if (iLevel == 0) continue;
+      level.rhs.resize(level.nPoint * nVar);
+      level.sol.resize(level.nPoint * nVar);
+    }
+
+    /*--- If the coarsest level is small enough, factorize it (dense LU with partial pivoting). ---*/
+
+    auto& coarsest = AMGLevels.back();
+    const auto N = coarsest.nPoint * nVar;
+    coarsest.denseLU.clear();
+
+    if (N <= AMG_MAX_DENSE) {
+      auto& LU = coarsest.denseLU;
+      LU.assign(N * N, 0.0);
+      coarsest.pivot.resize(N);
+
+      for (auto i = 0ul; i < coarsest.nPoint; ++i) {
+        for (auto index = coarsest.rowPtr[i]; index < coarsest.rowPtr[i + 1]; ++index) {
+          const auto j = coarsest.colInd[index];
+          if (j >= coarsest.nPoint) continue;
+          for (auto iVar = 0ul; iVar < nVar; ++iVar)
+            for (auto jVar = 0ul; jVar < nVar; ++jVar)
+              LU[(i * nVar + iVar) * N + j * nVar + jVar] = coarsest.values[(index * nVar + iVar) * nVar + jVar];
+        }
+      }
+
+      for (auto k = 0ul; k < N; ++k) {
+        auto p = k;
+        for (auto i = k + 1; i < N; ++i)
+          if (fabs(LU[i * N + k]) > fabs(LU[p * N + k])) p = i;
+
+        /*--- Singular coarse operator, fall back to smoothing. ---*/
+        if (LU[p * N + k] == ScalarType(0.0)) {
+          LU.clear();
+          break;
+        }
+        coarsest.pivot[k] = p;
+        if (p != k)
+          for (auto j = 0ul; j < N; ++j) std::swap(LU[k * N + j], LU[p * N + j]);
+
+        for (auto i = k + 1; i < N; ++i) {
+          LU[i * N + k] /= LU[k * N + k];
+          for (auto j = k + 1; j < N; ++j) LU[i * N + j] -= LU[i * N + k] * LU[k * N + j];
+        }
+      }
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::AMGCycle(unsigned long iLevel, const ScalarType* b, ScalarType* x) const {
+  const auto& level = AMGLevels[iLevel];
+  const auto n = level.nPoint;
+  const auto blkSize = nVar * nVar;
+  const bool coarsest = (iLevel + 1 == AMGLevels.size());
+  const auto chunk = computeStaticChunkSize(n, omp_get_num_threads(), OMP_MAX_SIZE_H);
+  auto* res = level.res.data();
+
+  /*--- Direct solution on the coarsest level. ---*/
+
+  if (coarsest && !level.denseLU.empty()) {
+    SU2_OMP_MASTER {
+      const auto N = n * nVar;
+      const auto& LU = level.denseLU;
+      for (auto i = 0ul; i < N; ++i) x[i] = b[i];
+      for (auto k = 0ul; k < N; ++k) std::swap(x[k], x[level.pivot[k]]);
+      for (auto i = 1ul; i < N; ++i)
+        for (auto j = 0ul; j < i; ++j) x[i] -= LU[i * N + j] * x[j];
+      for (auto i = N; i-- > 0;) {
+        for (auto j = i + 1; j < N; ++j) x[i] -= LU[i * N + j] * x[j];
+        x[i] /= LU[i * N + i];
+      }
+    }
+    END_SU2_OMP_MASTER
+    SU2_OMP_BARRIER
+    return;
+  }
+
+  /*--- res = b - A x, couplings to halo points are neglected. ---*/
+
+  auto residual = [&]() {
+    SU2_OMP_FOR_STAT(chunk)
+    for (auto i = 0ul; i < n; ++i) {
+      ScalarType aux[MAXNVAR];
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) aux[iVar] = b[i * nVar + iVar];
+      for (auto index = level.rowPtr[i]; index < level.rowPtr[i + 1]; ++index) {
+        const auto j = level.colInd[index];
+        if (j < n) MatrixVectorProductSub(&level.values[index * blkSize], &x[j * nVar], aux);
+      }
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) res[i * nVar + iVar] = aux[iVar];
+    }
+    END_SU2_OMP_FOR
+  };
+
+  /*--- Damped block Jacobi, starting from x = 0 if zeroGuess. ---*/
+
+  auto smooth = [&](int nSweeps, bool zeroGuess) {
+    for (int iSweep = 0; iSweep < nSweeps; ++iSweep) {
+      const bool fromZero = zeroGuess && (iSweep == 0);
+      if (!fromZero) residual();
+
+      SU2_OMP_FOR_STAT(chunk)
+      for (auto i = 0ul; i < n; ++i) {
+        ScalarType aux[MAXNVAR];
+        MatrixVectorProduct(&level.invDiag[i * blkSize], fromZero ? &b[i * nVar] : &res[i * nVar], aux);
+        for (auto iVar = 0ul; iVar < nVar; ++iVar)
+          x[i * nVar + iVar] = (fromZero ? ScalarType(0.0) : x[i * nVar + iVar]) + AMG_RELAX * aux[iVar];
+      }
+      END_SU2_OMP_FOR
+    }
+  };
+
+  if (coarsest) {
+    smooth(AMG_COARSE_SWEEPS, true);
+    return;
+  }
+
+  /*--- Pre-smoothing. ---*/
+
+  smooth(AMG_SWEEPS, true);
+
+  /*--- Restrict the residual (sum over the points of each aggregate), and solve for the coarse correction. ---*/
+
+  residual();
+
+  const auto& coarse = AMGLevels[iLevel + 1];
+  const auto coarseChunk = computeStaticChunkSize(coarse.nPoint, omp_get_num_threads(), OMP_MAX_SIZE_H);
+
+  SU2_OMP_FOR_STAT(coarseChunk)
+  for (auto iAggr = 0ul; iAggr < coarse.nPoint; ++iAggr) {
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+      ScalarType sum = 0.0;
+      for (auto k = level.childPtr[iAggr]; k < level.childPtr[iAggr + 1]; ++k) sum += res[level.child[k] * nVar + iVar];
+      coarse.rhs[iAggr * nVar + iVar] = sum;
+    }
+  }
+  END_SU2_OMP_FOR
+
+  AMGCycle(iLevel + 1, coarse.rhs.data(), coarse.sol.data());
+
+  /*--- Prolongate (inject) the correction. ---*/
+
+  SU2_OMP_FOR_STAT(chunk)
+  for (auto i = 0ul; i < n; ++i)
+    for (auto iVar = 0ul; iVar < nVar; ++iVar) x[i * nVar + iVar] += coarse.sol[level.parent[i] * nVar + iVar];
+  END_SU2_OMP_FOR
+
+  /*--- Post-smoothing, with as many sweeps as the pre-smoothing the preconditioner is symmetric. ---*/
+
+  smooth(AMG_SWEEPS, false);
+}
+
+template <class ScalarType>
+void CSysMatrix<ScalarType>::ComputeAMGPreconditioner(const CSysVector<ScalarType>& vec, CSysVector<ScalarType>& prod,
+                                                      CGeometry* geometry, const CConfig* config) const {
+  SU2_ZONE_SCOPED_N("Preconditioner_AMG");
+
+  /*--- Coherent view of vectors. ---*/
+  SU2_OMP_BARRIER
+
+  AMGCycle(0, &vec[0], &prod[0]);
+
+  /*--- MPI Parallelization ---*/
+
+  CSysMatrixComms::Initiate(prod, geometry, config);
+  CSysMatrixComms::Complete(prod, geometry, config);
+}
+
 template <class ScalarType>
 void CSysMatrix<ScalarType>::ComputeResidual(const CSysVector<ScalarType>& sol, const CSysVector<ScalarType>& f,
                                              CSysVector<ScalarType>& res) const {
@@ -0,0 +1,399 @@
+/*!
+ * \file CRegionProfiler.cpp
+ * \brief Built-in hierarchical timers for named code regions.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/toolboxes/CRegionProfiler.hpp"
+#include "../../include/option_structure.hpp"
+#include "../../include/toolboxes/printing_toolbox.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <numeric>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+bool CRegionProfiler::enabled = false;
+bool CRegionProfiler::countersEnabled = false;
+vector<string> CRegionProfiler::names;
+vector<CRegionProfiler::CThreadData> CRegionProfiler::threads;
+
+namespace {
+/*--- Timings of one path on one rank (max over threads), or across ranks. ---*/
+struct CRegionStats {
+  passivedouble calls = 0, minTime = 0, avgTime = 0, maxTime = 0, imbalance = 1;
+  passivedouble flops = 0, counters[CRegionProfiler::N_COUNTERS] = {}; /*--- Sums over threads and ranks. ---*/
+};
+
+/*--- Values of a path sent by each rank. ---*/
+enum : int { CALLS, MAX_TIME, IMBALANCE, FLOPS, COUNTERS, N_VALUES = COUNTERS + CRegionProfiler::N_COUNTERS };
+
+/*--- Tree used to write the hierarchical JSON report. ---*/
+struct CReportNode {
+  string name;
+  const CRegionStats* stats = nullptr;
+  vector<CReportNode> children;
+};
+
+void WriteJSON(ofstream& file, const CReportNode& node, int indent) {
+  const string pad(indent, ' ');
+  file << pad << "{\"name\": \"" << node.name << "\"";
+  if (node.stats) {
+    const auto& s = *node.stats;
+    file << ", \"calls\": " << static_cast<unsigned long>(s.calls) << ", \"min_time\": " << s.minTime
+         << ", \"avg_time\": " << s.avgTime << ", \"max_time\": " << s.maxTime
+         << ", \"thread_imbalance\": " << s.imbalance << ", \"flops\": " << s.flops
+         << ", \"cycles\": " << s.counters[CRegionProfiler::CYCLES]
+         << ", \"instructions\": " << s.counters[CRegionProfiler::INSTRUCTIONS]
+         << ", \"cache_references\": " << s.counters[CRegionProfiler::CACHE_REFERENCES]
+         << ", \"cache_misses\": " << s.counters[CRegionProfiler::CACHE_MISSES];
+  }
+  file << ", \"children\": [";
+  for (size_t i = 0; i < node.children.size(); ++i) {
+    file << (i ? ",\n" : "\n");
+    WriteJSON(file, node.children[i], indent + 2);
+  }
+  if (!node.children.empty()) file << "\n" << pad;
+  file << "]}";
+}
+}  // namespace
+
+void CRegionProfiler::Enable(bool enable, bool counters) {
+  CloseCounters();
+  enabled = enable;
+  countersEnabled = enable && counters;
+  threads.clear();
+  if (enable) threads.resize(omp_get_max_threads());
+}
+
+vector<int> CRegionProfiler::OpenCounters() {
+  vector<int> fds;
+#ifdef __linux__
+  const unsigned long long config[] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                       PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES};
+  for (int iCounter = 0; iCounter < N_COUNTERS; ++iCounter) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config[iCounter];
+    attr.read_format = PERF_FORMAT_GROUP;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    /*--- Count the calling thread on any CPU, the first counter is the group leader. ---*/
+    const int fd = syscall(SYS_perf_event_open, &attr, 0, -1, fds.empty() ? -1 : fds[0], 0);
+    if (fd < 0) {
+      for (const auto openFd : fds) close(openFd);
+      return {};
+    }
+    fds.push_back(fd);
+  }
+#endif
+  return fds;
+}
+
+void CRegionProfiler::CloseCounters() {
+#ifdef __linux__
+  /*--- Each counter of a group has its own file descriptor, closing the leader does not release the others. ---*/
+  for (auto& data : threads) {
+    for (const auto fd : data.counterFds) close(fd);
+    data.counterFds.clear();
+  }
+#endif
+}
+
+void CRegionProfiler::ReadCounters(CounterArray& values) {
+  values.fill(0);
+  if (!countersEnabled) return;
+  auto& data = threads[omp_get_thread_num()];
+  if (!data.counterInit) {
+    data.counterFds = OpenCounters();
+    data.counterInit = true;
+  }
+#ifdef __linux__
+  if (data.counterFds.empty()) return;
+  unsigned long long buffer[N_COUNTERS + 1];
+  if (read(data.counterFds[0], buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer))) return;
+  for (int iCounter = 0; iCounter < N_COUNTERS; ++iCounter) values[iCounter] = buffer[iCounter + 1];
+#endif
+}
+
+void CRegionProfiler::AddFlops_impl(passivedouble flops) {
+  const auto thread = static_cast<size_t>(omp_get_thread_num());
+  if (thread >= threads.size()) return;
+  auto& data = threads[thread];
+  for (auto iNode = data.current; iNode >= 0; iNode = data.nodes[iNode].parent) {
+    data.nodes[iNode].flops += flops;
+  }
+}
+
+unsigned short CRegionProfiler::Register(const char* name) {
+  unsigned short region = 0;
+  SU2_OMP_CRITICAL {
+    const auto it = find(names.begin(), names.end(), name);
+    region = it - names.begin();
+    if (it == names.end()) names.emplace_back(name);
+  }
+  END_SU2_OMP_CRITICAL
+  return region;
+}
+
+bool CRegionProfiler::Start(unsigned short region) {
+  if (!enabled) return false;
+  const auto thread = static_cast<size_t>(omp_get_thread_num());
+  if (thread >= threads.size()) return false;
+  auto& data = threads[thread];
+
+  /*--- Find the region among the children of the current node, or create it. ---*/
+  auto& siblings = data.current < 0 ? data.roots : data.nodes[data.current].children;
+  for (const auto iNode : siblings) {
+    if (data.nodes[iNode].region == region) {
+      data.current = iNode;
+      return true;
+    }
+  }
+  const int iNode = data.nodes.size();
+  siblings.push_back(iNode);
+  data.nodes.push_back({region, data.current, {}});
+  data.current = iNode;
+  return true;
+}
+
+void CRegionProfiler::Stop(passivedouble elapsed, const CounterArray& start) {
+  CounterArray end;
+  ReadCounters(end);
+
+  auto& data = threads[omp_get_thread_num()];
+  auto& node = data.nodes[data.current];
+  node.calls += 1;
+  node.time += elapsed;
+  for (int iCounter = 0; iCounter < N_COUNTERS; ++iCounter) node.counters[iCounter] += end[iCounter] - start[iCounter];
+  data.current = node.parent;
+}
+
+string CRegionProfiler::NodePath(const CThreadData& data, int iNode) {
+  string path = names[data.nodes[iNode].region];
+  for (auto i = data.nodes[iNode].parent; i >= 0; i = data.nodes[i].parent) {
+    path = names[data.nodes[i].region] + "/" + path;
+  }
+  return path;
+}
+
+void CRegionProfiler::WriteReport(const string& filename, SU2_Comm comm) {
+  if (!enabled) return;
+  using MPIWrapper = SelectMPIWrapper<passivedouble>::W;
+
+  int rank = MASTER_NODE, size = SINGLE_NODE;
+  SU2_MPI::Comm_rank(comm, &rank);
+  SU2_MPI::Comm_size(comm, &size);
+
+  /*--- Regions opened by worker threads outside of any other region are usually inside a parallel
+   * section started by the master thread, they are attached where the master opened the same region. ---*/
+  map<unsigned short, string> masterPrefix;
+  const auto& master = threads[0];
+  for (int iNode = master.nodes.size() - 1; iNode >= 0; --iNode) {
+    const auto parent = master.nodes[iNode].parent;
+    masterPrefix[master.nodes[iNode].region] = parent < 0 ? "" : NodePath(master, parent) + "/";
+  }
+
+  /*--- Merge the threads of this rank, the time of a path is the max over threads. ---*/
+  struct CThreadSum {
+    passivedouble calls = 0, maxTime = 0, sumTime = 0, flops = 0, counters[N_COUNTERS] = {};
+    int nThreads = 0;
+  };
+  map<string, CThreadSum> local;
+
+  for (size_t iThread = 0; iThread < threads.size(); ++iThread) {
+    const auto& data = threads[iThread];
+    for (int iNode = 0; iNode < static_cast<int>(data.nodes.size()); ++iNode) {
+      int root = iNode;
+      while (data.nodes[root].parent >= 0) root = data.nodes[root].parent;
+      string path = NodePath(data, iNode);
+      if (iThread > 0) path = masterPrefix[data.nodes[root].region] + path;
+
+      auto& sum = local[path];
+      sum.calls = max<passivedouble>(sum.calls, data.nodes[iNode].calls);
+      sum.maxTime = max(sum.maxTime, data.nodes[iNode].time);
+      sum.sumTime += data.nodes[iNode].time;
+      sum.flops += data.nodes[iNode].flops;
+      for (int iCounter = 0; iCounter < N_COUNTERS; ++iCounter) {
+        sum.counters[iCounter] += data.nodes[iNode].counters[iCounter];
+      }
+      sum.nThreads += 1;
+    }
+  }
+
+  /*--- Gather the paths (separated by new lines) and their timings from all ranks. ---*/
+  string localPaths;
+  vector<passivedouble> localValues;
+  for (const auto& entry : local) {
+    localPaths += entry.first + "\n";
+    const auto& s = entry.second;
+    const passivedouble avgTime = s.sumTime / s.nThreads;
+    localValues.insert(localValues.end(), {s.calls, s.maxTime, avgTime > 0 ? s.maxTime / avgTime : 1.0, s.flops});
+    localValues.insert(localValues.end(), s.counters, s.counters + N_COUNTERS);
+  }
+
+  int localCounts[] = {static_cast<int>(localPaths.size()), static_cast<int>(localValues.size())};
+  vector<int> counts(2 * size);
+  MPIWrapper::Allgather(localCounts, 2, MPI_INT, counts.data(), 2, MPI_INT, comm);
+
+  vector<int> nChars(size), nValues(size), charDispl(size, 0), valueDispl(size, 0);
+  for (int iRank = 0; iRank < size; ++iRank) {
+    nChars[iRank] = counts[2 * iRank];
+    nValues[iRank] = counts[2 * iRank + 1];
+    if (iRank) {
+      charDispl[iRank] = charDispl[iRank - 1] + nChars[iRank - 1];
+      valueDispl[iRank] = valueDispl[iRank - 1] + nValues[iRank - 1];
+    }
+  }
+  string allPaths(charDispl.back() + nChars.back(), '\0');
+  vector<passivedouble> allValues(valueDispl.back() + nValues.back());
+
+  MPIWrapper::Allgatherv(localPaths.data(), nChars[rank], MPI_CHAR, &allPaths[0], nChars.data(), charDispl.data(),
+                         MPI_CHAR, comm);
+  MPIWrapper::Allgatherv(localValues.data(), nValues[rank], MPI_DOUBLE, allValues.data(), nValues.data(),
+                         valueDispl.data(), MPI_DOUBLE, comm);
+
+  if (rank != MASTER_NODE) return;
+
+  /*--- Reduce across ranks, ranks that never entered a region count as 0 for the min and avg. ---*/
+  map<string, CRegionStats> global;
+  map<string, int> nRanks;
+  size_t pos = 0, iValue = 0;
+  while (pos < allPaths.size()) {
+    const auto end = allPaths.find('\n', pos);
+    const auto path = allPaths.substr(pos, end - pos);
+    pos = end + 1;
+
+    const auto* values = &allValues[iValue];
+    const auto time = values[MAX_TIME];
+    auto& s = global[path];
+    auto& n = nRanks[path];
+    s.calls = max(s.calls, values[CALLS]);
+    s.minTime = n ? min(s.minTime, time) : time;
+    s.avgTime += time / size;
+    s.maxTime = max(s.maxTime, time);
+    s.imbalance = max(s.imbalance, values[IMBALANCE]);
+    s.flops += values[FLOPS];
+    for (int iCounter = 0; iCounter < N_COUNTERS; ++iCounter) s.counters[iCounter] += values[COUNTERS + iCounter];
+    n += 1;
+    iValue += N_VALUES;
+  }
+  for (auto& entry : global) {
+    if (nRanks[entry.first] < size) entry.second.minTime = 0;
+  }
+
+  /*--- Flat CSV report, the paths encode the hierarchy. ---*/
+  ofstream csv(filename + ".csv");
+  csv << scientific << setprecision(6);
+  csv << "\"Region\",\"Depth\",\"Calls\",\"Min_Time\",\"Avg_Time\",\"Max_Time\",\"Thread_Imbalance\",\"Flops\","
+         "\"Cycles\",\"Instructions\",\"Cache_References\",\"Cache_Misses\"\n";
+  for (const auto& entry : global) {
+    const auto& s = entry.second;
+    csv << "\"" << entry.first << "\"," << count(entry.first.begin(), entry.first.end(), '/') << ","
+        << static_cast<unsigned long>(s.calls) << "," << s.minTime << "," << s.avgTime << "," << s.maxTime << ","
+        << s.imbalance << "," << s.flops;
+    for (int iCounter = 0; iCounter < N_COUNTERS; ++iCounter) csv << "," << s.counters[iCounter];
+    csv << "\n";
+  }
+
+  /*--- Hierarchical JSON report. ---*/
+  CReportNode root;
+  root.name = "SU2";
+  for (const auto& entry : global) {
+    auto* node = &root;
+    size_t begin = 0;
+    while (true) {
+      const auto end = entry.first.find('/', begin);
+      const auto name = entry.first.substr(begin, end - begin);
+      auto it = find_if(node->children.begin(), node->children.end(),
+                        [&name](const CReportNode& child) { return child.name == name; });
+      if (it == node->children.end()) {
+        node->children.push_back({name, nullptr, {}});
+        it = node->children.end() - 1;
+      }
+      node = &(*it);
+      if (end == string::npos) break;
+      begin = end + 1;
+    }
+    node->stats = &entry.second;
+  }
+
+  ofstream json(filename + ".json");
+  json << scientific << setprecision(6);
+  json << "{\"ranks\": " << size << ", \"threads\": " << threads.size() << ", \"regions\":\n";
+  WriteJSON(json, root, 2);
+  json << "\n}\n";
+
+  if (!countersEnabled) return;
+
+  /*--- Roofline-style summary, rates are aggregated over ranks (total work / average time). ---*/
+  if (threads[0].counterFds.empty()) {
+    cout << "\nHardware counters are not available, check /proc/sys/kernel/perf_event_paranoid.\n" << endl;
+    return;
+  }
+  passivedouble lineSize = 64;
+#ifdef _SC_LEVEL1_DCACHE_LINESIZE
+  if (sysconf(_SC_LEVEL1_DCACHE_LINESIZE) > 0) lineSize = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+#endif
+
+  cout << "\nRoofline summary (memory traffic estimated from last level cache misses):" << endl;
+  PrintingToolbox::CTablePrinter table(&cout);
+  table.AddColumn("Region", 40);
+  table.AddColumn("Avg. Time (s)", 14);
+  table.AddColumn("GB/s", 10);
+  table.AddColumn("GFLOP/s", 10);
+  table.AddColumn("FLOP/Byte", 10);
+  table.AddColumn("IPC", 8);
+  table.AddColumn("Miss Ratio", 10);
+  table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+  table.PrintHeader();
+
+  for (const auto& entry : global) {
+    const auto& s = entry.second;
+    const auto& c = s.counters;
+    const passivedouble bytes = c[CACHE_MISSES] * lineSize;
+    const passivedouble time = max(s.avgTime, 1e-12);
+    const auto depth = count(entry.first.begin(), entry.first.end(), '/');
+    const auto name = string(2 * depth, ' ') + entry.first.substr(entry.first.find_last_of('/') + 1);
+
+    table << name.substr(0, 40) << time << bytes / time / 1e9 << s.flops / time / 1e9
+          << (bytes > 0 ? s.flops / bytes : 0.0) << (c[CYCLES] > 0 ? c[INSTRUCTIONS] / c[CYCLES] : 0.0)
+          << (c[CACHE_REFERENCES] > 0 ? c[CACHE_MISSES] / c[CACHE_REFERENCES] : 0.0);
+  }
+  table.PrintFooter();
+}
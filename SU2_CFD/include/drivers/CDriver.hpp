@@ -52,9 +52,13 @@ class CDriver : public CDriverBase {
  protected:
   su2double
       UsedTimeOutput; /*!< \brief Elapsed time between Start and Stop point of the timer for tracking output phase.*/
+  su2double UsedTimePartition =
+      0.0; /*!< \brief Time spent reading, partitioning, and distributing the grids (part of the preprocessing).*/
 
   su2double BandwidthSum =
       0.0;                    /*!< \brief Aggregate value of the bandwidth for writing restarts (to be average later).*/
+  passivedouble LoadStartTime = 0.0, /*!< \brief Wall time at the start of the compute phase (load measurement). */
+      LoadStartWaitTime = 0.0;       /*!< \brief Communication wait time at the start of the compute phase. */
   unsigned long IterCount,    /*!< \brief Iteration count stored for performance benchmarking.*/
       OutputCount;            /*!< \brief Output count stored for performance benchmarking.*/
   unsigned long DOFsPerPoint; /*!< \brief Number of unknowns at each vertex, i.e., number of equations solved. */
@@ -69,6 +73,8 @@ class CDriver : public CDriverBase {
       fsi,         /*!< \brief FSI simulation flag.*/
       fem_solver;  /*!< \brief FEM fluid solver simulation flag. */
 
+  SU2_Comm worldComm; /*!< \brief Communicator of all the ranks, set by drivers that split them into groups. */
+
   CFreeFormDefBox*** FFDBox;            /*!< \brief FFD FFDBoxes of the problem. */
 
   CIteration*** iteration_container;      /*!< \brief Container vector with all the iteration methods. */
@@ -352,6 +358,21 @@ class CDriver : public CDriverBase {
    */
   void PrintDirectResidual(RECORDING kind_recording);
 
+  /*!
+   * \brief Print the tape memory of each zone and the peak resident set size (min/avg/max over ranks).
+   * \note Collective call, all ranks must participate.
+   * \param[in] zoneTapeMemory - Tape memory (bytes) recorded by each zone on this rank, empty for single zone
+   *            problems (the zone tape is the total).
+   */
+  void PrintTapeMemory(const vector<passivedouble>& zoneTapeMemory) const;
+
+  /*!
+   * \brief Write the point weights of all zones scaled by the measured load of each rank, for the
+   *        partitioning of future runs (PARMETIS_WRITE_WEIGHTS).
+   * \note Collective call, all ranks must participate.
+   */
+  void WritePointWeights() const;
+
   /*!
    * \brief Set the solution of all solvers (adjoint or primal) in a zone.
    * \param[in] iZone - Index of the zone.
@@ -648,6 +669,35 @@ class CHBDriver : public CFluidDriver {
   unsigned short nInstHB;
   su2double** D; /*!< \brief Harmonic Balance operator. */
 
+  unsigned short nInstGroups = 1;     /*!< \brief Number of rank groups that iterate the instances concurrently. */
+  unsigned short iInstGroup = 0;      /*!< \brief Group of this rank. */
+  vector<unsigned short> instGroup;   /*!< \brief Group that iterates each instance. */
+  SU2_Comm crossComm;                 /*!< \brief Ranks with the same rank within their group, ordered by group. */
+
+  /*!
+   * \brief Split the communicator into contiguous groups of ranks, one per set of instances.
+   * \param[in] MPICommunicator - Communicator of all the ranks.
+   * \param[in] nGroups - Number of groups.
+   * \return Communicator of the group of this rank.
+   */
+  static SU2_Comm SplitInstanceGroups(SU2_Comm MPICommunicator, unsigned short nGroups);
+
+  /*!
+   * \brief Check that all groups partitioned the mesh identically, as required to exchange the instances.
+   */
+  void CheckInstanceGroupPartitions() const;
+
+  /*!
+   * \brief Broadcast the solutions of each instance from the group that iterates it to the other groups.
+   */
+  void ExchangeInstanceSolutions();
+
+  /*!
+   * \brief Whether the instance is iterated by the group of this rank.
+   * \param[in] iInst - Instance number.
+   */
+  inline bool IsOwnInstance(unsigned short iInst) const { return instGroup[iInst] == iInstGroup; }
+
   /*!
    * \brief Computation and storage of the Harmonic Balance method source terms.
    * \author T. Economon, K. Naik
@@ -673,8 +723,9 @@ class CHBDriver : public CFluidDriver {
    * \param[in] confFile - Configuration file name.
    * \param[in] val_nZone - Total number of zones.
    * \param[in] MPICommunicator - MPI communicator for SU2.
+   * \param[in] nGroups - Number of rank groups over which the time instances are distributed.
    */
-  CHBDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator);
+  CHBDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator, unsigned short nGroups = 1);
 
   /*!
    * \brief Destructor of the class.
@@ -690,4 +741,9 @@ class CHBDriver : public CFluidDriver {
    * \brief Update the solution for the Harmonic Balance.
    */
   void Update() override;
+
+  /*!
+   * \brief Output the solution of the instances iterated by this group.
+   */
+  void Output(unsigned long InnerIter) override;
 };
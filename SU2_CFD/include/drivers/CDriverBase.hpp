@@ -228,7 +228,7 @@ class CDriverBase {
     }
     auto* coords =
         const_cast<su2activematrix*>(solver_container[selected_zone][INST_0][MESH_0][MESH_SOL]->GetNodes()->GetMesh_Coord());
-    return CPyWrapperMatrixView(*coords, "InitialCoordinates", true);
+    return CPyWrapperMatrixView(*coords, main_geometry->GetnPointDomain(), "InitialCoordinates", true);
   }
 
   /*!
@@ -251,7 +251,7 @@ class CDriverBase {
    */
   inline CPyWrapperMatrixView Coordinates() {
     auto& coords = const_cast<su2activematrix&>(main_geometry->nodes->GetCoord());
-    return CPyWrapperMatrixView(coords, "Coordinates", false);
+    return CPyWrapperMatrixView(coords, main_geometry->GetnPointDomain(), "Coordinates", false);
   }
 
   /*!
@@ -441,7 +441,7 @@ class CDriverBase {
    */
   inline CPyWrapperMatrixView Solution(unsigned short iSolver) {
     auto* solver = GetSolverAndCheckMarker(iSolver);
-    return CPyWrapperMatrixView(solver->GetNodes()->GetSolution(), "Solution of " + solver->GetSolverName(), false);
+    return CPyWrapperMatrixView(solver->GetNodes()->GetSolution(), main_geometry->GetnPointDomain(), "Solution of " + solver->GetSolverName(), false);
   }
 
   /*!
@@ -449,7 +449,8 @@ class CDriverBase {
    */
   inline CPyWrapper3DMatrixView Gradient(unsigned short iSolver) {
     auto* solver = GetSolverAndCheckMarker(iSolver);
-    return CPyWrapper3DMatrixView(solver->GetNodes()->GetGradient(), "Gradient of " + solver->GetSolverName(), false);
+    return CPyWrapper3DMatrixView(solver->GetNodes()->GetGradient(), main_geometry->GetnPointDomain(),
+                                  "Gradient of " + solver->GetSolverName(), false);
   }
 
   /*!
@@ -458,7 +459,16 @@ class CDriverBase {
   inline CPyWrapperMatrixView UserDefinedSource(unsigned short iSolver) {
     auto* solver = GetSolverAndCheckMarker(iSolver);
     return CPyWrapperMatrixView(
-      solver->GetNodes()->GetUserDefinedSource(), "User Defined Source of " + solver->GetSolverName(), false);
+      solver->GetNodes()->GetUserDefinedSource(), main_geometry->GetnPointDomain(), "User Defined Source of " + solver->GetSolverName(), false);
+  }
+
+  /*!
+   * \brief Get a read-only view of the residual of the last iteration of a solver on all mesh nodes.
+   * \note For implicit time integration this is the right hand side of the linear system.
+   */
+  inline CPyWrapperMatrixView Residual(unsigned short iSolver) {
+    auto* solver = GetSolverAndCheckMarker(iSolver);
+    return CPyWrapperMatrixView(solver->GetLinSysRes(), "Residual of " + solver->GetSolverName(), true);
   }
 
   /*!
@@ -477,7 +487,7 @@ class CDriverBase {
   inline CPyWrapperMatrixView SolutionTimeN(unsigned short iSolver) {
     auto* solver = GetSolverAndCheckMarker(iSolver);
     return CPyWrapperMatrixView(
-        solver->GetNodes()->GetSolution_time_n(), "SolutionTimeN of " + solver->GetSolverName(), false);
+        solver->GetNodes()->GetSolution_time_n(), main_geometry->GetnPointDomain(), "SolutionTimeN of " + solver->GetSolverName(), false);
   }
 
   /*!
@@ -496,7 +506,7 @@ class CDriverBase {
   inline CPyWrapperMatrixView SolutionTimeN1(unsigned short iSolver) {
     auto* solver = GetSolverAndCheckMarker(iSolver);
     return CPyWrapperMatrixView(
-        solver->GetNodes()->GetSolution_time_n1(), "SolutionTimeN1 of " + solver->GetSolverName(), false);
+        solver->GetNodes()->GetSolution_time_n1(), main_geometry->GetnPointDomain(), "SolutionTimeN1 of " + solver->GetSolverName(), false);
   }
 
   /*!
@@ -521,7 +531,8 @@ class CDriverBase {
    */
   inline CPyWrapperMatrixView Primitives() {
     auto* solver = GetSolverAndCheckMarker(FLOW_SOL);
-    return CPyWrapperMatrixView(const_cast<su2activematrix&>(solver->GetNodes()->GetPrimitive()), "Primitives", false);
+    return CPyWrapperMatrixView(const_cast<su2activematrix&>(solver->GetNodes()->GetPrimitive()),
+                                main_geometry->GetnPointDomain(), "Primitives", false);
   }
 
   /*!
@@ -541,7 +552,7 @@ class CDriverBase {
   inline CPyWrapperMatrixView Sensitivity(unsigned short iSolver) {
     auto* solver = GetSolverAndCheckMarker(iSolver);
     auto& sensitivity = const_cast<su2activematrix&>(solver->GetNodes()->GetSensitivity());
-    return CPyWrapperMatrixView(sensitivity, "Sensitivity", true);
+    return CPyWrapperMatrixView(sensitivity, main_geometry->GetnPointDomain(), "Sensitivity", true);
   }
 
   /*!
@@ -0,0 +1,121 @@
+/*!
+ * \file CPararealDriver.hpp
+ * \brief Headers of the parallel-in-time (Parareal) driver for dual time stepping problems.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+#include <array>
+#include "CSinglezoneDriver.hpp"
+
+/*!
+ * \class CPararealDriver
+ * \ingroup Drivers
+ * \brief Parallel-in-time driver for single-zone dual time stepping problems.
+ * \details The time iterations are split into slabs, each solved by a group of ranks holding the full mesh. A cheap
+ * coarse propagator (larger time step, fewer inner iterations) provides the initial state of each slab, which is
+ * corrected with the fine propagator (the normal time stepping) of the previous slab until it no longer changes:
+ * lambda_{n+1} = G(lambda_n) + F(lambda_n^old) - G(lambda_n^old). The fine propagators run concurrently, the coarse
+ * corrections sweep the slabs in order.
+ * \author The SU2 Developers
+ */
+class CPararealDriver : public CSinglezoneDriver {
+ private:
+  unsigned short nSlabs;        /*!< \brief Number of time slabs (groups of ranks). */
+  unsigned short iSlab = 0;     /*!< \brief Time slab of this rank. */
+  unsigned long firstTimeIter;  /*!< \brief First time iteration of the slab of this rank. */
+  unsigned long nSlabTimeIter;  /*!< \brief Number of time iterations of each slab. */
+  unsigned short coarsening;    /*!< \brief Time step ratio of the coarse propagator. */
+  SU2_Comm crossComm;           /*!< \brief Ranks with the same rank within their group, ordered by slab. */
+
+  /*! \brief Offsets into the slab state of the solution, and of the solutions at time n and n-1, of each solver. */
+  vector<array<size_t, 3> > stateBlocks;
+  size_t stateSize = 0; /*!< \brief Size of the slab state of this rank. */
+
+  /*!
+   * \brief Split the communicator into contiguous groups of ranks, one per time slab.
+   * \param[in] MPICommunicator - Communicator of all the ranks.
+   * \param[in] nGroups - Number of groups.
+   * \return Communicator of the group of this rank.
+   */
+  static SU2_Comm SplitTimeSlabs(SU2_Comm MPICommunicator, unsigned short nGroups);
+
+  /*!
+   * \brief Copy the state (solution at time n and n-1 of all solvers and grid levels) into a vector.
+   * \param[out] state - Slab state.
+   */
+  void GetState(vector<su2double>& state) const;
+
+  /*!
+   * \brief Set the state of all solvers and grid levels from a vector.
+   * \param[in] state - Slab state.
+   */
+  void SetState(const vector<su2double>& state);
+
+  /*!
+   * \brief Change the time step of the solution at time n-1, by linear extrapolation, for the coarse propagator.
+   * \param[in,out] state - Slab state.
+   * \param[in] ratio - Ratio between the new and old time steps.
+   */
+  void ScaleTimeStep(vector<su2double>& state, su2double ratio) const;
+
+  /*!
+   * \brief Inner iterations of a time step without the monitor, i.e. without history output, time averages and
+   * convergence checks of the history fields. Used by the propagators whose results are not the final solution.
+   */
+  void RunWithoutOutput();
+
+  /*!
+   * \brief Advance a state over the slab of this rank with the fine propagator.
+   * \param[in,out] state - Initial state on entry, final state on exit.
+   * \param[in] output - Monitor the time iterations and write their history and output files.
+   */
+  void FinePropagator(vector<su2double>& state, bool output);
+
+  /*!
+   * \brief Advance a state over the slab of this rank with the coarse propagator.
+   * \param[in,out] state - Initial state on entry, final state on exit.
+   */
+  void CoarsePropagator(vector<su2double>& state);
+
+ public:
+  /*!
+   * \brief Constructor of the class.
+   * \param[in] confFile - Configuration file name.
+   * \param[in] val_nZone - Total number of zones.
+   * \param[in] MPICommunicator - MPI communicator for SU2.
+   * \param[in] nGroups - Number of time slabs.
+   */
+  CPararealDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator, unsigned short nGroups);
+
+  /*!
+   * \brief Destructor of the class.
+   */
+  ~CPararealDriver(void) override;
+
+  /*!
+   * \brief [Overload] Launch the Parareal iterations.
+   */
+  void StartSolver() override;
+};
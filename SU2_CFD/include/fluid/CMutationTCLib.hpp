@@ -35,6 +35,8 @@
 /*!
  * \derived class CMutationTCLib
  * \brief Child class for Mutation++ nonequilibrium gas model.
+ * \note The Mutation++ mixture object is not reentrant, even the const methods set its state, thus each thread
+ * needs its own object.
  * \author:  C. Garbacz
  */
 class CMutationTCLib : public CNEMOGas {
@@ -43,7 +45,7 @@ private:
 
   std::unique_ptr<Mutation::Mixture> mix; /*!< \brief Pointer to object Mixture from Mutation++ library. */
 
-  vector<su2double> Cv_ks,                /*!< \brief Species specific heats at constant volume. */
+  mutable vector<su2double> Cv_ks,        /*!< \brief Species specific heats at constant volume. */
   es,                                     /*!< \brief Species energies. */
   omega_vec;                              /*!< \brief Dummy vector for vibrational energy source term. */
 
@@ -67,7 +69,7 @@ public:
    * \param[in] T    - Translational/Rotational temperature.
    * \param[in] Tve  - Vibrational/Electronic temperature.
    */
-  void SetTDStateRhosTTv(vector<su2double>& val_rhos, su2double val_temperature, su2double val_temperature_ve) final;
+  void SetTDStateRhosTTv(const su2double* val_rhos, su2double val_temperature, su2double val_temperature_ve) final;
 
   /*!
    * \brief Get species T-R specific heats at constant volume.
@@ -77,17 +79,18 @@ public:
   /*!
    * \brief Compute species V-E specific heats at constant volume.
    */
-  vector<su2double>& ComputeSpeciesCvVibEle(su2double val_T) final;
+  void ComputeSpeciesCvVibEle(su2double val_T, su2double* val_cvves) const final;
 
   /*!
    * \brief Compute mixture energies (total internal energy and vibrational energy).
    */
-  vector<su2double>& ComputeMixtureEnergies() final;
+  void ComputeMixtureEnergies(const su2double* val_rhos, su2double val_T, su2double val_Tve,
+                              su2double* val_energies) const final;
 
   /*!
    * \brief Compute vector of species V-E energy.
    */
-  vector<su2double>& ComputeSpeciesEve(su2double val_T, bool vibe_only = false) final;
+  void ComputeSpeciesEve(su2double val_T, su2double* val_eves, bool vibe_only = false) const final;
 
   /*!
    * \brief Compute species net production rates.
@@ -104,12 +107,13 @@ public:
   /*!
    * \brief Compute species enthalpies.
    */
-  vector<su2double>& ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, su2double *val_eves) final;
+  void ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, const su2double *val_eves,
+                              su2double* val_hs) const final;
 
   /*!
    * \brief Get species diffusion coefficients.
    */
-  vector<su2double>& GetDiffusionCoeff() final;
+  void GetDiffusionCoeff(su2double* val_Ds) final;
 
   /*!
    * \brief Get viscosity.
@@ -120,12 +124,13 @@ public:
   /*!
    * \brief Get T-R and V-E thermal conductivities vector.
    */
-  vector<su2double>& GetThermalConductivities() final;
+  void GetThermalConductivities(su2double* val_conductivities) final;
 
   /*!
    * \brief Compute translational and vibrational temperatures vector.
    */
-  vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel, su2double Tve_old) final;
+  void ComputeTemperatures(const su2double* val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel,
+                           su2double Tve_old, su2double* val_temperatures) const final;
 
   /*!
    * \brief Get species molar mass.
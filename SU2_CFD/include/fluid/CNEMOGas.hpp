@@ -33,6 +33,9 @@
 /*!
  * \class CNEMOGas
  * \brief Class for defining the 2T (trans-rotational and vibro-electronic) nonequilibrium gas model.
+ * \note The const methods write their results to arrays owned by the caller and do not depend on the mixture state
+ * (SetTDState*), in the native library (CSU2TCLib) they can be used concurrently by multiple threads. The other
+ * methods use the mixture state, thus each thread needs its own object.
  * \author: C. Garbacz, W. Maier, S. R. Copeland
  */
 class CNEMOGas : public CFluidModel {
@@ -99,7 +102,7 @@ public:
    * \param[in] T    - Translational/Rotational temperature.
    * \param[in] Tve  - Vibrational/Electronic temperature.
    */
-  virtual void SetTDStateRhosTTv(vector<su2double>& val_rhos, su2double val_temperature, su2double val_temperature_ve){}
+  virtual void SetTDStateRhosTTv(const su2double* val_rhos, su2double val_temperature, su2double val_temperature_ve){}
 
   /*!
    * \brief Set mixture thermodynamic state.
@@ -117,13 +120,20 @@ public:
 
   /*!
    * \brief Compute species V-E specific heats at constant volume.
+   * \param[in] val_T - Vibrational/Electronic temperature.
+   * \param[out] val_cvves - Species V-E specific heats (nSpecies).
    */
-  virtual vector<su2double>& ComputeSpeciesCvVibEle(su2double val_T) = 0;
+  virtual void ComputeSpeciesCvVibEle(su2double val_T, su2double* val_cvves) const = 0;
 
   /*!
    * \brief Compute mixture energies (total internal energy and vibrational energy).
+   * \param[in] val_rhos - Species partial densities.
+   * \param[in] val_T - Translational/Rotational temperature.
+   * \param[in] val_Tve - Vibrational/Electronic temperature.
+   * \param[out] val_energies - Mixture energies (nEnergyEq).
    */
-  virtual vector<su2double>& ComputeMixtureEnergies() = 0;
+  virtual void ComputeMixtureEnergies(const su2double* val_rhos, su2double val_T, su2double val_Tve,
+                                      su2double* val_energies) const = 0;
 
   /*!
    * \brief Compute species net production rates.
@@ -153,18 +163,27 @@ public:
 
   /*!
    * \brief Compute vector of species V-E energy.
+   * \param[in] val_T - Vibrational/Electronic temperature.
+   * \param[out] val_eves - Species V-E energies (nSpecies).
+   * \param[in] vibe_only - Only the vibrational part.
    */
-  virtual vector<su2double>& ComputeSpeciesEve(su2double val_T, bool vibe_only = false) = 0;
+  virtual void ComputeSpeciesEve(su2double val_T, su2double* val_eves, bool vibe_only = false) const = 0;
 
   /*!
    * \brief Compute species enthalpies.
+   * \param[in] val_T - Translational/Rotational temperature.
+   * \param[in] val_Tve - Vibrational/Electronic temperature.
+   * \param[in] val_eves - Species V-E energies.
+   * \param[out] val_hs - Species enthalpies (nSpecies).
    */
-  virtual vector<su2double>& ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, su2double *val_eves) = 0;
+  virtual void ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, const su2double *val_eves,
+                                      su2double* val_hs) const = 0;
 
   /*!
-   * \brief Get species diffusion coefficients.
+   * \brief Get species diffusion coefficients (of the current mixture state).
+   * \param[out] val_Ds - Species diffusion coefficients (nSpecies).
    */
-  virtual vector<su2double>& GetDiffusionCoeff() = 0;
+  virtual void GetDiffusionCoeff(su2double* val_Ds) = 0;
 
   /*!
    * \brief Get viscosity.
@@ -172,14 +191,22 @@ public:
   virtual su2double GetViscosity() { return 0; }
 
   /*!
-   * \brief Get T-R and V-E thermal conductivities vector.
+   * \brief Get T-R and V-E thermal conductivities (of the current mixture state).
+   * \param[out] val_conductivities - Thermal conductivities (nEnergyEq).
    */
-  virtual vector<su2double>& GetThermalConductivities() = 0;
+  virtual void GetThermalConductivities(su2double* val_conductivities) = 0;
 
   /*!
-   * \brief Compute translational and vibrational temperatures vector.
+   * \brief Compute translational and vibrational temperatures.
+   * \param[in] val_rhos - Species partial densities.
+   * \param[in] rhoEmix - Total energy per unit volume.
+   * \param[in] rhoEve - Vibrational/Electronic energy per unit volume.
+   * \param[in] rhoEvel - Kinetic energy per unit volume.
+   * \param[in] Tve_old - Previous Vibrational/Electronic temperature (initial guess).
+   * \param[out] val_temperatures - T and Tve.
    */
-  virtual vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel, su2double Tve_old) = 0;
+  virtual void ComputeTemperatures(const su2double* val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel,
+                                   su2double Tve_old, su2double* val_temperatures) const = 0;
 
   /*!
    * \brief Compute speed of sound.
@@ -204,7 +231,7 @@ public:
   /*!
    * \brief Compute derivative of pressure w.r.t. conservative variables.
    */
-  void ComputedPdU(const su2double *V, const vector<su2double>& val_eves, su2double *val_dPdU);
+  void ComputedPdU(const su2double *V, const su2double* val_eves, su2double *val_dPdU);
 
   /*!
    * \brief Compute derivative of temperature w.r.t. conservative variables.
@@ -214,7 +241,7 @@ public:
   /*!
    * \brief Compute derivative of vibrational temperature w.r.t. conservative variables.
    */
-  void ComputedTvedU(const su2double *V, const vector<su2double>& val_eves, su2double *val_dTvedU);
+  void ComputedTvedU(const su2double *V, const su2double* val_eves, su2double *val_dTvedU);
 
   /*!
    * \brief Set the translational temperature.
@@ -27,7 +27,9 @@
 
 #pragma once
 
+#include <memory>
 #include "CNEMOGas.hpp"
+#include "../../../Common/include/toolboxes/C1DInterpolation.hpp"
 
 /*!
  * \derived class CSU2TCLib
@@ -89,6 +91,18 @@ private:
   const su2double C2_r = 0.157;
   const su2double c2_r = 0.0274;
 
+  vector<su2activematrix> RxnConstantTables; /*!< \brief Equilibrium reaction constants of each reaction. */
+
+  /*!
+   * \brief Functions of temperature tabulated w.r.t. log(T), shared by all instances of the same gas model.
+   */
+  struct CTemperatureTables {
+    vector<CHermiteTable> Eve;         /*!< \brief Vib.-el. energy of each species vs log(Tve), derivative is Tve*Cvve. */
+    vector<CHermiteTable> LogRate;     /*!< \brief Log of the Arrhenius rate of each reaction vs log(Trxn). */
+    std::array<CHermiteTable,5> Keq;   /*!< \brief Temperature terms of log(Keq) vs log(Trxn), [1] is constant and unused. */
+  };
+  std::shared_ptr<const CTemperatureTables> Tables; /*!< \brief Tables of the gas model, null if not tabulated. */
+
   su2activematrix CharElTemp,    /*!< \brief Characteristic temperature of electron states. */
   ElDegeneracy,                  /*!< \brief Degeneracy of electron states. */
   RxnConstantTable,              /*!< \brief Table of chemical equiibrium reaction constants */
@@ -107,6 +121,7 @@ private:
   coeff, eta, epsilon, T_min,
   Trxnf, Trxnb,
   Thf, Thb, dThf, dThb,
+  dlnkf, dlnkb,                 /*!< \brief Derivatives of log(kf) and log(kb) w.r.t. the log of the rate-controlling temperatures. */
   theta, af, bf, ab, bb;
 
   vector<su2double>
@@ -135,7 +150,7 @@ public:
    * \param[in] T    - Translational/Rotational temperature.
    * \param[in] Tve  - Vibrational/Electronic temperature.
    */
-  void SetTDStateRhosTTv(vector<su2double>& val_rhos, su2double val_temperature, su2double val_temperature_ve) final;
+  void SetTDStateRhosTTv(const su2double* val_rhos, su2double val_temperature, su2double val_temperature_ve) final;
 
   /*!
    * \brief Get species molar mass.
@@ -150,17 +165,18 @@ public:
   /*!
    * \brief Compute species V-E specific heats at constant volume.
    */
-  vector<su2double>& ComputeSpeciesCvVibEle(su2double val_T) final;
+  void ComputeSpeciesCvVibEle(su2double val_T, su2double* val_cvves) const final;
 
   /*!
    * \brief Compute mixture energies (total internal energy and vibrational energy).
    */
-  vector<su2double>& ComputeMixtureEnergies() final;
+  void ComputeMixtureEnergies(const su2double* val_rhos, su2double val_T, su2double val_Tve,
+                              su2double* val_energies) const final;
 
   /*!
    * \brief Compute species V-E energy.
    */
-  vector<su2double>& ComputeSpeciesEve(su2double val_T, bool vibe_only = false) final;
+  void ComputeSpeciesEve(su2double val_T, su2double* val_eves, bool vibe_only = false) const final;
 
   /*!
    * \brief Compute species net production rates.
@@ -191,12 +207,13 @@ public:
   /*!
    * \brief Compute species enthalpies.
    */
-  vector<su2double>& ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, su2double *val_eves) final;
+  void ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, const su2double *val_eves,
+                              su2double* val_hs) const final;
 
   /*!
    * \brief Get species diffusion coefficients.
    */
-  vector<su2double>& GetDiffusionCoeff() final;
+  void GetDiffusionCoeff(su2double* val_Ds) final;
 
   /*!
    * \brief Get viscosity.
@@ -206,12 +223,13 @@ public:
   /*!
    * \brief Get T-R and V-E thermal conductivities vector.
    */
-  vector<su2double>& GetThermalConductivities() final;
+  void GetThermalConductivities(su2double* val_conductivities) final;
 
   /*!
    * \brief Compute translational and vibrational temperatures vector.
    */
-  vector<su2double>& ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel, su2double Tve_old) final;
+  void ComputeTemperatures(const su2double* val_rhos, su2double rhoEmix, su2double rhoEve, su2double rhoEvel,
+                           su2double Tve_old, su2double* val_temperatures) const final;
 
   private:
 
@@ -220,6 +238,36 @@ public:
   */
   void GetChemistryEquilConstants(unsigned short iReaction);
 
+  /*!
+   * \brief Build the tables of the temperature dependent properties, or get them from other instances.
+   */
+  void SetTemperatureTables();
+
+  /*!
+   * \brief Analytic V-E energy of one species.
+   * \param[in] iSpecies - Species index.
+   * \param[in] val_T - Vibrational/Electronic temperature.
+   * \param[in] vibe_only - Only the vibrational part.
+   */
+  su2double SpeciesEve(unsigned short iSpecies, su2double val_T, bool vibe_only) const;
+
+  /*!
+   * \brief Analytic V-E specific heat at constant volume of one species.
+   * \param[in] iSpecies - Species index.
+   * \param[in] val_T - Vibrational/Electronic temperature.
+   */
+  su2double SpeciesCvVibEle(unsigned short iSpecies, su2double val_T) const;
+
+  /*!
+   * \brief Compute the mixture V-E energy and specific heat per unit volume (for the Tve iterations).
+   * \param[in] val_rhos - Species partial densities.
+   * \param[in] val_Tve - Vibrational/Electronic temperature.
+   * \param[out] rhoEve - Density times V-E energy.
+   * \param[out] rhoCvve - Density times V-E specific heat.
+   */
+  void ComputeMixtureEveCvve(const su2double* val_rhos, su2double val_Tve, su2double& rhoEve,
+                             su2double& rhoCvve) const;
+
   /*!
    * \brief Calculates constants used for Keq correlation.
    * \param[out] A - Reference to coefficient array.
@@ -32,6 +32,7 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/tracy_structure.hpp"
 #include "correctGradientsSymmetry.hpp"
 
 namespace detail {
@@ -191,6 +192,7 @@ template <class FieldType, class GradientType>
 void computeGradientsGreenGauss(CSolver* solver, MPI_QUANTITIES kindMpiComm, PERIODIC_QUANTITIES kindPeriodicComm,
                                 CGeometry& geometry, const CConfig& config, const FieldType& field,
                                 const size_t varBegin, const size_t varEnd, const int idxVel, GradientType& gradient) {
+  SU2_ZONE_SCOPED_N("Gradients_GreenGauss");
   switch (geometry.GetnDim()) {
     case 2:
       detail::computeGradientsGreenGauss<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config, field, varBegin,
@@ -28,6 +28,7 @@
 
 #include "../../../Common/include/parallelization/omp_structure.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/tracy_structure.hpp"
 #include "correctGradientsSymmetry.hpp"
 
 namespace detail {
@@ -349,6 +350,7 @@ void computeGradientsLeastSquares(CSolver* solver,
                                   const int idxVel,
                                   GradientType& gradient,
                                   RMatrixType& Rmatrix) {
+  SU2_ZONE_SCOPED_N("Gradients_LeastSquares");
   switch (geometry.GetnDim()) {
   case 2:
     detail::computeGradientsLeastSquares<2>(solver, kindMpiComm, kindPeriodicComm, geometry, config,
@@ -29,6 +29,7 @@
 #pragma once
 
 #include "../../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../../Common/include/containers/C2DContainer.hpp"
 
 #include <cmath>
 #include <string>
@@ -38,6 +39,7 @@
 #include <iostream>
 #include <stdlib.h>
 #include <stdio.h>
+#include <vector>
 
 class CConfig;
 class CGeometry;
@@ -71,6 +73,10 @@ protected:
   unsigned short nSpanMaxAllZones = 0;
 
   unsigned short nVar = 0;
+
+  /*--- Persistent buffers of the point to point transfer, per interface. ---*/
+  vector<su2activematrix> SendBuffer, RecvBuffer;
+
   static constexpr size_t MAXNDIM = 3;  /*!< \brief Max number of space dimensions, used in some static arrays. */
 
 public:
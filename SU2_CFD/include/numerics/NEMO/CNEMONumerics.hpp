@@ -69,6 +69,8 @@ public:
 
   CNEMOGas *fluidmodel;
 
+  vector<su2double> eve_aux, hs_aux; /*!< \brief Workspaces for the species V-E energies and enthalpies. */
+
   /*!
    * \brief Constructor of the class.
    * \param[in] val_nDim - Number of dimensions of the problem.
@@ -223,7 +225,8 @@ public:
     su2double RuSI= UNIVERSAL_GAS_CONSTANT;
     su2double Ru  = 1000.0*RuSI;
     const auto& Ds  = val_diffusion_coeff;
-    const auto& hs = fluidmodel->ComputeSpeciesEnthalpy(T, Tve, val_Mean_Eve);
+    fluidmodel->ComputeSpeciesEnthalpy(T, Tve, val_Mean_Eve, hs_aux.data());
+    const auto& hs = hs_aux;
     const auto& Cvtr = fluidmodel->GetSpeciesCvTraRot();
     const auto& Ms = fluidmodel->GetSpeciesMolarMass();
 
@@ -74,6 +74,78 @@ public:
    */
   su2double Compute_Averaged_NodalStress(CElement *element_container, const CConfig *config) final;
 
+  /*!
+   * \brief Get the material parameters of an element, for the batched computation of the tangent matrix.
+   * \param[in] element - Element whose properties are used.
+   * \param[in] config - Definition of the problem.
+   * \param[out] lambda - First Lame parameter, modified for plane stress.
+   * \param[out] mu - Shear modulus.
+   * \param[out] thermal - Thermal stress per unit of temperature difference.
+   * \param[out] tempRef - Reference temperature of the thermal expansion.
+   */
+  void GetElementParameters(const CElement *element, const CConfig *config, su2double& lambda, su2double& mu,
+                            su2double& thermal, su2double& tempRef);
+
+  /*!
+   * \brief Compute the tangent matrix and thermal stress term of a batch of elements of the same type, e.g. one
+   *        element per SIMD lane, this is equivalent to Compute_Tangent_Matrix but uses the isotropic form of BT.D.B.
+   * \param[in] element - Element type, only its shape functions and quadrature are used.
+   * \param[in] Coord - Nodal (reference) coordinates of the elements.
+   * \param[in] Disp - Nodal displacements of the elements.
+   * \param[in] Temperature - Nodal temperatures of the elements.
+   * \param[in] lambda, mu, thermal, tempRef - Material parameters, see GetElementParameters.
+   * \param[out] Kab - Tangent matrix, a nDim x nDim block (row-major) for each pair of nodes.
+   * \param[out] Kt_a - Stress term (K times the displacements, plus thermal stress) of each node.
+   */
+  template <class T, unsigned short NGAUSS, unsigned short NNODE, unsigned short NDIM>
+  static void ComputeBatchTangentMatrix(const CElementWithKnownSizes<NGAUSS, NNODE, NDIM>& element,
+                                        const T Coord[][NDIM], const T Disp[][NDIM], const T* Temperature, const T& lambda, const T& mu,
+                                        const T& thermal, const T& tempRef, T Kab[][NNODE][NDIM * NDIM],
+                                        T Kt_a[][NDIM]) {
+    T GradNi[NGAUSS][NNODE][NDIM], DetJac[NGAUSS];
+    element.ComputeGradBatch(Coord, GradNi, DetJac);
+
+    for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+      for (unsigned short iDim = 0; iDim < NDIM; iDim++) Kt_a[iNode][iDim] = 0.0;
+      for (unsigned short jNode = 0; jNode < NNODE; jNode++)
+        for (unsigned short iVar = 0; iVar < NDIM * NDIM; iVar++) Kab[iNode][jNode][iVar] = 0.0;
+    }
+
+    for (unsigned short iGauss = 0; iGauss < NGAUSS; iGauss++) {
+      const T wJ = element.GetWeight(iGauss) * DetJac[iGauss];
+
+      T temp = 0.0;
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++) temp += element.GetNi(iNode, iGauss) * Temperature[iNode];
+      const T thermalStress = wJ * thermal * (temp - tempRef);
+
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+        const T* dNa = GradNi[iGauss][iNode];
+        for (unsigned short iDim = 0; iDim < NDIM; iDim++) Kt_a[iNode][iDim] += thermalStress * dNa[iDim];
+
+        /*--- BT.D.B = lambda dNa_i dNb_j + mu (dNa_j dNb_i + delta_ij dNa.dNb) ---*/
+        for (unsigned short jNode = 0; jNode < NNODE; jNode++) {
+          const T* dNb = GradNi[iGauss][jNode];
+          T dot = 0.0;
+          for (unsigned short iDim = 0; iDim < NDIM; iDim++) dot += dNa[iDim] * dNb[iDim];
+          for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+            for (unsigned short jDim = 0; jDim < NDIM; jDim++) {
+              Kab[iNode][jNode][iDim * NDIM + jDim] += wJ * (lambda * dNa[iDim] * dNb[jDim] + mu * dNa[jDim] * dNb[iDim]);
+            }
+            Kab[iNode][jNode][iDim * NDIM + iDim] += wJ * mu * dot;
+          }
+        }
+      }
+    }
+
+    /*--- Stress term of the displacements. ---*/
+
+    for (unsigned short iNode = 0; iNode < NNODE; iNode++)
+      for (unsigned short jNode = 0; jNode < NNODE; jNode++)
+        for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+          for (unsigned short jDim = 0; jDim < NDIM; jDim++)
+            Kt_a[iNode][iDim] += Kab[iNode][jNode][iDim * NDIM + jDim] * Disp[jNode][jDim];
+  }
+
 private:
   /*!
    * \brief Compute the constitutive matrix.
@@ -53,6 +53,130 @@ public:
    */
   ~CFEM_NeoHookean_Comp(void) override = default;
 
+  /*!
+   * \brief Check if the batched computation of the element terms supports this problem (not plane stress).
+   */
+  inline bool BatchSupported() const { return (nDim == 3) || !plane_stress; }
+
+  /*!
+   * \brief Get the material parameters of an element, for the batched computation of the element terms.
+   * \param[in] element - Element whose properties are used.
+   * \param[in] config - Definition of the problem.
+   * \param[out] lambda - First Lame parameter.
+   * \param[out] mu - Shear modulus.
+   * \param[out] thermal - Thermal stress per unit of temperature difference.
+   * \param[out] tempRef - Reference temperature of the thermal expansion.
+   */
+  void GetElementParameters(const CElement *element, const CConfig *config, su2double& lambda, su2double& mu,
+                            su2double& thermal, su2double& tempRef);
+
+  /*!
+   * \brief Compute the tangent matrix and nodal stress term of a batch of elements of the same type, e.g. one
+   *        element per SIMD lane, this is equivalent to Compute_Tangent_Matrix (or to Compute_NodalStress_Term)
+   *        but uses the isotropic form of BT.D.B, see BatchSupported.
+   * \param[in] element - Element type, only its shape functions and quadrature are used.
+   * \param[in] RefCoord - Nodal reference coordinates of the elements.
+   * \param[in] CurrCoord - Nodal current coordinates of the elements.
+   * \param[in] Temperature - Nodal temperatures of the elements.
+   * \param[in] lambda, mu, thermal, tempRef - Material parameters, see GetElementParameters.
+   * \param[out] Kab - Constitutive term of the tangent matrix, a nDim x nDim block (row-major) for each pair of nodes.
+   * \param[out] Ks_ab - Stress term of the tangent matrix (diagonal of the blocks) for each pair of nodes.
+   * \param[out] Kt_a - Nodal stress term of each node.
+   * \tparam TANGENT - Compute the tangent matrix, otherwise Kab and Ks_ab are not used.
+   */
+  template <bool TANGENT, class T, unsigned short NGAUSS, unsigned short NNODE, unsigned short NDIM>
+  static void ComputeBatchTerms(const CElementWithKnownSizes<NGAUSS, NNODE, NDIM>& element, const T RefCoord[][NDIM],
+                                const T CurrCoord[][NDIM], const T* Temperature, const T& lambda, const T& mu,
+                                const T& thermal, const T& tempRef, T Kab[][NNODE][NDIM * NDIM], T Ks_ab[][NNODE],
+                                T Kt_a[][NDIM]) {
+    T GradNi_Ref[NGAUSS][NNODE][NDIM], GradNi_Curr[NGAUSS][NNODE][NDIM], DetJac_Ref[NGAUSS], DetJac_Curr[NGAUSS];
+    element.ComputeGradBatch(RefCoord, GradNi_Ref, DetJac_Ref);
+    element.ComputeGradBatch(CurrCoord, GradNi_Curr, DetJac_Curr);
+
+    for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+      for (unsigned short iDim = 0; iDim < NDIM; iDim++) Kt_a[iNode][iDim] = 0.0;
+      if (!TANGENT) continue;
+      for (unsigned short jNode = 0; jNode < NNODE; jNode++) {
+        Ks_ab[iNode][jNode] = 0.0;
+        for (unsigned short iVar = 0; iVar < NDIM * NDIM; iVar++) Kab[iNode][jNode][iVar] = 0.0;
+      }
+    }
+
+    for (unsigned short iGauss = 0; iGauss < NGAUSS; iGauss++) {
+      const T wJ = element.GetWeight(iGauss) * DetJac_Curr[iGauss];
+
+      /*--- Deformation gradient, plane strain in 2D (F33 = 1). ---*/
+
+      T F_Mat[3][3];
+      for (unsigned short iVar = 0; iVar < 3; iVar++)
+        for (unsigned short jVar = 0; jVar < 3; jVar++) F_Mat[iVar][jVar] = 0.0;
+      if (NDIM == 2) F_Mat[2][2] = 1.0;
+
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++)
+        for (unsigned short iVar = 0; iVar < NDIM; iVar++)
+          for (unsigned short jVar = 0; jVar < NDIM; jVar++)
+            F_Mat[iVar][jVar] += CurrCoord[iNode][iVar] * GradNi_Ref[iGauss][iNode][jVar];
+
+      const T J_F = F_Mat[0][0]*F_Mat[1][1]*F_Mat[2][2] + F_Mat[0][1]*F_Mat[1][2]*F_Mat[2][0] +
+                    F_Mat[0][2]*F_Mat[1][0]*F_Mat[2][1] - F_Mat[0][2]*F_Mat[1][1]*F_Mat[2][0] -
+                    F_Mat[1][2]*F_Mat[2][1]*F_Mat[0][0] - F_Mat[2][2]*F_Mat[0][1]*F_Mat[1][0];
+      T logJ;
+      for (size_t k = 0; k < T::Size; ++k) logJ[k] = log(J_F[k]);
+
+      T temp = 0.0;
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++) temp += element.GetNi(iNode, iGauss) * Temperature[iNode];
+
+      /*--- Cauchy stress, see Compute_Stress_Tensor (only the in-plane components are needed in 2D). ---*/
+
+      const T Mu_J = mu / J_F;
+      const T pressure = lambda / J_F * logJ + thermal * (temp - tempRef) - Mu_J;
+      T Stress[NDIM][NDIM];
+      for (unsigned short iVar = 0; iVar < NDIM; iVar++) {
+        for (unsigned short jVar = 0; jVar < NDIM; jVar++) {
+          T b_ij = 0.0;
+          for (unsigned short kVar = 0; kVar < NDIM; kVar++) b_ij += F_Mat[iVar][kVar] * F_Mat[jVar][kVar];
+          Stress[iVar][jVar] = Mu_J * b_ij;
+        }
+        Stress[iVar][iVar] += pressure;
+      }
+
+      /*--- Constitutive parameters, see Compute_Constitutive_Matrix. ---*/
+
+      const T Mu_p = (mu - lambda * logJ) / J_F;
+      const T Lambda_p = lambda / J_F;
+
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+        const T* dNa = GradNi_Curr[iGauss][iNode];
+
+        T StressGrad[NDIM];
+        for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+          StressGrad[iDim] = 0.0;
+          for (unsigned short jDim = 0; jDim < NDIM; jDim++) StressGrad[iDim] += Stress[iDim][jDim] * dNa[jDim];
+          Kt_a[iNode][iDim] += wJ * StressGrad[iDim];
+        }
+        if (!TANGENT) continue;
+
+        /*--- BT.D.B = lambda' dNa_i dNb_j + mu' (dNa_j dNb_i + delta_ij dNa.dNb), Ks = dNa.sigma.dNb ---*/
+        for (unsigned short jNode = 0; jNode < NNODE; jNode++) {
+          const T* dNb = GradNi_Curr[iGauss][jNode];
+          T dot = 0.0, stressTerm = 0.0;
+          for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+            dot += dNa[iDim] * dNb[iDim];
+            stressTerm += StressGrad[iDim] * dNb[iDim];
+          }
+          Ks_ab[iNode][jNode] += wJ * stressTerm;
+          for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+            for (unsigned short jDim = 0; jDim < NDIM; jDim++) {
+              Kab[iNode][jNode][iDim * NDIM + jDim] +=
+                  wJ * (Lambda_p * dNa[iDim] * dNb[jDim] + Mu_p * dNa[jDim] * dNb[iDim]);
+            }
+            Kab[iNode][jNode][iDim * NDIM + iDim] += wJ * Mu_p * dot;
+          }
+        }
+      }
+    }
+  }
+
 private:
   /*!
    * \brief Compute the plane stress term.
@@ -145,3 +145,52 @@ CNumericsSIMD* CNumericsSIMD::CreateNumerics(const CConfig& config, int nDim, in
 
   return nullptr;
 }
+
+passivedouble CNumericsSIMD::FlopsPerEdge(const CConfig& config, int nDim, int iMesh) {
+  /*--- A multiply-add counts as 2 operations, only the terms that scale with nVar, nDim, or their products are
+   * counted (geometry, averages and the other scalar work are a small fraction on the finest grid). ---*/
+  const passivedouble nVar = nDim + 2;
+  const bool finestGrid = (iMesh == MESH_0);
+  const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
+  const bool idealGas = (config.GetKind_FluidModel() == STANDARD_AIR) || (config.GetKind_FluidModel() == IDEAL_GAS);
+
+  /*--- Projected inviscid fluxes of i and j, and their Jacobians. ---*/
+  passivedouble flops = 8 * nVar + (implicit ? 6 * nVar * nVar : 0);
+
+  /*--- Matrix dissipation, P and P^-1, the product P |Lambda| P^-1, and its product with the jump. ---*/
+  const passivedouble matrixDissipation = 6 * nVar * nVar + 3 * nVar * nVar * nVar + 2 * nVar * nVar;
+
+  switch (config.GetKind_ConvNumScheme_Flow()) {
+    case SPACE_UPWIND:
+      if (!idealGas || (config.GetKind_Upwind_Flow() != UPWIND::ROE)) return 0.0;
+      /*--- MUSCL reconstruction of the primitives of both points (gradient projection and limiter). ---*/
+      if (finestGrid && config.GetMUSCL_Flow()) flops += 2 * nVar * (2 * nDim + 4);
+      flops += matrixDissipation + (implicit ? 2 * nVar * nVar : 0);
+      break;
+
+    case SPACE_CENTERED:
+      switch (finestGrid ? config.GetKind_Centered_Flow() : CENTERED::LAX) {
+        case CENTERED::NONE:
+          return 0.0;
+        case CENTERED::JST_MAT:
+          flops += matrixDissipation + 2 * nVar * nVar;
+          break;
+        default:
+          /*--- Scalar dissipation of the jump (and of the undivided Laplacians for JST). ---*/
+          flops += 10 * nVar;
+          break;
+      }
+      break;
+
+    default:
+      return 0.0;
+  }
+
+  if (config.GetViscous()) {
+    /*--- Corrected average gradient, stress tensor, heat flux, viscous flux, and its Jacobians. ---*/
+    flops += 6 * nDim * nVar + 4 * nDim * nDim + 4 * nDim + 2 * nDim * nVar + (implicit ? 2 * nDim * nVar * nVar : 0);
+  }
+
+  /*--- Update of the residuals of i and j, and of the four blocks of the Jacobian. ---*/
+  return flops + 2 * nVar + (implicit ? 4 * nVar * nVar : 0);
+}
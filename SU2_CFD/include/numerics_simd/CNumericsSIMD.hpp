@@ -97,4 +97,14 @@ public:
    */
   static CNumericsSIMD* CreateNumerics(const CConfig& config, int nDim, int iMesh, const CVariable* turbVars = nullptr);
 
+  /*!
+   * \brief Leading order estimate of the floating point operations per edge of the numerics created by the factory.
+   * \note Used to declare the work of the edge loop to the region profiler (CRegionProfiler::AddFlops).
+   * \param[in] config - Problem definitions.
+   * \param[in] nDim - 2D or 3D.
+   * \param[in] iMesh - Grid index.
+   * \return Operations per edge, 0 if the factory does not create numerics for the configuration.
+   */
+  static passivedouble FlopsPerEdge(const CConfig& config, int nDim, int iMesh);
+
 };
@@ -51,6 +51,7 @@ protected:
   const su2double gamma;
   const su2double fixFactor;
   const bool dynamicGrid;
+  const bool externalFlux;
   const su2double stretchParam = 0.3;
 
   /*!
@@ -60,7 +61,8 @@ protected:
   CCenteredBase(const CConfig& config, Ts&... args) : Base(config, args...),
     gamma(config.GetGamma()),
     fixFactor(config.GetCent_Jac_Fix_Factor()),
-    dynamicGrid(config.GetDynamic_Grid()) {
+    dynamicGrid(config.GetDynamic_Grid()),
+    externalFlux(config.GetAD_ExternalFlux()) {
   }
 
   /*!
@@ -89,16 +91,16 @@ public:
                    CSysVector<su2double>& vector,
                    SparseMatrixType& matrix) const final {
 
-    /*--- Start preaccumulation, inputs are registered
-     *    automatically in "gatherVariables". ---*/
-    AD::StartPreacc();
-
     const bool implicit = (config.GetKind_TimeIntScheme() == EULER_IMPLICIT);
     const auto& solution = static_cast<const CEulerVariable&>(solution_);
 
     const auto iPoint = geometry.edges->GetNode(iEdge,0);
     const auto jPoint = geometry.edges->GetNode(iEdge,1);
 
+    /*--- Start preaccumulation, inputs are registered
+     *    automatically in "gatherVariables". ---*/
+    AD::StartPreacc();
+
     /*--- Geometric properties. ---*/
 
     const auto normal = gatherVariables<nDim>(iEdge, geometry.edges->GetNormal());
@@ -133,9 +135,13 @@ public:
     }
     diffU(nVar-1) = V.i.density()*V.i.enthalpy() - V.j.density()*V.j.enthalpy();
 
-    /*--- Inviscid fluxes and Jacobians. ---*/
+    /*--- Inviscid fluxes and Jacobians. When recording, the central flux may be taped as an external
+     *    function with a hand-written adjoint instead of as statements (without preaccumulation this
+     *    reduces the tape, with preaccumulation it reduces the cost of computing the edge Jacobian). ---*/
 
-    auto flux = inviscidProjFlux(avgV, avgU, normal);
+    VectorDbl<nVar> flux;
+    if (externalFlux) flux = centralInviscidFlux(V, normal);
+    else flux = inviscidProjFlux(avgV, avgU, normal);
 
     MatrixDbl<nVar> jac_i, jac_j;
     if (implicit) {
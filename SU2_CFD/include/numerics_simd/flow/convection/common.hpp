@@ -322,6 +322,200 @@ FORCEINLINE VectorDbl<nDim+2> inviscidProjFlux(const PrimVarType& V,
   return flux;
 }
 
+/*!
+ * \brief Projected inviscid flux of the average of two states, on plain arrays.
+ * \note This is the primal of the hand-written adjoint in centralInviscidFlux_b. The inputs "x" are the
+ * velocity (nDim), pressure, density, and enthalpy of state i, the same for state j, and the normal (nDim).
+ * \param[in] x - Inputs, 3*nDim+6 values.
+ * \param[out] y - Flux, nDim+2 values.
+ */
+template<size_t nDim, class Scalar>
+FORCEINLINE void centralInviscidFlux_p(const Scalar* x, Scalar* y) {
+  constexpr size_t nState = nDim+3;
+  const Scalar* normal = x + 2*nState;
+
+  Scalar avgV[nState];
+  for (size_t iVar = 0; iVar < nState; ++iVar) {
+    avgV[iVar] = 0.5 * (x[iVar] + x[nState+iVar]);
+  }
+  const Scalar& pressure = avgV[nDim];
+  const Scalar& density = avgV[nDim+1];
+  const Scalar& enthalpy = avgV[nDim+2];
+
+  Scalar projVel = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    projVel += avgV[iDim] * normal[iDim];
+  }
+  const Scalar mdot = density * projVel;
+
+  y[0] = mdot;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    y[iDim+1] = mdot * avgV[iDim] + normal[iDim] * pressure;
+  }
+  y[nDim+1] = mdot * enthalpy;
+}
+
+/*!
+ * \brief Hand-written forward (tangent) of centralInviscidFlux_p, i.e. y_d = (dy/dx) x_d, also computes y.
+ * \param[in] x - Inputs, see centralInviscidFlux_p.
+ * \param[in] x_d - Tangent of the inputs, 3*nDim+6 values.
+ * \param[out] y - Flux, nDim+2 values.
+ * \param[out] y_d - Tangent of the flux, nDim+2 values.
+ */
+template<size_t nDim, class Scalar>
+FORCEINLINE void centralInviscidFlux_d(const Scalar* x, const Scalar* x_d, Scalar* y, Scalar* y_d) {
+  constexpr size_t nState = nDim+3;
+  const Scalar* normal = x + 2*nState;
+  const Scalar* normal_d = x_d + 2*nState;
+
+  Scalar avgV[nState], avgV_d[nState];
+  for (size_t iVar = 0; iVar < nState; ++iVar) {
+    avgV[iVar] = 0.5 * (x[iVar] + x[nState+iVar]);
+    avgV_d[iVar] = 0.5 * (x_d[iVar] + x_d[nState+iVar]);
+  }
+  const Scalar& pressure = avgV[nDim];
+  const Scalar& density = avgV[nDim+1];
+  const Scalar& enthalpy = avgV[nDim+2];
+
+  Scalar projVel = 0.0, projVel_d = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    projVel += avgV[iDim] * normal[iDim];
+    projVel_d += avgV_d[iDim] * normal[iDim] + avgV[iDim] * normal_d[iDim];
+  }
+  const Scalar mdot = density * projVel;
+  const Scalar mdot_d = avgV_d[nDim+1] * projVel + density * projVel_d;
+
+  y[0] = mdot;
+  y_d[0] = mdot_d;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    y[iDim+1] = mdot * avgV[iDim] + normal[iDim] * pressure;
+    y_d[iDim+1] = mdot_d * avgV[iDim] + mdot * avgV_d[iDim] + normal_d[iDim] * pressure + normal[iDim] * avgV_d[nDim];
+  }
+  y[nDim+1] = mdot * enthalpy;
+  y_d[nDim+1] = mdot_d * enthalpy + mdot * avgV_d[nDim+2];
+}
+
+/*!
+ * \brief Hand-written reverse (adjoint) of centralInviscidFlux_p, i.e. x_b = (dy/dx)^T y_b.
+ * \param[in] x - Inputs, see centralInviscidFlux_p.
+ * \param[in] y_b - Adjoint of the flux, nDim+2 values.
+ * \param[out] x_b - Adjoint of the inputs (overwritten), 3*nDim+6 values.
+ */
+template<size_t nDim, class Scalar>
+FORCEINLINE void centralInviscidFlux_b(const Scalar* x, const Scalar* y_b, Scalar* x_b) {
+  constexpr size_t nState = nDim+3;
+  const Scalar* normal = x + 2*nState;
+
+  /*--- Recompute the forward sweep. ---*/
+
+  Scalar avgV[nState];
+  for (size_t iVar = 0; iVar < nState; ++iVar) {
+    avgV[iVar] = 0.5 * (x[iVar] + x[nState+iVar]);
+  }
+  const Scalar& pressure = avgV[nDim];
+  const Scalar& density = avgV[nDim+1];
+  const Scalar& enthalpy = avgV[nDim+2];
+
+  Scalar projVel = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    projVel += avgV[iDim] * normal[iDim];
+  }
+  const Scalar mdot = density * projVel;
+
+  /*--- Reverse sweep. ---*/
+
+  Scalar mdot_b = y_b[0] + y_b[nDim+1] * enthalpy;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    mdot_b += y_b[iDim+1] * avgV[iDim];
+  }
+
+  Scalar avgV_b[nState];
+  Scalar* normal_b = x_b + 2*nState;
+  avgV_b[nDim] = 0.0;
+  for (size_t iDim = 0; iDim < nDim; ++iDim) {
+    avgV_b[iDim] = y_b[iDim+1] * mdot + mdot_b * density * normal[iDim];
+    avgV_b[nDim] += y_b[iDim+1] * normal[iDim];
+    normal_b[iDim] = mdot_b * density * avgV[iDim] + y_b[iDim+1] * pressure;
+  }
+  avgV_b[nDim+1] = mdot_b * projVel;
+  avgV_b[nDim+2] = y_b[nDim+1] * mdot;
+
+  for (size_t iVar = 0; iVar < nState; ++iVar) {
+    x_b[iVar] = 0.5 * avgV_b[iVar];
+    x_b[nState+iVar] = 0.5 * avgV_b[iVar];
+  }
+}
+
+#ifdef CODI_REVERSE_TYPE
+/*!
+ * \brief Callbacks to register centralInviscidFlux_p/_d/_b as a CoDiPack external function, for all the lanes of a
+ * SIMD pack, the inputs and outputs of each lane are contiguous.
+ */
+template<size_t nDim>
+struct CCentralInviscidFluxExtFunc {
+  using Real = su2double::Real;
+  static constexpr size_t nIn = 3*nDim+6, nOut = nDim+2;
+
+  static void Primal(const Real* x, size_t m, Real* y, size_t, codi::ExternalFunctionUserData*) {
+    for (size_t k = 0; k < m/nIn; ++k) centralInviscidFlux_p<nDim>(x+k*nIn, y+k*nOut);
+  }
+
+  static void Forward(const Real* x, const Real* x_d, size_t m, Real* y, Real* y_d, size_t,
+                      codi::ExternalFunctionUserData*) {
+    for (size_t k = 0; k < m/nIn; ++k) centralInviscidFlux_d<nDim>(x+k*nIn, x_d+k*nIn, y+k*nOut, y_d+k*nOut);
+  }
+
+  static void Reverse(const Real* x, Real* x_b, size_t m, const Real*, const Real* y_b, size_t,
+                      codi::ExternalFunctionUserData*) {
+    for (size_t k = 0; k < m/nIn; ++k) centralInviscidFlux_b<nDim>(x+k*nIn, y_b+k*nOut, x_b+k*nIn);
+  }
+};
+#endif
+
+/*!
+ * \brief Projected inviscid flux of the average of two states (compressible flow), equivalent to inviscidProjFlux
+ * of the average primitives. When recording, the flux of the SIMD pack is added to the tape as one external function
+ * whose adjoint is the hand-written centralInviscidFlux_b. The tangent centralInviscidFlux_d is also registered,
+ * for preaccumulation regions whose Jacobian is computed in forward mode.
+ */
+template<class PrimVarType, size_t nDim>
+FORCEINLINE VectorDbl<nDim+2> centralInviscidFlux(const CPair<PrimVarType>& V,
+                                                  const VectorDbl<nDim>& normal) {
+  constexpr size_t nState = nDim+3;
+  VectorDbl<nDim+2> flux;
+
+#ifdef CODI_REVERSE_TYPE
+  if (AD::TapeActive()) {
+    using ExtFunc = CCentralInviscidFluxExtFunc<nDim>;
+    for (size_t k = 0; k < Double::Size; ++k) {
+      for (const auto* Vk : {&V.i, &V.j}) {
+        for (size_t iVar = 0; iVar < nState; ++iVar) AD::LocalFuncHelper.addInput(Vk->all(iVar+1)[k]);
+      }
+      for (size_t iDim = 0; iDim < nDim; ++iDim) AD::LocalFuncHelper.addInput(normal(iDim)[k]);
+    }
+    for (size_t k = 0; k < Double::Size; ++k) {
+      for (size_t iVar = 0; iVar < nDim+2; ++iVar) AD::LocalFuncHelper.addOutput(flux(iVar)[k]);
+    }
+    AD::LocalFuncHelper.callPrimalFunc(ExtFunc::Primal);
+    AD::LocalFuncHelper.addToTape(ExtFunc::Reverse, ExtFunc::Forward);
+    return flux;
+  }
+#endif
+
+  /*--- Velocity, pressure, density, and enthalpy are contiguous in the primitives. ---*/
+  Double x[3*nDim+6], y[nDim+2];
+  for (size_t iVar = 0; iVar < nState; ++iVar) {
+    x[iVar] = V.i.all(iVar+1);
+    x[nState+iVar] = V.j.all(iVar+1);
+  }
+  for (size_t iDim = 0; iDim < nDim; ++iDim) x[2*nState+iDim] = normal(iDim);
+
+  centralInviscidFlux_p<nDim>(x, y);
+
+  for (size_t iVar = 0; iVar < nDim+2; ++iVar) flux(iVar) = y[iVar];
+  return flux;
+}
+
 /*!
  * \brief Jacobian of the convective flux (compressible flow, ideal gas).
  */
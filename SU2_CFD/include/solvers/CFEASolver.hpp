@@ -29,6 +29,9 @@
 
 #include "CFEASolverBase.hpp"
 
+class CFEALinearElasticity;
+class CFEM_NeoHookean_Comp;
+
 /*!
  * \class CFEASolver
  * \ingroup Elasticity_Equations
@@ -88,7 +91,7 @@ protected:
 #ifdef HAVE_OMP
   vector<GridColor<> > ElemColoring;   /*!< \brief Element colors. */
   bool LockStrategy = false;           /*!< \brief Whether to use an OpenMP lock to guard updates of the Jacobian. */
-  vector<omp_lock_t> UpdateLocks;      /*!< \brief Locks that may be used to protect accesses to CSysMatrix/Vector in element loops. */
+  mutable vector<omp_lock_t> UpdateLocks; /*!< \brief Locks that may be used to protect accesses to CSysMatrix/Vector in element loops. */
 #else
   array<DummyGridColor<>,1> ElemColoring;      /*--- Behaves like a normal integer type. ---*/
   static constexpr bool LockStrategy = false;  /*--- Lock strategy is never needed for MPI-only. ---*/
@@ -100,6 +103,26 @@ protected:
   bool initial_calc = true;    /*!< \brief Becomes false after first call to Preprocessing. */
   bool body_forces = false;    /*!< \brief Whether any body force is active. */
 
+  /*!
+   * \brief Elements of each color sorted by type, each type padded (with nElement) to a multiple of the SIMD
+   * length, for the batched assembly of linear elasticity (empty if not used).
+   */
+  vector<vector<unsigned long> > ElemBatches;
+
+  /*--- Matrix-free (element by element) operator, the global matrix is not stored. ---*/
+
+  enum : unsigned short {FREE_NODE = 0, FIXED_NODE = 1, SYMMETRY_NODE = 2};
+
+  bool MatrixFree = false;                    /*!< \brief Whether the matrix-free operator replaces the Jacobian. */
+  vector<unsigned short> Constraint;          /*!< \brief Type of essential BC of each point, for the matrix-free operator. */
+  su2passivematrix ConstraintNormal;          /*!< \brief Normal of the symmetry plane of each (symmetry) point. */
+  su2passivematrix InvDiagBlocks;             /*!< \brief Inverse of the diagonal blocks of the operator (block Jacobi). */
+  CSysVector<JacobianScalarType> MatrixFreeRes, MatrixFreeSol; /*!< \brief Linear system in the type of the solver. */
+
+  CGeometry* MatrixFreeGeometry = nullptr;    /*!< \brief Geometry, numerics, and config used by the operator. */
+  CNumerics** MatrixFreeNumerics = nullptr;
+  const CConfig* MatrixFreeConfig = nullptr;
+
   /*!
    * \brief Pointer to the heat solver nodes to access temperature for coupled simulations.
    */
@@ -140,6 +163,162 @@ protected:
    */
   void HybridParallelInitialization(CGeometry* geometry);
 
+  /*!
+   * \brief Group the elements of each color by type, in batches of the SIMD length.
+   * \param[in] geometry - Geometrical definition of the problem.
+   */
+  void SetElementBatches(const CGeometry* geometry);
+
+  /*!
+   * \brief Compute the stiffness matrix and stress term of one element (scalar assembly).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iElem - Element index.
+   */
+  void Compute_StiffMatrix_Element(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                   unsigned long iElem);
+
+  /*!
+   * \brief Compute the linear elasticity stiffness matrix and stress term of a batch of elements of the same type.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Linear elasticity numerics of the batch.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] element - Element of the type of the batch.
+   * \param[in] batch - Element indices, nElement for unused SIMD lanes.
+   */
+  template <class ElementType>
+  void Compute_StiffMatrix_Batch(const CGeometry *geometry, CFEALinearElasticity *numerics, const CConfig *config,
+                                 ElementType& element, const unsigned long* batch);
+
+  /*!
+   * \brief Compute the nonlinear (neo-Hookean) nodal stress term, and optionally the tangent matrix, of a batch of
+   *        elements of the same type.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Neo-Hookean numerics of the batch.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] element - Element of the type of the batch.
+   * \param[in] batch - Element indices, nElement for unused SIMD lanes.
+   * \tparam TANGENT - Assemble the tangent matrix, otherwise only the residual.
+   */
+  template <bool TANGENT, class ElementType>
+  void Compute_NonlinearTerms_Batch(const CGeometry *geometry, CFEM_NeoHookean_Comp *numerics, const CConfig *config,
+                                    ElementType& element, const unsigned long* batch);
+
+  /*!
+   * \brief Gather the coordinates, displacements, temperatures, material parameters, and stiffness penalty of a
+   *        batch of elements, unused SIMD lanes repeat the first element.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Numerics of the batch, provides the material parameters.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] element - Element of the type of the batch.
+   * \param[in] batch - Element indices, nElement for unused SIMD lanes.
+   * \param[out] Coord, Disp, Temperature - Nodal (reference) coordinates, displacements, and temperatures.
+   * \param[out] lambda, mu, thermal, tempRef - Material parameters.
+   * \param[out] penalty - Stiffness penalty (topology optimization).
+   * \param[out] indexNode - Point indices of the elements.
+   */
+  template <class NumericsType, class ElementType, class Double>
+  void GatherElementBatch(const CGeometry *geometry, NumericsType *numerics, const CConfig *config,
+                          ElementType& element, const unsigned long* batch, Double Coord[][ElementType::nDimBatch],
+                          Double Disp[][ElementType::nDimBatch], Double* Temperature, Double& lambda, Double& mu,
+                          Double& thermal, Double& tempRef, Double& penalty,
+                          unsigned long indexNode[][ElementType::nNodeBatch]) const;
+
+  /*!
+   * \brief Loop over the element batches (in parallel), call the batch function for the batches of supported
+   *        element types whose material has batched numerics, and the scalar function for the other elements.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] batchNumerics - Numerics of each material that support the batched computation, or nullptr.
+   * \param[in] batchFunc - Called with the numerics, the element of the type of the batch, and the batch.
+   * \param[in] elementFunc - Called with the index of an element.
+   */
+  template <class NumericsType, class BatchFunc, class ElementFunc>
+  void AssembleElementBatches(const CGeometry *geometry, const array<NumericsType*, MAX_TERMS>& batchNumerics,
+                              const BatchFunc& batchFunc, const ElementFunc& elementFunc);
+
+  /*!
+   * \brief Compute the tangent matrix and nodal stress term of one element (scalar assembly) for nonlinear problems.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iElem - Element index.
+   */
+  void Compute_StiffMatrix_NodalStressRes_Element(const CGeometry *geometry, CNumerics **numerics,
+                                                  const CConfig *config, unsigned long iElem);
+
+  /*!
+   * \brief Compute the nodal stress term of one element (scalar assembly) and add it to the residual.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iElem - Element index.
+   */
+  void Compute_NodalStressRes_Element(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                      unsigned long iElem);
+
+  /*!
+   * \brief Load the coordinates and properties of an element into the element of the thread and compute its tangent matrix.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] iElem - Element index.
+   * \param[out] indexNode - Point indices of the element.
+   * \param[out] nNodes - Number of nodes of the element.
+   * \param[out] simp_penalty - Stiffness penalty (topology optimization).
+   * \return Element with the tangent matrix and stress term.
+   */
+  CElement* Compute_Tangent_Element(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                    unsigned long iElem, unsigned long* indexNode, unsigned short& nNodes,
+                                    su2double& simp_penalty) const;
+
+  /*!
+   * \brief Allocate the data of the matrix-free operator, called instead of initializing the Jacobian.
+   */
+  void InitializeMatrixFree();
+
+  /*!
+   * \brief Mark a point as fixed for the matrix-free operator, or eliminate it from the Jacobian.
+   * \param[in] iPoint - Point index.
+   * \param[in] x - Known solution at the point.
+   */
+  void EnforceSolutionAtNode(unsigned long iPoint, const su2double* x);
+
+  /*!
+   * \brief Mark a point as sliding on a plane for the matrix-free operator, or remove the normal components
+   * of its rows and columns of the Jacobian.
+   * \param[in] iPoint - Point index.
+   * \param[in] normal - Unit normal of the plane.
+   */
+  void EnforceZeroProjection(unsigned long iPoint, const su2double* normal);
+
+  /*!
+   * \brief Clear the essential BC of the matrix-free operator (the Jacobian is reset by the assembly).
+   */
+  void ResetMatrixFreeConstraints();
+
+  /*!
+   * \brief Apply the stiffness operator element by element.
+   * \param[in] u - Input vector.
+   * \param[out] v - Result.
+   * \param[in] constrained - Apply the essential BC, otherwise the raw operator.
+   */
+  void ApplyMatrixFreeOperator(const CSysVector<JacobianScalarType>& u, CSysVector<JacobianScalarType>& v,
+                               bool constrained) const;
+
+  /*!
+   * \brief Compute and invert the diagonal blocks of the constrained operator (block Jacobi preconditioner).
+   */
+  void BuildMatrixFreePreconditioner();
+
+  /*!
+   * \brief Solve the linear system with the matrix-free operator.
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] numerics - Description of the numerical method.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void Solve_System_MatrixFree(CGeometry *geometry, CNumerics **numerics, const CConfig *config);
+
   /*!
    * \brief Set container of element properties.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -503,6 +682,22 @@ public:
    */
   void Solve_System(CGeometry *geometry, CConfig *config) final;
 
+  /*!
+   * \brief Product of the constrained matrix-free operator (used by the Krylov solvers).
+   * \param[in] u - Input vector.
+   * \param[out] v - Result.
+   */
+  inline void MatrixFreeProduct(const CSysVector<JacobianScalarType>& u, CSysVector<JacobianScalarType>& v) const {
+    ApplyMatrixFreeOperator(u, v, true);
+  }
+
+  /*!
+   * \brief Block Jacobi preconditioner of the matrix-free operator.
+   * \param[in] u - Input vector.
+   * \param[out] v - Result.
+   */
+  void MatrixFreePreconditioner(const CSysVector<JacobianScalarType>& u, CSysVector<JacobianScalarType>& v) const;
+
   /*!
    * \brief Get the residual for FEM structural analysis.
    * \param[in] val_var - Index of the variable.
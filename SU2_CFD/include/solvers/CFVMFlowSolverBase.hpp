@@ -82,6 +82,37 @@ class CFVMFlowSolverBase : public CSolver {
   su2double Global_Delta_Time = 0.0, /*!< \brief Time-step for TIME_STEPPING time marching strategy. */
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
+  bool multirateLTS = false;           /*!< \brief Multirate (local) explicit time stepping. */
+  vector<unsigned short> TimeLevel;    /*!< \brief Time level of the points, their time step is 2^level global ones. */
+  unsigned long multirateStart = 0;    /*!< \brief Time iteration at the start of the current multirate cycle. */
+  unsigned long multirateIter = 0;     /*!< \brief Time iteration within the current multirate cycle. */
+  su2double multirateDeltaTime = 0.0;  /*!< \brief Global time step, frozen over a multirate cycle. */
+  CSysVector<su2double> MultirateRes;  /*!< \brief Residuals accumulated over the time step of each point. */
+
+  /*!
+   * \brief Weight of the residual of an edge in multirate time stepping. An edge advances with the time step
+   *        of its finer point, it is evaluated in the last time iteration of that time step, when the point is
+   *        updated (with a weight of 2^level), and skipped (weight 0) in the other time iterations.
+   * \param[in] iPoint - First point of the edge.
+   * \param[in] jPoint - Second point of the edge.
+   */
+  inline su2double EdgeTimeWeight(unsigned long iPoint, unsigned long jPoint) const {
+    if (!multirateLTS) return 1.0;
+    const auto period = 1ul << min(TimeLevel[iPoint], TimeLevel[jPoint]);
+    return ((multirateIter + 1) % period == 0) ? su2double(period) : su2double(0.0);
+  }
+
+  /*!
+   * \brief Weight of the source terms of a point in multirate time stepping. They are evaluated in the last time
+   *        iteration of the time step of the point (with a weight of 2^level) and skipped (weight 0) in the others.
+   * \param[in] iPoint - Point.
+   */
+  inline su2double PointTimeWeight(unsigned long iPoint) const {
+    if (!multirateLTS) return 1.0;
+    const auto period = 1ul << TimeLevel[iPoint];
+    return ((multirateIter + 1) % period == 0) ? su2double(period) : su2double(0.0);
+  }
+
   unsigned long ErrorCounter = 0;    /*!< \brief Counter for number of un-physical states. */
 
   /*!
@@ -566,15 +597,68 @@ class CFVMFlowSolverBase : public CSolver {
       }
       END_SU2_OMP_SAFE_GLOBAL_ACCESS
 
+      /*--- Multirate time stepping, each point advances with 2^level times the global time step. The levels
+       *    are based on the local time step and, with the global time step, they are frozen over a cycle of
+       *    2^(nLevels-1) time iterations at the end of which all points are synchronized. ---*/
+
+      const auto nLevels = config->GetnLevels_TimeAccurateLTS();
+      const bool multirate = (nLevels > 1) && (iMesh == MESH_0);
+      const unsigned long cycle = 1ul << (nLevels - 1);
+      const auto timeIter = config->GetTimeIter();
+      const bool newLevels = multirate && (TimeLevel.empty() || (timeIter < multirateStart) ||
+                                           (timeIter - multirateStart >= cycle));
+      SU2_OMP_BARRIER
+
+      if (multirate) {
+        BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+        {
+          if (newLevels) {
+            TimeLevel.resize(nPoint);
+            if (MultirateRes.GetLocSize() == 0) MultirateRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+            multirateStart = timeIter;
+            multirateDeltaTime = Global_Delta_Time;
+          }
+          multirateIter = timeIter - multirateStart;
+          Global_Delta_Time = Max_Delta_Time = multirateDeltaTime;
+          config->SetDelta_UnstTimeND(Global_Delta_Time);
+        }
+        END_SU2_OMP_SAFE_GLOBAL_ACCESS
+      }
+      ompMasterAssignBarrier(multirateLTS, multirate);
+
       /*--- Sets the regular CFL equal to the unsteady CFL. ---*/
 
       SU2_OMP_FOR_STAT(omp_chunk_size)
       for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
         nodes->SetLocalCFL(iPoint, config->GetUnst_CFL());
-        nodes->SetDelta_Time(iPoint, Global_Delta_Time);
+
+        if (newLevels) {
+          const su2double ratio = nodes->GetDelta_Time(iPoint) / Global_Delta_Time;
+          unsigned short level = 0;
+          while ((level < nLevels-1) && (ratio >= su2double(2ul << level))) ++level;
+          TimeLevel[iPoint] = level;
+        }
+        const unsigned long period = multirate ? (1ul << TimeLevel[iPoint]) : 1;
+        nodes->SetDelta_Time(iPoint, su2double(period) * Global_Delta_Time);
       }
       END_SU2_OMP_FOR
 
+      /*--- The levels of the halos are needed for the weights of the edges, they are recovered from their time
+       *    step, which is an exact power of 2 multiple of the global time step. ---*/
+
+      if (newLevels) {
+        InitiateComms(geometry, config, MPI_QUANTITIES::DELTA_TIME);
+        CompleteComms(geometry, config, MPI_QUANTITIES::DELTA_TIME);
+
+        SU2_OMP_FOR_STAT(omp_chunk_size)
+        for (auto iPoint = nPointDomain; iPoint < nPoint; iPoint++) {
+          const su2double ratio = nodes->GetDelta_Time(iPoint) / Global_Delta_Time;
+          unsigned short level = 0;
+          while (su2double(2ul << level) <= ratio) ++level;
+          TimeLevel[iPoint] = level;
+        }
+        END_SU2_OMP_FOR
+      }
     }
 
     /*--- Recompute the unsteady time step for the dual time strategy if the unsteady CFL is diferent from 0.
@@ -812,6 +896,20 @@ class CFVMFlowSolverBase : public CSolver {
     const su2double RK_FuncCoeff[] = {1.0/6.0, 1.0/3.0, 1.0/3.0, 1.0/6.0};
     const su2double RK_TimeCoeff[] = {0.5, 0.5, 1.0, 1.0};
 
+    /*--- Weight of the residual of this stage in the final solution, the sum of these weights, and the number
+     *    of stages (the stages of RUNGE_KUTTA_EXPLICIT start from the old solution, only the last one counts). ---*/
+    su2double stageWeight = 1.0, stageWeightSum = 1.0;
+    unsigned short nStages = 1;
+    if (IntegrationType == RUNGE_KUTTA_EXPLICIT) {
+      nStages = config->GetnRKStep();
+      stageWeightSum = config->Get_Alpha_RKStep(nStages - 1);
+      stageWeight = (iRKStep == nStages - 1) ? stageWeightSum : su2double(0.0);
+    }
+    if (IntegrationType == CLASSICAL_RK4_EXPLICIT) {
+      stageWeight = RK_FuncCoeff[iRKStep];
+      nStages = 4;
+    }
+
     /*--- Local residual variables for current thread ---*/
     su2double resMax[MAXNVAR] = {0.0}, resRMS[MAXNVAR] = {0.0};
     unsigned long idxMax[MAXNVAR] = {0};
@@ -822,6 +920,27 @@ class CFVMFlowSolverBase : public CSolver {
       SU2_OMP_FOR_(schedule(static,omp_chunk_size) SU2_NOWAIT)
       for (unsigned long iPoint = 0; iPoint < nPointDomain; iPoint++) {
 
+        /*--- Multirate time stepping, a point is frozen over its time step and all its stages are done in the
+         *    last time iteration of the step, together with the stages of the finer points (and its edges and
+         *    sources are only evaluated in that iteration, see EdgeTimeWeight). In the previous iterations the
+         *    residuals (fluxes from finer neighbours, boundary conditions) are accumulated with the weight of
+         *    the stage in the final solution, and then they are spread over the stages of the update. Thus the
+         *    point receives the same weighted fluxes as its neighbours and the fluxes between time levels are
+         *    conservative. The residual is scaled by 1/2^level since the time step of the point is 2^level
+         *    global ones. ---*/
+        if (multirateLTS) {
+          const auto period = 1ul << TimeLevel[iPoint];
+          if ((multirateIter + 1) % period != 0) {
+            MultirateRes.AddBlock(iPoint, LinSysRes.GetBlock(iPoint), stageWeight);
+            continue;
+          }
+          for (unsigned short iVar = 0; iVar < nVar; iVar++) {
+            LinSysRes(iPoint, iVar) += MultirateRes(iPoint, iVar) / stageWeightSum;
+            LinSysRes(iPoint, iVar) /= su2double(period);
+          }
+          if (iRKStep == nStages - 1) MultirateRes.SetBlock_Zero(iPoint);
+        }
+
         su2double Vol = geometry->nodes->GetVolume(iPoint) + geometry->nodes->GetPeriodicVolume(iPoint);
         su2double Delta = nodes->GetDelta_Time(iPoint) / Vol;
 
@@ -909,6 +1028,7 @@ class CFVMFlowSolverBase : public CSolver {
    */
   template<class DiagonalPrecond>
   void PrepareImplicitIteration_impl(DiagonalPrecond& preconditioner, CGeometry *geometry, CConfig *config) {
+    SU2_ZONE_SCOPED_N("PrepareImplicitIteration");
 
     const bool implicit = (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
 
@@ -980,6 +1100,7 @@ class CFVMFlowSolverBase : public CSolver {
    */
   template<bool compute_ur>
   void CompleteImplicitIteration_impl(CGeometry *geometry, CConfig *config) {
+    SU2_ZONE_SCOPED_N("CompleteImplicitIteration");
 
     if (compute_ur) ComputeUnderRelaxationFactor(config);
 
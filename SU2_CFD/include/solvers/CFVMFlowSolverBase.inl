@@ -475,14 +475,17 @@ void CFVMFlowSolverBase<V, R>::Viscous_Residual_impl(unsigned long iEdge, CGeome
 
   auto residual = numerics->ComputeResidual(config);
 
+  /*--- Weight of the edge in multirate time stepping (1 otherwise). ---*/
+  const su2double timeWeight = EdgeTimeWeight(iPoint, jPoint);
+
   if (ReducerStrategy) {
-    EdgeFluxes.SubtractBlock(iEdge, residual);
+    EdgeFluxes.AddBlock(iEdge, residual, -timeWeight);
     if (implicit)
       Jacobian.UpdateBlocksSub(iEdge, residual.jacobian_i, residual.jacobian_j);
   }
   else {
-    LinSysRes.SubtractBlock(iPoint, residual);
-    LinSysRes.AddBlock(jPoint, residual);
+    LinSysRes.AddBlock(iPoint, residual, -timeWeight);
+    LinSysRes.AddBlock(jPoint, residual, timeWeight);
 
     if (implicit)
       Jacobian.UpdateBlocksSub(iEdge, iPoint, jPoint, residual.jacobian_i, residual.jacobian_j);
@@ -1516,6 +1519,8 @@ template <class V, ENUM_REGIME R>
 void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
                                                 const CSolver* const* solvers,
                                                 CConfig *config) {
+  SU2_ZONE_SCOPED_N("EdgeFluxResidual");
+
   if (!edgeNumerics) {
     if (!ReducerStrategy && (omp_get_max_threads() > 1) &&
         (config->GetEdgeColoringGroupSize() % Double::Size != 0)) {
@@ -1530,8 +1535,8 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     }
   }
 
-  /*--- Non-physical counter. ---*/
-  unsigned long counterLocal = 0;
+  /*--- Non-physical counter, and number of edges computed by this thread (to declare the work to the profiler). ---*/
+  unsigned long counterLocal = 0, edgesLocal = 0;
   SU2_OMP_MASTER
   ErrorCounter = 0;
   END_SU2_OMP_MASTER
@@ -1549,11 +1554,18 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     for(auto k = 0ul; k < color.size; k += Double::Size) {
       Int iEdge;
       Double mask;
+      bool inactive = true;
       for (auto j = 0ul; j < Double::Size; ++j) {
         bool in = (k+j < color.size);
-        mask[j] = in;
         iEdge[j] = color.indices[k+j*in];
+        /*--- The mask also applies the weight of the edge in multirate time stepping, 0 skips it. ---*/
+        const auto iPoint = geometry->edges->GetNode(iEdge[j],0), jPoint = geometry->edges->GetNode(iEdge[j],1);
+        mask[j] = in ? EdgeTimeWeight(iPoint, jPoint) : su2double(0.0);
+        if (ReducerStrategy && in && (mask[j] == 0.0)) EdgeFluxes.SetBlock_Zero(iEdge[j]);
+        inactive &= (mask[j] == 0.0);
+        edgesLocal += (mask[j] != 0.0);
       }
+      if (inactive) continue;
 
       if (ReducerStrategy) {
         edgeNumerics->ComputeFlux(iEdge, *config, *geometry, *nodes, UpdateType::REDUCTION, mask, EdgeFluxes, Jacobian);
@@ -1568,6 +1580,8 @@ void CFVMFlowSolverBase<V, R>::EdgeFluxResidual(const CGeometry *geometry,
     END_SU2_OMP_FOR
   }
 
+  CRegionProfiler::AddFlops(edgesLocal * CNumericsSIMD::FlopsPerEdge(*config, nDim, MGLevel));
+
   FinalizeResidualComputation(geometry, pausePreacc, counterLocal, config);
 }
 
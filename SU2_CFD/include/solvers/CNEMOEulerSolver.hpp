@@ -60,9 +60,45 @@ protected:
   Global_Delta_UnstTimeND = 0.0;     /*!< \brief Unsteady time step for the dual time strategy. */
 
   CNEMOGas  *FluidModel;          /*!< \brief fluid model used in the solver */
+  vector<CNEMOGas*> ThreadFluidModel; /*!< \brief Fluid model of each thread, the first is FluidModel. */
+
+  bool SplitChemistry = false;        /*!< \brief Chemistry integrated in a separate stage after the flow update. */
+  bool SplitVibCoupling = false;      /*!< \brief The split chemistry also exchanges the vib.-el. energy of the species. */
+  unsigned long ChemistryFailures = 0; /*!< \brief Points where the split chemistry did not complete the time step. */
 
   CNEMOEulerVariable* node_infty = nullptr;
 
+  /*!
+   * \brief Create the fluid model (thermochemical library) selected in the config.
+   * \param[in] config - Definition of the particular problem.
+   * \param[in] nDim - Number of dimensions.
+   * \param[in] viscous - Compute transport properties.
+   */
+  static CNEMOGas* CreateFluidModel(const CConfig *config, unsigned short nDim, bool viscous);
+
+  /*!
+   * \brief Integrate the chemical source terms of one point over a time step, with backward Euler sub-steps.
+   * \note The sub-step is halved when a species density would become negative or change by more than 10%
+   *       of the mixture density, and doubled after each accepted sub-step.
+   * \param[in] gas - Fluid model, one per thread.
+   * \param[in] dt - Time step.
+   * \param[in] maxSubSteps - Maximum number of (accepted or rejected) sub-steps.
+   * \param[in,out] U - Conservative variables of the point, only the species densities and (with the
+   *                   chemistry-vibration coupling) the vib.-el. energy change.
+   * \param[in,out] V - Primitive variables of the point, the temperatures are used as initial guess.
+   * \return True if the end of the time step was reached.
+   */
+  bool IntegrateChemistry(CNEMOGas *gas, su2double dt, unsigned long maxSubSteps, su2double *U, su2double *V) const;
+
+  /*!
+   * \brief Operator split chemistry stage, integrate the chemical source terms of each point over the physical
+   *        time step and communicate the solution.
+   * \note Called once per time step, after the flow update (TIME_STEPPING only).
+   * \param[in] geometry - Geometrical definition of the problem.
+   * \param[in] config - Definition of the particular problem.
+   */
+  void ChemistryStage(CGeometry *geometry, CConfig *config);
+
   /*!
    * \brief Set the maximum value of the eigenvalue.
    * \param[in] geometry - Geometrical definition of the problem.
@@ -224,7 +260,9 @@ public:
    * \brief Compute the pressure at the infinity.
    * \return Value of the pressure at the infinity.
    */
-  inline CNEMOGas* GetFluidModel(void) const final { return FluidModel;}
+  inline CNEMOGas* GetFluidModel(void) const final {
+    return ThreadFluidModel.empty() ? FluidModel : ThreadFluidModel[omp_get_thread_num()];
+  }
 
   /*!
    * \brief Impose the far-field boundary condition using characteristics.
@@ -129,6 +129,8 @@ template <class VariableType>
 void CScalarSolver<VariableType>::Upwind_Residual(CGeometry* geometry, CSolver** solver_container,
                                                   CNumerics** numerics_container, CConfig* config,
                                                   unsigned short iMesh) {
+  SU2_ZONE_SCOPED_N("Upwind_Residual");
+
   /*--- Define booleans that are solver specific through CConfig's GlobalParams which have to be set in CFluidIteration
    * before calling these solver functions. ---*/
   const bool implicit = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -453,6 +455,8 @@ void CScalarSolver<VariableType>::SetTime_Step(CGeometry *geometry, CSolver **so
 template <class VariableType>
 void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry, CSolver** solver_container,
                                                            CConfig* config) {
+  SU2_ZONE_SCOPED_N("PrepareImplicitIteration");
+
   /*--- Set shared residual variables to 0 and declare
    *    local ones for current thread to work on. ---*/
 
@@ -496,6 +500,8 @@ void CScalarSolver<VariableType>::PrepareImplicitIteration(CGeometry* geometry,
 template <class VariableType>
 void CScalarSolver<VariableType>::CompleteImplicitIteration(CGeometry* geometry, CSolver** solver_container,
                                                             CConfig* config) {
+  SU2_ZONE_SCOPED_N("CompleteImplicitIteration");
+
   ComputeUnderRelaxationFactor(config);
 
   /*--- Update solution (system written in terms of increments) ---*/
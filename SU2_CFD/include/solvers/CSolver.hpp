@@ -46,6 +46,7 @@
 #include "../sgs_model.hpp"
 #include "../../../Common/include/fem/fem_geometry_structure.hpp"
 #include "../../../Common/include/geometry/CGeometry.hpp"
+#include "../../../Common/include/tracy_structure.hpp"
 #include "../../../Common/include/CConfig.hpp"
 #include "../../../Common/include/linear_algebra/CSysMatrix.hpp"
 #include "../../../Common/include/linear_algebra/CSysVector.hpp"
@@ -232,6 +233,12 @@ public:
     return base_nodes;
   }
 
+  /*!
+   * \brief Allow outside access to the residual vector of the solver (one block per point).
+   * \return Residual of the implicit linear system.
+   */
+  inline CSysVector<su2double>& GetLinSysRes() { return LinSysRes; }
+
   /*!
    * \brief Helper function to define the type and number of variables per point for each communication type.
    * \param[in] config - Definition of the particular problem.
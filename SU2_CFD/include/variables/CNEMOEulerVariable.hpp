@@ -90,8 +90,6 @@ class CNEMOEulerVariable : public CFlowVariable {
   MatrixType Cvves;  /*!< \brief Specific heat of vib-el mode w.r.t. species. */
   VectorType Gamma;  /*!< \brief Ratio of specific heats. */
 
-  CNEMOGas *fluidmodel;
-
   /*!< \brief Index definition for NEMO pritimive variables. */
   unsigned long RHOS_INDEX, T_INDEX, TVE_INDEX, VEL_INDEX, P_INDEX,
   RHO_INDEX, H_INDEX, A_INDEX, RHOCVTR_INDEX, RHOCVVE_INDEX,
@@ -176,12 +174,14 @@ class CNEMOEulerVariable : public CFlowVariable {
    */
   bool SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) override;
 
-   /*!
-  * \brief Set all the primitive and secondary variables from the conserved vector.
-  */
-  bool Cons2PrimVar(su2double *U, su2double *V, su2double *dPdU,
-                    su2double *dTdU, su2double *dTvedU, su2double *val_eves,
-                    su2double *val_Cvves);
+  /*!
+   * \brief Set all the primitive and secondary variables from the conserved vector, with a given fluid model.
+   * \note Thread safe if each thread uses its own fluid model.
+   * \param[in] gas - Fluid model used to compute the thermodynamic state.
+   * \param[in] derivatives - Compute the partial derivatives of pressure and temperatures.
+   */
+  bool Cons2PrimVar(CNEMOGas *gas, bool derivatives, su2double *U, su2double *V, su2double *dPdU,
+                    su2double *dTdU, su2double *dTvedU, su2double *val_eves, su2double *val_Cvves) const;
 
   /*---------------------------------------*/
   /*---   Specific variable routines    ---*/
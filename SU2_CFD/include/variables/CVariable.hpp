@@ -480,6 +480,12 @@ public:
   inline const MatrixType& GetSolution() const { return Solution; }
   inline MatrixType& GetSolution() { return Solution; }
 
+  /*!
+   * \brief Get the entire old solution of the problem.
+   * \return Reference to the old solution matrix.
+   */
+  inline MatrixType& GetSolution_Old() { return Solution_Old; }
+
   /*!
    * \brief Get the solution of the problem.
    * \param[in] iPoint - Point index.
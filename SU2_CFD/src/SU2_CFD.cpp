@@ -110,6 +110,9 @@ int main(int argc, char *argv[]) {
     if (disc_adj) {
       driver = new CDiscAdjSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
+    else if (config.GetnParareal_Slabs() > 1) {
+      driver = new CPararealDriver(config_file_name, nZone, MPICommunicator, config.GetnParareal_Slabs());
+    }
     else {
       driver = new CSinglezoneDriver(config_file_name, nZone, MPICommunicator);
     }
@@ -130,7 +133,7 @@ int main(int argc, char *argv[]) {
     assert(harmonic_balance);
 
     /*--- Harmonic balance problem: instantiate the Harmonic Balance driver class. ---*/
-    driver = new CHBDriver(config_file_name, nZone, MPICommunicator);
+    driver = new CHBDriver(config_file_name, nZone, MPICommunicator, config.GetnHB_InstanceGroups());
 
   }
 
@@ -687,6 +687,11 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
 
   AD::Reset();
 
+  /*--- Tape memory of the zone iterations, the objective function and transfer sections are not included. ---*/
+
+  const bool wrt_ad_statistics = (kind_recording != RECORDING::CLEAR_INDICES) && driver_config->GetWrt_AD_Statistics();
+  vector<passivedouble> zoneTapeMemory(nZone, 0.0);
+
   /*--- Prepare for recording by resetting the solution to the initial converged solution. ---*/
 
   for(iZone = 0; iZone < nZone; iZone++) {
@@ -781,17 +786,23 @@ void CDiscAdjMultizoneDriver::SetRecording(RECORDING kind_recording, Kind_Tape t
 
       AD::Push_TapePosition(); /// enter_zone
 
+      if (wrt_ad_statistics) zoneTapeMemory[iZone] = AD::GetTapeMemoryUsed();
+
       DirectIteration(iZone, kind_recording);
 
       iteration_container[iZone][INST_0]->RegisterOutput(solver_container, geometry_container,
                                                          config_container, iZone, INST_0);
+
+      if (wrt_ad_statistics) zoneTapeMemory[iZone] = AD::GetTapeMemoryUsed() - zoneTapeMemory[iZone];
+
       AD::Push_TapePosition(); /// leave_zone
     }
     PrintDirectResidual(kind_recording);
   }
 
-  if (kind_recording != RECORDING::CLEAR_INDICES && driver_config->GetWrt_AD_Statistics()) {
+  if (wrt_ad_statistics) {
     AD::PrintStatistics(SU2_MPI::GetComm(), rank == MASTER_NODE);
+    PrintTapeMemory(zoneTapeMemory);
   }
 
   AD::StopRecording();
@@ -31,6 +31,7 @@
 #include "../../../Common/include/geometry/CDummyGeometry.hpp"
 #include "../../../Common/include/geometry/CPhysicalGeometry.hpp"
 #include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+#include "../../../Common/include/tracy_structure.hpp"
 
 #include "../../include/solvers/CSolverFactory.hpp"
 #include "../../include/solvers/CFEM_DG_EulerSolver.hpp"
@@ -106,7 +107,8 @@
 #include <cfenv>
 
 CDriver::CDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator, bool dummy_geo) :
-CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false), fem_solver(false), dry_run(dummy_geo) {
+CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false), fem_solver(false),
+worldComm(MPICommunicator), dry_run(dummy_geo) {
 
   /*--- Start timer to track preprocessing for benchmarking. ---*/
 
@@ -294,6 +296,18 @@ CDriverBase(confFile, val_nZone, MPICommunicator), StopCalc(false), fsi(false),
 
   StartTime = SU2_MPI::Wtime();
 
+  /*--- Start the region timers, these cover the iterations and the output. ---*/
+
+  CRegionProfiler::Enable(config_container[ZONE_0]->GetProfiling(),
+                          config_container[ZONE_0]->GetProfiling_HWCounters());
+
+  /*--- Start measuring the load of this rank (for PARMETIS_WRITE_WEIGHTS), the time spent in
+   * blocking MPI calls is only measured for that purpose. ---*/
+
+  SU2_MPI::SetMeasureWaitTime(config_container[ZONE_0]->GetParMETIS_WriteWeights());
+  LoadStartTime = SU2_MPI::Wtime();
+  LoadStartWaitTime = SU2_MPI::GetWaitTime();
+
 }
 
 void CDriver::InitializeContainers(){
@@ -348,6 +362,10 @@ void CDriver::Finalize() {
 
   const bool wrt_perf = config_container[ZONE_0]->GetWrt_Performance();
 
+  /*--- Write the measured point weights before the geometry is deleted. ---*/
+
+  if (config_container[ZONE_0]->GetParMETIS_WriteWeights()) WritePointWeights();
+
     /*--- Output some information to the console. ---*/
 
   if (rank == MASTER_NODE) {
@@ -463,6 +481,10 @@ void CDriver::Finalize() {
   config_container[ZONE_0]->SetProfilingCSV();
   config_container[ZONE_0]->GEMMProfilingCSV();
 
+  /*--- Over all the ranks, the groups of split drivers would otherwise overwrite each other's report. ---*/
+  CRegionProfiler::WriteReport(config_container[ZONE_0]->GetProfiling_FileName(), worldComm);
+  CRegionProfiler::Enable(false);
+
   /*--- Deallocate config container ---*/
   if (config_container!= nullptr) {
     for (iZone = 0; iZone < nZone; iZone++)
@@ -513,6 +535,8 @@ void CDriver::Finalize() {
     cout << "Preprocessing phase:" << endl;
     cout << setw(25) << "Preproc. Time (s):"  << setw(12)<< UsedTimePreproc << " | ";
     cout << setw(20) << "Preproc. Time (%):" << setw(12)<< ((UsedTimePreproc * 100.0) / (TotalTime)) << endl;
+    cout << setw(25) << "Partition Time (s):"  << setw(12)<< UsedTimePartition << " | ";
+    cout << setw(20) << "Partition Time (%):" << setw(12)<< ((UsedTimePartition * 100.0) / (TotalTime)) << endl;
     cout << endl;
     cout << "Compute phase:" << endl;
     cout << setw(25) << "Compute Time (s):"  << setw(12)<< UsedTimeCompute << " | ";
@@ -695,6 +719,8 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
   /*--- Definition of the geometry class to store the primal grid in the partitioning process.
    *    All ranks process the grid and call ParMETIS for partitioning ---*/
 
+  const su2double PartitionStartTime = SU2_MPI::Wtime();
+
   CGeometry *geometry_aux = new CPhysicalGeometry(config, iZone, nZone);
 
   /*--- Set the dimension --- */
@@ -718,6 +744,8 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   delete geometry_aux;
 
+  UsedTimePartition += SU2_MPI::Wtime() - PartitionStartTime;
+
   /*--- Add the Send/Receive boundaries ---*/
   geometry[MESH_0]->SetSendReceive(config);
 
@@ -856,6 +884,8 @@ void CDriver::InitializeGeometryFVM(CConfig *config, CGeometry **&geometry) {
 
   }
 
+  if (config->GetMG_AgglomerationStatistics()) CMultiGridGeometry::PrintAgglomerationStatistics(geometry, config);
+
   if (config->GetWrt_MultiGrid()) geometry[MESH_0]->ColorMGLevels(config->GetnMGLevels(), geometry);
 
   /*--- For unsteady simulations, initialize the grid volumes
@@ -2875,6 +2905,79 @@ void CDriver::PrintDirectResidual(RECORDING kind_recording) {
 
 }
 
+void CDriver::WritePointWeights() const {
+
+  /*--- Busy time of this rank, i.e. the elapsed time not spent waiting for other ranks. ---*/
+
+  const passivedouble busyTime = (SU2_MPI::Wtime() - LoadStartTime) - (SU2_MPI::GetWaitTime() - LoadStartWaitTime);
+
+  vector<vector<long> > weights(nZone);
+  passivedouble localLoad[] = {busyTime, 0.0}, totalLoad[2];
+
+  for (auto jZone = 0u; jZone < nZone; jZone++) {
+    weights[jZone] = geometry_container[jZone][INST_0][MESH_0]->GetPointWeights(config_container[jZone]);
+    for (const auto w : weights[jZone]) localLoad[1] += w;
+  }
+  SelectMPIWrapper<passivedouble>::W::Allreduce(localLoad, totalLoad, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+  /*--- Scale the weights by the time per unit of weight of this rank relative to the average, this
+   * makes the weights of each rank proportional to its busy time. Costs that the weights do not
+   * model (source terms, wall functions, chemistry, partially active zones) are thus accounted for. ---*/
+
+  passivedouble scale = 1.0;
+  if (localLoad[1] > 0.0 && totalLoad[0] > 0.0) {
+    scale = (busyTime / localLoad[1]) / (totalLoad[0] / totalLoad[1]);
+  }
+
+  if (rank == MASTER_NODE) {
+    cout << "Average busy time per rank: " << totalLoad[0] / size << " s." << endl;
+  }
+  for (auto jZone = 0u; jZone < nZone; jZone++) {
+    geometry_container[jZone][INST_0][MESH_0]->WritePointWeights(config_container[jZone], weights[jZone], scale);
+  }
+}
+
+void CDriver::PrintTapeMemory(const vector<passivedouble>& zoneTapeMemory) const {
+
+  constexpr passivedouble toMB = 1.0 / (1024.0 * 1024.0);
+
+  /*--- Local values are [zone tapes..., total tape, peak RSS], reduced to min/sum/max over ranks. ---*/
+
+  vector<passivedouble> localValues(zoneTapeMemory);
+  localValues.push_back(AD::GetTapeMemoryUsed());
+  localValues.push_back(MemoryAllocation::GetPeakResidentSetSize());
+
+  const int nValues = localValues.size();
+  vector<passivedouble> minValues(nValues), sumValues(nValues), maxValues(nValues);
+
+  /*--- Passive values, they must not go through the AD-aware MPI wrapper. ---*/
+  using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+  MPI_Wrapper::Allreduce(localValues.data(), minValues.data(), nValues, MPI_DOUBLE, MPI_MIN, SU2_MPI::GetComm());
+  MPI_Wrapper::Allreduce(localValues.data(), sumValues.data(), nValues, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  MPI_Wrapper::Allreduce(localValues.data(), maxValues.data(), nValues, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  if (rank != MASTER_NODE) return;
+
+  PrintingToolbox::CTablePrinter MemoryTable(&std::cout);
+  MemoryTable.AddColumn("Memory per rank (MB)", 25);
+  MemoryTable.AddColumn("Minimum", 15);
+  MemoryTable.AddColumn("Average", 15);
+  MemoryTable.AddColumn("Maximum", 15);
+  MemoryTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  MemoryTable.PrintHeader();
+
+  for (int iValue = 0; iValue < nValues; ++iValue) {
+    string name;
+    if (iValue < nValues-2) name = "Tape of zone " + std::to_string(iValue);
+    else if (iValue == nValues-2) name = "Tape total";
+    else name = "Peak resident set size";
+
+    MemoryTable << name << minValues[iValue] * toMB << sumValues[iValue] * toMB / size << maxValues[iValue] * toMB;
+  }
+  MemoryTable.PrintFooter();
+
+}
+
 
 CFluidDriver::CFluidDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator) : CDriver(confFile, val_nZone, MPICommunicator, false) {
   Max_Iter = config_container[ZONE_0]->GetnInner_Iter();
@@ -2994,8 +3097,10 @@ void CFluidDriver::Run() {
   if ( unsteady ) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (jZone = 0; jZone < nZone; jZone++)
-        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr)
-        interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr) {
+          interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+          interpolator_container[iZone][jZone]->SetTransferPattern(config_container);
+        }
     }
   }
 
@@ -3109,9 +3214,10 @@ void CFluidDriver::Output(unsigned long InnerIter) {
 
 CHBDriver::CHBDriver(char* confFile,
     unsigned short val_nZone,
-    SU2_Comm MPICommunicator) : CFluidDriver(confFile,
+    SU2_Comm MPICommunicator,
+    unsigned short nGroups) : CFluidDriver(confFile,
         val_nZone,
-        MPICommunicator) {
+        SplitInstanceGroups(MPICommunicator, nGroups)) {
   unsigned short kInst;
 
   nInstHB = nInst[ZONE_0];
@@ -3119,6 +3225,38 @@ CHBDriver::CHBDriver(char* confFile,
   /*--- allocate dynamic memory for the Harmonic Balance operator ---*/
   D = new su2double*[nInstHB];
   for (kInst = 0; kInst < nInstHB; kInst++) D[kInst] = new su2double[nInstHB];
+
+  /*--- Distribute the instances over the groups of ranks in contiguous blocks. Every group holds all the
+   instances, but only iterates its own, the others are received from their groups before computing the
+   harmonic balance sources. ---*/
+
+  nInstGroups = nGroups;
+  if (nInstGroups > nInstHB)
+    SU2_MPI::Error("HB_INSTANCE_GROUPS cannot be larger than TIME_INSTANCES.", CURRENT_FUNCTION);
+
+  instGroup.resize(nInstHB);
+  for (unsigned short iGroup = 0; iGroup < nInstGroups; iGroup++)
+    for (kInst = iGroup*nInstHB/nInstGroups; kInst < (iGroup+1)*nInstHB/nInstGroups; kInst++)
+      instGroup[kInst] = iGroup;
+
+  worldComm = MPICommunicator;
+  crossComm = MPICommunicator;
+
+  if (nInstGroups > 1) {
+    int worldRank;
+    SU2_MPI::Comm_rank(MPICommunicator, &worldRank);
+    iInstGroup = worldRank / size;
+
+    /*--- Ranks with the same rank in their group hold the same part of the mesh in every group, and
+     their rank in the cross communicator is the group number. ---*/
+    SU2_MPI::Comm_split(MPICommunicator, rank, iInstGroup, &crossComm);
+
+    CheckInstanceGroupPartitions();
+
+    if (worldRank == MASTER_NODE)
+      cout << "Harmonic balance instances iterated concurrently by " << nInstGroups << " groups of "
+           << size << " ranks." << endl;
+  }
 }
 
 CHBDriver::~CHBDriver() {
@@ -3128,33 +3266,130 @@ CHBDriver::~CHBDriver() {
   /*--- delete dynamic memory for the Harmonic Balance operator ---*/
   for (kInst = 0; kInst < nInstHB; kInst++) delete [] D[kInst];
   delete [] D;
+
+  if (nInstGroups > 1) {
+    /*--- The group must not stay installed after it is freed. ---*/
+    SU2_Comm groupComm = SU2_MPI::GetComm();
+    SU2_MPI::SetComm(worldComm);
+    SU2_MPI::Comm_free(&groupComm);
+    SU2_MPI::Comm_free(&crossComm);
+
+    /*--- See SplitInstanceGroups. ---*/
+    cout.clear();
+  }
+}
+
+SU2_Comm CHBDriver::SplitInstanceGroups(SU2_Comm MPICommunicator, unsigned short nGroups) {
+
+  if (nGroups <= 1) return MPICommunicator;
+
+  int worldRank = 0, worldSize = 1;
+  SU2_MPI::Comm_rank(MPICommunicator, &worldRank);
+  SU2_MPI::Comm_size(MPICommunicator, &worldSize);
+
+  if (worldSize % nGroups != 0) {
+    SU2_MPI::SetComm(MPICommunicator);
+    SU2_MPI::Error("The number of ranks must be a multiple of HB_INSTANCE_GROUPS.", CURRENT_FUNCTION);
+  }
+
+  /*--- Contiguous blocks of ranks, to keep each group within as few nodes as possible. ---*/
+
+  const int groupSize = worldSize / nGroups;
+  SU2_Comm groupComm = MPICommunicator;
+  SU2_MPI::Comm_split(MPICommunicator, worldRank / groupSize, worldRank, &groupComm);
+
+  /*--- The master of each group would print the same preprocessing and convergence output, only the
+   first group writes to the screen (the files of each instance are written by the group that owns it). ---*/
+
+  if (worldRank >= groupSize) cout.setstate(ios::failbit);
+
+  return groupComm;
+}
+
+void CHBDriver::CheckInstanceGroupPartitions() const {
+
+  /*--- Every group partitions the same mesh on the same number of ranks, the exchange of the instances
+   relies on the partitions (including the halos and the coarse levels) being identical. ---*/
+
+  unsigned long local[2] = {0, 0}, minimum[2] = {0, 0}, maximum[2] = {0, 0};
+
+  for (unsigned short iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+    const auto* geometry = geometry_container[ZONE_0][INST_0][iMGlevel];
+    local[0] += geometry->GetnPoint();
+    if (iMGlevel == MESH_0) {
+      for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+        local[1] = local[1] * 31 + geometry->nodes->GetGlobalIndex(iPoint);
+    }
+  }
+
+  SU2_MPI::Allreduce(local, minimum, 2, MPI_UNSIGNED_LONG, MPI_MIN, crossComm);
+  SU2_MPI::Allreduce(local, maximum, 2, MPI_UNSIGNED_LONG, MPI_MAX, crossComm);
+
+  int mismatch = (minimum[0] != maximum[0]) || (minimum[1] != maximum[1]), anyMismatch = 0;
+  SU2_MPI::Allreduce(&mismatch, &anyMismatch, 1, MPI_INT, MPI_MAX, SU2_MPI::GetComm());
+
+  if (anyMismatch)
+    SU2_MPI::Error("The groups of HB_INSTANCE_GROUPS produced different partitions of the mesh.", CURRENT_FUNCTION);
 }
 
+void CHBDriver::ExchangeInstanceSolutions() {
+
+  if (nInstGroups <= 1) return;
+
+  const bool adjoint = config_container[ZONE_0]->GetContinuous_Adjoint();
+  const bool implicit = adjoint ? (config_container[ZONE_0]->GetKind_TimeIntScheme_AdjFlow() == EULER_IMPLICIT)
+                                : (config_container[ZONE_0]->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT);
+  const bool rans = (config_container[ZONE_0]->GetKind_Solver() == MAIN_SOLVER::RANS);
+
+  auto Broadcast = [&](auto& values, int root) {
+    SU2_MPI::Bcast(values.data(), values.size(), MPI_DOUBLE, root, crossComm);
+  };
+
+  /*--- Exactly the data read by SetHarmonicBalance, i.e. the solutions on all grid levels. ---*/
+
+  for (unsigned short jInst = 0; jInst < nInstHB; jInst++) {
+    const int root = instGroup[jInst];
+
+    for (unsigned short iMGlevel = 0; iMGlevel <= config_container[ZONE_0]->GetnMGLevels(); iMGlevel++) {
+      auto* nodes = solver_container[ZONE_0][jInst][iMGlevel][adjoint ? ADJFLOW_SOL : FLOW_SOL]->GetNodes();
+      Broadcast(nodes->GetSolution(), root);
+      if (implicit) Broadcast(nodes->GetSolution_Old(), root);
+    }
+    if (rans) Broadcast(solver_container[ZONE_0][jInst][MESH_0][TURB_SOL]->GetNodes()->GetSolution(), root);
+  }
+}
 
 void CHBDriver::Run() {
 
   /*--- Run a single iteration of a Harmonic Balance problem. Preprocess all
-   all zones before beginning the iteration. ---*/
+   all zones before beginning the iteration. Only the instances of this group
+   of ranks are iterated. ---*/
 
   for (iInst = 0; iInst < nInstHB; iInst++)
-    iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+    if (IsOwnInstance(iInst))
+      iteration_container[ZONE_0][iInst]->Preprocess(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
   for (iInst = 0; iInst < nInstHB; iInst++)
-    iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+    if (IsOwnInstance(iInst))
+      iteration_container[ZONE_0][iInst]->Iterate(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
   for (iInst = 0; iInst < nInstHB; iInst++)
-    iteration_container[ZONE_0][iInst]->Monitor(output_container[ZONE_0], integration_container, geometry_container,
-        solver_container, numerics_container, config_container,
-        surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
+    if (IsOwnInstance(iInst))
+      iteration_container[ZONE_0][iInst]->Monitor(output_container[ZONE_0], integration_container, geometry_container,
+          solver_container, numerics_container, config_container,
+          surface_movement, grid_movement, FFDBox, ZONE_0, iInst);
 
 }
 
 void CHBDriver::Update() {
 
+  /*--- Gather the instances iterated by the other groups ---*/
+  ExchangeInstanceSolutions();
+
   for (iInst = 0; iInst < nInstHB; iInst++) {
     /*--- Compute the harmonic balance terms across all zones ---*/
     SetHarmonicBalance(iInst);
@@ -3168,6 +3403,7 @@ void CHBDriver::Update() {
   }
 
   for (iInst = 0; iInst < nInstHB; iInst++) {
+    if (!IsOwnInstance(iInst)) continue;
 
     /*--- Update the harmonic balance terms across all zones ---*/
     iteration_container[ZONE_0][iInst]->Update(output_container[ZONE_0], integration_container, geometry_container,
@@ -3178,6 +3414,22 @@ void CHBDriver::Update() {
 
 }
 
+void CHBDriver::Output(unsigned long InnerIter) {
+
+  const auto inst = config_container[ZONE_0]->GetiInst();
+
+  for (iInst = 0; iInst < nInstHB; ++iInst) {
+    if (!IsOwnInstance(iInst)) continue;
+    config_container[ZONE_0]->SetiInst(iInst);
+    output_container[ZONE_0]->SetResultFiles(geometry_container[ZONE_0][iInst][MESH_0],
+                                             config_container[ZONE_0],
+                                             solver_container[ZONE_0][iInst][MESH_0],
+                                             InnerIter, StopCalc);
+  }
+  config_container[ZONE_0]->SetiInst(inst);
+
+}
+
 void CHBDriver::SetHarmonicBalance(unsigned short iInst) {
 
   unsigned short iVar, jInst, iMGlevel;
@@ -269,8 +269,10 @@ void CMultizoneDriver::Preprocess(unsigned long TimeIter) {
   if (driver_config->GetTime_Domain()) {
     for (iZone = 0; iZone < nZone; iZone++) {
       for (unsigned short jZone = 0; jZone < nZone; jZone++){
-        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr && prefixed_motion[iZone])
+        if(jZone != iZone && interpolator_container[iZone][jZone] != nullptr && prefixed_motion[iZone]) {
           interpolator_container[iZone][jZone]->SetTransferCoeff(config_container);
+          interpolator_container[iZone][jZone]->SetTransferPattern(config_container);
+        }
       }
     }
   }
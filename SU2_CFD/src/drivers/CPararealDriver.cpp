@@ -0,0 +1,356 @@
+/*!
+ * \file CPararealDriver.cpp
+ * \brief The main subroutines for driving parallel-in-time (Parareal) dual time stepping problems.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "../../include/drivers/CPararealDriver.hpp"
+#include "../../include/iteration/CIteration.hpp"
+#include "../../include/output/COutput.hpp"
+#include "../../include/solvers/CSolver.hpp"
+
+CPararealDriver::CPararealDriver(char* confFile, unsigned short val_nZone, SU2_Comm MPICommunicator,
+                                 unsigned short nGroups)
+    : CSinglezoneDriver(confFile, val_nZone, SplitTimeSlabs(MPICommunicator, nGroups)),
+      nSlabs(nGroups),
+      crossComm(MPICommunicator) {
+  worldComm = MPICommunicator;
+
+  const auto* config = config_container[ZONE_0];
+
+  if ((config->GetTime_Marching() != TIME_MARCHING::DT_STEPPING_1ST) &&
+      (config->GetTime_Marching() != TIME_MARCHING::DT_STEPPING_2ND))
+    SU2_MPI::Error("PARAREAL_SLABS requires dual time stepping.", CURRENT_FUNCTION);
+
+  if (config->GetGrid_Movement() || config->GetDeform_Mesh() || config->GetDiscrete_Adjoint())
+    SU2_MPI::Error("PARAREAL_SLABS does not support moving grids or adjoints.", CURRENT_FUNCTION);
+
+  /*--- Equal slabs, with a whole number of coarse time steps each. ---*/
+
+  const unsigned long startIter = config->GetRestart() ? config->GetRestart_Iter() : 0;
+  const unsigned long nTimeIter = config->GetnTime_Iter() - startIter;
+  coarsening = max<unsigned short>(config->GetParareal_Coarsening(), 1);
+  nSlabTimeIter = nTimeIter / nSlabs;
+
+  if (nTimeIter % nSlabs != 0 || nSlabTimeIter % coarsening != 0)
+    SU2_MPI::Error("The number of time iterations must be a multiple of PARAREAL_SLABS * PARAREAL_COARSENING.",
+                   CURRENT_FUNCTION);
+
+  int worldRank = 0;
+  SU2_MPI::Comm_rank(MPICommunicator, &worldRank);
+  iSlab = worldRank / size;
+
+  /*--- Ranks with the same rank in their group hold the same part of the mesh in every group, and
+   their rank in the cross communicator is the slab number. ---*/
+  SU2_MPI::Comm_split(MPICommunicator, rank, iSlab, &crossComm);
+  firstTimeIter = startIter + iSlab * nSlabTimeIter;
+
+  /*--- Each slab writes its own history. All the history files were opened with the same name by the base class,
+   the barrier ensures no slab starts writing before the others have re-opened theirs with a different name. ---*/
+
+  if (iSlab > 0) {
+    config_container[ZONE_0]->SetiParareal_Slab(iSlab);
+    delete output_container[ZONE_0];
+    PreprocessOutput(config_container, driver_config, output_container, driver_output);
+  }
+  SU2_MPI::Barrier(MPICommunicator);
+
+  /*--- Layout of the state, the solution and its time levels of all the time dependent solvers on all the grid
+   levels (also the coarse levels keep their own time levels). ---*/
+
+  for (unsigned short iMesh = 0; iMesh <= config->GetnMGLevels(); iMesh++) {
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      auto* solver = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (solver == nullptr) continue;
+      auto* nodes = solver->GetNodes();
+      const auto n = nodes->GetSolution().size();
+      if (n == 0 || nodes->GetSolution_time_n().size() != n || nodes->GetSolution_time_n1().size() != n) continue;
+
+      stateBlocks.push_back({stateSize, stateSize + n, stateSize + 2 * n});
+      stateSize += 3 * n;
+    }
+  }
+
+  /*--- The states are exchanged between slabs as they are, the partitions must match. ---*/
+
+  unsigned long local[2] = {stateSize, 0}, minimum[2] = {0, 0}, maximum[2] = {0, 0};
+  const auto* geometry = geometry_container[ZONE_0][INST_0][MESH_0];
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); iPoint++)
+    local[1] = local[1] * 31 + geometry->nodes->GetGlobalIndex(iPoint);
+
+  SU2_MPI::Allreduce(local, minimum, 2, MPI_UNSIGNED_LONG, MPI_MIN, crossComm);
+  SU2_MPI::Allreduce(local, maximum, 2, MPI_UNSIGNED_LONG, MPI_MAX, crossComm);
+
+  int mismatch = (minimum[0] != maximum[0]) || (minimum[1] != maximum[1]), anyMismatch = 0;
+  SU2_MPI::Allreduce(&mismatch, &anyMismatch, 1, MPI_INT, MPI_MAX, MPICommunicator);
+
+  if (anyMismatch)
+    SU2_MPI::Error("The time slabs of PARAREAL_SLABS produced different partitions of the mesh.", CURRENT_FUNCTION);
+}
+
+CPararealDriver::~CPararealDriver() {
+  /*--- The group must not stay installed after it is freed. ---*/
+  SU2_Comm groupComm = SU2_MPI::GetComm();
+  SU2_MPI::SetComm(worldComm);
+  SU2_MPI::Comm_free(&groupComm);
+  SU2_MPI::Comm_free(&crossComm);
+
+  /*--- See SplitTimeSlabs. ---*/
+  cout.clear();
+}
+
+SU2_Comm CPararealDriver::SplitTimeSlabs(SU2_Comm MPICommunicator, unsigned short nGroups) {
+
+  int worldRank = 0, worldSize = 1;
+  SU2_MPI::Comm_rank(MPICommunicator, &worldRank);
+  SU2_MPI::Comm_size(MPICommunicator, &worldSize);
+
+  if (nGroups < 2 || worldSize % nGroups != 0) {
+    SU2_MPI::SetComm(MPICommunicator);
+    SU2_MPI::Error("PARAREAL_SLABS must be larger than 1 and divide the number of ranks.", CURRENT_FUNCTION);
+  }
+
+  /*--- Contiguous blocks of ranks, to keep each slab within as few nodes as possible. ---*/
+
+  const int groupSize = worldSize / nGroups;
+  SU2_Comm groupComm = MPICommunicator;
+  SU2_MPI::Comm_split(MPICommunicator, worldRank / groupSize, worldRank, &groupComm);
+
+  /*--- The master of each slab would print its own preprocessing and convergence output, only the first
+   slab writes to the screen (each slab writes its own history and solution files). ---*/
+
+  if (worldRank >= groupSize) cout.setstate(ios::failbit);
+
+  return groupComm;
+}
+
+void CPararealDriver::GetState(vector<su2double>& state) const {
+
+  state.resize(stateSize);
+  size_t iBlock = 0;
+
+  for (unsigned short iMesh = 0; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      auto* solver = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (solver == nullptr) continue;
+      auto* nodes = solver->GetNodes();
+      const auto n = nodes->GetSolution().size();
+      if (n == 0 || nodes->GetSolution_time_n().size() != n || nodes->GetSolution_time_n1().size() != n) continue;
+
+      const auto& block = stateBlocks[iBlock++];
+      copy_n(nodes->GetSolution().data(), n, &state[block[0]]);
+      copy_n(nodes->GetSolution_time_n().data(), n, &state[block[1]]);
+      copy_n(nodes->GetSolution_time_n1().data(), n, &state[block[2]]);
+    }
+  }
+}
+
+void CPararealDriver::SetState(const vector<su2double>& state) {
+
+  size_t iBlock = 0;
+
+  for (unsigned short iMesh = 0; iMesh <= config_container[ZONE_0]->GetnMGLevels(); iMesh++) {
+    for (unsigned short iSol = 0; iSol < MAX_SOLS; iSol++) {
+      auto* solver = solver_container[ZONE_0][INST_0][iMesh][iSol];
+      if (solver == nullptr) continue;
+      auto* nodes = solver->GetNodes();
+      const auto n = nodes->GetSolution().size();
+      if (n == 0 || nodes->GetSolution_time_n().size() != n || nodes->GetSolution_time_n1().size() != n) continue;
+
+      const auto& block = stateBlocks[iBlock++];
+      copy_n(&state[block[0]], n, nodes->GetSolution().data());
+      copy_n(&state[block[1]], n, nodes->GetSolution_time_n().data());
+      copy_n(&state[block[2]], n, nodes->GetSolution_time_n1().data());
+    }
+  }
+}
+
+void CPararealDriver::ScaleTimeStep(vector<su2double>& state, su2double ratio) const {
+
+  /*--- u_{n-1} = u_n - ratio * (u_n - u_{n-1}), second order accurate for the BDF2 history. ---*/
+
+  for (const auto& block : stateBlocks) {
+    const auto n = block[1] - block[0];
+    for (size_t i = 0; i < n; i++) {
+      const su2double un = state[block[1] + i];
+      state[block[2] + i] = un - ratio * (un - state[block[2] + i]);
+    }
+  }
+}
+
+void CPararealDriver::RunWithoutOutput() {
+
+  auto* config = config_container[ZONE_0];
+  auto* iteration = iteration_container[ZONE_0][INST_0];
+  const auto* solver = solver_container[ZONE_0][INST_0][MESH_0][config->GetFluidProblem() ? FLOW_SOL : HEAT_SOL];
+
+  config->SetOuterIter(0);
+  iteration->Preprocess(output_container[ZONE_0], integration_container, geometry_container, solver_container,
+                        numerics_container, config_container, surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+  /*--- The convergence criteria are evaluated by the history output, which must only see the final fine sweep,
+   the same default criterion (residual of the first variable) is checked directly. ---*/
+
+  for (auto iInner = 0ul; iInner < config->GetnInner_Iter(); iInner++) {
+    config->SetInnerIter(iInner);
+    iteration->Iterate(output_container[ZONE_0], integration_container, geometry_container, solver_container,
+                       numerics_container, config_container, surface_movement, grid_movement, FFDBox, ZONE_0, INST_0);
+
+    if (solver != nullptr && log10(SU2_TYPE::GetValue(solver->GetRes_RMS(0))) < SU2_TYPE::GetValue(config->GetMinLogResidual())) break;
+  }
+}
+
+void CPararealDriver::FinePropagator(vector<su2double>& state, bool output) {
+
+  SetState(state);
+
+  for (auto iter = firstTimeIter; iter < firstTimeIter + nSlabTimeIter; iter++) {
+    Preprocess(iter);
+    if (output) {
+      Run();
+    } else {
+      RunWithoutOutput();
+    }
+    Postprocess();
+    Update();
+    if (output) {
+      Monitor(iter);
+      Output(iter);
+    }
+  }
+  StopCalc = false;
+
+  GetState(state);
+}
+
+void CPararealDriver::CoarsePropagator(vector<su2double>& state) {
+
+  auto* config = config_container[ZONE_0];
+  const su2double fineTimeStep = config->GetDelta_UnstTimeND();
+  const auto fineInnerIter = config->GetnInner_Iter();
+
+  ScaleTimeStep(state, coarsening);
+  SetState(state);
+
+  config->SetDelta_UnstTimeND(fineTimeStep * coarsening);
+  if (config->GetnParareal_CoarseInnerIter() > 0) config->SetnInner_Iter(config->GetnParareal_CoarseInnerIter());
+
+  /*--- The time iterations keep the numbering of the fine propagator. ---*/
+
+  for (auto iter = firstTimeIter; iter < firstTimeIter + nSlabTimeIter; iter += coarsening) {
+    Preprocess(iter);
+    config->SetPhysicalTime(static_cast<su2double>(iter) * fineTimeStep);
+    RunWithoutOutput();
+    Postprocess();
+    Update();
+  }
+
+  config->SetDelta_UnstTimeND(fineTimeStep);
+  config->SetnInner_Iter(fineInnerIter);
+
+  GetState(state);
+  ScaleTimeStep(state, 1.0 / coarsening);
+}
+
+void CPararealDriver::StartSolver() {
+
+  StartTime = SU2_MPI::Wtime();
+  config_container[ZONE_0]->Set_StartTime(StartTime);
+
+  if (rank == MASTER_NODE)
+    cout << endl <<"------------------------------ Begin Solver -----------------------------" << endl;
+
+  if (rank == MASTER_NODE && iSlab == 0) {
+    cout << endl << "Simulation Run using the Parareal Driver" << endl;
+    cout << "The " << nSlabs * nSlabTimeIter << " time steps are split into " << nSlabs << " slabs of "
+         << nSlabTimeIter << " steps." << endl;
+  }
+
+  const int tag = 0;
+  const bool hasPrevious = (iSlab > 0), hasNext = (iSlab + 1 < nSlabs);
+  SU2_MPI::Status status;
+
+  /*--- Initial state of each slab, from the coarse propagator. The first slab starts from the initial condition. ---*/
+
+  vector<su2double> lambda, coarse, fine, lambdaNew;
+  GetState(lambda);
+
+  if (hasPrevious)
+    SU2_MPI::Recv(lambda.data(), stateSize, MPI_DOUBLE, iSlab - 1, tag, crossComm, &status);
+  coarse = lambda;
+  CoarsePropagator(coarse);
+  if (hasNext) SU2_MPI::Send(coarse.data(), stateSize, MPI_DOUBLE, iSlab + 1, tag, crossComm);
+
+  /*--- Parareal iterations. After k corrections the first k slabs are exact, no more than nSlabs are needed. ---*/
+
+  const unsigned short maxIter = min(config_container[ZONE_0]->GetnParareal_Iter(), nSlabs);
+  const su2double tol = config_container[ZONE_0]->GetParareal_Tol();
+  bool converged = false;
+
+  for (unsigned short iIter = 0; ; iIter++) {
+
+    /*--- The last fine propagation, from the converged initial states, writes the solution. ---*/
+
+    const bool lastSweep = converged || (iIter + 1 >= maxIter);
+
+    fine = lambda;
+    FinePropagator(fine, lastSweep);
+    if (lastSweep) break;
+
+    /*--- Coarse correction, the slabs are swept in order. ---*/
+
+    lambdaNew = lambda;
+    if (hasPrevious)
+      SU2_MPI::Recv(lambdaNew.data(), stateSize, MPI_DOUBLE, iSlab - 1, tag, crossComm, &status);
+
+    vector<su2double> coarseNew = lambdaNew;
+    CoarsePropagator(coarseNew);
+
+    if (hasNext) {
+      vector<su2double> next(stateSize);
+      for (size_t i = 0; i < stateSize; i++) next[i] = coarseNew[i] + fine[i] - coarse[i];
+      SU2_MPI::Send(next.data(), stateSize, MPI_DOUBLE, iSlab + 1, tag, crossComm);
+    }
+
+    /*--- Relative change of the initial states. ---*/
+
+    passivedouble local[2] = {0.0, 0.0}, global[2] = {0.0, 0.0};
+    for (size_t i = 0; i < stateSize; i++) {
+      local[0] += pow(SU2_TYPE::GetValue(lambdaNew[i] - lambda[i]), 2);
+      local[1] += pow(SU2_TYPE::GetValue(lambdaNew[i]), 2);
+    }
+    using MPI_Wrapper = SelectMPIWrapper<passivedouble>::W;
+    MPI_Wrapper::Allreduce(local, global, 2, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+    passivedouble change = sqrt(global[0] / max(global[1], 1e-16)), maxChange = 0.0;
+    MPI_Wrapper::Allreduce(&change, &maxChange, 1, MPI_DOUBLE, MPI_MAX, crossComm);
+
+    if (rank == MASTER_NODE && iSlab == 0)
+      cout << "Parareal iteration " << iIter + 1 << ", relative change of the slab initial states: " << maxChange
+           << endl;
+
+    converged = (maxChange < tol);
+    lambda.swap(lambdaNew);
+    coarse.swap(coarseNew);
+  }
+}
@@ -96,7 +96,7 @@ CMutationTCLib::CMutationTCLib(const CConfig* config, unsigned short val_nDim):
 
 CMutationTCLib::~CMutationTCLib(){}
 
-void CMutationTCLib::SetTDStateRhosTTv(vector<su2double>& val_rhos, su2double val_temperature, su2double val_temperature_ve){
+void CMutationTCLib::SetTDStateRhosTTv(const su2double* val_rhos, su2double val_temperature, su2double val_temperature_ve){
 
   temperatures[0] = val_temperature;
   temperatures[1] = val_temperature_ve;
@@ -104,11 +104,11 @@ void CMutationTCLib::SetTDStateRhosTTv(vector<su2double>& val_rhos, su2double va
   T   = temperatures[0];
   Tve = temperatures[1];
 
-  rhos = val_rhos;
-
   Density = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    rhos[iSpecies] = val_rhos[iSpecies];
     Density += rhos[iSpecies];
+  }
 
   Pressure = ComputePressure();
 
@@ -133,33 +133,32 @@ vector<su2double>& CMutationTCLib::GetSpeciesCvTraRot(){
 }
 
 
-vector<su2double>& CMutationTCLib::ComputeSpeciesCvVibEle(su2double val_T){
+void CMutationTCLib::ComputeSpeciesCvVibEle(su2double val_T, su2double* val_cvves) const {
 
    mix->getCvsMass(Cv_ks.data());
 
-   for(iSpecies = 0; iSpecies < nSpecies; iSpecies++) Cvves[iSpecies] = Cv_ks[nSpecies+iSpecies];
-
-   return Cvves;
+   for(unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) val_cvves[iSpecies] = Cv_ks[nSpecies+iSpecies];
 }
 
-vector<su2double>& CMutationTCLib::ComputeMixtureEnergies(){
+void CMutationTCLib::ComputeMixtureEnergies(const su2double* val_rhos, su2double val_T, su2double val_Tve,
+                                            su2double* val_energies) const {
 
-  SetTDStateRhosTTv(rhos, T, Tve);
+  const su2double val_temperatures[] = {val_T, val_Tve};
 
-  mix->mixtureEnergies(energies.data());
+  mix->setState(val_rhos, val_temperatures, 1);
 
-  return energies;
+  mix->mixtureEnergies(val_energies);
 }
 
-vector<su2double>& CMutationTCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only){
+void CMutationTCLib::ComputeSpeciesEve(su2double val_T, su2double* val_eves, bool vibe_only) const {
 
-  SetTDStateRhosTTv(rhos, T, val_T);
+  const su2double val_temperatures[] = {T, val_T};
 
-  mix->getEnergiesMass(es.data());
+  mix->setState(rhos.data(), val_temperatures, 1);
 
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++) eves[iSpecies] = es[nSpecies+iSpecies];
+  mix->getEnergiesMass(es.data());
 
-  return eves;
+  for(unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) val_eves[iSpecies] = es[nSpecies+iSpecies];
 }
 
 vector<su2double>& CMutationTCLib::ComputeNetProductionRates(bool implicit, const su2double *V, const su2double* eve,
@@ -180,18 +179,17 @@ su2double CMutationTCLib::ComputeEveSourceTerm(){
   return omega;
 }
 
-vector<su2double>& CMutationTCLib::ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, su2double *val_eves){
+void CMutationTCLib::ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, const su2double *val_eves,
+                                            su2double* val_hs) const {
 
-  mix->getEnthalpiesMass(hs.data());
+  mix->getEnthalpiesMass(es.data());
 
-  return hs;
+  for(unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) val_hs[iSpecies] = es[iSpecies];
 }
 
-vector<su2double>& CMutationTCLib::GetDiffusionCoeff(){
-
-  mix->averageDiffusionCoeffs(DiffusionCoeff.data());
+void CMutationTCLib::GetDiffusionCoeff(su2double* val_Ds){
 
-  return DiffusionCoeff;
+  mix->averageDiffusionCoeffs(val_Ds);
 }
 
 su2double CMutationTCLib::GetViscosity(){
@@ -201,28 +199,19 @@ su2double CMutationTCLib::GetViscosity(){
   return Mu;
 }
 
-vector<su2double>& CMutationTCLib::GetThermalConductivities(){
+void CMutationTCLib::GetThermalConductivities(su2double* val_conductivities){
 
-  mix->frozenThermalConductivityVector(ThermalConductivities.data());
-
-  return ThermalConductivities;
+  mix->frozenThermalConductivityVector(val_conductivities);
 }
 
-vector<su2double>& CMutationTCLib::ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel, su2double Tve_old){
-
-  rhos = val_rhos;
-
-  energies[0] = rhoE - rhoEvel;
-  energies[1] = rhoEve;
+void CMutationTCLib::ComputeTemperatures(const su2double* val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel,
+                                         su2double Tve_old, su2double* val_temperatures) const {
 
-  mix->setState(rhos.data(), energies.data(), 0);
+  const su2double val_energies[] = {rhoE - rhoEvel, rhoEve};
 
-  mix->getTemperatures(temperatures.data());
-
-  T   = temperatures[0];
-  Tve = temperatures[1];
+  mix->setState(val_rhos, val_energies, 0);
 
-  return temperatures;
+  mix->getTemperatures(val_temperatures);
 }
 
 vector<su2double>& CMutationTCLib::GetRefTemperature() {
@@ -144,7 +144,7 @@ su2double CNEMOGas::ComputeGamma(){
 
 su2double CNEMOGas::ComputerhoCvve() {
 
-    Cvves = ComputeSpeciesCvVibEle(Tve);
+    ComputeSpeciesCvVibEle(Tve, Cvves.data());
 
     rhoCvve = 0.0;
     for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
@@ -153,7 +153,7 @@ su2double CNEMOGas::ComputerhoCvve() {
     return rhoCvve;
 }
 
-void CNEMOGas::ComputedPdU(const su2double *V, const vector<su2double>& val_eves, su2double *val_dPdU){
+void CNEMOGas::ComputedPdU(const su2double *V, const su2double* val_eves, su2double *val_dPdU){
 
   // Note: Electron energy not included properly.
 
@@ -270,7 +270,7 @@ void CNEMOGas::ComputedTdU(const su2double *V, su2double *val_dTdU){
 
 }
 
-void CNEMOGas::ComputedTvedU(const su2double *V, const vector<su2double>& val_eves, su2double *val_dTvedU){
+void CNEMOGas::ComputedTvedU(const su2double *V, const su2double* val_eves, su2double *val_dTvedU){
 
   /*--- Necessary indexes to assess primitive variables ---*/
   unsigned long RHOCVVE_INDEX = nSpecies+nDim+7;
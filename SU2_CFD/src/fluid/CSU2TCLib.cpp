@@ -27,6 +27,29 @@
 
 #include "../../include/fluid/CSU2TCLib.hpp"
 #include "../../../Common/include/option_structure.hpp"
+#include <map>
+
+namespace {
+/*--- Artificial chemistry parameters, these increase the rate-controlling reaction temperature to relax some of the
+ * stiffness in the chemistry source term. ---*/
+const su2double T_min = 800.0;
+const su2double epsilon = 80;
+
+/*--- Range and size of the temperature tables (uniform in log(T)). ---*/
+const passivedouble TableTmin = 50.0;
+const passivedouble TableTmax = 1e5;
+const unsigned long TableSize = 2048;
+
+/*!
+ * \brief Modified (smoothly limited from below) rate-controlling temperature, and its derivative.
+ */
+su2double ModifiedTemperature(su2double Trxn, su2double& dTh) {
+  const su2double root = sqrt((Trxn-T_min)*(Trxn-T_min)+epsilon*epsilon);
+  dTh = 0.5 * (1.0 + (Trxn-T_min)/root);
+  return 0.5 * (Trxn+T_min + root);
+}
+}
+
 
 CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscous): CNEMOGas(config, val_nDim){
 
@@ -52,6 +75,7 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
   taus.resize(nSpecies,0.0);
   eve_eq.resize(nSpecies,0.0);
   eve.resize(nSpecies,0.0);
+  cvve_eq.resize(nSpecies,0.0);
 
   if (viscous) {
     MolarFracWBE.resize(nSpecies,0.0);
@@ -1158,19 +1182,94 @@ CSU2TCLib::CSU2TCLib(const CConfig* config, unsigned short val_nDim, bool viscou
 
   if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
   else            { nHeavy = nSpecies;   nEl = 0; }
+
+  /*--- The equilibrium constants only depend on the reaction, look them up once. ---*/
+  RxnConstantTables.resize(nReactions);
+  for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+    GetChemistryEquilConstants(iReaction);
+    RxnConstantTables[iReaction] = RxnConstantTable;
+  }
+
+  /*--- The T-R specific heats are constant. ---*/
+  GetSpeciesCvTraRot();
+
+  if (config->GetTabulate_ThermoChemistry()) SetTemperatureTables();
 }
 
 CSU2TCLib::~CSU2TCLib()= default;
 
-void CSU2TCLib::SetTDStateRhosTTv(vector<su2double>& val_rhos, su2double val_temperature, su2double val_temperature_ve){
+void CSU2TCLib::SetTemperatureTables() {
+
+  /*--- The properties only depend on the gas model, the tables are built by the first instance and shared by the
+   * others (e.g. the fluid models of each zone or thread). The cache does not keep them alive. ---*/
+  static std::map<string, std::weak_ptr<const CTemperatureTables> > cache;
+  const string key = gas_model + (ionization ? "+ions" : "");
+
+  SU2_OMP_CRITICAL
+  {
+    Tables = cache[key].lock();
+
+    if (Tables == nullptr) {
+      auto tables = std::make_shared<CTemperatureTables>();
+      const passivedouble x0 = log(TableTmin), x1 = log(TableTmax);
+
+      /*--- Species vib.-el. energies, built with the analytic expressions (Tables is still null). ---*/
+      for (unsigned short s = 0; s < nSpecies; s++) {
+        tables->Eve.emplace_back(x0, x1, TableSize, [&](su2double logT, su2double& dEdlogT) {
+          const su2double Temp = exp(logT);
+          dEdlogT = SpeciesCvVibEle(s, Temp) * Temp;
+          return SpeciesEve(s, Temp, false);
+        });
+      }
+
+      /*--- Arrhenius rates, in terms of the rate-controlling temperature (before the modification). ---*/
+      for (unsigned short iReaction = 0; iReaction < nReactions; iReaction++) {
+        const su2double logC = log(ArrheniusCoefficient[iReaction]);
+        const su2double eta = ArrheniusEta[iReaction], theta = ArrheniusTheta[iReaction];
+        tables->LogRate.emplace_back(x0, x1, TableSize, [&](su2double logTrxn, su2double& dlogk) {
+          const su2double Trxn = exp(logTrxn);
+          su2double dTh;
+          const su2double Th = ModifiedTemperature(Trxn, dTh);
+          dlogk = (eta/Th + theta/(Th*Th)) * dTh * Trxn;
+          return logC + eta*log(Th) - theta/Th;
+        });
+      }
+
+      /*--- Terms of log(Keq) = A0*Th/1E4 + A1 + A2*log(1E4/Th) + A3*1E4/Th + A4*(1E4/Th)^2. ---*/
+      for (const int iTerm : {0, 2, 3, 4}) {
+        tables->Keq[iTerm] = CHermiteTable(x0, x1, TableSize, [&](su2double logTrxn, su2double& dterm) {
+          const su2double Trxn = exp(logTrxn);
+          su2double dTh;
+          const su2double x = ModifiedTemperature(Trxn, dTh) / 1E4;
+          su2double term = 0, dtermdx = 0;
+          switch (iTerm) {
+            case 0: term = x; dtermdx = 1; break;
+            case 2: term = -log(x); dtermdx = -1/x; break;
+            case 3: term = 1/x; dtermdx = -1/(x*x); break;
+            case 4: term = 1/(x*x); dtermdx = -2/(x*x*x); break;
+          }
+          dterm = dtermdx * dTh / 1E4 * Trxn;
+          return term;
+        });
+      }
+
+      Tables = tables;
+      cache[key] = Tables;
+    }
+  }
+  END_SU2_OMP_CRITICAL
+}
+
+void CSU2TCLib::SetTDStateRhosTTv(const su2double* val_rhos, su2double val_temperature, su2double val_temperature_ve){
 
-  rhos = val_rhos;
   T    = val_temperature;
   Tve  = val_temperature_ve;
 
   Density = 0.0;
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    rhos[iSpecies] = val_rhos[iSpecies];
     Density += rhos[iSpecies];
+  }
 
   Pressure = ComputePressure();
 
@@ -1180,158 +1279,170 @@ vector<su2double>& CSU2TCLib::GetSpeciesCvTraRot(){
 
   if(ionization) Cvtrs[0] = 0.0;
 
-  for (iSpecies = nEl; iSpecies < nHeavy; iSpecies++)
+  for (unsigned short iSpecies = nEl; iSpecies < nHeavy; iSpecies++)
     Cvtrs[iSpecies] = (3.0/2.0 + RotationModes[iSpecies]/2.0) * Ru/MolarMass[iSpecies];
 
   return Cvtrs;
 }
 
-vector<su2double>& CSU2TCLib::ComputeSpeciesCvVibEle(su2double val_T){
+su2double CSU2TCLib::SpeciesCvVibEle(unsigned short iSpecies, su2double val_T) const {
 
   su2double thoTve, exptv, num, num2, num3, denom, Cvvs, Cves;
-  unsigned short iElectron = 0;
+  const unsigned short iElectron = 0;
 
-  /*--- Loop through species ---*/
-  for(iSpecies = 0; iSpecies < nSpecies; iSpecies++){
+  /*--- If requesting electron specific heat ---*/
+  if (ionization && iSpecies == iElectron) {
+    return 3.0/2.0 * Ru/MolarMass[iSpecies];
+  }
+
+  /*--- Heavy particle specific heat ---*/
+
+  /*--- Vibrational energy ---*/
+  if (CharVibTemp[iSpecies] != 0.0) {
+    thoTve = CharVibTemp[iSpecies]/val_T;
+    exptv = exp(CharVibTemp[iSpecies]/val_T);
+    Cvvs  = Ru/MolarMass[iSpecies] * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
+  } else {
+    Cvvs = 0.0;
+  }
 
-    /*--- If requesting electron specific heat ---*/
-    if (ionization && iSpecies == iElectron) {
-      Cvvs = 0.0;
-      Cves = 3.0/2.0 * Ru/MolarMass[iSpecies];
+  /*--- Electronic energy ---*/
+  if (nElStates[iSpecies] != 0) {
+    num = 0.0; num2 = 0.0;
+    denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
+    num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exp(-CharElTemp[iSpecies][0]/val_T);
+    for (unsigned short iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
+      thoTve = CharElTemp[iSpecies][iEl]/val_T;
+      exptv = exp(-CharElTemp[iSpecies][iEl]/val_T);
+
+      num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exptv;
+      denom += ElDegeneracy[iSpecies][iEl] * exptv;
+      num2  += ElDegeneracy[iSpecies][iEl] * (thoTve*thoTve) * exptv;
+      num3  += ElDegeneracy[iSpecies][iEl] * thoTve/val_T * exptv;
     }
+    Cves = Ru/MolarMass[iSpecies] * (num2/denom - num*num3/(denom*denom));
+  } else {
+    Cves = 0.0;
+  }
 
-    /*--- Heavy particle specific heat ---*/
-    else {
+  return Cvvs + Cves;
+}
 
-      /*--- Vibrational energy ---*/
-      if (CharVibTemp[iSpecies] != 0.0) {
-        thoTve = CharVibTemp[iSpecies]/val_T;
-        exptv = exp(CharVibTemp[iSpecies]/val_T);
-        Cvvs  = Ru/MolarMass[iSpecies] * thoTve*thoTve * exptv / ((exptv-1.0)*(exptv-1.0));
-      } else {
-        Cvvs = 0.0;
-      }
+void CSU2TCLib::ComputeSpeciesCvVibEle(su2double val_T, su2double* val_cvves) const {
 
-      /*--- Electronic energy ---*/
-      if (nElStates[iSpecies] != 0) {
-        num = 0.0; num2 = 0.0;
-        denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-        num3  = ElDegeneracy[iSpecies][0] * (CharElTemp[iSpecies][0]/(val_T*val_T))*exp(-CharElTemp[iSpecies][0]/val_T);
-        for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-          thoTve = CharElTemp[iSpecies][iEl]/val_T;
-          exptv = exp(-CharElTemp[iSpecies][iEl]/val_T);
-
-          num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exptv;
-          denom += ElDegeneracy[iSpecies][iEl] * exptv;
-          num2  += ElDegeneracy[iSpecies][iEl] * (thoTve*thoTve) * exptv;
-          num3  += ElDegeneracy[iSpecies][iEl] * thoTve/val_T * exptv;
-        }
-        Cves = Ru/MolarMass[iSpecies] * (num2/denom - num*num3/(denom*denom));
-      } else {
-        Cves = 0.0;
+  /*--- Derivative of the tabulated energies (consistent with ComputeSpeciesEve) ---*/
+  if (Tables != nullptr) {
+    const su2double logT = log(val_T);
+    if (Tables->Eve[0].InRange(logT)) {
+      su2double dEdlogT;
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+        Tables->Eve[iSpecies].Evaluate(logT, dEdlogT);
+        val_cvves[iSpecies] = dEdlogT / val_T;
       }
+      return;
     }
-
-    Cvves[iSpecies] = Cvvs + Cves;
   }
 
-  return Cvves;
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    val_cvves[iSpecies] = SpeciesCvVibEle(iSpecies, val_T);
 
 }
 
-vector<su2double>& CSU2TCLib::ComputeMixtureEnergies(){
+void CSU2TCLib::ComputeMixtureEnergies(const su2double* val_rhos, su2double val_T, su2double val_Tve,
+                                       su2double* val_energies) const {
 
-  su2double Ev, Ee, Ef, num;
+  su2double Eve, Ef;
 
   su2double rhoEmix = 0.0;
   su2double rhoEve  = 0.0;
-  su2double denom   = 0.0;
+  su2double rho     = 0.0;
 
-  // Electrons
-  for (iSpecies = 0; iSpecies < nEl; iSpecies++) {
+  const su2double logTve = Tables != nullptr ? log(val_Tve) : 0.0;
+  const bool tabulated = Tables != nullptr && Tables->Eve[0].InRange(logTve);
 
-    // Species formation energy
-    Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies] * Ref_Temperature[iSpecies];
+  // Electrons
+  for (unsigned short iSpecies = 0; iSpecies < nEl; iSpecies++) {
 
     // Electron t-r mode contributes to mixture vib-el energy
-    rhoEve += rhos[iSpecies]*((3.0/2.0) * Ru/MolarMass[iSpecies] * (Tve - Ref_Temperature[iSpecies]));
+    rhoEve += val_rhos[iSpecies]*((3.0/2.0) * Ru/MolarMass[iSpecies] * (val_Tve - Ref_Temperature[iSpecies]));
+    rho    += val_rhos[iSpecies];
   }
 
-  for (iSpecies = nEl; iSpecies < nSpecies; iSpecies++){
+  for (unsigned short iSpecies = nEl; iSpecies < nSpecies; iSpecies++){
 
     // Species formation energy
     Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies]*Ref_Temperature[iSpecies];
 
-    // Species vibrational energy
-    if (CharVibTemp[iSpecies] != 0.0)
-      Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/Tve)-1.0);
-    else
-      Ev = 0.0;
-
-    // Species electronic energy
-    num = 0.0;
-    denom = ElDegeneracy(iSpecies,0) * exp(-CharElTemp(iSpecies,0)/Tve);
-    for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-      num   += ElDegeneracy(iSpecies,iEl) * CharElTemp(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
-      denom += ElDegeneracy(iSpecies,iEl) * exp(-CharElTemp(iSpecies,iEl)/Tve);
-    }
-    Ee = Ru/MolarMass[iSpecies] * (num/denom);
+    // Species vibrational-electronic energy
+    Eve = tabulated ? Tables->Eve[iSpecies](logTve) : SpeciesEve(iSpecies, val_Tve, false);
 
     // Mixture total energy
-    rhoEmix += rhos[iSpecies] * ((3.0/2.0+RotationModes[iSpecies]/2.0) * Ru/MolarMass[iSpecies] * (T-Ref_Temperature[iSpecies]) + Ev + Ee + Ef);
+    rhoEmix += val_rhos[iSpecies] * ((3.0/2.0+RotationModes[iSpecies]/2.0) * Ru/MolarMass[iSpecies] * (val_T-Ref_Temperature[iSpecies]) + Eve + Ef);
 
     // Mixture vibrational-electronic energy
-    rhoEve += rhos[iSpecies] * (Ev + Ee);
+    rhoEve += val_rhos[iSpecies] * Eve;
+    rho    += val_rhos[iSpecies];
 
   }
 
-  energies[0] = rhoEmix/Density;
-  energies[1] = rhoEve/Density;
-
-  return energies;
+  val_energies[0] = rhoEmix/rho;
+  val_energies[1] = rhoEve/rho;
 
 }
 
-vector<su2double>& CSU2TCLib::ComputeSpeciesEve(su2double val_T, bool vibe_only){
+su2double CSU2TCLib::SpeciesEve(unsigned short iSpecies, su2double val_T, bool vibe_only) const {
 
   su2double Ev, Eel, Ef, num, denom;
-  unsigned short iElectron = 0;
+  const unsigned short iElectron = 0;
 
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
+  /*--- Electron species energy ---*/
+  if ( ionization && (iSpecies == iElectron)) {
 
-    /*--- Electron species energy ---*/
-    if ( ionization && (iSpecies == iElectron)) {
+    if (vibe_only) return 0.0;
 
-      /*--- Calculate formation energy ---*/
-      Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies] * Ref_Temperature[iSpecies];
+    /*--- Calculate formation energy ---*/
+    Ef = Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies] * Ref_Temperature[iSpecies];
 
-      /*--- Electron t-r mode contributes to mixture vib-el energy ---*/
-      Eel = (3.0/2.0) * Ru/MolarMass[iSpecies] * (val_T - Ref_Temperature[iSpecies]) + Ef;
-      Ev  = 0.0;
-    }
-    /*--- Heavy particle energy ---*/
-    else {
-
-      /*--- Calculate vibrational energy (harmonic-oscillator model) ---*/
-      if (CharVibTemp[iSpecies] != 0.0)
-        Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/val_T)-1.0);
-      else
-        Ev = 0.0;
-
-      /*--- Calculate electronic energy ---*/
-      num = 0.0;
-      denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
-      for (iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
-        num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
-        denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
-      }
-      Eel = Ru/MolarMass[iSpecies] * (num/denom);
+    /*--- Electron t-r mode contributes to mixture vib-el energy ---*/
+    return (3.0/2.0) * Ru/MolarMass[iSpecies] * (val_T - Ref_Temperature[iSpecies]) + Ef;
+  }
+
+  /*--- Heavy particle energy ---*/
+
+  /*--- Calculate vibrational energy (harmonic-oscillator model) ---*/
+  if (CharVibTemp[iSpecies] != 0.0)
+    Ev = Ru/MolarMass[iSpecies] * CharVibTemp[iSpecies] / (exp(CharVibTemp[iSpecies]/val_T)-1.0);
+  else
+    Ev = 0.0;
+
+  if (vibe_only) return Ev;
+
+  /*--- Calculate electronic energy ---*/
+  num = 0.0;
+  denom = ElDegeneracy[iSpecies][0] * exp(-CharElTemp[iSpecies][0]/val_T);
+  for (unsigned short iEl = 1; iEl < nElStates[iSpecies]; iEl++) {
+    num   += ElDegeneracy[iSpecies][iEl] * CharElTemp[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+    denom += ElDegeneracy[iSpecies][iEl] * exp(-CharElTemp[iSpecies][iEl]/val_T);
+  }
+  Eel = Ru/MolarMass[iSpecies] * (num/denom);
+
+  return Ev + Eel;
+}
+
+void CSU2TCLib::ComputeSpeciesEve(su2double val_T, su2double* val_eves, bool vibe_only) const {
+
+  /*--- Tabulated vib.-el. energies (only the total is tabulated) ---*/
+  if (Tables != nullptr && !vibe_only) {
+    const su2double logT = log(val_T);
+    if (Tables->Eve[0].InRange(logT)) {
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+        val_eves[iSpecies] = Tables->Eve[iSpecies](logT);
+      return;
     }
-    if (vibe_only) {eves[iSpecies] = Ev;}
-    else {eves[iSpecies] = Ev + Eel;}
   }
 
-  return eves;
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    val_eves[iSpecies] = SpeciesEve(iSpecies, val_T, vibe_only);
 }
 
 vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2double *V, const su2double* eve,
@@ -1348,16 +1459,16 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies ++)
     ws[iSpecies] = 0.0;
 
-  /*--- Define artificial chemistry parameters ---*/
-  // Note: These parameters artificially increase the rate-controlling reaction
-  //       temperature.  This relaxes some of the stiffness in the chemistry
-  //       source term.
-  const su2double T_min   = 800.0;
-  const su2double epsilon = 80;
-
   /*--- Define preferential dissociation coefficient ---*/
   //alpha = 0.3; //TODO: make this a config option?
 
+  /*--- The tabulated rates are functions of the log of the rate-controlling temperatures. ---*/
+  su2double logT = 0.0, logTve = 0.0;
+  if (Tables != nullptr) {
+    logT = log(T);
+    logTve = log(Tve);
+  }
+
   /*--- Loop over all reactions ---*/
   for (iReaction = 0; iReaction < nReactions; iReaction++) {
 
@@ -1366,24 +1477,53 @@ vector<su2double>& CSU2TCLib::ComputeNetProductionRates(bool implicit, const su2
     bf = Tcf_b[iReaction];
     ab = Tcb_a[iReaction];
     bb = Tcb_b[iReaction];
-    Trxnf = pow(T, af)*pow(Tve, bf);
-    Trxnb = pow(T, ab)*pow(Tve, bb);
-
-    /*--- Calculate the modified temperature ---*/
-    Thf = 0.5 * (Trxnf+T_min + sqrt((Trxnf-T_min)*(Trxnf-T_min)+epsilon*epsilon));
-    Thb = 0.5 * (Trxnb+T_min + sqrt((Trxnb-T_min)*(Trxnb-T_min)+epsilon*epsilon));
 
     /*--- Get the Keq & Arrhenius coefficients ---*/
     ComputeKeqConstants(iReaction);
 
-    /*--- Calculate Keq ---*/
-    const su2double Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
-        + A[3]*(1E4/Thb) + A[4]*(1E4/Thb)*(1E4/Thb) );
+    const su2double logTrxnf = af*logT + bf*logTve;
+    const su2double logTrxnb = ab*logT + bb*logTve;
+    const auto* logRate = Tables != nullptr ? &Tables->LogRate[iReaction] : nullptr;
+
+    if (logRate != nullptr && logRate->InRange(logTrxnf) && logRate->InRange(logTrxnb)) {
+
+      /*--- Interpolate log(kf), and log(kb) = log(kf(Thb)) - log(Keq) with log(Keq) linear in A. ---*/
+      su2double dlogKeq = 0.0, dterm;
+      su2double logKeq = A[1];
+      for (const int iTerm : {0, 2, 3, 4}) {
+        logKeq += A[iTerm] * Tables->Keq[iTerm].Evaluate(logTrxnb, dterm);
+        dlogKeq += A[iTerm] * dterm;
+      }
+      kf = exp(logRate->Evaluate(logTrxnf, dlnkf));
+      kb = exp(logRate->Evaluate(logTrxnb, dlnkb) - logKeq);
+      dlnkb -= dlogKeq;
+
+    } else {
+
+      Trxnf = pow(T, af)*pow(Tve, bf);
+      Trxnb = pow(T, ab)*pow(Tve, bb);
+
+      /*--- Calculate the modified temperature ---*/
+      Thf = ModifiedTemperature(Trxnf, dThf);
+      Thb = ModifiedTemperature(Trxnb, dThb);
 
-    /*--- Calculate rate coefficients ---*/
-    kf  = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thf)) * exp(-ArrheniusTheta[iReaction]/Thf);
-    kfb = ArrheniusCoefficient[iReaction] * exp(ArrheniusEta[iReaction]*log(Thb)) * exp(-ArrheniusTheta[iReaction]/Thb);
-    kb  = kfb / Keq;
+      /*--- Calculate Keq ---*/
+      const su2double Keq = exp(  A[0]*(Thb/1E4) + A[1] + A[2]*log(1E4/Thb)
+          + A[3]*(1E4/Thb) + A[4]*(1E4/Thb)*(1E4/Thb) );
+
+      /*--- Calculate rate coefficients ---*/
+      const su2double eta = ArrheniusEta[iReaction], theta = ArrheniusTheta[iReaction];
+      kf  = ArrheniusCoefficient[iReaction] * exp(eta*log(Thf) - theta/Thf);
+      kfb = ArrheniusCoefficient[iReaction] * exp(eta*log(Thb) - theta/Thb);
+      kb  = kfb / Keq;
+
+      /*--- Derivatives w.r.t. the log of the rate-controlling temperatures (for the Jacobian) ---*/
+      if (implicit) {
+        const su2double dlogKeq = A[0]/1E4 - A[2]/Thb - A[3]*1E4/(Thb*Thb) - 2*A[4]*1E8/(Thb*Thb*Thb);
+        dlnkf = (eta/Thf + theta/(Thf*Thf)) * dThf * Trxnf;
+        dlnkb = (eta/Thb + theta/(Thb*Thb) - dlogKeq) * dThb * Trxnb;
+      }
+    }
 
     /*--- Determine production & destruction of each species ---*/
     fwdRxn = 1.0;
@@ -1435,9 +1575,6 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
   unsigned short nEve = nSpecies+nDim+1;
   unsigned short nVar = nSpecies+nDim+2;
 
-  su2double T_min   = 800.0;
-  su2double epsilon = 80;
-
   /*--- Initializing derivative variables ---*/
   dkf.resize(nVar,0.0);      dkb.resize(nVar,0.0);
   dRfok.resize(nVar,0.0);    dRbok.resize(nVar,0.0);
@@ -1452,30 +1589,14 @@ void CSU2TCLib::ChemistryJacobian(unsigned short iReaction, const su2double *V,
    alphak[iSpecies]=0; betak[iSpecies]=0;
   }
 
-  /*--- Extract additional Arrhenius information ---*/
-  su2double eta   = ArrheniusEta[iReaction];
-  su2double theta = ArrheniusTheta[iReaction];
-
-  /*--- Derivative of modified temperature wrt Trxnf ---*/
-  dThf = 0.5 * (1.0 + (Trxnf-T_min)/sqrt((Trxnf-T_min)*(Trxnf-T_min)
-                                                  + epsilon*epsilon));
-  dThb = 0.5 * (1.0 + (Trxnb-T_min)/sqrt((Trxnb-T_min)*(Trxnb-T_min)
-                                                  + epsilon*epsilon));
-
   /*--- Fwd rate coefficient derivatives ---*/
-  coeff = kf * (eta/Thf+theta/(Thf*Thf)) * dThf;
   for (iVar = 0; iVar < nVar; iVar++) {
-    dkf[iVar] = coeff * ( af*Trxnf/T*dTdU[iVar] +
-                          bf*Trxnf/Tve*dTvedU[iVar] );
+    dkf[iVar] = kf * dlnkf * ( af/T*dTdU[iVar] + bf/Tve*dTvedU[iVar] );
   }
 
   /*--- Bkwd rate coefficient derivatives ---*/
-  coeff = kb * (eta/Thb+theta/(Thb*Thb)) * dThb;
   for (iVar = 0; iVar < nVar; iVar++) {
-    dkb[iVar] = coeff*( ab*Trxnb/T*dTdU[iVar] + bb*Trxnb/Tve*dTvedU[iVar])
-                      - kb*((A[0]*Thb/1E4 - A[2] - A[3]*1E4/Thb
-                      - 2*A[4]*(1E4/Thb)*(1E4/Thb))/Thb) * dThb *
-                      ( ab*Trxnb/T*dTdU[iVar] + bb*Trxnb/Tve*dTvedU[iVar]);
+    dkb[iVar] = kb * dlnkb * ( ab/T*dTdU[iVar] + bb/Tve*dTvedU[iVar] );
   }
 
   /*--- Rxn rate derivatives ---*/
@@ -1559,8 +1680,8 @@ void CSU2TCLib::ComputeKeqConstants(unsigned short val_Reaction) {
 
   unsigned short ii;
 
-  /*--- Acquire database constants from CConfig ---*/
-  GetChemistryEquilConstants(val_Reaction);
+  /*--- Database constants of the reaction (see GetChemistryEquilConstants) ---*/
+  const auto& RxnConstantTable = RxnConstantTables[val_Reaction];
 
   /*--- Calculate mixture number density ---*/
   su2double N = 0.0;
@@ -1635,8 +1756,8 @@ su2double CSU2TCLib::ComputeEveSourceTerm(){
     MolarFrac[iSpecies] = (rhos[iSpecies] / MolarMass[iSpecies]) / conc;
 
   /*--- Compute Eve and Eve* ---*/
-  eve_eq = ComputeSpeciesEve(T, true);
-  eve    = ComputeSpeciesEve(Tve, true);
+  ComputeSpeciesEve(T, eve_eq.data(), true);
+  ComputeSpeciesEve(Tve, eve.data(), true);
 
   /*--- Loop over species to calculate source term --*/
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
@@ -1689,7 +1810,7 @@ void CSU2TCLib::GetEveSourceTermJacobian(const su2double *V, const su2double *ev
   unsigned short nVar = nSpecies+nDim+2;
 
   /*--- Compute Cvvs ---*/
-  const auto& cvve_eq = ComputeSpeciesCvVibEle(T);
+  ComputeSpeciesCvVibEle(T, cvve_eq.data());
 
   /*--- Loop through species ---*/
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
@@ -1703,22 +1824,16 @@ void CSU2TCLib::GetEveSourceTermJacobian(const su2double *V, const su2double *ev
       val_jacobian[nEv][iSpecies] += (eve_eq[iSpecies]-eve[iSpecies])/taus[iSpecies];//TODO *Volume;
 }
 
-vector<su2double>& CSU2TCLib::ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, su2double *val_eves){
+void CSU2TCLib::ComputeSpeciesEnthalpy(su2double val_T, su2double val_Tve, const su2double *val_eves,
+                                       su2double* val_hs) const {
 
-  vector<su2double> cvtrs;
   //TODO: ADD Electrons?
-  cvtrs = GetSpeciesCvTraRot();
-
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
-    eves[iSpecies] = val_eves[iSpecies];
-    hs[iSpecies] = Ru/MolarMass[iSpecies]*val_T + cvtrs[iSpecies]*val_T + Enthalpy_Formation[iSpecies] + eves[iSpecies];
-  }
-
-  return hs;
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    val_hs[iSpecies] = Ru/MolarMass[iSpecies]*val_T + Cvtrs[iSpecies]*val_T + Enthalpy_Formation[iSpecies] + val_eves[iSpecies];
 
 }
 
-vector<su2double>& CSU2TCLib::GetDiffusionCoeff(){
+void CSU2TCLib::GetDiffusionCoeff(su2double* val_Ds){
 
   if(Kind_TransCoeffModel == TRANSCOEFFMODEL::WILKE)
    DiffusionCoeffWBE();
@@ -1727,7 +1842,8 @@ vector<su2double>& CSU2TCLib::GetDiffusionCoeff(){
   if(Kind_TransCoeffModel == TRANSCOEFFMODEL::SUTHERLAND)
    DiffusionCoeffWBE();
 
-  return DiffusionCoeff;
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    val_Ds[iSpecies] = DiffusionCoeff[iSpecies];
 
 }
 
@@ -1744,7 +1860,7 @@ su2double CSU2TCLib::GetViscosity(){
 
 }
 
-vector<su2double>& CSU2TCLib::GetThermalConductivities(){
+void CSU2TCLib::GetThermalConductivities(su2double* val_conductivities){
 
   if(Kind_TransCoeffModel == TRANSCOEFFMODEL::WILKE)
     ThermalConductivitiesWBE();
@@ -1753,7 +1869,8 @@ vector<su2double>& CSU2TCLib::GetThermalConductivities(){
   if(Kind_TransCoeffModel == TRANSCOEFFMODEL::SUTHERLAND)
     ThermalConductivitiesSuth();
 
-  return ThermalConductivities;
+  val_conductivities[0] = ThermalConductivities[0];
+  val_conductivities[1] = ThermalConductivities[1];
 
 }
 
@@ -1862,7 +1979,7 @@ void CSU2TCLib::ThermalConductivitiesWBE(){
   ks.resize(nSpecies,0.0);
   kves.resize(nSpecies,0.0);
 
-  Cvves = ComputeSpeciesCvVibEle(Tve);
+  ComputeSpeciesCvVibEle(Tve, Cvves.data());
 
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
     ks[iSpecies] = mus[iSpecies]*(15.0/4.0 + RotationModes[iSpecies]/2.0)*Ru/MolarMass[iSpecies];
@@ -1911,10 +2028,11 @@ su2double CSU2TCLib::ComputeCollisionCrossSection(unsigned iSpecies, unsigned jS
     }
 
   } else {
-    if (d1) {
-      return 1E-20 * Omega11(iSpecies,jSpecies,3) * pow(T, Omega11(iSpecies,jSpecies,0)*log(T)*log(T) + Omega11(iSpecies,jSpecies,1)*log(T) + Omega11(iSpecies,jSpecies,2));
-    }       return 1E-20 * Omega22(iSpecies,jSpecies,3) * pow(T, Omega22(iSpecies,jSpecies,0)*log(T)*log(T) + Omega22(iSpecies,jSpecies,1)*log(T) + Omega22(iSpecies,jSpecies,2));
-   
+    /*--- pow(T, a*log(T)^2 + b*log(T) + c) as a single exponential ---*/
+    const auto& Omega = d1 ? Omega11 : Omega22;
+    const su2double logT = log(T);
+    return 1E-20 * Omega(iSpecies,jSpecies,3) * exp(((Omega(iSpecies,jSpecies,0)*logT + Omega(iSpecies,jSpecies,1))*logT +
+                                                     Omega(iSpecies,jSpecies,2))*logT);
   }
 }
 
@@ -2012,7 +2130,7 @@ void CSU2TCLib::ThermalConductivitiesGY(){
   const su2double kb   = BOLTZMANN_CONSTANT;
 
   /*--- Mixture vibrational-electronic specific heat ---*/
-  const auto Cvves = ComputeSpeciesCvVibEle(Tve);
+  ComputeSpeciesCvVibEle(Tve, Cvves.data());
   su2double rhoCvve = 0.0;
   for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
     rhoCvve += rhos[iSpecies]*Cvves[iSpecies];
@@ -2106,21 +2224,43 @@ void CSU2TCLib::ThermalConductivitiesSuth(){
   ThermalConductivities[1] = kve;
 }
 
-vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel, su2double Tve_old) {
+void CSU2TCLib::ComputeMixtureEveCvve(const su2double* val_rhos, su2double val_Tve, su2double& rhoEve,
+                                      su2double& rhoCvve) const {
+  rhoEve = rhoCvve = 0.0;
+
+  if (Tables != nullptr) {
+    const su2double logT = log(val_Tve);
+    if (Tables->Eve[0].InRange(logT)) {
+      su2double dEdlogT;
+      for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+        rhoEve  += val_rhos[iSpecies] * Tables->Eve[iSpecies].Evaluate(logT, dEdlogT);
+        rhoCvve += val_rhos[iSpecies] * dEdlogT / val_Tve;
+      }
+      return;
+    }
+  }
+
+  for (unsigned short iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
+    rhoEve  += val_rhos[iSpecies] * SpeciesEve(iSpecies, val_Tve, false);
+    rhoCvve += val_rhos[iSpecies] * SpeciesCvVibEle(iSpecies, val_Tve);
+  }
+}
+
+void CSU2TCLib::ComputeTemperatures(const su2double* val_rhos, su2double rhoE, su2double rhoEve, su2double rhoEvel,
+                                    su2double Tve_old, su2double* val_temperatures) const {
 
-  rhos = val_rhos;
 
   /*----------Translational temperature----------*/
   su2double rhoE_f   = 0.0;
   su2double rhoE_ref = 0.0;
   su2double rhoCvtr  = 0.0;
-  for (iSpecies = nEl; iSpecies < nSpecies; iSpecies++) {
-    rhoCvtr  += rhos[iSpecies] * Cvtrs[iSpecies];
-    rhoE_ref += rhos[iSpecies] * Cvtrs[iSpecies] * Ref_Temperature[iSpecies];
-    rhoE_f   += rhos[iSpecies] * (Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies]*Ref_Temperature[iSpecies]);
+  for (unsigned short iSpecies = nEl; iSpecies < nSpecies; iSpecies++) {
+    rhoCvtr  += val_rhos[iSpecies] * Cvtrs[iSpecies];
+    rhoE_ref += val_rhos[iSpecies] * Cvtrs[iSpecies] * Ref_Temperature[iSpecies];
+    rhoE_f   += val_rhos[iSpecies] * (Enthalpy_Formation[iSpecies] - Ru/MolarMass[iSpecies]*Ref_Temperature[iSpecies]);
   }
 
-  T = (rhoE - rhoEve - rhoE_f + rhoE_ref - rhoEvel) / rhoCvtr;
+  su2double T = (rhoE - rhoEve - rhoE_f + rhoE_ref - rhoEvel) / rhoCvtr;
 
   /*--- Set temperature clipping values ---*/
   const su2double Tmin   = 50.0; const su2double Tmax   = 8E4;
@@ -2141,7 +2281,7 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
 
   /*--- Execute a Newton-Raphson root-finding method for Tve ---*/
   //Initialize solution
-  Tve = Tve_old;
+  su2double Tve = Tve_old;
 
   bool Bconvg = false;
   bool NRconvg = false;
@@ -2149,14 +2289,7 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
 
   /*--- Newton-Raphson Method --*/
   for (unsigned short iIter = 0; iIter < maxNIter; iIter++) {
-    rhoEve_t = rhoCvve = 0.0;
-    const auto& val_eves  = ComputeSpeciesEve(Tve);
-    const auto& val_cvves = ComputeSpeciesCvVibEle(Tve);
-
-    for (iSpecies = 0; iSpecies < nSpecies; iSpecies++){
-      rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
-      rhoCvve += rhos[iSpecies] * val_cvves[iSpecies];
-    }
+    ComputeMixtureEveCvve(val_rhos, Tve, rhoEve_t, rhoCvve);
 
     /*--- Find the roots ---*/
     su2double f  = rhoEve - rhoEve_t;
@@ -2178,9 +2311,7 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
   if (!NRconvg) {
     for (unsigned short iIter = 0; iIter < maxBIter; iIter++) {
       Tve      = (Tve_o+Tve2)/2.0;
-      const auto& val_eves = ComputeSpeciesEve(Tve);
-      rhoEve_t = 0.0;
-      for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) rhoEve_t += rhos[iSpecies] * val_eves[iSpecies];
+      ComputeMixtureEveCvve(val_rhos, Tve, rhoEve_t, rhoCvve);
       if (fabs(rhoEve_t - rhoEve) < Btol) {
         Bconvg = true;
         break;
@@ -2195,10 +2326,8 @@ vector<su2double>& CSU2TCLib::ComputeTemperatures(vector<su2double>& val_rhos, s
     Tve = T;
   }
 
-  temperatures[0] = T;
-  temperatures[1] = Tve;
-
-  return temperatures;
+  val_temperatures[0] = T;
+  val_temperatures[1] = Tve;
 }
 
 void CSU2TCLib::GetChemistryEquilConstants(unsigned short iReaction){
@@ -79,87 +79,156 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
 
     if(!CInterpolator::CheckInterfaceBoundary(markDonor, markTarget)) continue;
 
-    /*--- Count donor vertices on this rank. ---*/
-
-    int nLocalVertexDonor = 0;
-    if (markDonor >= 0) {
-      for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
-        /*--- Only domain points are donors. ---*/
-        nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+    /*--- Point to point transfer, each rank receives only the donors of its target vertices. ---*/
+
+    const bool sparse = (iMarkerInt < interpolator.transferPattern.size()) &&
+                        interpolator.transferPattern[iMarkerInt].valid;
+
+    vector<unsigned long> donorIdx;
+    su2activematrix donorVar;
+
+    if (sparse) {
+      const auto& pattern = interpolator.transferPattern[iMarkerInt];
+
+      if (SendBuffer.size() < interpolator.transferPattern.size()) {
+        SendBuffer.resize(interpolator.transferPattern.size());
+        RecvBuffer.resize(interpolator.transferPattern.size());
       }
-    }
+      auto& sendVar = SendBuffer[iMarkerInt];
+      auto& recvVar = RecvBuffer[iMarkerInt];
+      if (sendVar.rows() != pattern.sendVertex.size()) sendVar.resize(pattern.sendVertex.size(), nVar);
+      if (recvVar.rows() != pattern.recvStart.back()) recvVar.resize(pattern.recvStart.back(), nVar);
 
-    /*--- Gather donor counts and compute total sizes, and displacements (cumulative
-     * sums) to perform an Allgatherv of donor indices and variables. ---*/
+      if (markDonor >= 0) {
 
-    vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
-    SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
+        /*--- Apply contact resistance if specified. ---*/
 
-    for (int i = 0; i < size; ++i) {
-      nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
-      if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
-      displVar[i] = displIdx[i] * nVar;
+        SetContactResistance(donor_config->GetContactResistance(iMarkerInt));
+
+        for (auto iSend = 0ul; iSend < pattern.sendVertex.size(); iSend++) {
+          const auto iVertex = pattern.sendVertex[iSend];
+          const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+
+          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+          for (auto iVar = 0u; iVar < nVar; iVar++) sendVar(iSend, iVar) = Donor_Variable[iVar];
+        }
+      }
+
+      /*--- The data of this rank is copied, the rest is exchanged with the neighbors of the interface. ---*/
+
+      for (auto iSend = 0ul; iSend < pattern.sendRank.size(); ++iSend) {
+        if (pattern.sendRank[iSend] != rank) continue;
+        const auto iRecv = find(pattern.recvRank.begin(), pattern.recvRank.end(), rank) - pattern.recvRank.begin();
+        for (auto i = pattern.sendStart[iSend]; i < pattern.sendStart[iSend+1]; ++i)
+          for (auto iVar = 0u; iVar < nVar; iVar++)
+            recvVar(pattern.recvStart[iRecv] + i - pattern.sendStart[iSend], iVar) = sendVar(i, iVar);
+      }
+#ifdef HAVE_MPI
+      vector<SU2_MPI::Request> requests;
+      requests.reserve(pattern.sendRank.size() + pattern.recvRank.size());
+
+      for (auto iRecv = 0ul; iRecv < pattern.recvRank.size(); ++iRecv) {
+        if (pattern.recvRank[iRecv] == rank) continue;
+        const auto count = (pattern.recvStart[iRecv+1] - pattern.recvStart[iRecv]) * nVar;
+        requests.emplace_back();
+        SU2_MPI::Irecv(recvVar[pattern.recvStart[iRecv]], count, MPI_DOUBLE, pattern.recvRank[iRecv], 0,
+                       SU2_MPI::GetComm(), &requests.back());
+      }
+      for (auto iSend = 0ul; iSend < pattern.sendRank.size(); ++iSend) {
+        if (pattern.sendRank[iSend] == rank) continue;
+        const auto count = (pattern.sendStart[iSend+1] - pattern.sendStart[iSend]) * nVar;
+        requests.emplace_back();
+        SU2_MPI::Isend(sendVar[pattern.sendStart[iSend]], count, MPI_DOUBLE, pattern.sendRank[iSend], 0,
+                       SU2_MPI::GetComm(), &requests.back());
+      }
+      SU2_MPI::Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+#endif
     }
+    else {
+      /*--- Count donor vertices on this rank. ---*/
+
+      int nLocalVertexDonor = 0;
+      if (markDonor >= 0) {
+        for (auto iVertex = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+          auto Point_Donor = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+          /*--- Only domain points are donors. ---*/
+          nLocalVertexDonor += donor_geometry->nodes->GetDomain(Point_Donor);
+        }
+      }
 
-    /*--- Fill send buffers. ---*/
+      /*--- Gather donor counts and compute total sizes, and displacements (cumulative
+       * sums) to perform an Allgatherv of donor indices and variables. ---*/
 
-    vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
-    su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
+      vector<int> nAllVertexDonor(size), nAllVarCounts(size), displIdx(size,0), displVar(size);
+      SU2_MPI::Allgather(&nLocalVertexDonor, 1, MPI_INT, nAllVertexDonor.data(), 1, MPI_INT, SU2_MPI::GetComm());
 
-    if (markDonor >= 0) {
+      for (int i = 0; i < size; ++i) {
+        nAllVarCounts[i] = nAllVertexDonor[i] * nVar;
+        if(i) displIdx[i] = displIdx[i-1] + nAllVertexDonor[i-1];
+        displVar[i] = displIdx[i] * nVar;
+      }
 
-      /*--- Apply contact resistance if specified. ---*/
-      
-      SetContactResistance(donor_config->GetContactResistance(iMarkerInt));
+      /*--- Fill send buffers. ---*/
 
-      for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
-        const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+      vector<unsigned long> sendDonorIdx(nLocalVertexDonor);
+      su2activematrix sendDonorVar(nLocalVertexDonor, nVar);
 
-        /*--- If this processor owns the node. ---*/
-        if (donor_geometry->nodes->GetDomain(iPoint)) {
+      if (markDonor >= 0) {
 
-          GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
-          for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
+        /*--- Apply contact resistance if specified. ---*/
+
+        SetContactResistance(donor_config->GetContactResistance(iMarkerInt));
+
+        for (auto iVertex = 0ul, iSend = 0ul; iVertex < donor_geometry->GetnVertex(markDonor); iVertex++) {
+          const auto iPoint = donor_geometry->vertex[markDonor][iVertex]->GetNode();
+
+          /*--- If this processor owns the node. ---*/
+          if (donor_geometry->nodes->GetDomain(iPoint)) {
+
+            GetDonor_Variable(donor_solution, donor_geometry, donor_config, markDonor, iVertex, iPoint);
+            for (auto iVar = 0u; iVar < nVar; iVar++) sendDonorVar(iSend, iVar) = Donor_Variable[iVar];
 
-          sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
-          ++iSend;
+            sendDonorIdx[iSend] = donor_geometry->nodes->GetGlobalIndex(iPoint);
+            ++iSend;
+          }
         }
       }
-    }
 
-    /*--- Gather data. ---*/
+      /*--- Gather data. ---*/
 
-    const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
+      const auto nGlobalVertexDonor = displIdx.back() + nAllVertexDonor.back();
 
-    vector<unsigned long> donorIdx(nGlobalVertexDonor);
-    su2activematrix donorVar(nGlobalVertexDonor, nVar);
+      donorIdx.resize(nGlobalVertexDonor);
+      donorVar.resize(nGlobalVertexDonor, nVar);
 
-    SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
-                        nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
+      SU2_MPI::Allgatherv(sendDonorIdx.data(), sendDonorIdx.size(), MPI_UNSIGNED_LONG, donorIdx.data(),
+                          nAllVertexDonor.data(), displIdx.data(), MPI_UNSIGNED_LONG, SU2_MPI::GetComm());
 
-    SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
-                        nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
+      SU2_MPI::Allgatherv(sendDonorVar.data(), sendDonorVar.size(), MPI_DOUBLE, donorVar.data(),
+                          nAllVarCounts.data(), displVar.data(), MPI_DOUBLE, SU2_MPI::GetComm());
 
-    /*--- This rank does not need to do more work. ---*/
-    if (markTarget < 0) continue;
+      if (markTarget < 0) continue;
 
-    /*--- Sort the donor information by index to then use binary searches. ---*/
+      /*--- Sort the donor information by index to then use binary searches. ---*/
 
-    vector<size_t> order(donorIdx.size());
-    iota(order.begin(), order.end(), 0ul);
-    sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
+      vector<size_t> order(donorIdx.size());
+      iota(order.begin(), order.end(), 0ul);
+      sort(order.begin(), order.end(), [&donorIdx](size_t i, size_t j) {return donorIdx[i] < donorIdx[j];} );
 
-    /*--- inplace permutation. ---*/
-    for (size_t i = 0; i < order.size(); ++i) {
-      auto j = order[i];
-      while (j < i) j = order[j];
-      if (i == j) continue;
-      swap(donorIdx[i], donorIdx[j]);
-      for (auto iVar = 0u; iVar < nVar; ++iVar)
-        swap(donorVar(i,iVar), donorVar(j,iVar));
+      /*--- inplace permutation. ---*/
+      for (size_t i = 0; i < order.size(); ++i) {
+        auto j = order[i];
+        while (j < i) j = order[j];
+        if (i == j) continue;
+        swap(donorIdx[i], donorIdx[j]);
+        for (auto iVar = 0u; iVar < nVar; ++iVar)
+          swap(donorVar(i,iVar), donorVar(j,iVar));
+      }
     }
 
+    /*--- This rank does not need to do more work. ---*/
+    if (markTarget < 0) continue;
+
     /*--- Loop over target vertices. ---*/
 
     for (auto iVertex = 0ul; iVertex < target_geometry->GetnVertex(markTarget); iVertex++) {
@@ -180,13 +249,19 @@ void CInterface::BroadcastData(const CInterpolator& interpolator,
         const auto donorGlobalIndex = targetVertex.globalPoint[iDonorPoint];
         const auto donorCoeff = targetVertex.coefficient[iDonorPoint];
 
-        /*--- Find the index of the global donor point in the donor data. ---*/
+        /*--- Find the donor data, its position is known for the point to point transfer. ---*/
 
-        const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
-        assert(idx < static_cast<long>(donorIdx.size()));
+        const su2double* donorData = nullptr;
+        if (sparse) {
+          donorData = RecvBuffer[iMarkerInt][interpolator.transferPattern[iMarkerInt].donorIndex[iVertex][iDonorPoint]];
+        } else {
+          const auto idx = lower_bound(donorIdx.begin(), donorIdx.end(), donorGlobalIndex) - donorIdx.begin();
+          assert(idx < static_cast<long>(donorIdx.size()));
+          donorData = donorVar[idx];
+        }
 
         /*--- Recover the Target_Variable from the buffer of variables. ---*/
-        RecoverTarget_Variable(donorVar[idx], donorCoeff);
+        RecoverTarget_Variable(donorData, donorCoeff);
 
         /*--- If the value is not directly aggregated in the previous function. ---*/
         if (!valAggregated)
@@ -59,6 +59,9 @@ CNEMONumerics::CNEMONumerics(unsigned short val_nDim, unsigned short val_nVar,
     if (ionization) { nHeavy = nSpecies-1; nEl = 1; }
     else            { nHeavy = nSpecies;   nEl = 0; }
 
+    eve_aux.resize(nSpecies, 0.0);
+    hs_aux.resize(nSpecies, 0.0);
+
     /*--- Instatiate the correct fluid model ---*/
     switch (config->GetKind_FluidModel()) {
       case MUTATIONPP:
@@ -250,7 +253,8 @@ void CNEMONumerics::GetViscousProjFlux(const su2double *val_primvar,
   const su2double Tve = val_primvar[TVE_INDEX];
   const auto& V   = val_primvar;
   const auto& GV  = val_gradprimvar;
-  const auto& hs = fluidmodel->ComputeSpeciesEnthalpy(T, Tve, val_eve);
+  fluidmodel->ComputeSpeciesEnthalpy(T, Tve, val_eve, hs_aux.data());
+  const auto& hs = hs_aux;
 
   /*--- Pre-compute mixture quantities ---*/  //TODO
   su2double Vector[MAXNDIM] = {0.0};
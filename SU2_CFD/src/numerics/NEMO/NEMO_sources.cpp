@@ -69,8 +69,6 @@ CSource_NEMO::~CSource_NEMO() {
 CNumerics::ResidualType<> CSource_NEMO::ComputeChemistry(const CConfig *config) {
 
   /*--- Nonequilibrium chemistry ---*/
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
 
   /*--- Initialize residual and Jacobian arrays ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++)
@@ -84,11 +82,9 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeChemistry(const CConfig *config)
   /*--- Rename for convenience ---*/
   su2double T = V_i[T_INDEX];
   su2double Tve = V_i[TVE_INDEX];
-  for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
-    rhos[iSpecies]=V_i[RHOS_INDEX+iSpecies];
 
   /*--- Set mixture state ---*/
-  fluidmodel->SetTDStateRhosTTv(rhos, T, Tve);
+  fluidmodel->SetTDStateRhosTTv(&V_i[RHOS_INDEX], T, Tve);
 
   /*---Compute Prodcution/destruction terms ---*/
   const auto& ws = fluidmodel->ComputeNetProductionRates(implicit, V_i, eve_i, Cvve_i,
@@ -119,9 +115,6 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeVibRelaxation(const CConfig *conf
   const su2double res_min = -1E6;
   const su2double res_max = 1E6;
 
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Initialize residual and Jacobian arrays ---*/
   for (auto iVar = 0ul; iVar < nVar; iVar++) {
     residual[iVar] = 0.0;
@@ -135,11 +128,9 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeVibRelaxation(const CConfig *conf
   /*--- Rename for convenience ---*/
   const su2double T = V_i[T_INDEX];
   const su2double Tve = V_i[TVE_INDEX];
-  for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
-    rhos[iSpecies]=V_i[RHOS_INDEX+iSpecies];
 
   /*--- Set fluid state ---*/
-  fluidmodel->SetTDStateRhosTTv(rhos, T, Tve);
+  fluidmodel->SetTDStateRhosTTv(&V_i[RHOS_INDEX], T, Tve);
 
   /*--- Compute residual and jacobians ---*/
   const su2double VTterm = fluidmodel -> ComputeEveSourceTerm();
@@ -182,7 +173,8 @@ CNumerics::ResidualType<> CSource_NEMO::ComputeAxisymmetric(const CConfig *confi
   const su2double H = V_i[H_INDEX];
   const su2double rhoEve = U_i[nVar-1];
   const auto& Ms = fluidmodel->GetSpeciesMolarMass();
-  const auto& hs = fluidmodel->ComputeSpeciesEnthalpy(V_i[T_INDEX], V_i[TVE_INDEX], eve_i );
+  fluidmodel->ComputeSpeciesEnthalpy(V_i[T_INDEX], V_i[TVE_INDEX], eve_i, hs_aux.data());
+  const auto& hs = hs_aux;
 
   const bool viscous = config->GetViscous();
   const bool rans = (config->GetKind_Turb_Model() != TURB_MODEL::NONE);
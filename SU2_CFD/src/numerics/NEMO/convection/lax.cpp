@@ -93,8 +93,8 @@ CNumerics::ResidualType<> CCentLax_NEMO::ComputeResidual(const CConfig *config)
     MeanV[iVar] = 0.5*(V_i[iVar]+V_j[iVar]);
 
   /*--- Compute NonEq specific variables ---*/
-  const auto& mean_eves = fluidmodel->ComputeSpeciesEve(MeanV[TVE_INDEX]);
-  fluidmodel->ComputedPdU(MeanV, mean_eves, MeandPdU);
+  fluidmodel->ComputeSpeciesEve(MeanV[TVE_INDEX], eve_aux.data());
+  fluidmodel->ComputedPdU(MeanV, eve_aux.data(), MeandPdU);
 
   /*--- Get projected flux tensor ---*/
   GetInviscidProjFlux(MeanU, MeanV, Normal, ProjFlux);
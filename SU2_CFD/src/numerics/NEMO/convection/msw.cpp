@@ -165,11 +165,11 @@ CNumerics::ResidualType<> CUpwMSW_NEMO::ComputeResidual(const CConfig *config) {
   const su2double ProjVelst_i = onemw*ProjVelocity_i + w*ProjVelocity_j;
   const su2double ProjVelst_j = onemw*ProjVelocity_j + w*ProjVelocity_i;
 
-  const auto& eves_st_i = fluidmodel->ComputeSpeciesEve(Vst_i[TVE_INDEX]);
-  const auto& eves_st_j = fluidmodel->ComputeSpeciesEve(Vst_j[TVE_INDEX]);
+  fluidmodel->ComputeSpeciesEve(Vst_i[TVE_INDEX], eve_aux.data());
+  fluidmodel->ComputedPdU(Vst_i, eve_aux.data(), dPdUst_i);
 
-  fluidmodel->ComputedPdU(Vst_i, eves_st_i, dPdUst_i);
-  fluidmodel->ComputedPdU(Vst_j, eves_st_j, dPdUst_j);
+  fluidmodel->ComputeSpeciesEve(Vst_j[TVE_INDEX], eve_aux.data());
+  fluidmodel->ComputedPdU(Vst_j, eve_aux.data(), dPdUst_j);
 
   /*--- Flow eigenvalues at i (Lambda+) ---*/
   for (auto iVar = 0; iVar < nSpecies+nDim-1; iVar++)
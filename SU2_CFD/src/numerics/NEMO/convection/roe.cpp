@@ -107,10 +107,10 @@ CNumerics::ResidualType<> CUpwRoe_NEMO::ComputeResidual(const CConfig *config) {
   for (auto iVar = 0ul; iVar < nPrimVar; iVar++)
     RoeV[iVar] = (R*V_j[iVar] + V_i[iVar])/(R+1);
 
-  const auto& roe_eves = fluidmodel->ComputeSpeciesEve(RoeV[TVE_INDEX]);
+  fluidmodel->ComputeSpeciesEve(RoeV[TVE_INDEX], eve_aux.data());
 
   /*--- Calculate derivatives of pressure ---*/
-  fluidmodel->ComputedPdU(RoeV, roe_eves, RoedPdU);
+  fluidmodel->ComputedPdU(RoeV, eve_aux.data(), RoedPdU);
 
   /*--- Calculate dual grid tangent vectors for P & invP ---*/
   su2double l[MAXNDIM], m[MAXNDIM];
@@ -202,6 +202,18 @@ void CFEALinearElasticity::Compute_Tangent_Matrix(CElement *element, const CConf
 }
 
 
+void CFEALinearElasticity::GetElementParameters(const CElement *element, const CConfig *config, su2double& lambda,
+                                                su2double& mu, su2double& thermal, su2double& tempRef) {
+
+  SetElement_Properties(element, config);
+
+  /*--- The plane stress constitutive matrix has the plane strain form with a modified Lambda. ---*/
+  lambda = (nDim == 2 && plane_stress) ? E*Nu/(1-Nu*Nu) : Lambda;
+  mu = Mu;
+  thermal = ThermalStressTerm;
+  tempRef = ReferenceTemperature;
+}
+
 void CFEALinearElasticity::Compute_Constitutive_Matrix(CElement *element_container, const CConfig *config) {
 
   /*--- Compute the D Matrix (for plane stress and 2-D)---*/
@@ -34,6 +34,17 @@ CFEM_NeoHookean_Comp::CFEM_NeoHookean_Comp(unsigned short val_nDim,
                                            CFEANonlinearElasticity(val_nDim, val_nVar, config) {
 }
 
+void CFEM_NeoHookean_Comp::GetElementParameters(const CElement *element, const CConfig *config, su2double& lambda,
+                                                su2double& mu, su2double& thermal, su2double& tempRef) {
+
+  SetElement_Properties(element, config);
+
+  lambda = Lambda;
+  mu = Mu;
+  thermal = ThermalStressTerm;
+  tempRef = ReferenceTemperature;
+}
+
 void CFEM_NeoHookean_Comp::Compute_Plane_Stress_Term(CElement *element, const CConfig *config) {
 
   su2double j_red = 1.0;
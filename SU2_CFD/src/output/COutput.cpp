@@ -191,6 +191,8 @@ void COutput::SetHistoryOutput(CGeometry *geometry,
                                   unsigned long TimeIter,
                                   unsigned long OuterIter,
                                   unsigned long InnerIter) {
+  SU2_ZONE_SCOPED_N("Output_History");
+
   curTimeIter = TimeIter;
   curAbsTimeIter = max(TimeIter, config->GetStartWindowIteration()) - config->GetStartWindowIteration();
   curOuterIter = OuterIter;
@@ -806,6 +808,7 @@ bool COutput::GetCauchyCorrectedTimeConvergence(const CConfig *config){
 
 bool COutput::SetResultFiles(CGeometry *geometry, CConfig *config, CSolver** solver_container,
                               unsigned long iter, bool force_writing) {
+  SU2_ZONE_SCOPED_N("Output_ResultFiles");
 
   bool isFileWrite = false, dataIsLoaded = false;
   const auto nVolumeFiles = config->GetnVolumeOutputFiles();
@@ -1756,12 +1756,14 @@ void CEulerSolver::SetTime_Step(CGeometry *geometry, CSolver **solver_container,
 
 void CEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                      CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  SU2_ZONE_SCOPED_N("Centered_Residual");
 
   EdgeFluxResidual(geometry, solver_container, config);
 }
 
 void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container,
                                    CNumerics **numerics_container, CConfig *config, unsigned short iMesh) {
+  SU2_ZONE_SCOPED_N("Upwind_Residual");
 
   const bool ideal_gas = (config->GetKind_FluidModel() == STANDARD_AIR) ||
                          (config->GetKind_FluidModel() == IDEAL_GAS);
@@ -1817,6 +1819,13 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     auto iPoint = geometry->edges->GetNode(iEdge,0);
     auto jPoint = geometry->edges->GetNode(iEdge,1);
 
+    /*--- Multirate time stepping, the edge is skipped between the updates of its finer point. ---*/
+    const su2double timeWeight = EdgeTimeWeight(iPoint, jPoint);
+    if (timeWeight == 0.0) {
+      if (ReducerStrategy) EdgeFluxes.SetBlock_Zero(iEdge);
+      continue;
+    }
+
     numerics->SetNormal(geometry->edges->GetNormal(iEdge));
 
     auto Coord_i = geometry->nodes->GetCoord(iPoint);
@@ -1956,13 +1965,13 @@ void CEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_contain
     /*--- Update residual value ---*/
 
     if (ReducerStrategy) {
-      EdgeFluxes.SetBlock(iEdge, residual);
+      EdgeFluxes.SetBlock(iEdge, residual, timeWeight);
       if (implicit)
         Jacobian.SetBlocks(iEdge, residual.jacobian_i, residual.jacobian_j);
     }
     else {
-      LinSysRes.AddBlock(iPoint, residual);
-      LinSysRes.SubtractBlock(jPoint, residual);
+      LinSysRes.AddBlock(iPoint, residual, timeWeight);
+      LinSysRes.AddBlock(jPoint, residual, -timeWeight);
 
       /*--- Set implicit computation ---*/
       if (implicit)
@@ -2053,6 +2062,9 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
   /*--- Pick one numerics object per thread. ---*/
   CNumerics* numerics = numerics_container[SOURCE_FIRST_TERM + omp_get_thread_num()*MAX_TERMS];
 
+  /*--- With multirate time stepping the sources are only evaluated in the time iteration that updates each
+   *    point, with a weight for the whole time step (see PointTimeWeight). ---*/
+
   if (body_force) {
 
     /*--- Loop over all points ---*/
@@ -2060,6 +2072,9 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+      const su2double timeWeight = PointTimeWeight(iPoint);
+      if (timeWeight == 0.0) continue;
+
       /*--- Load the conservative variables ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint),
                                 nodes->GetSolution(iPoint));
@@ -2071,7 +2086,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       auto residual = numerics->ComputeResidual(config);
 
       /*--- Add the source residual to the total ---*/
-      LinSysRes.AddBlock(iPoint, residual);
+      LinSysRes.AddBlock(iPoint, residual, timeWeight);
 
     }
     END_SU2_OMP_FOR
@@ -2090,6 +2105,9 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+      const su2double timeWeight = PointTimeWeight(iPoint);
+      if (timeWeight == 0.0) continue;
+
       /*--- Load the conservative variables ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint),
                                 nodes->GetSolution(iPoint));
@@ -2101,7 +2119,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       auto residual = numerics->ComputeResidual(config);
 
       /*--- Add the source residual to the total ---*/
-      LinSysRes.AddBlock(iPoint, residual);
+      LinSysRes.AddBlock(iPoint, residual, timeWeight);
 
       /*--- Add the implicit Jacobian contribution ---*/
       if (implicit) Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
@@ -2123,6 +2141,9 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+      const su2double timeWeight = PointTimeWeight(iPoint);
+      if (timeWeight == 0.0) continue;
+
       /*--- Set solution  ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint), nodes->GetSolution(iPoint));
 
@@ -2157,7 +2178,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       auto residual = numerics->ComputeResidual(config);
 
       /*--- Add Residual ---*/
-      LinSysRes.AddBlock(iPoint, residual);
+      LinSysRes.AddBlock(iPoint, residual, timeWeight);
 
       /*--- Implicit part ---*/
       if (implicit)
@@ -2176,6 +2197,9 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+      const su2double timeWeight = PointTimeWeight(iPoint);
+      if (timeWeight == 0.0) continue;
+
       /*--- Set solution  ---*/
       numerics->SetConservative(nodes->GetSolution(iPoint), nodes->GetSolution(iPoint));
 
@@ -2186,7 +2210,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       auto residual = numerics->ComputeResidual(config);
 
       /*--- Add Residual ---*/
-      LinSysRes.AddBlock(iPoint, residual);
+      LinSysRes.AddBlock(iPoint, residual, timeWeight);
 
     }
     END_SU2_OMP_FOR
@@ -2199,12 +2223,15 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
     SU2_OMP_FOR_STAT(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+      const su2double timeWeight = PointTimeWeight(iPoint);
+      if (timeWeight == 0.0) continue;
+
       /*--- Get control volume ---*/
       su2double Volume = geometry->nodes->GetVolume(iPoint);
 
       /*--- Get stored time spectral source term and add to residual ---*/
       for (auto iVar = 0ul; iVar < nVar; iVar++) {
-        LinSysRes(iPoint,iVar) += Volume * nodes->GetHarmonicBalance_Source(iPoint,iVar);
+        LinSysRes(iPoint,iVar) += timeWeight * Volume * nodes->GetHarmonicBalance_Source(iPoint,iVar);
       }
     }
     END_SU2_OMP_FOR
@@ -2231,6 +2258,10 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
     SU2_OMP_FOR_DYN(omp_chunk_size)
     for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+
+      const su2double timeWeight = PointTimeWeight(iPoint);
+      if (timeWeight == 0.0) continue;
+
       second_numerics->SetPrimitive(nodes->GetPrimitive(iPoint), nullptr);
       second_numerics->SetVorticity(nodes->GetVorticity(iPoint), nullptr);
       second_numerics->SetAuxVarGrad(nodes->GetAuxVarGradient(iPoint), nullptr);
@@ -2238,7 +2269,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       second_numerics->SetVolume(geometry->nodes->GetVolume(iPoint));
       auto residual = second_numerics->ComputeResidual(config);
 
-      LinSysRes.AddBlock(iPoint, residual);
+      LinSysRes.AddBlock(iPoint, residual, timeWeight);
 
       if (implicit) Jacobian.AddBlock2Diag(iPoint, residual.jacobian_i);
     }
@@ -2259,6 +2290,9 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
       SU2_OMP_FOR_DYN(omp_chunk_size)
       for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
 
+        const su2double timeWeight = PointTimeWeight(iPoint);
+        if (timeWeight == 0.0) continue;
+
         /*--- Get control volume size. ---*/
         su2double Volume = geometry->nodes->GetVolume(iPoint);
 
@@ -2271,7 +2305,7 @@ void CEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_contain
 
         /*--- Compute the residual for this control volume and subtract. ---*/
         for (auto iVar = 0ul; iVar < nVar; iVar++) {
-          LinSysRes(iPoint,iVar) -= sourceMan[iVar]*Volume;
+          LinSysRes(iPoint,iVar) -= sourceMan[iVar]*Volume*timeWeight;
         }
       }
       END_SU2_OMP_FOR
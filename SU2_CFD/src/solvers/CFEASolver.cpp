@@ -27,14 +27,47 @@
 
 #include "../../include/solvers/CFEASolver.hpp"
 #include "../../include/variables/CFEABoundVariable.hpp"
-#include "../../include/numerics/elasticity/CFEAElasticity.hpp"
+#include "../../include/numerics/elasticity/CFEALinearElasticity.hpp"
+#include "../../include/numerics/elasticity/nonlinear_models.hpp"
 #include "../../../Common/include/toolboxes/printing_toolbox.hpp"
 #include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
 #include "../../include/solvers/CHeatSolver.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
 #include <algorithm>
 
 using namespace GeometryToolbox;
 
+namespace {
+/*!
+ * \brief Numerics of each material of the current thread that are of a given type (nullptr for other types).
+ */
+template <class NumericsType>
+array<NumericsType*, MAX_TERMS> GetBatchNumerics(CNumerics **numerics) {
+  const int thread = omp_get_thread_num();
+  array<NumericsType*, MAX_TERMS> batchNumerics;
+  for (auto iTerm = 0u; iTerm < MAX_TERMS; ++iTerm)
+    batchNumerics[iTerm] = dynamic_cast<NumericsType*>(numerics[thread*MAX_TERMS + iTerm]);
+  return batchNumerics;
+}
+
+/*!
+ * \brief Call a function with the element cast to its type of known sizes, for the types supported by the
+ *        batched assembly, returns false (without calling the function) for other types.
+ */
+template <class F>
+bool DispatchElementType(unsigned short nDim, int EL_KIND, CElement *element, const F& f) {
+  if (nDim == 2 && EL_KIND == EL_TRIA) f(*static_cast<CTRIA1*>(element));
+  else if (nDim == 2 && EL_KIND == EL_QUAD) f(*static_cast<CQUAD4*>(element));
+  else if (nDim == 3 && EL_KIND == EL_TETRA) f(*static_cast<CTETRA1*>(element));
+  else if (nDim == 3 && EL_KIND == EL_HEXA) f(*static_cast<CHEXA8*>(element));
+  else if (nDim == 3 && EL_KIND == EL_PYRAM) f(*static_cast<CPYRAM5*>(element));
+  else if (nDim == 3 && EL_KIND == EL_PRISM) f(*static_cast<CPRISM6*>(element));
+  else return false;
+  return true;
+}
+}  // namespace
+
 
 CFEASolver::CFEASolver(LINEAR_SOLVER_MODE mesh_deform_mode) : CFEASolverBase(mesh_deform_mode) {
 
@@ -167,6 +200,8 @@ CFEASolver::CFEASolver(CGeometry *geometry, CConfig *config) : CFEASolverBase(ge
   /*--- Initialize structures for hybrid-parallel mode. ---*/
   HybridParallelInitialization(geometry);
 
+  if (config->GetFEA_BatchedAssembly()) SetElementBatches(geometry);
+
   /*--- Initialize the value of the total objective function ---*/
   Total_OFRefGeom = 0.0;
   Total_OFRefNode = 0.0;
@@ -282,6 +317,36 @@ void CFEASolver::HybridParallelInitialization(CGeometry* geometry) {
 #endif
 }
 
+void CFEASolver::SetElementBatches(const CGeometry* geometry) {
+
+  /*--- No benefit without SIMD, e.g. for reverse AD. ---*/
+  const auto simdLen = simd::Array<su2double>::Size;
+  if (simdLen == 1) return;
+
+  ElemBatches.clear();
+
+  for (const auto& color : ElemColoring) {
+    array<vector<unsigned long>, MAX_FE_KINDS> byKind;
+
+    for (auto k = 0ul; k < color.size; ++k) {
+      const auto iElem = color.indices[k];
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+      byKind[EL_KIND].push_back(iElem);
+    }
+
+    ElemBatches.emplace_back();
+    auto& batches = ElemBatches.back();
+
+    for (auto& elems : byKind) {
+      if (elems.empty()) continue;
+      elems.resize(nextMultiple(elems.size(), simdLen), nElement);
+      batches.insert(batches.end(), elems.begin(), elems.end());
+    }
+  }
+}
+
 void CFEASolver::Set_ElementProperties(CGeometry *geometry, CConfig *config) {
 
   const bool topology_mode = config->GetTopology_Optimization();
@@ -641,102 +706,308 @@ void CFEASolver::SetInitialCondition(CGeometry **geometry, CSolver ***solver_con
   END_SU2_OMP_PARALLEL
 }
 
-void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+CElement* CFEASolver::Compute_Tangent_Element(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                              unsigned long iElem, unsigned long* indexNode, unsigned short& nNodes,
+                                              su2double& simp_penalty) const {
 
   const bool topology_mode = config->GetTopology_Optimization();
   const su2double simp_exponent = config->GetSIMP_Exponent();
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
   const su2double t_ref = config->GetTemperature_Ref();
 
-  /*--- Start OpenMP parallel region. ---*/
+  unsigned short iNode, iDim;
 
-  SU2_OMP_PARALLEL
-  {
-    /*--- Clear vector and matrix before calculation. ---*/
-    LinSysRes.SetValZero();
-    Jacobian.SetValZero();
+  int thread = omp_get_thread_num();
 
-    for(auto color : ElemColoring) {
+  /*--- Convert VTK type to index in the element container. ---*/
+  int EL_KIND;
+  GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
 
-      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-      for(auto k = 0ul; k < color.size; ++k) {
+  /*--- Each thread needs a dedicated element. ---*/
+  CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
 
-        auto iElem = color.indices[k];
+  /*--- For the number of nodes, get the coordinates and cache the point indices. ---*/
+  for (iNode = 0; iNode < nNodes; iNode++) {
 
-        unsigned short iNode, jNode, iDim, iVar;
+    indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
 
-        int thread = omp_get_thread_num();
+    for (iDim = 0; iDim < nDim; iDim++) {
+      su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+      su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
+      element->SetRef_Coord(iNode, iDim, val_Coord);
+      element->SetCurr_Coord(iNode, iDim, val_Sol);
+    }
+    if (heat_nodes) {
+      element->SetTemperature(iNode, heat_nodes->GetSolution(indexNode[iNode], 0) * t_ref);
+    }
+  }
 
-        /*--- Convert VTK type to index in the element container. ---*/
-        int EL_KIND;
-        unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+  /*--- In topology mode determine the penalty to apply to the stiffness. ---*/
+  simp_penalty = 1.0;
+  if (topology_mode) {
+    su2double density = element_properties[iElem]->GetPhysicalDensity();
+    simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+  }
 
-        /*--- Each thread needs a dedicated element. ---*/
-        CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+  /*--- Set the properties of the element ---*/
+  element->Set_ElProperties(element_properties[iElem]);
 
-        /*--- For the number of nodes, get the coordinates and cache the point indices. ---*/
-        unsigned long indexNode[MAXNNODE_3D];
+  /*--- Compute the components of the jacobian and the stress term, one numerics per thread. ---*/
+  int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
-        for (iNode = 0; iNode < nNodes; iNode++) {
+  numerics[NUM_TERM]->Compute_Tangent_Matrix(element, config);
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+  return element;
+}
 
-          for (iDim = 0; iDim < nDim; iDim++) {
-            su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
-            su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
-            element->SetRef_Coord(iNode, iDim, val_Coord);
-            element->SetCurr_Coord(iNode, iDim, val_Sol);
-          }
-          if (heat_nodes) {
-            element->SetTemperature(iNode, heat_nodes->GetSolution(indexNode[iNode], 0) * t_ref);
-          }
-        }
+void CFEASolver::Compute_StiffMatrix_Element(const CGeometry *geometry, CNumerics **numerics, const CConfig *config,
+                                             unsigned long iElem) {
 
-        /*--- In topology mode determine the penalty to apply to the stiffness. ---*/
-        su2double simp_penalty = 1.0;
-        if (topology_mode) {
-          su2double density = element_properties[iElem]->GetPhysicalDensity();
-          simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
-        }
+  unsigned long indexNode[MAXNNODE_3D];
+  unsigned short nNodes;
+  su2double simp_penalty;
 
-        /*--- Set the properties of the element ---*/
-        element->Set_ElProperties(element_properties[iElem]);
+  const auto element = Compute_Tangent_Element(geometry, numerics, config, iElem, indexNode, nNodes, simp_penalty);
 
-        /*--- Compute the components of the jacobian and the stress term, one numerics per thread. ---*/
-        int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+  /*--- Update residual and stiffness matrix with contributions from the element. ---*/
+  for (unsigned short iNode = 0; iNode < nNodes; iNode++) {
 
-        numerics[NUM_TERM]->Compute_Tangent_Matrix(element, config);
+    if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
 
-        /*--- Update residual and stiffness matrix with contributions from the element. ---*/
-        for (iNode = 0; iNode < nNodes; iNode++) {
+    auto Ta = element->Get_Kt_a(iNode);
+    for (unsigned short iVar = 0; iVar < nVar; iVar++)
+      LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
 
-          if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+    for (unsigned short jNode = 0; jNode < nNodes; jNode++) {
+      auto Kab = element->Get_Kab(iNode, jNode);
+      Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Kab, simp_penalty);
+    }
 
-          auto Ta = element->Get_Kt_a(iNode);
-          for (iVar = 0; iVar < nVar; iVar++)
-            LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+  }
+}
 
-          for (jNode = 0; jNode < nNodes; jNode++) {
-            auto Kab = element->Get_Kab(iNode, jNode);
-            Jacobian.AddBlock(indexNode[iNode], indexNode[jNode], Kab, simp_penalty);
-          }
+template <class NumericsType, class ElementType, class Double>
+void CFEASolver::GatherElementBatch(const CGeometry *geometry, NumericsType *numerics, const CConfig *config,
+                                    ElementType& element, const unsigned long* batch,
+                                    Double Coord[][ElementType::nDimBatch], Double Disp[][ElementType::nDimBatch],
+                                    Double* Temperature, Double& lambda, Double& mu, Double& thermal,
+                                    Double& tempRef, Double& penalty,
+                                    unsigned long indexNode[][ElementType::nNodeBatch]) const {
+  constexpr auto NNODE = ElementType::nNodeBatch;
+  constexpr auto NDIM = ElementType::nDimBatch;
 
-          if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+  const bool topology_mode = config->GetTopology_Optimization();
+  const su2double simp_exponent = config->GetSIMP_Exponent();
+  const su2double simp_minstiff = config->GetSIMP_MinStiffness();
+  const su2double t_ref = config->GetTemperature_Ref();
+
+  /*--- Unused lanes repeat the first element and are not scattered. ---*/
+
+  for (size_t iLane = 0; iLane < Double::Size; ++iLane) {
+    const auto iElem = (batch[iLane] < nElement) ? batch[iLane] : batch[0];
+
+    for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+      const auto iPoint = geometry->elem[iElem]->GetNode(iNode);
+      indexNode[iLane][iNode] = iPoint;
+      for (unsigned short iDim = 0; iDim < NDIM; iDim++) {
+        Coord[iNode][iDim][iLane] = Get_ValCoord(geometry, iPoint, iDim);
+        Disp[iNode][iDim][iLane] = nodes->GetSolution(iPoint, iDim);
+      }
+      Temperature[iNode][iLane] = heat_nodes ? heat_nodes->GetSolution(iPoint, 0) * t_ref
+                                             : element.GetTemperature(0);
+    }
+
+    element.Set_ElProperties(element_properties[iElem]);
+    numerics->GetElementParameters(&element, config, lambda[iLane], mu[iLane], thermal[iLane], tempRef[iLane]);
+
+    penalty[iLane] = 1.0;
+    if (topology_mode) {
+      const su2double density = element_properties[iElem]->GetPhysicalDensity();
+      penalty[iLane] = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+    }
+  }
+}
+
+template <class ElementType>
+void CFEASolver::Compute_StiffMatrix_Batch(const CGeometry *geometry, CFEALinearElasticity *numerics,
+                                           const CConfig *config, ElementType& element,
+                                           const unsigned long* batch) {
+  using Double = simd::Array<su2double>;
+  constexpr auto NNODE = ElementType::nNodeBatch;
+  constexpr auto NDIM = ElementType::nDimBatch;
+
+  Double Coord[NNODE][NDIM], Disp[NNODE][NDIM], Temperature[NNODE];
+  Double lambda, mu, thermal, tempRef, penalty;
+  unsigned long indexNode[Double::Size][NNODE];
+
+  GatherElementBatch(geometry, numerics, config, element, batch, Coord, Disp, Temperature, lambda, mu, thermal,
+                     tempRef, penalty, indexNode);
+
+  Double Kab[NNODE][NNODE][NDIM*NDIM], Kt_a[NNODE][NDIM];
+  CFEALinearElasticity::ComputeBatchTangentMatrix(element, Coord, Disp, Temperature, lambda, mu, thermal, tempRef,
+                                                  Kab, Kt_a);
+
+  /*--- Scatter, the elements of a color do not share nodes. ---*/
+
+  for (size_t iLane = 0; iLane < Double::Size; ++iLane) {
+    if (batch[iLane] >= nElement) continue;
+
+    for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+      const auto iPoint = indexNode[iLane][iNode];
+
+      if (LockStrategy) omp_set_lock(&UpdateLocks[iPoint]);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        LinSysRes(iPoint, iVar) -= penalty[iLane] * Kt_a[iNode][iVar][iLane];
+
+      for (unsigned short jNode = 0; jNode < NNODE; jNode++) {
+        su2double block[NDIM*NDIM];
+        for (unsigned short iVar = 0; iVar < NDIM*NDIM; iVar++) block[iVar] = Kab[iNode][jNode][iVar][iLane];
+        Jacobian.AddBlock(iPoint, indexNode[iLane][jNode], block, penalty[iLane]);
+      }
+
+      if (LockStrategy) omp_unset_lock(&UpdateLocks[iPoint]);
+    }
+  }
+}
+
+template <bool TANGENT, class ElementType>
+void CFEASolver::Compute_NonlinearTerms_Batch(const CGeometry *geometry, CFEM_NeoHookean_Comp *numerics,
+                                              const CConfig *config, ElementType& element,
+                                              const unsigned long* batch) {
+  using Double = simd::Array<su2double>;
+  constexpr auto NNODE = ElementType::nNodeBatch;
+  constexpr auto NDIM = ElementType::nDimBatch;
+
+  Double RefCoord[NNODE][NDIM], CurrCoord[NNODE][NDIM], Temperature[NNODE];
+  Double lambda, mu, thermal, tempRef, penalty;
+  unsigned long indexNode[Double::Size][NNODE];
+
+  GatherElementBatch(geometry, numerics, config, element, batch, RefCoord, CurrCoord, Temperature, lambda, mu,
+                     thermal, tempRef, penalty, indexNode);
+
+  /*--- Current coordinates, if pre-stretched the reference coordinates are stored in the nodes. ---*/
+
+  for (unsigned short iNode = 0; iNode < NNODE; iNode++)
+    for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+      CurrCoord[iNode][iDim] += RefCoord[iNode][iDim];
+
+  if (config->GetPrestretch()) {
+    for (size_t iLane = 0; iLane < Double::Size; ++iLane)
+      for (unsigned short iNode = 0; iNode < NNODE; iNode++)
+        for (unsigned short iDim = 0; iDim < NDIM; iDim++)
+          RefCoord[iNode][iDim][iLane] = nodes->GetPrestretch(indexNode[iLane][iNode], iDim);
+  }
+
+  Double Kab[NNODE][NNODE][NDIM*NDIM], Ks_ab[NNODE][NNODE], Kt_a[NNODE][NDIM];
+  CFEM_NeoHookean_Comp::ComputeBatchTerms<TANGENT>(element, RefCoord, CurrCoord, Temperature, lambda, mu, thermal,
+                                                   tempRef, Kab, Ks_ab, Kt_a);
+
+  /*--- Scatter, the elements of a color do not share nodes. ---*/
+
+  for (size_t iLane = 0; iLane < Double::Size; ++iLane) {
+    if (batch[iLane] >= nElement) continue;
+
+    for (unsigned short iNode = 0; iNode < NNODE; iNode++) {
+      const auto iPoint = indexNode[iLane][iNode];
+
+      if (LockStrategy) omp_set_lock(&UpdateLocks[iPoint]);
+
+      for (unsigned short iVar = 0; iVar < nVar; iVar++)
+        LinSysRes(iPoint, iVar) -= penalty[iLane] * Kt_a[iNode][iVar][iLane];
+
+      /*--- Full block of the constitutive term plus the stress term on the diagonal. ---*/
+      for (unsigned short jNode = 0; TANGENT && jNode < NNODE; jNode++) {
+        su2double block[NDIM*NDIM];
+        for (unsigned short iVar = 0; iVar < NDIM*NDIM; iVar++) block[iVar] = Kab[iNode][jNode][iVar][iLane];
+        for (unsigned short iVar = 0; iVar < NDIM; iVar++) block[iVar*(NDIM+1)] += Ks_ab[iNode][jNode][iLane];
+        Jacobian.AddBlock(iPoint, indexNode[iLane][jNode], block, penalty[iLane]);
+      }
+
+      if (LockStrategy) omp_unset_lock(&UpdateLocks[iPoint]);
+    }
+  }
+}
+
+template <class NumericsType, class BatchFunc, class ElementFunc>
+void CFEASolver::AssembleElementBatches(const CGeometry *geometry, const array<NumericsType*, MAX_TERMS>& batchNumerics,
+                                        const BatchFunc& batchFunc, const ElementFunc& elementFunc) {
+  const auto simdLen = simd::Array<su2double>::Size;
+  const int thread = omp_get_thread_num();
+
+  for (const auto& batches : ElemBatches) {
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, simdLen))
+    for (auto k = 0ul; k < batches.size(); k += simdLen) {
+      const auto* batch = &batches[k];
+
+      int EL_KIND;
+      unsigned short nNodes;
+      GetElemKindAndNumNodes(geometry->elem[batch[0]]->GetVTK_Type(), EL_KIND, nNodes);
+
+      /*--- All the elements of the batch must use the same numerics. ---*/
+      const auto matMod = element_properties[batch[0]]->GetMat_Mod();
+      bool sameMaterial = true;
+      for (auto iLane = 1ul; iLane < simdLen; ++iLane) {
+        if (batch[iLane] < nElement) sameMaterial &= (element_properties[batch[iLane]]->GetMat_Mod() == matMod);
+      }
+      auto* batchNum = sameMaterial ? batchNumerics[matMod] : nullptr;
+
+      auto* element = element_container[FEA_TERM][EL_KIND + thread*MAX_FE_KINDS];
+
+      const bool batched = (batchNum != nullptr) &&
+        DispatchElementType(nDim, EL_KIND, element, [&](auto& elem) { batchFunc(batchNum, elem, batch); });
+
+      if (!batched) {
+        for (auto iLane = 0ul; iLane < simdLen; ++iLane) {
+          if (batch[iLane] < nElement) elementFunc(batch[iLane]);
         }
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+}
 
-      } // end iElem loop
-      END_SU2_OMP_FOR
+void CFEASolver::Compute_StiffMatrix(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
-    } // end color loop
+  /*--- Start OpenMP parallel region. ---*/
+
+  SU2_OMP_PARALLEL
+  {
+    /*--- Clear vector and matrix before calculation. ---*/
+    LinSysRes.SetValZero();
+    Jacobian.SetValZero();
 
+    if (ElemBatches.empty()) {
+      for(auto color : ElemColoring) {
+
+        /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+        SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+        for(auto k = 0ul; k < color.size; ++k) {
+          Compute_StiffMatrix_Element(geometry, numerics, config, color.indices[k]);
+        }
+        END_SU2_OMP_FOR
+
+      } // end color loop
+    }
+    else {
+      /*--- Batched (SIMD) assembly, elements of the same type and linear elastic material are processed
+       *    together, other elements (e.g. with a different material model) use the scalar assembly. ---*/
+
+      AssembleElementBatches(geometry, GetBatchNumerics<CFEALinearElasticity>(numerics),
+        [&](CFEALinearElasticity* linElas, auto& element, const unsigned long* batch) {
+          Compute_StiffMatrix_Batch(geometry, linElas, config, element, batch);
+        },
+        [&](unsigned long iElem) { Compute_StiffMatrix_Element(geometry, numerics, config, iElem); });
+    }
   }
   END_SU2_OMP_PARALLEL
 
 }
 
-void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+void CFEASolver::Compute_StiffMatrix_NodalStressRes_Element(const CGeometry *geometry, CNumerics **numerics,
+                                                            const CConfig *config, unsigned long iElem) {
 
   const bool prestretch_fem = config->GetPrestretch();
   const bool de_effects = config->GetDE_Effects();
@@ -746,137 +1017,153 @@ void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumeri
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
   const su2double t_ref = config->GetTemperature_Ref();
 
-  /*--- Start OpenMP parallel region. ---*/
+  unsigned short iNode, jNode, iDim, iVar;
 
-  SU2_OMP_PARALLEL
-  {
-    /*--- Clear vector and matrix before calculation. ---*/
-    LinSysRes.SetValZero();
-    Jacobian.SetValZero();
+  int thread = omp_get_thread_num();
 
-    for(auto color : ElemColoring) {
+  /*--- Convert VTK type to index in the element container. ---*/
+  int EL_KIND;
+  unsigned short nNodes;
+  GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
 
-      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-      for(auto k = 0ul; k < color.size; ++k) {
+  /*--- Each thread needs a dedicated element. ---*/
+  CElement* fea_elem = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+  CElement* de_elem = element_container[DE_TERM][EL_KIND+thread*MAX_FE_KINDS];
 
-        auto iElem = color.indices[k];
+  /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
+  unsigned long indexNode[MAXNNODE_3D];
 
-        unsigned short iNode, jNode, iDim, iVar;
+  for (iNode = 0; iNode < nNodes; iNode++) {
 
-        int thread = omp_get_thread_num();
+    indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
 
-        /*--- Convert VTK type to index in the element container. ---*/
-        int EL_KIND;
-        unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      /*--- Compute current coordinate. ---*/
+      su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+      su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
 
-        /*--- Each thread needs a dedicated element. ---*/
-        CElement* fea_elem = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
-        CElement* de_elem = element_container[DE_TERM][EL_KIND+thread*MAX_FE_KINDS];
+      /*--- If pre-stretched the reference coordinate is stored in the nodes. ---*/
+      if (prestretch_fem)
+        val_Coord = nodes->GetPrestretch(indexNode[iNode],iDim);
 
-        /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
-        unsigned long indexNode[MAXNNODE_3D];
+      /*--- Set coordinates. ---*/
+      fea_elem->SetCurr_Coord(iNode, iDim, val_Sol);
+      fea_elem->SetRef_Coord(iNode, iDim, val_Coord);
 
-        for (iNode = 0; iNode < nNodes; iNode++) {
+      if (de_effects) {
+        de_elem->SetCurr_Coord(iNode, iDim, val_Sol);
+        de_elem->SetRef_Coord(iNode, iDim, val_Coord);
+      }
+    }
+    if (heat_nodes) {
+      fea_elem->SetTemperature(iNode, heat_nodes->GetSolution(indexNode[iNode], 0) * t_ref);
+    }
+  }
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+  /*--- In topology mode determine the penalty to apply to the stiffness. ---*/
+  su2double simp_penalty = 1.0;
+  if (topology_mode) {
+    su2double density = element_properties[iElem]->GetPhysicalDensity();
+    simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+  }
 
-          for (iDim = 0; iDim < nDim; iDim++) {
-            /*--- Compute current coordinate. ---*/
-            su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
-            su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
+  /*--- Set the properties of the element. ---*/
+  fea_elem->Set_ElProperties(element_properties[iElem]);
+  if (de_effects)
+    de_elem->Set_ElProperties(element_properties[iElem]);
 
-            /*--- If pre-stretched the reference coordinate is stored in the nodes. ---*/
-            if (prestretch_fem)
-              val_Coord = nodes->GetPrestretch(indexNode[iNode],iDim);
+  /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
+  int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
-            /*--- Set coordinates. ---*/
-            fea_elem->SetCurr_Coord(iNode, iDim, val_Sol);
-            fea_elem->SetRef_Coord(iNode, iDim, val_Coord);
+  numerics[NUM_TERM]->Compute_Tangent_Matrix(fea_elem, config);
 
-            if (de_effects) {
-              de_elem->SetCurr_Coord(iNode, iDim, val_Sol);
-              de_elem->SetRef_Coord(iNode, iDim, val_Coord);
-            }
-          }
-          if (heat_nodes) {
-            fea_elem->SetTemperature(iNode, heat_nodes->GetSolution(indexNode[iNode], 0) * t_ref);
-          }
-        }
+  /*--- Compute the electric component of the Jacobian and the stress term. ---*/
+  if (de_effects)
+    numerics[DE_TERM + thread*MAX_TERMS]->Compute_Tangent_Matrix(de_elem, config);
 
-        /*--- In topology mode determine the penalty to apply to the stiffness. ---*/
-        su2double simp_penalty = 1.0;
-        if (topology_mode) {
-          su2double density = element_properties[iElem]->GetPhysicalDensity();
-          simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
-        }
+  /*--- Update residual and stiffness matrix with contributions from the element. ---*/
+  for (iNode = 0; iNode < nNodes; iNode++) {
 
-        /*--- Set the properties of the element. ---*/
-        fea_elem->Set_ElProperties(element_properties[iElem]);
-        if (de_effects)
-          de_elem->Set_ElProperties(element_properties[iElem]);
+    if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
 
-        /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
-        int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+    auto Ta = fea_elem->Get_Kt_a(iNode);
+    for (iVar = 0; iVar < nVar; iVar++)
+      LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
 
-        numerics[NUM_TERM]->Compute_Tangent_Matrix(fea_elem, config);
+    /*--- Retrieve the electric contribution to the residual. ---*/
+    if (de_effects) {
+      auto Ta_DE = de_elem->Get_Kt_a(iNode);
+      for (iVar = 0; iVar < nVar; iVar++)
+        LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta_DE[iVar];
+    }
 
-        /*--- Compute the electric component of the Jacobian and the stress term. ---*/
-        if (de_effects)
-          numerics[DE_TERM + thread*MAX_TERMS]->Compute_Tangent_Matrix(de_elem, config);
+    for (jNode = 0; jNode < nNodes; jNode++) {
 
-        /*--- Update residual and stiffness matrix with contributions from the element. ---*/
-        for (iNode = 0; iNode < nNodes; iNode++) {
+      /*--- Get a pointer to the matrix block to perform the update. ---*/
+      auto Kij = Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
 
-          if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+      /*--- Retrieve the values of the FEA term. ---*/
+      auto Kab = fea_elem->Get_Kab(iNode, jNode);
+      su2double Ks_ab = fea_elem->Get_Ks_ab(iNode, jNode);
 
-          auto Ta = fea_elem->Get_Kt_a(iNode);
-          for (iVar = 0; iVar < nVar; iVar++)
-            LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
+      /*--- Full block. ---*/
+      for (iVar = 0; iVar < nVar*nVar; iVar++)
+        Kij[iVar] += SU2_TYPE::GetValue(simp_penalty*Kab[iVar]);
 
-          /*--- Retrieve the electric contribution to the residual. ---*/
-          if (de_effects) {
-            auto Ta_DE = de_elem->Get_Kt_a(iNode);
-            for (iVar = 0; iVar < nVar; iVar++)
-              LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta_DE[iVar];
-          }
+      /*--- Only the block's diagonal. ---*/
+      for (iVar = 0; iVar < nVar; iVar++)
+        Kij[iVar*(nVar+1)] += SU2_TYPE::GetValue(simp_penalty*Ks_ab);
 
-          for (jNode = 0; jNode < nNodes; jNode++) {
+      /*--- Retrieve the electric contribution to the Jacobian ---*/
+      if (de_effects) {
+        //auto Kab_DE = de_elem->Get_Kab(iNode, jNode);
+        su2double Ks_ab_DE = de_elem->Get_Ks_ab(iNode, jNode);
 
-            /*--- Get a pointer to the matrix block to perform the update. ---*/
-            auto Kij = Jacobian.GetBlock(indexNode[iNode], indexNode[jNode]);
+        for (iVar = 0; iVar < nVar; iVar++)
+          Kij[iVar*(nVar+1)] += SU2_TYPE::GetValue(simp_penalty*Ks_ab_DE);
+      }
+    }
 
-            /*--- Retrieve the values of the FEA term. ---*/
-            auto Kab = fea_elem->Get_Kab(iNode, jNode);
-            su2double Ks_ab = fea_elem->Get_Ks_ab(iNode, jNode);
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+  }
+}
 
-            /*--- Full block. ---*/
-            for (iVar = 0; iVar < nVar*nVar; iVar++)
-              Kij[iVar] += SU2_TYPE::GetValue(simp_penalty*Kab[iVar]);
+void CFEASolver::Compute_StiffMatrix_NodalStressRes(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
-            /*--- Only the block's diagonal. ---*/
-            for (iVar = 0; iVar < nVar; iVar++)
-              Kij[iVar*(nVar+1)] += SU2_TYPE::GetValue(simp_penalty*Ks_ab);
+  const bool de_effects = config->GetDE_Effects();
 
-            /*--- Retrieve the electric contribution to the Jacobian ---*/
-            if (de_effects) {
-              //auto Kab_DE = de_elem->Get_Kab(iNode, jNode);
-              su2double Ks_ab_DE = de_elem->Get_Ks_ab(iNode, jNode);
+  /*--- Start OpenMP parallel region. ---*/
 
-              for (iVar = 0; iVar < nVar; iVar++)
-                Kij[iVar*(nVar+1)] += SU2_TYPE::GetValue(simp_penalty*Ks_ab_DE);
-            }
-          }
+  SU2_OMP_PARALLEL
+  {
+    /*--- Clear vector and matrix before calculation. ---*/
+    LinSysRes.SetValZero();
+    Jacobian.SetValZero();
 
-          if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+    if (ElemBatches.empty() || de_effects) {
+      for(auto color : ElemColoring) {
+
+        /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+        SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+        for(auto k = 0ul; k < color.size; ++k) {
+          Compute_StiffMatrix_NodalStressRes_Element(geometry, numerics, config, color.indices[k]);
         }
+        END_SU2_OMP_FOR
 
-      } // end iElem loop
-      END_SU2_OMP_FOR
+      } // end color loop
+    }
+    else {
+      /*--- Batched (SIMD) assembly of the neo-Hookean elements, see Compute_StiffMatrix. ---*/
 
-    } // end color loop
+      auto neoHookean = GetBatchNumerics<CFEM_NeoHookean_Comp>(numerics);
+      for (auto& nh : neoHookean) if (nh && !nh->BatchSupported()) nh = nullptr;
 
+      AssembleElementBatches(geometry, neoHookean,
+        [&](CFEM_NeoHookean_Comp* nh, auto& element, const unsigned long* batch) {
+          Compute_NonlinearTerms_Batch<true>(geometry, nh, config, element, batch);
+        },
+        [&](unsigned long iElem) { Compute_StiffMatrix_NodalStressRes_Element(geometry, numerics, config, iElem); });
+    }
   }
   END_SU2_OMP_PARALLEL
 
@@ -1053,7 +1340,8 @@ void CFEASolver::Compute_MassRes(const CGeometry *geometry, CNumerics **numerics
 
 }
 
-void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+void CFEASolver::Compute_NodalStressRes_Element(const CGeometry *geometry, CNumerics **numerics,
+                                                const CConfig *config, unsigned long iElem) {
 
   const bool prestretch_fem = config->GetPrestretch();
 
@@ -1062,89 +1350,103 @@ void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numeric
   const su2double simp_minstiff = config->GetSIMP_MinStiffness();
   const su2double t_ref = config->GetTemperature_Ref();
 
-  /*--- Start OpenMP parallel region. ---*/
+  unsigned short iNode, iDim, iVar;
 
-  SU2_OMP_PARALLEL
-  {
-    /*--- Clear vector before calculation. ---*/
-    LinSysRes.SetValZero();
-    SU2_OMP_BARRIER
+  int thread = omp_get_thread_num();
 
-    for(auto color : ElemColoring) {
+  /*--- Convert VTK type to index in the element container. ---*/
+  int EL_KIND;
+  unsigned short nNodes;
+  GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
 
-      /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
-      SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
-      for(auto k = 0ul; k < color.size; ++k) {
+  /*--- Each thread needs a dedicated element. ---*/
+  CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
 
-        auto iElem = color.indices[k];
+  /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
+  unsigned long indexNode[MAXNNODE_3D];
 
-        unsigned short iNode, iDim, iVar;
+  for (iNode = 0; iNode < nNodes; iNode++) {
 
-        int thread = omp_get_thread_num();
+    indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
 
-        /*--- Convert VTK type to index in the element container. ---*/
-        int EL_KIND;
-        unsigned short nNodes;
-        GetElemKindAndNumNodes(geometry->elem[iElem]->GetVTK_Type(), EL_KIND, nNodes);
+    for (iDim = 0; iDim < nDim; iDim++) {
+      /*--- Compute current coordinate. ---*/
+      su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
+      su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
 
-        /*--- Each thread needs a dedicated element. ---*/
-        CElement* element = element_container[FEA_TERM][EL_KIND+thread*MAX_FE_KINDS];
+      /*--- If pre-stretched the reference coordinate is stored in the nodes. ---*/
+      if (prestretch_fem)
+        val_Coord = nodes->GetPrestretch(indexNode[iNode],iDim);
 
-        /*--- For the number of nodes, we get the coordinates from the connectivity matrix ---*/
-        unsigned long indexNode[MAXNNODE_3D];
+      /*--- Set coordinates. ---*/
+      element->SetCurr_Coord(iNode, iDim, val_Sol);
+      element->SetRef_Coord(iNode, iDim, val_Coord);
+    }
+    if (heat_nodes) {
+      element->SetTemperature(iNode, heat_nodes->GetSolution(indexNode[iNode], 0) * t_ref);
+    }
+  }
 
-        for (iNode = 0; iNode < nNodes; iNode++) {
+  /*--- In topology mode determine the penalty to apply to the stiffness ---*/
+  su2double simp_penalty = 1.0;
+  if (topology_mode) {
+    su2double density = element_properties[iElem]->GetPhysicalDensity();
+    simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
+  }
 
-          indexNode[iNode] = geometry->elem[iElem]->GetNode(iNode);
+  /*--- Set the properties of the element. ---*/
+  element->Set_ElProperties(element_properties[iElem]);
 
-          for (iDim = 0; iDim < nDim; iDim++) {
-            /*--- Compute current coordinate. ---*/
-            su2double val_Coord = Get_ValCoord(geometry, indexNode[iNode], iDim);
-            su2double val_Sol = nodes->GetSolution(indexNode[iNode],iDim) + val_Coord;
+  /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
+  int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
 
-            /*--- If pre-stretched the reference coordinate is stored in the nodes. ---*/
-            if (prestretch_fem)
-              val_Coord = nodes->GetPrestretch(indexNode[iNode],iDim);
+  numerics[NUM_TERM]->Compute_NodalStress_Term(element, config);
 
-            /*--- Set coordinates. ---*/
-            element->SetCurr_Coord(iNode, iDim, val_Sol);
-            element->SetRef_Coord(iNode, iDim, val_Coord);
-          }
-          if (heat_nodes) {
-            element->SetTemperature(iNode, heat_nodes->GetSolution(indexNode[iNode], 0) * t_ref);
-          }
-        }
+  for (iNode = 0; iNode < nNodes; iNode++) {
+    if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
 
-        /*--- In topology mode determine the penalty to apply to the stiffness ---*/
-        su2double simp_penalty = 1.0;
-        if (topology_mode) {
-          su2double density = element_properties[iElem]->GetPhysicalDensity();
-          simp_penalty = simp_minstiff+(1.0-simp_minstiff)*pow(density,simp_exponent);
-        }
+    auto Ta = element->Get_Kt_a(iNode);
+    for (iVar = 0; iVar < nVar; iVar++)
+      LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
 
-        /*--- Set the properties of the element. ---*/
-        element->Set_ElProperties(element_properties[iElem]);
+    if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+  }
+}
 
-        /*--- Compute the components of the Jacobian and the stress term for the material. ---*/
-        int NUM_TERM = thread*MAX_TERMS + element_properties[iElem]->GetMat_Mod();
+void CFEASolver::Compute_NodalStressRes(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
 
-        numerics[NUM_TERM]->Compute_NodalStress_Term(element, config);
+  /*--- Start OpenMP parallel region. ---*/
 
-        for (iNode = 0; iNode < nNodes; iNode++) {
-          if (LockStrategy) omp_set_lock(&UpdateLocks[indexNode[iNode]]);
+  SU2_OMP_PARALLEL
+  {
+    /*--- Clear vector before calculation. ---*/
+    LinSysRes.SetValZero();
+    SU2_OMP_BARRIER
 
-          auto Ta = element->Get_Kt_a(iNode);
-          for (iVar = 0; iVar < nVar; iVar++)
-            LinSysRes(indexNode[iNode], iVar) -= simp_penalty*Ta[iVar];
+    if (ElemBatches.empty()) {
+      for(auto color : ElemColoring) {
 
-          if (LockStrategy) omp_unset_lock(&UpdateLocks[indexNode[iNode]]);
+        /*--- Chunk size is at least OMP_MIN_SIZE and a multiple of the color group size. ---*/
+        SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+        for(auto k = 0ul; k < color.size; ++k) {
+          Compute_NodalStressRes_Element(geometry, numerics, config, color.indices[k]);
         }
+        END_SU2_OMP_FOR
 
-      } // end iElem loop
-      END_SU2_OMP_FOR
+      } // end color loop
+    }
+    else {
+      /*--- Batched (SIMD) computation of the neo-Hookean elements, see Compute_StiffMatrix. ---*/
 
-    } // end color loop
+      auto neoHookean = GetBatchNumerics<CFEM_NeoHookean_Comp>(numerics);
+      for (auto& nh : neoHookean) if (nh && !nh->BatchSupported()) nh = nullptr;
 
+      AssembleElementBatches(geometry, neoHookean,
+        [&](CFEM_NeoHookean_Comp* nh, auto& element, const unsigned long* batch) {
+          Compute_NonlinearTerms_Batch<false>(geometry, nh, config, element, batch);
+        },
+        [&](unsigned long iElem) { Compute_NodalStressRes_Element(geometry, numerics, config, iElem); });
+    }
   }
   END_SU2_OMP_PARALLEL
 
@@ -1589,7 +1891,7 @@ void CFEASolver::BC_Clamped(CGeometry *geometry, const CConfig *config, unsigned
 
     LinSysSol.SetBlock(iPoint, zeros);
     if (LinSysReact.GetLocSize() > 0) LinSysReact.SetBlock(iPoint, zeros);
-    Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+    EnforceSolutionAtNode(iPoint, zeros);
 
   }
 
@@ -1686,7 +1988,7 @@ void CFEASolver::BC_Sym_Plane(CGeometry *geometry, const CConfig *config, unsign
       SubtractProjection(nDim, normal, [&](unsigned short iDim) { return LinSysReact(iPoint, iDim); },
                          [&](unsigned short iDim, const su2double& x) { LinSysReact(iPoint, iDim) = x; });
     }
-    Jacobian.EnforceZeroProjection(iPoint, normal, LinSysRes);
+    EnforceZeroProjection(iPoint, normal);
 
   }
 
@@ -2551,6 +2853,356 @@ void CFEASolver::Solve_System(CGeometry *geometry, CConfig *config) {
 
 }
 
+namespace {
+using MatrixFreeScalar = CSolver::JacobianScalarType;
+
+/*--- Adaptors of the matrix-free operator of CFEASolver to the interface of the Krylov solvers. ---*/
+
+class CMatrixFreeElasticityProduct final : public CMatrixVectorProduct<MatrixFreeScalar> {
+  const CFEASolver* solver;
+public:
+  CMatrixFreeElasticityProduct(const CFEASolver* s) : solver(s) {}
+
+  inline void operator()(const CSysVector<MatrixFreeScalar>& u, CSysVector<MatrixFreeScalar>& v) const override {
+    solver->MatrixFreeProduct(u, v);
+  }
+};
+
+class CMatrixFreeElasticityPreconditioner final : public CPreconditioner<MatrixFreeScalar> {
+  const CFEASolver* solver;
+public:
+  CMatrixFreeElasticityPreconditioner(const CFEASolver* s) : solver(s) {}
+
+  inline void operator()(const CSysVector<MatrixFreeScalar>& u, CSysVector<MatrixFreeScalar>& v) const override {
+    solver->MatrixFreePreconditioner(u, v);
+  }
+};
+
+/*--- Remove the component of x along the unit normal n. ---*/
+template <class T>
+void RemoveNormalComponent(unsigned short nDim, const passivedouble* n, T* x) {
+  T proj{};
+  for (auto iDim = 0u; iDim < nDim; ++iDim) proj += x[iDim] * n[iDim];
+  for (auto iDim = 0u; iDim < nDim; ++iDim) x[iDim] -= proj * n[iDim];
+}
+
+/*--- In-place inversion of a small SPD block (no pivoting). ---*/
+void InvertBlockSPD(unsigned short n, passivedouble* A) {
+  for (auto k = 0u; k < n; ++k) {
+    const passivedouble pivot = 1.0 / A[k*n+k];
+    A[k*n+k] = 1.0;
+    for (auto j = 0u; j < n; ++j) A[k*n+j] *= pivot;
+    for (auto i = 0u; i < n; ++i) {
+      if (i == k) continue;
+      const passivedouble factor = A[i*n+k];
+      A[i*n+k] = 0.0;
+      for (auto j = 0u; j < n; ++j) A[i*n+j] -= factor * A[k*n+j];
+    }
+  }
+}
+}
+
+void CFEASolver::InitializeMatrixFree() {
+
+  MatrixFree = true;
+  Constraint.assign(nPoint, FREE_NODE);
+  ConstraintNormal.resize(nPoint, nVar) = passivedouble(0.0);
+  InvDiagBlocks.resize(nPoint, nVar*nVar) = passivedouble(0.0);
+  MatrixFreeRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
+  MatrixFreeSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
+}
+
+void CFEASolver::ResetMatrixFreeConstraints() {
+
+  if (MatrixFree) Constraint.assign(nPoint, FREE_NODE);
+}
+
+void CFEASolver::EnforceSolutionAtNode(unsigned long iPoint, const su2double* x) {
+
+  if (!MatrixFree) {
+    Jacobian.EnforceSolutionAtNode(iPoint, x, LinSysRes);
+    return;
+  }
+  /*--- The columns are eliminated when the system is solved. ---*/
+  Constraint[iPoint] = FIXED_NODE;
+  LinSysRes.SetBlock(iPoint, x);
+}
+
+void CFEASolver::EnforceZeroProjection(unsigned long iPoint, const su2double* normal) {
+
+  if (!MatrixFree) {
+    Jacobian.EnforceZeroProjection(iPoint, normal, LinSysRes);
+    return;
+  }
+  if (Constraint[iPoint] == FIXED_NODE) return;
+
+  Constraint[iPoint] = SYMMETRY_NODE;
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim)
+    ConstraintNormal(iPoint, iDim) = SU2_TYPE::GetValue(normal[iDim]);
+
+  su2double res[MAXNVAR] = {0.0};
+  for (unsigned short iDim = 0; iDim < nDim; ++iDim) res[iDim] = LinSysRes(iPoint, iDim);
+  RemoveNormalComponent(nDim, ConstraintNormal[iPoint], res);
+  LinSysRes.SetBlock(iPoint, res);
+}
+
+void CFEASolver::ApplyMatrixFreeOperator(const CSysVector<JacobianScalarType>& u, CSysVector<JacobianScalarType>& v,
+                                         bool constrained) const {
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar)
+      v(iPoint, iVar) = 0.0;
+  END_SU2_OMP_FOR
+
+  for (const auto& color : ElemColoring) {
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; ++k) {
+
+      unsigned long indexNode[MAXNNODE_3D];
+      unsigned short nNodes;
+      su2double simp_penalty;
+
+      const auto element = Compute_Tangent_Element(MatrixFreeGeometry, MatrixFreeNumerics, MatrixFreeConfig,
+                                                   color.indices[k], indexNode, nNodes, simp_penalty);
+
+      /*--- Gather the input without the components removed by the essential BC (column elimination). ---*/
+      su2double uElem[MAXNNODE_3D][MAXNVAR] = {{0.0}};
+
+      for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+        const auto iPoint = indexNode[iNode];
+        if (constrained && Constraint[iPoint] == FIXED_NODE) continue;
+
+        for (unsigned short iVar = 0; iVar < nVar; ++iVar) uElem[iNode][iVar] = u(iPoint, iVar);
+
+        if (constrained && Constraint[iPoint] == SYMMETRY_NODE)
+          RemoveNormalComponent(nDim, ConstraintNormal[iPoint], uElem[iNode]);
+      }
+
+      /*--- Element product, the rows of the fixed points are set after the element loop. ---*/
+      for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+        const auto iPoint = indexNode[iNode];
+        if (constrained && Constraint[iPoint] == FIXED_NODE) continue;
+
+        su2double vNode[MAXNVAR] = {0.0};
+        for (unsigned short jNode = 0; jNode < nNodes; ++jNode) {
+          const auto Kab = element->Get_Kab(iNode, jNode);
+          for (unsigned short iVar = 0; iVar < nVar; ++iVar)
+            for (unsigned short jVar = 0; jVar < nVar; ++jVar)
+              vNode[iVar] += Kab[iVar*nVar+jVar] * uElem[jNode][jVar];
+        }
+
+        if (LockStrategy) omp_set_lock(&UpdateLocks[iPoint]);
+        for (unsigned short iVar = 0; iVar < nVar; ++iVar)
+          v(iPoint, iVar) += SU2_TYPE::GetValue(simp_penalty * vNode[iVar]);
+        if (LockStrategy) omp_unset_lock(&UpdateLocks[iPoint]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Rows of the constrained points, identity for the fixed points and the normal direction of symmetry points. ---*/
+  if (constrained) {
+    SU2_OMP_FOR_STAT(omp_chunk_size)
+    for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+      if (Constraint[iPoint] == FIXED_NODE) {
+        for (unsigned short iVar = 0; iVar < nVar; ++iVar) v(iPoint, iVar) = u(iPoint, iVar);
+      }
+      else if (Constraint[iPoint] == SYMMETRY_NODE) {
+        const auto n = ConstraintNormal[iPoint];
+        JacobianScalarType projV{}, projU{};
+        for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+          projV += v(iPoint, iVar) * n[iVar];
+          projU += u(iPoint, iVar) * n[iVar];
+        }
+        for (unsigned short iVar = 0; iVar < nVar; ++iVar) v(iPoint, iVar) += (projU - projV) * n[iVar];
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- The rows of the halo points are incomplete, get them from their owners. ---*/
+  CSysMatrixComms::Initiate(v, MatrixFreeGeometry, MatrixFreeConfig);
+  CSysMatrixComms::Complete(v, MatrixFreeGeometry, MatrixFreeConfig);
+}
+
+void CFEASolver::BuildMatrixFreePreconditioner() {
+
+  const unsigned long nVar2 = nVar*nVar;
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iVar = 0ul; iVar < nVar2; ++iVar)
+      InvDiagBlocks(iPoint, iVar) = 0.0;
+  END_SU2_OMP_FOR
+
+  /*--- Assemble the diagonal blocks. ---*/
+  for (const auto& color : ElemColoring) {
+
+    SU2_OMP_FOR_DYN(nextMultiple(OMP_MIN_SIZE, color.groupSize))
+    for (auto k = 0ul; k < color.size; ++k) {
+
+      unsigned long indexNode[MAXNNODE_3D];
+      unsigned short nNodes;
+      su2double simp_penalty;
+
+      const auto element = Compute_Tangent_Element(MatrixFreeGeometry, MatrixFreeNumerics, MatrixFreeConfig,
+                                                   color.indices[k], indexNode, nNodes, simp_penalty);
+
+      for (unsigned short iNode = 0; iNode < nNodes; ++iNode) {
+        const auto iPoint = indexNode[iNode];
+        const auto Kaa = element->Get_Kab(iNode, iNode);
+
+        if (LockStrategy) omp_set_lock(&UpdateLocks[iPoint]);
+        for (auto iVar = 0ul; iVar < nVar2; ++iVar)
+          InvDiagBlocks(iPoint, iVar) += SU2_TYPE::GetValue(simp_penalty * Kaa[iVar]);
+        if (LockStrategy) omp_unset_lock(&UpdateLocks[iPoint]);
+      }
+    }
+    END_SU2_OMP_FOR
+  }
+
+  /*--- Apply the essential BC to the blocks (consistently with the operator) and invert them. ---*/
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    auto D = InvDiagBlocks[iPoint];
+
+    if (Constraint[iPoint] == FIXED_NODE) {
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          D[iVar*nVar+jVar] = (iVar == jVar);
+    }
+    else if (Constraint[iPoint] == SYMMETRY_NODE) {
+      /*--- P D P + n n^T, with P = I - n n^T. ---*/
+      const auto n = ConstraintNormal[iPoint];
+      passivedouble P[MAXNVAR*MAXNVAR] = {0.0}, PD[MAXNVAR*MAXNVAR] = {0.0};
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          P[iVar*nVar+jVar] = (iVar == jVar) - n[iVar]*n[jVar];
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar)
+        for (auto jVar = 0ul; jVar < nVar; ++jVar)
+          for (auto kVar = 0ul; kVar < nVar; ++kVar)
+            PD[iVar*nVar+jVar] += P[iVar*nVar+kVar] * D[kVar*nVar+jVar];
+
+      for (auto iVar = 0ul; iVar < nVar; ++iVar) {
+        for (auto jVar = 0ul; jVar < nVar; ++jVar) {
+          passivedouble val = n[iVar]*n[jVar];
+          for (auto kVar = 0ul; kVar < nVar; ++kVar) val += PD[iVar*nVar+kVar] * P[kVar*nVar+jVar];
+          D[iVar*nVar+jVar] = val;
+        }
+      }
+    }
+    InvertBlockSPD(nVar, D);
+  }
+  END_SU2_OMP_FOR
+}
+
+void CFEASolver::MatrixFreePreconditioner(const CSysVector<JacobianScalarType>& u,
+                                          CSysVector<JacobianScalarType>& v) const {
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    const auto D = InvDiagBlocks[iPoint];
+    JacobianScalarType prod[MAXNVAR] = {0.0};
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar)
+      for (unsigned short jVar = 0; jVar < nVar; ++jVar)
+        prod[iVar] += D[iVar*nVar+jVar] * u(iPoint, jVar);
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) v(iPoint, iVar) = prod[iVar];
+  }
+  END_SU2_OMP_FOR
+
+  CSysMatrixComms::Initiate(v, MatrixFreeGeometry, MatrixFreeConfig);
+  CSysMatrixComms::Complete(v, MatrixFreeGeometry, MatrixFreeConfig);
+}
+
+void CFEASolver::Solve_System_MatrixFree(CGeometry *geometry, CNumerics **numerics, const CConfig *config) {
+
+  MatrixFreeGeometry = geometry;
+  MatrixFreeNumerics = numerics;
+  MatrixFreeConfig = config;
+
+  /*--- Enforce solution at some halo points possibly not covered by essential BC markers. ---*/
+  CSysMatrixComms::Initiate(LinSysSol, geometry, config);
+  CSysMatrixComms::Complete(LinSysSol, geometry, config);
+
+  for (auto iPoint : ExtraVerticesToEliminate) {
+    EnforceSolutionAtNode(iPoint, LinSysSol.GetBlock(iPoint));
+  }
+
+  const auto kindSolver = config->GetKind_Deform_Linear_Solver();
+  const auto maxIter = config->GetDeform_Linear_Solver_Iter();
+  const JacobianScalarType tol = SU2_TYPE::GetValue(config->GetDeform_Linear_Solver_Error());
+  const bool monitoring = config->GetDeform_Output();
+
+  SU2_OMP_PARALLEL
+  {
+  BuildMatrixFreePreconditioner();
+
+  /*--- Move the products of the eliminated columns by the known solution to the right hand side. ---*/
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar)
+      MatrixFreeSol(iPoint, iVar) = (Constraint[iPoint] == FIXED_NODE) ? SU2_TYPE::GetValue(LinSysRes(iPoint, iVar)) : 0.0;
+  END_SU2_OMP_FOR
+
+  ApplyMatrixFreeOperator(MatrixFreeSol, MatrixFreeRes, false);
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar) {
+      const JacobianScalarType rhs = SU2_TYPE::GetValue(LinSysRes(iPoint, iVar));
+      MatrixFreeRes(iPoint, iVar) = (Constraint[iPoint] == FIXED_NODE) ? rhs : rhs - MatrixFreeRes(iPoint, iVar);
+      MatrixFreeSol(iPoint, iVar) = SU2_TYPE::GetValue(LinSysSol(iPoint, iVar));
+    }
+    if (Constraint[iPoint] == SYMMETRY_NODE)
+      RemoveNormalComponent(nDim, ConstraintNormal[iPoint], MatrixFreeRes.GetBlock(iPoint));
+  }
+  END_SU2_OMP_FOR
+
+  /*--- Solve the system. ---*/
+
+  const CMatrixFreeElasticityProduct mat_vec(this);
+  const CMatrixFreeElasticityPreconditioner precond(this);
+
+  JacobianScalarType residual = 0.0;
+  unsigned long iter = 0;
+
+  switch (kindSolver) {
+    case CONJUGATE_GRADIENT:
+      iter = System.CG_LinSolver(MatrixFreeRes, MatrixFreeSol, mat_vec, precond, tol, maxIter, residual, monitoring, config);
+      break;
+    case BCGSTAB:
+      iter = System.BCGSTAB_LinSolver(MatrixFreeRes, MatrixFreeSol, mat_vec, precond, tol, maxIter, residual, monitoring, config);
+      break;
+    case RESTARTED_FGMRES:
+      iter = System.RFGMRES_LinSolver(MatrixFreeRes, MatrixFreeSol, mat_vec, precond, tol, maxIter, residual, monitoring, config);
+      break;
+    case SMOOTHER:
+      iter = System.Smoother_LinSolver(MatrixFreeRes, MatrixFreeSol, mat_vec, precond, tol, maxIter, residual, monitoring, config);
+      break;
+    default:
+      iter = System.FGMRES_LinSolver(MatrixFreeRes, MatrixFreeSol, mat_vec, precond, tol, maxIter, residual, monitoring, config);
+      break;
+  }
+
+  SU2_OMP_FOR_STAT(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (unsigned short iVar = 0; iVar < nVar; ++iVar)
+      LinSysSol(iPoint, iVar) = MatrixFreeSol(iPoint, iVar);
+  END_SU2_OMP_FOR
+
+  SU2_OMP_MASTER
+  {
+    SetIterLinSolver(iter);
+    SetResLinSolver(residual);
+  }
+  END_SU2_OMP_MASTER
+  }
+  END_SU2_OMP_PARALLEL
+
+}
 
 void CFEASolver::PredictStruct_Displacement(CGeometry *geometry, const CConfig *config) {
 
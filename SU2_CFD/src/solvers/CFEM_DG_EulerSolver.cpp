@@ -265,6 +265,13 @@ CFEM_DG_EulerSolver::CFEM_DG_EulerSolver(CGeometry *geometry, CConfig *config, u
     sizeWorkArray = max(sizeWorkArray, sizePredictorADER);
   }
 
+  /*--- The sum factorization of the volume terms needs additional work space,
+        which is located after the arrays used in Volume_Residual. ---*/
+  unsigned long sizeSumFact = 0;
+  for(unsigned short i=0; i<nStandardElementsSol; ++i)
+    sizeSumFact = max(sizeSumFact, standardElementsSol[i].GetSizeWorkSumFactorization(nPadGemm));
+  sizeWorkArray += sizeSumFact;
+
   /*--- Perform the non-dimensionalization for the flow equations using the
         specified reference values. ---*/
   SetNondimensionalization(config, iMesh, true);
@@ -5879,11 +5886,17 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
     const su2double *matDerBasisIntTrans = standardElementsSol[ind].GetDerMatBasisFunctionsIntTrans();
     const su2double *weights             = standardElementsSol[ind].GetWeightsIntegration();
 
+    /* Determine whether the matrix products are replaced by sum factorization. */
+    const unsigned short sumFactPoly = config->GetSumFactorizationPoly_DGFEM();
+    const bool sumFact = standardElementsSol[ind].GetTensorProduct() && (sumFactPoly > 0) &&
+                         (standardElementsSol[ind].GetNPoly() >= sumFactPoly);
+
     /*--- Set the pointers for the local arrays. ---*/
     su2double *solDOFs = workArray;
     su2double *sources = solDOFs + nDOFs*NPad;
     su2double *solInt  = sources + nInt *NPad;
     su2double *fluxes  = solInt  + nInt *NPad;
+    su2double *workSumFact = fluxes + nInt*nDim*NPad;
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Interpolate the solution to the integration points of    ---*/
@@ -5908,7 +5921,10 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product to determine
        the solution in the integration points of the chunk of elements. */
-    blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactInterpolation(NPad, false, solDOFs, solInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt, NPad, nDOFs, matBasisInt, solDOFs, solInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the inviscid fluxes, multiplied by minus the     ---*/
@@ -6175,14 +6191,20 @@ void CFEM_DG_EulerSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product.
        Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactDerIntegration(NPad, fluxes, solDOFs, workSumFact);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
+      if( sumFact )
+        standardElementsSol[ind].SumFactIntegration(NPad, sources, solInt, workSumFact);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
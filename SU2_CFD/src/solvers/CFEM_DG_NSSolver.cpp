@@ -3201,11 +3201,17 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     unsigned short nPoly = standardElementsSol[ind].GetNPoly();
     if(nPoly == 0) nPoly = 1;
 
+    /* Determine whether the matrix products are replaced by sum factorization. */
+    const unsigned short sumFactPoly = config->GetSumFactorizationPoly_DGFEM();
+    const bool sumFact = standardElementsSol[ind].GetTensorProduct() && (sumFactPoly > 0) &&
+                         (standardElementsSol[ind].GetNPoly() >= sumFactPoly);
+
     /*--- Set the pointers for the local arrays. ---*/
     su2double *solDOFs       = workArray;
     su2double *sources       = solDOFs       + nDOFs*NPad;
     su2double *solAndGradInt = sources       + nInt *NPad;
     su2double *fluxes        = solAndGradInt + nInt *NPad*(nDim+1);
+    su2double *workSumFact   = fluxes        + nInt *NPad*nDim;
 
     /*------------------------------------------------------------------------*/
     /*--- Step 1: Determine the solution variables and their gradients     ---*/
@@ -3232,7 +3238,10 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
     /* Call the general function to carry out the matrix product to determine
        the solution and gradients in the integration points of the chunk
        of elements. */
-    blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactInterpolation(NPad, true, solDOFs, solAndGradInt, workSumFact);
+    else
+      blasFunctions->gemm(nInt*(nDim+1), NPad, nDOFs, matBasisInt, solDOFs, solAndGradInt, config);
 
     /*------------------------------------------------------------------------*/
     /*--- Step 2: Compute the total fluxes (inviscid fluxes minus the      ---*/
@@ -3687,14 +3696,20 @@ void CFEM_DG_NSSolver::Volume_Residual(CConfig             *config,
 
     /* Call the general function to carry out the matrix product.
        Use solDOFs as a temporary storage for the matrix product. */
-    blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
+    if( sumFact )
+      standardElementsSol[ind].SumFactDerIntegration(NPad, fluxes, solDOFs, workSumFact);
+    else
+      blasFunctions->gemm(nDOFs, NPad, nInt*nDim, matDerBasisIntTrans, fluxes, solDOFs, config);
 
     /* Add the contribution from the source terms, if needed. Use solAndGradInt
        as temporary storage for the matrix product. */
     if( addSourceTerms ) {
 
       /* Call the general function to carry out the matrix product. */
-      blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
+      if( sumFact )
+        standardElementsSol[ind].SumFactIntegration(NPad, sources, solAndGradInt, workSumFact);
+      else
+        blasFunctions->gemm(nDOFs, NPad, nInt, matBasisIntTrans, sources, solAndGradInt, config);
 
       /* Add the residuals due to source terms to the volume residuals */
       for(unsigned short i=0; i<(nDOFs*NPad); ++i)
@@ -101,7 +101,8 @@ CMeshSolver::CMeshSolver(CGeometry *geometry, CConfig *config) : CFEASolver(LINE
 
   LinSysSol.Initialize(nPoint, nPointDomain, nVar, 0.0);
   LinSysRes.Initialize(nPoint, nPointDomain, nVar, 0.0);
-  Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
+  if (config->GetDeform_MatrixFree()) InitializeMatrixFree();
+  else Jacobian.Initialize(nPoint, nPointDomain, nVar, nVar, false, geometry, config);
 
   /*--- Initialize structures for hybrid-parallel mode. ---*/
 
@@ -488,11 +489,12 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   InitiateComms(geometry[MESH_0], config, MPI_QUANTITIES::MESH_DISPLACEMENTS);
   CompleteComms(geometry[MESH_0], config, MPI_QUANTITIES::MESH_DISPLACEMENTS);
 
-  /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
+  /*--- Compute the stiffness matrix (unless matrix-free), no point recording because we clear the residual. ---*/
 
   const bool wasActive = AD::BeginPassive();
 
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
+  if (MatrixFree) ResetMatrixFreeConstraints();
+  else Compute_StiffMatrix(geometry[MESH_0], numerics, config);
 
   AD::EndPassive(wasActive);
 
@@ -514,7 +516,8 @@ void CMeshSolver::DeformMesh(CGeometry **geometry, CNumerics **numerics, CConfig
   SetBoundaryDisplacements(geometry[MESH_0], config, false);
 
   /*--- Solve the linear system. ---*/
-  Solve_System(geometry[MESH_0], config);
+  if (MatrixFree) Solve_System_MatrixFree(geometry[MESH_0], numerics, config);
+  else Solve_System(geometry[MESH_0], config);
 
   SU2_OMP_PARALLEL {
 
@@ -573,11 +576,12 @@ void CMeshSolver::ComputeGridVelocity_FromBoundary(CGeometry **geometry, CNumeri
     SU2_MPI::Error("It is not possible to compute grid velocity from boundary velocity for single zone problems.\n"
                    "MARKER_FLUID_LOAD should only be used for structural boundaries.", CURRENT_FUNCTION);
 
-  /*--- Compute the stiffness matrix, no point recording because we clear the residual. ---*/
+  /*--- Compute the stiffness matrix (unless matrix-free), no point recording because we clear the residual. ---*/
 
   const bool wasActive = AD::BeginPassive();
 
-  Compute_StiffMatrix(geometry[MESH_0], numerics, config);
+  if (MatrixFree) ResetMatrixFreeConstraints();
+  else Compute_StiffMatrix(geometry[MESH_0], numerics, config);
 
   AD::EndPassive(wasActive);
 
@@ -600,7 +604,8 @@ void CMeshSolver::ComputeGridVelocity_FromBoundary(CGeometry **geometry, CNumeri
   SetBoundaryDisplacements(geometry[MESH_0], config, true);
 
   /*--- Solve the linear system. ---*/
-  Solve_System(geometry[MESH_0], config);
+  if (MatrixFree) Solve_System_MatrixFree(geometry[MESH_0], numerics, config);
+  else Solve_System(geometry[MESH_0], config);
 
   SU2_OMP_PARALLEL {
     SU2_OMP_FOR_STAT(omp_chunk_size)
@@ -665,7 +670,7 @@ void CMeshSolver::BC_Deforming(CGeometry *geometry, const CConfig *config, unsig
       else Sol[iDim] = nodes->GetBound_Disp(iPoint,iDim);
     }
     LinSysSol.SetBlock(iPoint, Sol);
-    Jacobian.EnforceSolutionAtNode(iPoint, Sol, LinSysRes);
+    EnforceSolutionAtNode(iPoint, Sol);
   }
 }
 
@@ -729,7 +734,7 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
       su2double zeros[MAXNVAR] = {0.0};
       nodes->SetSolution(iPoint, zeros);
       LinSysSol.SetBlock(iPoint, zeros);
-      Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+      EnforceSolutionAtNode(iPoint, zeros);
     }
   }
 
@@ -746,7 +751,7 @@ void CMeshSolver::SetBoundaryDisplacements(CGeometry *geometry, CConfig *config,
           su2double zeros[MAXNVAR] = {0.0};
           nodes->SetSolution(iPoint, zeros);
           LinSysSol.SetBlock(iPoint, zeros);
-          Jacobian.EnforceSolutionAtNode(iPoint, zeros, LinSysRes);
+          EnforceSolutionAtNode(iPoint, zeros);
           break;
         }
       }
@@ -120,6 +120,19 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
     specified reference values. ---*/
   SetNondimensionalization(config, iMesh);
 
+  /*--- The mixture state of the fluid model is set point by point, each thread needs its own model. ---*/
+  ThreadFluidModel.resize(omp_get_max_threads());
+  ThreadFluidModel[0] = FluidModel;
+  for (auto iThread = 1ul; iThread < ThreadFluidModel.size(); iThread++)
+    ThreadFluidModel[iThread] = CreateFluidModel(config, nDim, config->GetViscous());
+
+  SplitChemistry = config->GetChemistry_Split() && !config->GetFrozen() && !config->GetMonoatomic();
+
+  /*--- The vib.-el. source of SU2TCLib includes the energy of the species created by the chemistry, from the
+   *    production rates of the source residual, the split stage has to apply it. Mutation++ computes the
+   *    complete energy transfer from the state. ---*/
+  SplitVibCoupling = SplitChemistry && (config->GetKind_FluidModel() == SU2_NONEQ);
+
   /// TODO: This type of variables will be replaced.
 
   AllocateTerribleLegacyTemporaryVariables();
@@ -128,6 +141,10 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 
   Allocate(*config);
 
+  /*--- The point loops are worksharing loops, the edge loops of this solver are not colored
+   *    (HybridParallelInitialization is not used) but the chunk size is still needed. ---*/
+  omp_chunk_size = computeStaticChunkSize(nPoint, omp_get_max_threads(), OMP_MAX_SIZE);
+
   /*--- Allocate Jacobians for implicit time-stepping ---*/
   if (config->GetKind_TimeIntScheme_Flow() == EULER_IMPLICIT) {
 
@@ -232,6 +249,8 @@ CNEMOEulerSolver::CNEMOEulerSolver(CGeometry *geometry, CConfig *config,
 CNEMOEulerSolver::~CNEMOEulerSolver() {
 
   delete node_infty;
+  for (auto iThread = 1ul; iThread < ThreadFluidModel.size(); iThread++)
+    delete ThreadFluidModel[iThread];
   delete FluidModel;
 
 }
@@ -317,14 +336,16 @@ void CNEMOEulerSolver::Preprocessing(CGeometry *geometry, CSolver **solver_conta
 
 unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_container, CConfig *config, bool Output) {
 
+  /*--- Number of non-physical points, local to the thread, needs
+   *    further reduction if function is called in parallel ---*/
   unsigned long nonPhysicalPoints = 0;
-  bool nonphysical = true;
 
+  SU2_OMP_FOR_STAT(omp_chunk_size)
   for (auto iPoint = 0ul; iPoint < nPoint; iPoint ++) {
 
-    /*--- Incompressible flow, primitive variables ---*/
+    /*--- Compressible flow, primitive variables ---*/
 
-    nonphysical = nodes->SetPrimVar(iPoint,FluidModel);
+    bool nonphysical = nodes->SetPrimVar(iPoint, GetFluidModel());
 
     /* Check for non-realizable states for reporting. */
 
@@ -335,6 +356,7 @@ unsigned long CNEMOEulerSolver::SetPrimitive_Variables(CSolver **solver_containe
     if (!Output) LinSysRes.SetBlock_Zero(iPoint);
 
   }
+  END_SU2_OMP_FOR
 
   return nonPhysicalPoints;
 }
@@ -412,6 +434,7 @@ void CNEMOEulerSolver::SetMax_Eigenvalue(CGeometry *geometry, CConfig *config) {
 
 void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                          CConfig *config, unsigned short iMesh, unsigned short iRKStep) {
+  SU2_ZONE_SCOPED_N("Centered_Residual");
 
   CNumerics* numerics = numerics_container[CONV_TERM];
 
@@ -461,6 +484,7 @@ void CNEMOEulerSolver::Centered_Residual(CGeometry *geometry, CSolver **solver_c
 
 void CNEMOEulerSolver::Upwind_Residual(CGeometry *geometry, CSolver **solver_container, CNumerics **numerics_container,
                                        CConfig *config, unsigned short iMesh) {
+  SU2_ZONE_SCOPED_N("Upwind_Residual");
 
   /*--- Set booleans based on config settings ---*/
   const bool implicit         = (config->GetKind_TimeIntScheme() == EULER_IMPLICIT);
@@ -651,23 +675,11 @@ su2double CNEMOEulerSolver::ComputeConsistentExtrapolation(CNEMOGas *fluidmodel,
   const unsigned short T_INDEX   = nSpecies;
   const unsigned short TVE_INDEX = nSpecies+1;
 
-  /*--- Rename density vector ---*/
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-  for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++ ){
-    rhos[iSpecies] = V[iSpecies];
-  }
-
-  /*--- Set new fluid state ---*/
-  fluidmodel->SetTDStateRhosTTv(rhos, V[T_INDEX], V[TVE_INDEX]);
+  /*--- Set new fluid state (the species densities are the first primitive variables) ---*/
+  fluidmodel->SetTDStateRhosTTv(V, V[T_INDEX], V[TVE_INDEX]);
 
   /*---Compute the secondary values ---*/
-  // This block of code copies a vector to corresponding pointer.
-  auto it = val_eves;
-  auto& ref = fluidmodel->ComputeSpeciesEve(V[TVE_INDEX]);
-  for (const auto& v : ref) {
-    *it = v;  ++it;
-  }
+  fluidmodel->ComputeSpeciesEve(V[TVE_INDEX], val_eves);
 
   const su2double val_gamma = fluidmodel->ComputeGamma();
 
@@ -676,10 +688,6 @@ su2double CNEMOEulerSolver::ComputeConsistentExtrapolation(CNEMOGas *fluidmodel,
 
 void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double *V) const {
 
-  /*---Useful variables ---*/
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
-
   /*--- Set Indices ---*/
   //TODO: Move these to a general location
   const unsigned short RHO_INDEX = nodes->GetRhoIndex();
@@ -690,7 +698,6 @@ void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double
   /*--- Set densities and mass fraction ---*/
   for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++){
     U[iSpecies]    = V[iSpecies];
-    rhos[iSpecies] = V[iSpecies];
   }
 
   /*--- Set momentum and compute v^2 ---*/
@@ -700,9 +707,9 @@ void CNEMOEulerSolver::RecomputeConservativeVector(su2double *U, const su2double
     sqvel += V[VEL_INDEX+iDim]*V[VEL_INDEX+iDim];
   }
 
-  /*--- Set the fluidmodel and recompute energies ---*/
-  FluidModel->SetTDStateRhosTTv( rhos, V[T_INDEX], V[TVE_INDEX]);
-  const auto& Energies = FluidModel->ComputeMixtureEnergies();
+  /*--- Recompute energies (does not modify the state of the fluid model) ---*/
+  su2double Energies[2];
+  GetFluidModel()->ComputeMixtureEnergies(V, V[T_INDEX], V[TVE_INDEX], Energies);
 
   /*--- Set conservative energies ---*/
   U[nSpecies+nDim]   = V[RHO_INDEX]*(Energies[0]+0.5*sqvel);
@@ -793,7 +800,7 @@ void CNEMOEulerSolver::Source_Residual(CGeometry *geometry, CSolver **solver_con
     /*--- Compute finite rate chemistry ---*/
 
     if(!monoatomic){
-      if(!frozen){
+      if(!frozen && !SplitChemistry){
         /*--- Compute the non-equilibrium chemistry ---*/
         auto residual = numerics->ComputeChemistry(config);
 
@@ -900,17 +907,23 @@ void CNEMOEulerSolver::ExplicitRK_Iteration(CGeometry *geometry, CSolver **solve
                                             CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<RUNGE_KUTTA_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep == config->GetnRKStep()-1) ChemistryStage(geometry, config);
 }
 
 void CNEMOEulerSolver::ClassicalRK4_Iteration(CGeometry *geometry, CSolver **solver_container,
                                               CConfig *config, unsigned short iRKStep) {
 
   Explicit_Iteration<CLASSICAL_RK4_EXPLICIT>(geometry, solver_container, config, iRKStep);
+
+  if (iRKStep == config->GetnRKStep()-1) ChemistryStage(geometry, config);
 }
 
 void CNEMOEulerSolver::ExplicitEuler_Iteration(CGeometry *geometry, CSolver **solver_container, CConfig *config) {
 
   Explicit_Iteration<EULER_EXPLICIT>(geometry, solver_container, config, 0);
+
+  ChemistryStage(geometry, config);
 }
 
 void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
@@ -926,6 +939,149 @@ void CNEMOEulerSolver::PrepareImplicitIteration(CGeometry *geometry, CSolver**,
 void CNEMOEulerSolver::CompleteImplicitIteration(CGeometry *geometry, CSolver**, CConfig *config) {
 
   CompleteImplicitIteration_impl<true>(geometry, config);
+
+  ChemistryStage(geometry, config);
+}
+
+bool CNEMOEulerSolver::IntegrateChemistry(CNEMOGas *gas, su2double dt, unsigned long maxSubSteps,
+                                          su2double *U, su2double *V) const {
+
+  /*--- Maximum change of a species density in one sub-step, relative to the mixture density,
+   *    and negative densities that are clipped to zero (round-off). ---*/
+  const su2double maxChange = 0.1, negativeTol = 1e-10;
+
+  su2double Utmp[MAXNVAR], dPdU[MAXNVAR], dTdU[MAXNVAR], dTvedU[MAXNVAR], eves[MAXNVAR], cvves[MAXNVAR];
+  su2double evibs[MAXNVAR];
+  su2double jacobian[MAXNVAR][MAXNVAR], matrix[MAXNVAR*MAXNVAR], delta[MAXNVAR];
+  su2double* jacobianRows[MAXNVAR];
+  for (auto iVar = 0ul; iVar < nVar; iVar++) jacobianRows[iVar] = jacobian[iVar];
+
+  su2double remaining = dt, step = dt;
+
+  for (auto iStep = 0ul; (iStep < maxSubSteps) && (remaining > 0.0); iStep++) {
+    step = min(step, remaining);
+
+    /*--- Thermodynamic state (also set in the fluid model) and its derivatives at the start of the sub-step. ---*/
+    for (auto iVar = 0ul; iVar < nVar; iVar++) Utmp[iVar] = U[iVar];
+    if (nodes->Cons2PrimVar(gas, true, Utmp, V, dPdU, dTdU, dTvedU, eves, cvves)) return false;
+
+    /*--- Production rates and their derivatives w.r.t. the conservative variables. ---*/
+    for (auto iVar = 0ul; iVar < nVar; iVar++)
+      for (auto jVar = 0ul; jVar < nVar; jVar++)
+        jacobian[iVar][jVar] = 0.0;
+
+    const auto& ws = gas->ComputeNetProductionRates(true, V, eves, cvves, dTdU, dTvedU, jacobianRows);
+
+    /*--- Backward Euler, only the species densities change: (I/dt - dw/drho_s) delta = w. ---*/
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++) {
+      for (auto jSpecies = 0ul; jSpecies < nSpecies; jSpecies++)
+        matrix[iSpecies*nSpecies+jSpecies] = (iSpecies == jSpecies)/step - jacobian[iSpecies][jSpecies];
+      delta[iSpecies] = ws[iSpecies];
+    }
+
+    /*--- Gaussian elimination with partial pivoting. ---*/
+    bool singular = false;
+    for (auto iSpecies = 0ul; iSpecies < nSpecies && !singular; iSpecies++) {
+      auto pivot = iSpecies;
+      for (auto jSpecies = iSpecies+1; jSpecies < nSpecies; jSpecies++)
+        if (fabs(matrix[jSpecies*nSpecies+iSpecies]) > fabs(matrix[pivot*nSpecies+iSpecies])) pivot = jSpecies;
+
+      if (matrix[pivot*nSpecies+iSpecies] == 0.0) { singular = true; break; }
+
+      if (pivot != iSpecies) {
+        for (auto kSpecies = 0ul; kSpecies < nSpecies; kSpecies++)
+          swap(matrix[iSpecies*nSpecies+kSpecies], matrix[pivot*nSpecies+kSpecies]);
+        swap(delta[iSpecies], delta[pivot]);
+      }
+      for (auto jSpecies = iSpecies+1; jSpecies < nSpecies; jSpecies++) {
+        const su2double factor = matrix[jSpecies*nSpecies+iSpecies] / matrix[iSpecies*nSpecies+iSpecies];
+        for (auto kSpecies = iSpecies; kSpecies < nSpecies; kSpecies++)
+          matrix[jSpecies*nSpecies+kSpecies] -= factor * matrix[iSpecies*nSpecies+kSpecies];
+        delta[jSpecies] -= factor * delta[iSpecies];
+      }
+    }
+    if (!singular) {
+      for (auto iSpecies = nSpecies; iSpecies-- > 0;) {
+        for (auto jSpecies = iSpecies+1; jSpecies < nSpecies; jSpecies++)
+          delta[iSpecies] -= matrix[iSpecies*nSpecies+jSpecies] * delta[jSpecies];
+        delta[iSpecies] /= matrix[iSpecies*nSpecies+iSpecies];
+      }
+    }
+
+    /*--- Accept the sub-step if the densities remain positive and do not change too much. ---*/
+    const su2double rho = V[prim_idx.Density()];
+    bool accept = !singular;
+    for (auto iSpecies = 0ul; iSpecies < nSpecies && accept; iSpecies++) {
+      accept = (U[iSpecies] + delta[iSpecies] >= -negativeTol * rho) &&
+               (fabs(delta[iSpecies]) <= maxChange * rho) && (delta[iSpecies] == delta[iSpecies]);
+    }
+    if (!accept) {
+      step *= 0.5;
+      continue;
+    }
+
+    /*--- Vibrational energy of the created and destroyed species at the start of the sub-step
+     *    (as the chemistry-vibration term of the vib.-el. source). ---*/
+    if (SplitVibCoupling) gas->ComputeSpeciesEve(V[prim_idx.Temperature_ve()], evibs, true);
+
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++) {
+      const su2double rhos = fmax(U[iSpecies] + delta[iSpecies], 0.0);
+      if (SplitVibCoupling) U[nVar-1] += (rhos - U[iSpecies]) * evibs[iSpecies];
+      U[iSpecies] = rhos;
+    }
+
+    remaining -= step;
+    step *= 2.0;
+  }
+  return remaining <= 0.0;
+}
+
+void CNEMOEulerSolver::ChemistryStage(CGeometry *geometry, CConfig *config) {
+
+  if (!SplitChemistry || (MGLevel != MESH_0)) return;
+
+  const auto maxSubSteps = config->GetChemistry_MaxSubSteps();
+  const su2double dt = config->GetDelta_UnstTimeND();
+  CNEMOGas* gas = GetFluidModel();
+
+  ompMasterAssignBarrier(ChemistryFailures, 0);
+  unsigned long failures = 0;
+
+  /*--- Each point is integrated over the physical time step (the stage runs once per time step with TIME_STEPPING),
+   *    keeping the progress of incomplete integrations. ---*/
+
+  SU2_OMP_FOR_DYN(omp_chunk_size)
+  for (auto iPoint = 0ul; iPoint < nPointDomain; iPoint++) {
+    su2double U[MAXNVAR], V[MAXNVAR];
+    for (auto iVar = 0ul; iVar < nVar; iVar++) U[iVar] = nodes->GetSolution(iPoint, iVar);
+    for (auto iVar = 0ul; iVar < nPrimVar; iVar++) V[iVar] = nodes->GetPrimitive(iPoint, iVar);
+
+    failures += !IntegrateChemistry(gas, dt, maxSubSteps, U, V);
+
+    for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
+      nodes->SetSolution(iPoint, iSpecies, U[iSpecies]);
+    nodes->SetSolution(iPoint, nVar-1, U[nVar-1]);
+  }
+  END_SU2_OMP_FOR
+
+  SU2_OMP_ATOMIC
+  ChemistryFailures += failures;
+
+  InitiateComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+  CompleteComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+
+  BEGIN_SU2_OMP_SAFE_GLOBAL_ACCESS
+  {
+    if (config->GetComm_Level() == COMM_FULL) {
+      unsigned long tmp = ChemistryFailures;
+      SU2_MPI::Allreduce(&tmp, &ChemistryFailures, 1, MPI_UNSIGNED_LONG, MPI_SUM, SU2_MPI::GetComm());
+
+      if ((rank == MASTER_NODE) && (ChemistryFailures != 0))
+        cout << "Warning. The split chemistry did not complete the time step at " << ChemistryFailures
+             << " points." << endl;
+    }
+  }
+  END_SU2_OMP_SAFE_GLOBAL_ACCESS
 }
 
 void CNEMOEulerSolver::ComputeUnderRelaxationFactor(const CConfig *config) {
@@ -982,6 +1138,26 @@ void CNEMOEulerSolver::ComputeUnderRelaxationFactor(const CConfig *config) {
   END_SU2_OMP_FOR
 }
 
+CNEMOGas* CNEMOEulerSolver::CreateFluidModel(const CConfig *config, unsigned short nDim, bool viscous) {
+
+  CNEMOGas* model = nullptr;
+
+  switch (config->GetKind_FluidModel()) {
+  case MUTATIONPP:
+   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
+     model = new CMutationTCLib(config, nDim);
+   #else
+     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
+     CURRENT_FUNCTION);
+   #endif
+   break;
+  case SU2_NONEQ:
+   model = new CSU2TCLib(config, nDim, viscous);
+   break;
+  }
+  return model;
+}
+
 void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short iMesh) {
 
   su2double
@@ -1023,19 +1199,7 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   config->SetConductivity_Ref(1.0);
 
   /*--- Instatiate the fluid model ---*/
-  switch (config->GetKind_FluidModel()) {
-  case MUTATIONPP:
-   #if defined(HAVE_MPP) && !defined(CODI_REVERSE_TYPE) && !defined(CODI_FORWARD_TYPE)
-     FluidModel = new CMutationTCLib(config, nDim);
-   #else
-     SU2_MPI::Error(string("Either 1) Mutation++ has not been configured/compiled (add '-Denable-mpp=true' to your meson string) or 2) CODI must be deactivated since it is not compatible with Mutation++."),
-     CURRENT_FUNCTION);
-   #endif
-   break;
-  case SU2_NONEQ:
-   FluidModel = new CSU2TCLib(config, nDim, viscous);
-   break;
-  }
+  FluidModel = CreateFluidModel(config, nDim, viscous);
 
   /*--- Compute the Free Stream Pressure, Temperatrue, and Density ---*/
   Pressure_FreeStream        = config->GetPressure_FreeStream();
@@ -1079,7 +1243,12 @@ void CNEMOEulerSolver::SetNondimensionalization(CConfig *config, unsigned short
   ModVel_FreeStream = sqrt(ModVel_FreeStream); config->SetModVel_FreeStream(ModVel_FreeStream);
 
   /*--- Calculate energies ---*/
-  const auto& energies = FluidModel->ComputeMixtureEnergies();
+  vector<su2double> Rhos_FreeStream(nSpecies);
+  for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies++)
+    Rhos_FreeStream[iSpecies] = MassFrac_Inf[iSpecies]*Density_FreeStream;
+  su2double energies[2];
+  FluidModel->ComputeMixtureEnergies(Rhos_FreeStream.data(), Temperature_FreeStream, Temperature_ve_FreeStream,
+                                     energies);
 
   /*--- Viscous initialization ---*/
   if (viscous) {
@@ -1893,8 +2062,7 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
                                  CNumerics *conv_numerics, CNumerics *visc_numerics, CConfig *config, unsigned short val_marker) {
 
   su2double UnitNormal[MAXNDIM] = {0.0};
-  vector<su2double> rhos;
-  rhos.resize(nSpecies,0.0);
+  CNEMOGas* gas = GetFluidModel();
 
   string Marker_Tag = config->GetMarker_All_TagBound(val_marker);
   const bool dynamic_grid = config->GetGrid_Movement();
@@ -2019,7 +2187,6 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
         /*--- Primitive variables, using the derived quantities ---*/
         for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies ++) {
           V_outlet[iSpecies] = Ys[iSpecies]*Density;
-          rhos[iSpecies] = V_outlet[iSpecies];
         }
 
         V_outlet[T_INDEX] = V_domain[T_INDEX];
@@ -2034,11 +2201,12 @@ void CNEMOEulerSolver::BC_Outlet(CGeometry *geometry, CSolver **solver_container
         V_outlet[A_INDEX]     = SoundSpeed;
 
         /*--- Set mixture state and compute quantities ---*/
-        FluidModel->SetTDStateRhosTTv(rhos, Temperature, Tve);
-        V_outlet[RHOCVTR_INDEX] = FluidModel->ComputerhoCvtr();
-        V_outlet[RHOCVVE_INDEX] = FluidModel->ComputerhoCvve();
+        gas->SetTDStateRhosTTv(V_outlet, Temperature, Tve);
+        V_outlet[RHOCVTR_INDEX] = gas->ComputerhoCvtr();
+        V_outlet[RHOCVVE_INDEX] = gas->ComputerhoCvve();
 
-        const auto& energies = FluidModel->ComputeMixtureEnergies();
+        su2double energies[2];
+        gas->ComputeMixtureEnergies(V_outlet, Temperature, Tve, energies);
 
         /*--- Conservative variables, using the derived quantities ---*/
         for (auto iSpecies = 0ul; iSpecies < nSpecies; iSpecies ++){
@@ -2162,10 +2330,11 @@ void CNEMOEulerSolver::BC_Supersonic_Inlet(
   }
 
   /*--- Set mixture state ---*/
-  FluidModel->SetTDStatePTTv(Pressure, Mass_Frac, Temperature, Temperature_ve);
+  CNEMOGas* gas = GetFluidModel();
+  gas->SetTDStatePTTv(Pressure, Mass_Frac, Temperature, Temperature_ve);
 
   /*--- Compute Ma vector for flow direction ---*/
-  const su2double soundspeed = FluidModel->ComputeSoundSpeed();
+  const su2double soundspeed = gas->ComputeSoundSpeed();
 
   su2double Mvec[MAXNDIM] = {0.0};
 
@@ -2175,8 +2344,8 @@ void CNEMOEulerSolver::BC_Supersonic_Inlet(
   /*--- Allocate inlet node to compute gradients for numerics ---*/
   CNEMOEulerVariable node_inlet(Pressure, Mass_Frac, Mvec, Temperature,
                                 Temperature_ve, 1, nDim, nVar, nPrimVar,
-                                nPrimVarGrad, config, FluidModel);
-  node_inlet.SetPrimVar(0, FluidModel);
+                                nPrimVarGrad, config, gas);
+  node_inlet.SetPrimVar(0, gas);
 
   su2double Normal[MAXNDIM] = {0.0};
 
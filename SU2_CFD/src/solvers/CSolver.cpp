@@ -1335,6 +1335,7 @@ void CSolver::GetCommCountAndType(const CConfig* config,
       break;
     case MPI_QUANTITIES::MAX_EIGENVALUE:
     case MPI_QUANTITIES::SENSOR:
+    case MPI_QUANTITIES::DELTA_TIME:
       COUNT_PER_POINT  = 1;
       MPI_TYPE         = COMM_TYPE_DOUBLE;
       break;
@@ -1406,6 +1407,7 @@ namespace CommHelpers {
 void CSolver::InitiateComms(CGeometry *geometry,
                             const CConfig *config,
                             MPI_QUANTITIES commType) {
+  SU2_ZONE_SCOPED_N("Solver_InitiateComms");
 
   /*--- Local variables ---*/
 
@@ -1498,6 +1500,9 @@ void CSolver::InitiateComms(CGeometry *geometry,
           case MPI_QUANTITIES::SENSOR:
             bufDSend[buf_offset] = base_nodes->GetSensor(iPoint);
             break;
+          case MPI_QUANTITIES::DELTA_TIME:
+            bufDSend[buf_offset] = base_nodes->GetDelta_Time(iPoint);
+            break;
           case MPI_QUANTITIES::SOLUTION_GRADIENT:
           case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
           case MPI_QUANTITIES::SOLUTION_GRAD_REC:
@@ -1548,6 +1553,7 @@ void CSolver::InitiateComms(CGeometry *geometry,
 void CSolver::CompleteComms(CGeometry *geometry,
                             const CConfig *config,
                             MPI_QUANTITIES commType) {
+  SU2_ZONE_SCOPED_N("Solver_CompleteComms");
 
   /*--- Local variables ---*/
 
@@ -1556,19 +1562,12 @@ void CSolver::CompleteComms(CGeometry *geometry,
   unsigned short COUNT_PER_POINT = 0;
   unsigned short MPI_TYPE = 0;
 
-  int ind, source, iMessage, jRecv;
-
-  /*--- Global status so all threads can see the result of Waitany. ---*/
-  static SU2_MPI::Status status;
+  int source, iMessage, jRecv;
 
   /*--- Set the size of the data packet and type depending on quantity. ---*/
 
   GetCommCountAndType(config, commType, COUNT_PER_POINT, MPI_TYPE);
 
-  /*--- Set some local pointers to make access simpler. ---*/
-
-  const su2double *bufDRecv = geometry->bufD_P2PRecv;
-
   /*--- Handle the different types of gradient and limiter. ---*/
 
   const auto nVarGrad = COUNT_PER_POINT / nDim;
@@ -1585,11 +1584,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
       /*--- For efficiency, recv the messages dynamically based on
        the order they arrive. ---*/
 
-      SU2_OMP_SAFE_GLOBAL_ACCESS(SU2_MPI::Waitany(geometry->nP2PRecv, geometry->req_P2PRecv, &ind, &status);)
-
       /*--- Once we have recv'd a message, get the source rank. ---*/
 
-      source = status.MPI_SOURCE;
+      source = geometry->WaitAnyP2PRecv(MPI_TYPE, COUNT_PER_POINT, false);
 
       /*--- We know the offsets based on the source rank. ---*/
 
@@ -1604,6 +1601,10 @@ void CSolver::CompleteComms(CGeometry *geometry,
       nRecv = (geometry->nPoint_P2PRecv[jRecv+1] -
                geometry->nPoint_P2PRecv[jRecv]);
 
+      /*--- Set a local pointer to the start of the message to make access simpler. ---*/
+
+      const su2double *bufDRecv = geometry->GetP2PRecvBufferD(source, COUNT_PER_POINT, false);
+
       SU2_OMP_FOR_STAT(OMP_MIN_SIZE)
       for (iRecv = 0; iRecv < nRecv; iRecv++) {
 
@@ -1611,9 +1612,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
 
         iPoint = geometry->Local_Point_P2PRecv[msg_offset + iRecv];
 
-        /*--- Compute the offset in the recv buffer for this point. ---*/
+        /*--- Compute the offset in the message for this point. ---*/
 
-        buf_offset = (msg_offset + iRecv)*COUNT_PER_POINT;
+        buf_offset = iRecv*COUNT_PER_POINT;
 
         /*--- Store the data correctly depending on the quantity. ---*/
 
@@ -1646,6 +1647,9 @@ void CSolver::CompleteComms(CGeometry *geometry,
           case MPI_QUANTITIES::SENSOR:
             base_nodes->SetSensor(iPoint,bufDRecv[buf_offset]);
             break;
+          case MPI_QUANTITIES::DELTA_TIME:
+            base_nodes->SetDelta_Time(iPoint,bufDRecv[buf_offset]);
+            break;
           case MPI_QUANTITIES::SOLUTION_GRADIENT:
           case MPI_QUANTITIES::PRIMITIVE_GRADIENT:
           case MPI_QUANTITIES::SOLUTION_GRAD_REC:
@@ -1683,6 +1687,8 @@ void CSolver::CompleteComms(CGeometry *geometry,
         }
       }
       END_SU2_OMP_FOR
+
+      geometry->ReleaseP2PRecv(MPI_TYPE, source, false);
     }
 
     /*--- Verify that all non-blocking point-to-point sends have finished.
@@ -97,7 +97,11 @@ CNEMOEulerVariable::CNEMOEulerVariable(su2double val_pressure,
   const su2double rho = fluidmodel->GetDensity();
   const su2double soundspeed = fluidmodel->ComputeSoundSpeed();
   const su2double sqvel = GeometryToolbox::SquaredNorm(nDim, val_mach) * pow(soundspeed,2);
-  const auto& energies = fluidmodel->ComputeMixtureEnergies();
+  vector<su2double> rhos(nSpecies);
+  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++)
+    rhos[iSpecies] = rho*val_massfrac[iSpecies];
+  su2double energies[2];
+  fluidmodel->ComputeMixtureEnergies(rhos.data(), val_temperature, val_temperature_ve, energies);
 
   /*--- Loop over all points --*/
   for(unsigned long iPoint = 0; iPoint < nPoint; ++iPoint){
@@ -141,10 +145,11 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
 
   unsigned short iVar;
 
-  fluidmodel = static_cast<CNEMOGas*>(FluidModel);
+  /*--- The fluid model is not stored, each thread passes its own. ---*/
+  auto* gas = static_cast<CNEMOGas*>(FluidModel);
 
   /*--- Convert conserved to primitive variables ---*/
-  bool nonPhys = Cons2PrimVar(Solution[iPoint], Primitive[iPoint],
+  bool nonPhys = Cons2PrimVar(gas, implicit, Solution[iPoint], Primitive[iPoint],
                               dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
 
   /*--- Reset solution to previous one, if nonphys ---*/
@@ -153,28 +158,25 @@ bool CNEMOEulerVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidMode
       Solution(iPoint,iVar) = Solution_Old(iPoint,iVar);
 
     /*--- Recompute Primitive from previous solution ---*/
-    Cons2PrimVar(Solution[iPoint], Primitive[iPoint],
-                   dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
+    Cons2PrimVar(gas, implicit, Solution[iPoint], Primitive[iPoint],
+                 dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
   }
 
   /*--- Set additional point quantities ---*/
-  Gamma(iPoint) = fluidmodel->ComputeGamma();
+  Gamma(iPoint) = gas->ComputeGamma();
 
   SetVelocity2(iPoint);
 
   return nonPhys;
 }
 
-bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
+bool CNEMOEulerVariable::Cons2PrimVar(CNEMOGas *gas, bool derivatives, su2double *U, su2double *V,
                                       su2double *val_dPdU, su2double *val_dTdU,
                                       su2double *val_dTvedU, su2double *val_eves,
-                                      su2double *val_Cvves) {
+                                      su2double *val_Cvves) const {
 
   unsigned short iDim, iSpecies;
   su2double Tmin, Tmax, Tvemin, Tvemax;
-  vector<su2double> rhos;
-
-  rhos.resize(nSpecies,0.0);
 
   /*--- Conserved & primitive vector layout ---*/
   // U:  [rho1, ..., rhoNs, rhou, rhov, rhow, rhoe, rhoeve]^T
@@ -199,17 +201,16 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
     if (U[iSpecies] < 0.0) {
       U[iSpecies]            = 1E-20;
       V[RHOS_INDEX+iSpecies] = 1E-20;
-      rhos[iSpecies]         = 1E-20;
     //nonPhys                = true;
     } else {
       V[RHOS_INDEX+iSpecies] = U[iSpecies];
-      rhos[iSpecies]         = U[iSpecies];
     }
     V[RHO_INDEX]            += U[iSpecies];
   }
 
   // Rename for convenience
   su2double rho = V[RHO_INDEX];
+  const su2double* rhos = &V[RHOS_INDEX];
 
   /*--- Assign velocity^2 ---*/
   su2double sqvel = 0.0;
@@ -220,7 +221,8 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
 
   /*--- Assign temperatures ---*/
   const su2double Tve_old = V[TVE_INDEX];
-  const auto& T = fluidmodel->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel, Tve_old);
+  su2double T[2];
+  gas->ComputeTemperatures(rhos, rhoE, rhoEve, 0.5*rho*sqvel, Tve_old, T);
 
   /*--- Temperatures ---*/
   V[T_INDEX]   = T[0];
@@ -239,21 +241,16 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
   else {V[TVE_INDEX] = Tve_Freestream;}
 
   // Determine other properties of the mixture at the current state
-  fluidmodel->SetTDStateRhosTTv(rhos, V[T_INDEX], V[TVE_INDEX]);
-
-  const auto& cvves = fluidmodel->ComputeSpeciesCvVibEle(V[TVE_INDEX]);
-  vector<su2double> eves  = fluidmodel->ComputeSpeciesEve(V[TVE_INDEX]);
+  gas->SetTDStateRhosTTv(rhos, V[T_INDEX], V[TVE_INDEX]);
 
-  for (iSpecies = 0; iSpecies < nSpecies; iSpecies++) {
-    val_eves[iSpecies]  = eves[iSpecies];
-    val_Cvves[iSpecies] = cvves[iSpecies];
-  }
+  gas->ComputeSpeciesCvVibEle(V[TVE_INDEX], val_Cvves);
+  gas->ComputeSpeciesEve(V[TVE_INDEX], val_eves);
 
-  V[RHOCVTR_INDEX] = fluidmodel->ComputerhoCvtr();
-  V[RHOCVVE_INDEX] = fluidmodel->ComputerhoCvve();
+  V[RHOCVTR_INDEX] = gas->ComputerhoCvtr();
+  V[RHOCVVE_INDEX] = gas->ComputerhoCvve();
 
   /*--- Pressure ---*/
-  V[P_INDEX] = fluidmodel->ComputePressure();
+  V[P_INDEX] = gas->ComputePressure();
 
   if (V[P_INDEX] < 0.0) {
     V[P_INDEX] = 1E-20;
@@ -261,14 +258,14 @@ bool CNEMOEulerVariable::Cons2PrimVar(su2double *U, su2double *V,
   }
 
   /*--- Partial derivatives of pressure and temperature ---*/
-  if(implicit){
-    fluidmodel->ComputedPdU  (V, eves, val_dPdU  );
-    fluidmodel->ComputedTdU  (V, val_dTdU );
-    fluidmodel->ComputedTvedU(V, eves, val_dTvedU);
+  if(derivatives){
+    gas->ComputedPdU  (V, val_eves, val_dPdU  );
+    gas->ComputedTdU  (V, val_dTdU );
+    gas->ComputedTvedU(V, val_eves, val_dTvedU);
   }
 
   /*--- Sound speed ---*/
-  V[A_INDEX] = fluidmodel->ComputeSoundSpeed();
+  V[A_INDEX] = gas->ComputeSoundSpeed();
 
   /*--- Enthalpy ---*/
   V[H_INDEX] = (U[nSpecies+nDim] + V[P_INDEX])/V[RHO_INDEX];
@@ -78,10 +78,11 @@ CNEMONSVariable::CNEMONSVariable(su2double val_pressure,
 
 bool CNEMONSVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel) {
 
-  fluidmodel = static_cast<CNEMOGas*>(FluidModel);
+  /*--- The fluid model is not stored, each thread passes its own. ---*/
+  auto* gas = static_cast<CNEMOGas*>(FluidModel);
 
   /*--- Convert conserved to primitive variables ---*/
-  bool nonPhys = Cons2PrimVar(Solution[iPoint], Primitive[iPoint], dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
+  bool nonPhys = Cons2PrimVar(gas, implicit, Solution[iPoint], Primitive[iPoint], dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
 
   /*--- Reset solution to previous one, if nonphys ---*/
   if (nonPhys) {
@@ -89,29 +90,26 @@ bool CNEMONSVariable::SetPrimVar(unsigned long iPoint, CFluidModel *FluidModel)
       Solution(iPoint,iVar) = Solution_Old(iPoint,iVar);
 
     /*--- Recompute Primitive from previous solution ---*/
-    Cons2PrimVar(Solution[iPoint], Primitive[iPoint], dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
+    Cons2PrimVar(gas, implicit, Solution[iPoint], Primitive[iPoint], dPdU[iPoint], dTdU[iPoint], dTvedU[iPoint], eves[iPoint], Cvves[iPoint]);
   }
 
   /*--- Set additional point quantities ---*/
-  Gamma(iPoint) = fluidmodel->ComputeGamma();
+  Gamma(iPoint) = gas->ComputeGamma();
 
   SetVelocity2(iPoint);
 
-  const auto& Ds = fluidmodel->GetDiffusionCoeff();
-  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
-    DiffusionCoeff(iPoint, iSpecies) = Ds[iSpecies];
+  gas->GetDiffusionCoeff(DiffusionCoeff[iPoint]);
 
   su2double T   =  Primitive(iPoint,nSpecies);
   su2double Tve =  Primitive(iPoint,nSpecies+1);
 
   su2double* val_eves = GetEve(iPoint);
-  const auto& hs = fluidmodel->ComputeSpeciesEnthalpy(T, Tve, val_eves);
-  for (auto iSpecies = 0u; iSpecies < nSpecies; iSpecies++)
-    Enthalpys(iPoint, iSpecies) = hs[iSpecies];
+  gas->ComputeSpeciesEnthalpy(T, Tve, val_eves, Enthalpys[iPoint]);
 
-  LaminarViscosity(iPoint) = fluidmodel->GetViscosity();
+  LaminarViscosity(iPoint) = gas->GetViscosity();
 
-  const auto& thermalconductivities = fluidmodel->GetThermalConductivities();
+  su2double thermalconductivities[2];
+  gas->GetThermalConductivities(thermalconductivities);
   ThermalCond(iPoint)      = thermalconductivities[0];
   ThermalCond_ve(iPoint)   = thermalconductivities[1];
 
@@ -36,6 +36,12 @@ class CDiscAdjDeformationDriver : public CDriverBase {
  protected:
   su2double** Gradient;
 
+  passivedouble TimeMeshSensitivity = 0.0, /*!< \brief Wall time of the mesh sensitivity (volume deformation adjoint). */
+      TimeRecording = 0.0,                 /*!< \brief Wall time of recording the surface deformation. */
+      TimeReverseSweep = 0.0,              /*!< \brief Wall time of seeding and evaluating the deformation tape. */
+      TimeReduction = 0.0,                 /*!< \brief Wall time of extracting and reducing the DV gradients. */
+      TimeProjection = 0.0;                /*!< \brief Wall time of the whole projection onto the DVs. */
+
  public:
   /*!
    * \brief Constructor of the class.
@@ -93,6 +99,11 @@ class CDiscAdjDeformationDriver : public CDriverBase {
    */
   void SetProjection_AD(CGeometry* geometry, CConfig* config, CSurfaceMovement* surface_movement, su2double** Gradient);
 
+  /*!
+   * \brief Print the wall time spent in each phase of the gradient computation (maximum over ranks).
+   */
+  void PrintTimeBreakdown() const;
+
   /*!
    * \brief Prints the gradient information to a file.
    * \param[in] Gradient - The gradient data.
@@ -299,6 +299,8 @@ void CDiscAdjDeformationDriver::Preprocess() {
 }
 
 void CDiscAdjDeformationDriver::Run() {
+  auto StartPhase = SU2_MPI::Wtime();
+
   for (iZone = 0; iZone < nZone; iZone++) {
     if (!config_container[iZone]->GetDiscrete_Adjoint()) {
       continue;
@@ -315,6 +317,8 @@ void CDiscAdjDeformationDriver::Run() {
     }
   }
 
+  TimeMeshSensitivity = SU2_MPI::Wtime() - StartPhase;
+
   if (config_container[ZONE_0]->GetDiscrete_Adjoint()) {
     if (rank == MASTER_NODE)
       cout << "\n------------------------ Mesh sensitivity Output ------------------------" << endl;
@@ -342,6 +346,8 @@ void CDiscAdjDeformationDriver::Run() {
 
       /*--- If AD mode is enabled we can use it to compute the projection, otherwise we use finite differences. ---*/
 
+      StartPhase = SU2_MPI::Wtime();
+
       if (config_container[iZone]->GetAD_Mode()) {
         if (config_container[iZone]->GetSmoothGradient()) {
           DerivativeTreatment_Gradient(geometry_container[iZone][INST_0][MESH_0], config_container[iZone],
@@ -354,6 +360,8 @@ void CDiscAdjDeformationDriver::Run() {
         SetProjection_FD(geometry_container[iZone][INST_0][MESH_0], config_container[iZone], surface_movement[iZone],
                          Gradient);
       }
+
+      TimeProjection += SU2_MPI::Wtime() - StartPhase;
     }
   }
 
@@ -364,6 +372,8 @@ void CDiscAdjDeformationDriver::Run() {
   /*--- Print gradients to screen and writes to file. ---*/
 
   OutputGradient(Gradient, config_container[ZONE_0], Gradient_file);
+
+  PrintTimeBreakdown();
 }
 
 void CDiscAdjDeformationDriver::Finalize() {
@@ -650,7 +660,7 @@ void CDiscAdjDeformationDriver::SetProjection_FD(CGeometry* geometry, CConfig* c
 
 void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* config,
                                                  CSurfaceMovement* surface_movement, su2double** Gradient) {
-  su2double *VarCoord = nullptr, Sensitivity, my_Gradient, localGradient, *Normal, Area = 0.0;
+  su2double *VarCoord = nullptr, Sensitivity, *Normal, Area = 0.0;
   unsigned short iDV_Value = 0, iMarker, nMarker, iDim, nDim, iDV, nDV;
   unsigned long iVertex, nVertex, iPoint;
 
@@ -667,7 +677,10 @@ void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* c
          << "Evaluate functional gradient using Algorithmic Differentiation (ZONE " << config->GetiZone() << ")."
          << endl;
 
-  /*--- Start recording of operations. ---*/
+  /*--- Start recording of operations. The surface deformation is recorded once for all design variables, which are
+   * then differentiated together by a single reverse sweep. ---*/
+
+  auto StartPhase = SU2_MPI::Wtime();
 
   AD::StartRecording();
 
@@ -690,6 +703,9 @@ void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* c
 
   AD::StopRecording();
 
+  TimeRecording += SU2_MPI::Wtime() - StartPhase;
+  StartPhase = SU2_MPI::Wtime();
+
   /*--- Create a structure to identify points that have been already visited.
    * We need that to make sure to set the sensitivity of surface points only once.
    * Markers share points, so we would visit them more than once in the loop over the markers below). ---*/
@@ -732,12 +748,27 @@ void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* c
 
   AD::ComputeAdjoint();
 
+  TimeReverseSweep += SU2_MPI::Wtime() - StartPhase;
+  StartPhase = SU2_MPI::Wtime();
+
+  /*--- Gather the derivatives of all design variables and reduce them with a single collective call. ---*/
+
+  vector<passivedouble> my_Gradient, localGradient;
+
   for (iDV = 0; iDV < nDV; iDV++) {
     for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
-      my_Gradient = SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value));
+      my_Gradient.push_back(SU2_TYPE::GetDerivative(config->GetDV_Value(iDV, iDV_Value)));
+    }
+  }
+  localGradient.resize(my_Gradient.size());
 
-      SU2_MPI::Allreduce(&my_Gradient, &localGradient, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  /*--- The derivatives are passive, they must not go through the AD-aware MPI wrapper. ---*/
+  SelectMPIWrapper<passivedouble>::W::Allreduce(my_Gradient.data(), localGradient.data(), my_Gradient.size(),
+                                                MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
 
+  auto iGradient = 0ul;
+  for (iDV = 0; iDV < nDV; iDV++) {
+    for (iDV_Value = 0; iDV_Value < config->GetnDV_Value(iDV); iDV_Value++) {
       /*--- Angle of Attack design variable (this is different, the value comes form the input file). ---*/
 
       if ((config->GetDesign_Variable(iDV) == ANGLE_OF_ATTACK) ||
@@ -745,11 +776,43 @@ void CDiscAdjDeformationDriver::SetProjection_AD(CGeometry* geometry, CConfig* c
         Gradient[iDV][iDV_Value] = config->GetAoA_Sens();
       }
 
-      Gradient[iDV][iDV_Value] += localGradient;
+      Gradient[iDV][iDV_Value] += localGradient[iGradient++];
     }
   }
 
   AD::Reset();
+
+  TimeReduction += SU2_MPI::Wtime() - StartPhase;
+}
+
+void CDiscAdjDeformationDriver::PrintTimeBreakdown() const {
+  /*--- Phases are timed on every rank, report the slowest one. ---*/
+
+  const passivedouble localTimes[] = {TimeMeshSensitivity, TimeRecording, TimeReverseSweep, TimeReduction,
+                                      TimeProjection};
+  constexpr int nTimes = sizeof(localTimes) / sizeof(passivedouble);
+  passivedouble maxTimes[nTimes];
+
+  SelectMPIWrapper<passivedouble>::W::Allreduce(localTimes, maxTimes, nTimes, MPI_DOUBLE, MPI_MAX,
+                                                SU2_MPI::GetComm());
+
+  /*--- Phases that did not run (e.g. the tape phases with finite differences) are not reported. ---*/
+  if (rank != MASTER_NODE || std::none_of(maxTimes, maxTimes + nTimes, [](passivedouble t) { return t > 0.0; }))
+    return;
+
+  const string names[] = {"Mesh sensitivity", "Deformation recording", "Reverse sweep", "Gradient reduction",
+                          "Total projection"};
+
+  cout << endl;
+  PrintingToolbox::CTablePrinter TimeTable(&std::cout);
+  TimeTable.AddColumn("Gradient evaluation phase", 30);
+  TimeTable.AddColumn("Wall time (s)", 15);
+  TimeTable.SetAlign(PrintingToolbox::CTablePrinter::RIGHT);
+  TimeTable.PrintHeader();
+  for (int iTime = 0; iTime < nTimes; ++iTime) {
+    if (maxTimes[iTime] > 0.0) TimeTable << names[iTime] << maxTimes[iTime];
+  }
+  TimeTable.PrintFooter();
 }
 
 void CDiscAdjDeformationDriver::OutputGradient(su2double** Gradient, CConfig* config, ofstream& Gradient_file) {
@@ -93,6 +93,29 @@ const unsigned int ZONE_0 = 0; /*!< \brief Definition of the first grid domain.
 const unsigned int ZONE_1 = 1; /*!< \brief Definition of the first grid domain. */
 
 %include "../../Common/include/containers/CPyWrapperMatrixView.hpp"
+
+// Zero-copy access to the storage of the matrix views via the NumPy array interface, e.g.
+// numpy.asarray(driver.Solution(iSol)) or driver.Primitives().Array() (domain nodes only).
+// The arrays alias solver memory, they must not be used after the driver is finalized.
+%define PY_WRAPPER_ARRAY_INTERFACE(CLASS)
+%extend CLASS {
+%pythoncode %{
+  @property
+  def __array_interface__(self):
+      import sys
+      order = "<" if sys.byteorder == "little" else ">"
+      return {"version": 3, "shape": tuple(self.Shape()), "typestr": order + "f" + str(self.ItemSize()),
+              "data": (self.DataAddress(), self.IsReadOnly()), "strides": tuple(self.ByteStrides())}
+
+  def Array(self, halos=False):
+      import numpy
+      array = numpy.asarray(self)
+      return array if halos else array[:self.DomainRows()]
+%}
+}
+%enddef
+PY_WRAPPER_ARRAY_INTERFACE(CPyWrapperMatrixView)
+PY_WRAPPER_ARRAY_INTERFACE(CPyWrapper3DMatrixView)
 %include "../../SU2_CFD/include/drivers/CDriverBase.hpp"
 %include "../../SU2_CFD/include/drivers/CDriver.hpp"
 %include "../../SU2_CFD/include/drivers/CSinglezoneDriver.hpp"
@@ -306,6 +306,24 @@ def main():
     flatplate.test_vals = [-7.613292, -2.141207, 0.001084, 0.036230, 2.361500, -2.325300, 0.000000, 0.000000]
     test_list.append(flatplate)
 
+    # Laminar flat plate with multigrid on a generated mesh, without and with the halos of all the levels exchanged
+    # through shared memory (and the node-aware mapping of the partitions), the results must be the same.
+    flatplate_mg           = TestCase('flatplate_mg')
+    flatplate_mg.cfg_dir   = "navierstokes/shared_memory_halo"
+    flatplate_mg.cfg_file  = "lam_flatplate.cfg"
+    flatplate_mg.test_iter = 19
+    flatplate_mg.test_vals = [-4.710891, -1.916489, -2.546405, 0.641174, 0.282729]
+    flatplate_mg.command   = TestCase.Command("mpirun -n 4", "SU2_CFD")
+    test_list.append(flatplate_mg)
+
+    flatplate_shm           = TestCase('flatplate_shm')
+    flatplate_shm.cfg_dir   = "navierstokes/shared_memory_halo"
+    flatplate_shm.cfg_file  = "lam_flatplate_shm.cfg"
+    flatplate_shm.test_iter = 19
+    flatplate_shm.test_vals = [-4.710891, -1.916489, -2.546405, 0.641174, 0.282729]
+    flatplate_shm.command   = TestCase.Command("mpirun -n 4", "SU2_CFD")
+    test_list.append(flatplate_shm)
+
     # Custom objective function
     flatplate_udobj           = TestCase('flatplate_udobj')
     flatplate_udobj.cfg_dir   = "user_defined_functions"
@@ -936,6 +954,34 @@ def main():
     harmonic_balance.test_vals = [-1.559187, 0.829575, 0.931512, 3.954440]
     test_list.append(harmonic_balance)
 
+    # Pitching wall on a generated mesh, with the instances iterated by all ranks and concurrently by 2 groups of 2
+    # ranks. Jacobi preconditioning makes the results independent of the partitions and the instances are exchanged
+    # exactly, so both cases must give the same results.
+    harmonic_balance_rectangle           = TestCase('harmonic_balance_rectangle')
+    harmonic_balance_rectangle.cfg_dir   = "harmonic_balance/instance_groups"
+    harmonic_balance_rectangle.cfg_file  = "HB_rectangle.cfg"
+    harmonic_balance_rectangle.test_iter = 25
+    harmonic_balance_rectangle.test_vals = [-2.391104, -0.018702, 0.108398, 3.088510]
+    harmonic_balance_rectangle.command   = TestCase.Command("mpirun -n 2", "SU2_CFD")
+    test_list.append(harmonic_balance_rectangle)
+
+    harmonic_balance_groups           = TestCase('harmonic_balance_groups')
+    harmonic_balance_groups.cfg_dir   = "harmonic_balance/instance_groups"
+    harmonic_balance_groups.cfg_file  = "HB_instance_groups.cfg"
+    harmonic_balance_groups.test_iter = 25
+    harmonic_balance_groups.test_vals = [-2.391104, -0.018702, 0.108398, 3.088510]
+    harmonic_balance_groups.command   = TestCase.Command("mpirun -n 4", "SU2_CFD")
+    test_list.append(harmonic_balance_groups)
+
+    # Same with the halos of the ranks of each group exchanged through shared memory.
+    harmonic_balance_groups_shm           = TestCase('harmonic_balance_groups_shm')
+    harmonic_balance_groups_shm.cfg_dir   = "harmonic_balance/instance_groups"
+    harmonic_balance_groups_shm.cfg_file  = "HB_instance_groups_shm.cfg"
+    harmonic_balance_groups_shm.test_iter = 25
+    harmonic_balance_groups_shm.test_vals = [-2.391104, -0.018702, 0.108398, 3.088510]
+    harmonic_balance_groups_shm.command   = TestCase.Command("mpirun -n 4", "SU2_CFD")
+    test_list.append(harmonic_balance_groups_shm)
+
     # Turbulent pitching NACA 64a010 airfoil
     hb_rans_preconditioning           = TestCase('hb_rans_preconditioning')
     hb_rans_preconditioning.cfg_dir   = "harmonic_balance/hb_rans_preconditioning"
@@ -1031,6 +1077,18 @@ def main():
     flatplate_unsteady.unsteady  = True
     test_list.append(flatplate_unsteady)
 
+    # Parareal with as many iterations as time slabs, the script compares the solution with serial time marching
+    # and fails if they differ by more than round-off (2 slabs of 2 ranks), then prints the residuals of the last
+    # time step which are compared with the reference values.
+    parareal_vs_serial           = TestCase('parareal_vs_serial')
+    parareal_vs_serial.cfg_dir   = "parareal"
+    parareal_vs_serial.cfg_file  = "lam_channel.cfg"
+    parareal_vs_serial.test_iter = 7
+    parareal_vs_serial.test_vals = [-8.135010, -5.395367, -5.969210, -2.675927]
+    parareal_vs_serial.unsteady  = True
+    parareal_vs_serial.command   = TestCase.Command(exec = "python", param = "parareal_vs_serial.py -n 2 -f")
+    test_list.append(parareal_vs_serial)
+
     ######################################
     ### NICFD                          ###
     ######################################
@@ -1484,6 +1542,14 @@ def main():
     pywrapper_buoyancy.command = TestCase.Command("mpirun -np 2", "python", "run.py")
     test_list.append(pywrapper_buoyancy)
 
+    # zero-copy NumPy arrays of the matrix views, the script fails if they do not alias the solver data,
+    # expose halo nodes, or allow writes to read-only data
+    pywrapper_array_interface = TestCase('pywrapper_array_interface')
+    pywrapper_array_interface.cfg_dir = "py_wrapper/array_interface"
+    pywrapper_array_interface.cfg_file = "lam_flatplate.cfg"
+    pywrapper_array_interface.command = TestCase.Command("mpirun -np 2", "python", "run.py")
+    test_list.append(pywrapper_array_interface)
+
     # custom source: turbulent flamespeed closure (Zimont model) for PSI testcase
     pywrapper_zimont = TestCase('pywrapper_zimont')
     pywrapper_zimont.cfg_dir = "py_wrapper/turbulent_premixed_psi"
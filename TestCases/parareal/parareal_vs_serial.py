@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+
+## \file parareal_vs_serial.py
+#  \brief Checks that Parareal with as many iterations as time slabs reproduces serial time marching.
+#  \version 8.3.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# The case is run twice, with PARAREAL_SLABS= 1 (serial time marching) on N ranks, and as given in the
+# config (N ranks per slab). After PARAREAL_ITER= PARAREAL_SLABS iterations the initial state of every slab
+# is that of serial time marching, the restart files of the last time step must match up to round-off.
+
+from __future__ import print_function, division
+
+import csv
+import os
+import subprocess
+import sys
+from optparse import OptionParser
+
+
+def set_options(cfg_in, cfg_out, options):
+    """ Copy a config file replacing the given options. """
+    with open(cfg_in) as f:
+        lines = f.readlines()
+    for i, line in enumerate(lines):
+        key = line.split("=")[0].strip()
+        if "=" in line and not line.startswith("%") and key in options:
+            lines[i] = "%s= %s\n" % (key, options[key])
+    with open(cfg_out, "w") as f:
+        f.writelines(lines)
+
+
+def get_option(cfg, key):
+    with open(cfg) as f:
+        for line in f:
+            if not line.startswith("%") and line.split("=")[0].strip() == key:
+                return line.split("=", 1)[1].strip()
+    return None
+
+
+def run(launch, cfg, rundir, options):
+    if not os.path.isdir(rundir):
+        os.makedirs(rundir)
+    set_options(cfg, os.path.join(rundir, "case.cfg"), options)
+    if os.geteuid() == 0 and launch.startswith("mpirun"):
+        launch = launch.replace("mpirun", "mpirun --allow-run-as-root")
+    command = "%s SU2_CFD case.cfg" % launch
+    print(command + " (in %s)" % rundir)
+    sys.stdout.flush()
+    with open(os.path.join(rundir, "case.log"), "w") as log:
+        if subprocess.call(command, shell=True, cwd=rundir, stdout=log, stderr=subprocess.STDOUT) != 0:
+            sys.exit("ERROR: the run failed, see %s" % os.path.join(rundir, "case.log"))
+
+
+def read_restart(filename):
+    """ Restart fields by global point index. """
+    with open(filename) as f:
+        reader = csv.reader(f)
+        header = [name.strip().strip('"') for name in next(reader)]
+        rows = {int(row[0]): [float(x) for x in row[1:]] for row in reader}
+    return header[1:], rows
+
+
+def main():
+    parser = OptionParser()
+    parser.add_option("-f", "--file", dest="filename", help="read config from FILE", metavar="FILE")
+    parser.add_option("-n", "--partitions", dest="partitions", default=2, help="number of ranks of each time slab")
+    parser.add_option("-t", "--tol", dest="tol", default=1e-8,
+                      help="maximum difference relative to the largest magnitude of each field")
+    (options, args) = parser.parse_args()
+
+    cfg = os.path.abspath(options.filename)
+    nRanks = int(options.partitions)
+    nSlabs = int(get_option(cfg, "PARAREAL_SLABS"))
+    lastIter = int(get_option(cfg, "TIME_ITER")) - 1
+
+    run("mpirun -n %d" % nRanks, cfg, "serial", {"PARAREAL_SLABS": 1})
+    run("mpirun -n %d" % (nRanks * nSlabs), cfg, "parareal", {})
+
+    restart = "restart_flow_%05d.csv" % lastIter
+    fields, serial = read_restart(os.path.join("serial", restart))
+    _, parareal = read_restart(os.path.join("parareal", restart))
+
+    if sorted(serial) != sorted(parareal):
+        sys.exit("ERROR: the restart files have different points.")
+
+    failed = False
+    for j, name in enumerate(fields):
+        scale = max(abs(values[j]) for values in serial.values())
+        diff = max(abs(serial[i][j] - parareal[i][j]) for i in serial)
+        print("%-24s max difference %.3e, max magnitude %.3e" % (name, diff, scale))
+        if diff > float(options.tol) * max(scale, 1e-300):
+            failed = True
+
+    if failed:
+        sys.exit("ERROR: Parareal does not match serial time marching.")
+    print("Parareal matches serial time marching.")
+
+    # The last time step of the Parareal history, in the format of the screen output such that the regression
+    # can compare it with reference values (serial and Parareal could be equally wrong).
+    history = "history.csv" if nSlabs == 1 else "history_slab%d.csv" % (nSlabs - 1)
+    with open(os.path.join("parareal", history)) as f:
+        reader = csv.reader(f)
+        header = [name.strip().strip('"') for name in next(reader)]
+        last = [row for row in reader][-1]
+    values = [float(last[header.index(name)]) for name in ("rms[Rho]", "rms[RhoU]", "rms[RhoV]", "rms[RhoE]")]
+    print("\n------------------------------ Begin Solver -----------------------------")
+    print("|%12d|" % int(last[header.index("Time_Iter")]) + "|".join("%14.6f" % value for value in values) + "|")
+
+
+if __name__ == "__main__":
+    main()
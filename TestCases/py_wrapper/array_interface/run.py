@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+
+## \file run.py
+#  \brief Zero-copy access to solver data via the NumPy array interface of the matrix views.
+#  \version 8.3.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+import sys
+import numpy
+import pysu2
+from mpi4py import MPI
+
+comm = MPI.COMM_WORLD
+rank = comm.Get_rank()
+
+def check(condition, message):
+  """ Abort all ranks, otherwise the others would wait for the failed one in the next collective call. """
+  if not condition:
+    print('Rank %d: %s' % (rank, message))
+    sys.stdout.flush()
+    comm.Abort(1)
+
+def main():
+  """
+  Check that the arrays of the matrix views alias the solver data, that only the domain
+  nodes are exposed by Array(), and that read-only views give read-only arrays.
+  """
+  try:
+    driver = pysu2.CSinglezoneDriver('lam_flatplate.cfg', 1, comm)
+  except TypeError as exception:
+    print('A TypeError occured in pysu2.CSinglezoneDriver : ', exception)
+    raise
+
+  iSOLVER = driver.GetSolverIndices()['C.FLOW']
+  nNode = driver.GetNumberNodes()
+  nDomain = nNode - driver.GetNumberHaloNodes()
+
+  # The case runs on 2 ranks to have halo nodes, which must not be part of Array().
+  check(comm.Get_size() == 1 or driver.GetNumberHaloNodes() > 0, 'The partition has no halo nodes.')
+
+  solution = driver.Solution(iSOLVER)
+  check(solution.DomainRows() == nDomain, 'Wrong number of domain rows of the solution view.')
+
+  full = numpy.asarray(solution)
+  check(full.shape == tuple(solution.Shape()) and full.shape[0] == nNode, 'Wrong shape of the solution array.')
+
+  domain = solution.Array()
+  check(domain.shape[0] == nDomain, 'Array() exposes more than the domain nodes.')
+  check(numpy.shares_memory(domain, full), 'Array() is not a view of the full array.')
+  check(domain.flags.writeable, 'The solution array is not writeable.')
+
+  # Aliasing in both directions, writes through NumPy are seen by the solver (through any view) and vice versa.
+  iPoint = nDomain - 1
+  old = domain[iPoint, 0]
+  domain[iPoint, 0] = 2 * old
+  check(solution.Get(iPoint, 0) == 2 * old, 'A write to the array is not seen by the view.')
+  check(driver.Solution(iSOLVER)(iPoint, 0) == 2 * old, 'A write to the array is not seen by the solver.')
+  solution.Set(iPoint, 0, old)
+  check(domain[iPoint, 0] == old, 'A write to the view is not seen by the array.')
+
+  # The residual is read-only, NumPy must refuse writes instead of silently modifying solver data.
+  residual = driver.Residual(iSOLVER)
+  check(residual.IsReadOnly(), 'The residual view is not read-only.')
+  res = residual.Array()
+  check(res.shape[0] == nDomain, 'Array() of the residual exposes more than the domain nodes.')
+  check(not res.flags.writeable, 'The residual array is writeable.')
+  try:
+    res[0, 0] = 1.0
+    check(False, 'A write to the residual array did not raise.')
+  except ValueError:
+    pass
+
+  if rank == 0:
+    print("\n------------------------------ Begin Solver -----------------------------")
+    sys.stdout.flush()
+
+  # The arrays stay valid while the solver runs.
+  driver.StartSolver()
+  check(numpy.array_equal(full[:nDomain], domain), 'The solution array is no longer a view after solving.')
+  check(domain[iPoint, 0] == driver.Solution(iSOLVER)(iPoint, 0), 'The solution array is stale after solving.')
+
+  # Finalize the solver and exit cleanly.
+  driver.Finalize()
+
+if __name__ == '__main__':
+  main()
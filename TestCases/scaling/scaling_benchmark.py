@@ -0,0 +1,274 @@
+#!/usr/bin/env python
+
+## \file scaling_benchmark.py
+#  \brief Strong and weak scaling benchmark of SU2_CFD on box meshes generated in memory.
+#  \author The SU2 Developers
+#  \version 8.3.0 "Harrier"
+#
+# SU2 Project Website: https://su2code.github.io
+#
+# The SU2 Project is maintained by the SU2 Foundation
+# (http://su2foundation.org)
+#
+# Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+#
+# SU2 is free software; you can redistribute it and/or
+# modify it under the terms of the GNU Lesser General Public
+# License as published by the Free Software Foundation; either
+# version 2.1 of the License, or (at your option) any later version.
+#
+# SU2 is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+# Lesser General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public
+# License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+
+# Each case (*_box.cfg) runs a fixed number of iterations for every MPI ranks x OpenMP threads
+# layout. The mesh is generated by SU2 (MESH_FORMAT= BOX):
+#  - Strong scaling: the mesh is the same for all layouts.
+#  - Weak scaling: the mesh is extended in x with the number of cores, the cells per core are constant.
+# The timing breakdown is taken from the performance summary of SU2_CFD (preprocessing, partitioning,
+# iterations, output) and from its region profiler (linear solver and halo communications).
+#
+# Example:
+#   python scaling_benchmark.py --layouts 1x1,2x1,4x1,2x2,1x4 --cells 48 --weak-cells 24
+# writes scaling_strong.csv and scaling_weak.csv and prints the tables.
+
+from __future__ import print_function, division
+
+import argparse
+import csv
+import os
+import re
+import subprocess
+import sys
+import time
+
+CASES = {"euler": "euler_box.cfg", "rans": "rans_box.cfg", "incomp": "incomp_box.cfg"}
+
+# Columns of the tables, the times are in seconds (per iteration where noted).
+COLUMNS = ["Case", "Ranks", "Threads", "Cores", "Points", "Points/core", "Preprocessing", "Partitioning",
+           "s/iter", "Linear_solver/iter", "Comms/iter", "Output", "Speed-up", "Efficiency"]
+
+
+def parse_args():
+    parser = argparse.ArgumentParser(description="Strong and weak scaling benchmark of SU2_CFD.")
+    parser.add_argument("--exec", default="SU2_CFD", help="SU2_CFD executable.")
+    parser.add_argument("--launch", default="mpirun -n %d",
+                        help="MPI launch command, %%d is replaced by the number of ranks.")
+    parser.add_argument("--cases", default="euler,rans,incomp", help="Comma separated cases, from: " +
+                        ", ".join(sorted(CASES)))
+    parser.add_argument("--layouts", default="1x1,2x1,4x1",
+                        help="Comma separated RANKSxTHREADS layouts, the first one is the reference.")
+    parser.add_argument("--mode", default="both", choices=["strong", "weak", "both"])
+    parser.add_argument("--cells", type=int, default=32,
+                        help="Cells in each direction of the strong scaling mesh.")
+    parser.add_argument("--weak-cells", type=int, default=16,
+                        help="Cells in each direction of the weak scaling mesh, per core.")
+    parser.add_argument("--iter", type=int, default=20, help="Number of iterations of each run.")
+    parser.add_argument("--timeout", type=int, default=3600, help="Timeout of each run (s).")
+    parser.add_argument("--workdir", default="scaling_runs", help="Where the cases are run.")
+    parser.add_argument("--output", default="scaling", help="Prefix of the CSV tables.")
+    parser.add_argument("--min-efficiency", type=float, default=0.0,
+                        help="The exit code is the number of runs with a lower parallel efficiency.")
+    return parser.parse_args()
+
+
+def parse_layouts(layouts):
+    result = []
+    for layout in layouts.split(","):
+        ranks, threads = layout.lower().split("x")
+        result.append((int(ranks), int(threads)))
+    return result
+
+
+def set_options(cfg_in, cfg_out, options):
+    """ Copy a config file replacing (or adding) the given options. """
+    with open(cfg_in) as f:
+        lines = f.readlines()
+    remaining = dict(options)
+    for i, line in enumerate(lines):
+        key = line.split("=")[0].strip()
+        if "=" in line and not line.startswith("%") and key in remaining:
+            lines[i] = "%s= %s\n" % (key, remaining.pop(key))
+    lines += ["%s= %s\n" % (key, value) for key, value in remaining.items()]
+    with open(cfg_out, "w") as f:
+        f.writelines(lines)
+
+
+def get_option(cfg, key):
+    with open(cfg) as f:
+        for line in f:
+            if line.split("=")[0].strip() == key:
+                return line.split("=", 1)[1].strip()
+    return None
+
+
+def parse_performance(logfile):
+    """ Timings of the performance summary printed by SU2_CFD. """
+    labels = {"Preproc. Time (s):": "Preproc", "Partition Time (s):": "Partition",
+              "Compute Time (s):": "Compute", "Iteration count:": "Iterations", "Output Time (s):": "Output"}
+    values = {}
+    with open(logfile) as f:
+        for line in f:
+            for label, key in labels.items():
+                match = re.search(re.escape(label) + r"\s*([-+0-9.eE]+)", line)
+                if match:
+                    values[key] = float(match.group(1))
+    return values
+
+
+def parse_regions(csvfile):
+    """ Max time over ranks of the linear solvers and of the halo communications (outermost regions). """
+    times = {"Linear_solver": 0.0, "Comms": 0.0}
+    if not os.path.isfile(csvfile):
+        return times
+    with open(csvfile) as f:
+        for row in csv.DictReader(f):
+            names = row["Region"].split("/")
+            if names[-1] == "Linear_Solver" and "Linear_Solver" not in names[:-1]:
+                times["Linear_solver"] += float(row["Max_Time"])
+            if names[-1].endswith("Comms") and not any(n.endswith("Comms") for n in names[:-1]):
+                times["Comms"] += float(row["Max_Time"])
+    return times
+
+
+def run_case(args, case, ranks, threads, size, length, rundir):
+    """ Run one case and return the row of the table, or None if the run failed.
+        The size is the number of nodes in each direction (MESH_BOX_SIZE), i.e. cells + 1. """
+    if not os.path.isdir(rundir):
+        os.makedirs(rundir)
+    template = os.path.join(os.path.dirname(os.path.abspath(__file__)), CASES[case])
+    cfg = os.path.join(rundir, CASES[case])
+    set_options(template, cfg, {"MESH_BOX_SIZE": "%d, %d, %d" % size,
+                                "MESH_BOX_LENGTH": "%g, %g, %g" % length,
+                                "ITER": args.iter,
+                                "CONV_RESIDUAL_MINVAL": -20,
+                                "WRT_PERFORMANCE": "YES",
+                                "PROFILING": "YES",
+                                "PROFILING_FILENAME": "profiling_regions"})
+
+    launch = args.launch % ranks if "%d" in args.launch else args.launch
+    if os.geteuid() == 0 and launch.startswith("mpirun"):
+        launch = launch.replace("mpirun", "mpirun --allow-run-as-root")
+    command = " ".join(part for part in [launch, args.exec, "-t %d" % threads, CASES[case]] if part)
+    logfile = os.path.splitext(CASES[case])[0] + ".log"
+
+    cells = tuple(n - 1 for n in size)
+    print("%-8s %3d ranks x %3d threads, %dx%dx%d cells: %s" % ((case, ranks, threads) + cells + (command,)))
+    sys.stdout.flush()
+
+    start = time.time()
+    with open(os.path.join(rundir, logfile), "w") as log:
+        process = subprocess.Popen(command, shell=True, cwd=rundir, stdout=log, stderr=subprocess.STDOUT)
+        while process.poll() is None:
+            time.sleep(0.5)
+            if time.time() - start > args.timeout:
+                process.kill()
+                print("ERROR: timeout, see %s" % os.path.join(rundir, logfile))
+                return None
+
+    perf = parse_performance(os.path.join(rundir, logfile))
+    if process.returncode != 0 or "Compute" not in perf or not perf.get("Iterations"):
+        print("ERROR: the run failed, see %s" % os.path.join(rundir, logfile))
+        return None
+    regions = parse_regions(os.path.join(rundir, "profiling_regions.csv"))
+
+    nIter = perf["Iterations"]
+    nPoint = size[0] * size[1] * size[2]
+    cores = ranks * threads
+    # The partitioning is part of the preprocessing in the summary of SU2_CFD.
+    return {"Case": case, "Ranks": ranks, "Threads": threads, "Cores": cores, "Points": nPoint,
+            "Points/core": nPoint // cores,
+            "Preprocessing": perf["Preproc"] - perf.get("Partition", 0.0),
+            "Partitioning": perf.get("Partition", 0.0),
+            "s/iter": perf["Compute"] / nIter,
+            "Linear_solver/iter": regions["Linear_solver"] / nIter,
+            "Comms/iter": regions["Comms"] / nIter,
+            "Output": perf.get("Output", 0.0)}
+
+
+def add_efficiency(rows, weak):
+    """ Speed-up and parallel efficiency w.r.t. the first (reference) layout of each case. """
+    reference = {}
+    for row in rows:
+        ref = reference.setdefault(row["Case"], row)
+        speedup = ref["s/iter"] / row["s/iter"]
+        if weak:
+            # Same work per core, ideally the time per iteration does not change.
+            row["Speed-up"] = speedup * row["Cores"] / ref["Cores"]
+            row["Efficiency"] = speedup
+        else:
+            row["Speed-up"] = speedup
+            row["Efficiency"] = speedup * ref["Cores"] / row["Cores"]
+
+
+def write_table(rows, filename, title):
+    with open(filename, "w") as f:
+        writer = csv.DictWriter(f, fieldnames=COLUMNS, quoting=csv.QUOTE_NONNUMERIC)
+        writer.writeheader()
+        writer.writerows(rows)
+
+    widths = [max(len(c), 10) for c in COLUMNS]
+    line = "+" + "+".join("-" * (w + 2) for w in widths) + "+"
+    print("\n" + title + " (" + filename + ")")
+    print(line)
+    print("|" + "|".join(" %*s " % (w, c) for w, c in zip(widths, COLUMNS)) + "|")
+    print(line)
+    for row in rows:
+        cells = [("%.4g" % row[c]) if isinstance(row[c], float) else str(row[c]) for c in COLUMNS]
+        print("|" + "|".join(" %*s " % (w, c) for w, c in zip(widths, cells)) + "|")
+    print(line)
+
+
+def main():
+    args = parse_args()
+    layouts = parse_layouts(args.layouts)
+    cases = args.cases.split(",")
+    for case in cases:
+        if case not in CASES:
+            sys.exit("Unknown case %s." % case)
+
+    modes = ["strong", "weak"] if args.mode == "both" else [args.mode]
+    failed = 0
+
+    for mode in modes:
+        rows = []
+        for case in cases:
+            template = os.path.join(os.path.dirname(os.path.abspath(__file__)), CASES[case])
+            length = [float(x) for x in get_option(template, "MESH_BOX_LENGTH").split(",")]
+            for ranks, threads in layouts:
+                cores = ranks * threads
+                # MESH_BOX_SIZE is the number of nodes in each direction.
+                if mode == "strong":
+                    size = (args.cells + 1,) * 3
+                    box = tuple(length)
+                else:
+                    # Extend the mesh in x keeping the cell size, to scale the cells exactly with the cores.
+                    size = (args.weak_cells * cores + 1, args.weak_cells + 1, args.weak_cells + 1)
+                    box = (length[0] * cores, length[1], length[2])
+                rundir = os.path.join(args.workdir, "%s_%s_%dx%d" % (case, mode, ranks, threads))
+                row = run_case(args, case, ranks, threads, size, box, rundir)
+                if row is None:
+                    failed += 1
+                else:
+                    rows.append(row)
+
+        if not rows:
+            continue
+        add_efficiency(rows, mode == "weak")
+        write_table(rows, "%s_%s.csv" % (args.output, mode), mode.capitalize() + " scaling")
+
+        for row in rows:
+            if row["Efficiency"] < args.min_efficiency:
+                print("WARNING: %s %dx%d %s scaling efficiency %.3f is below %.3f." %
+                      (row["Case"], row["Ranks"], row["Threads"], mode, row["Efficiency"], args.min_efficiency))
+                failed += 1
+
+    sys.exit(failed)
+
+
+if __name__ == "__main__":
+    main()
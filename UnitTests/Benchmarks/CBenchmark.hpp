@@ -0,0 +1,281 @@
+/*!
+ * \file CBenchmark.hpp
+ * \brief Timing, reporting and baseline comparison for the kernel benchmarks.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../Common/include/option_structure.hpp"
+#include "../../Common/include/parallelization/mpi_structure.hpp"
+#include "../../Common/include/parallelization/omp_structure.hpp"
+#include "../../Common/include/toolboxes/printing_toolbox.hpp"
+
+/*!
+ * \brief Runs and records the kernel benchmarks (see benchmark_driver.cpp for the command line options).
+ * \details Threaded kernels are called by all threads of a parallel region, as in the solvers, they must therefore
+ * share the work with worksharing constructs. Each kernel is timed with each of the requested numbers of threads,
+ * the number of calls is chosen to reach a minimum measurement time and is the same on all ranks (kernels may
+ * communicate). The best time per call (least sensitive to noise) is used for the throughput, and with MPI the
+ * slowest rank determines the time.
+ */
+class CBenchmark {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  /*! \brief Measurement of a kernel with a number of threads. */
+  struct CResult {
+    std::string kernel;         /*!< \brief Name of the kernel. */
+    std::string unit;           /*!< \brief What is processed by the kernel (edges, points, etc.). */
+    int threads = 1;            /*!< \brief Number of threads per rank. */
+    passivedouble items = 0;    /*!< \brief Units processed per call (sum over ranks). */
+    passivedouble minTime = 0;  /*!< \brief Best time per call. */
+    passivedouble avgTime = 0;  /*!< \brief Average time per call. */
+  };
+
+  /*! \brief Numbers of threads used to run the threaded kernels. */
+  static std::vector<int>& Threads() {
+    static std::vector<int> threads{1};
+    return threads;
+  }
+
+  /*! \brief Minimum time (s) spent measuring a kernel with each number of threads. */
+  static passivedouble& MinTime() {
+    static passivedouble minTime = 0.5;
+    return minTime;
+  }
+
+  /*! \brief Number of cells in each direction of the synthetic meshes. */
+  static unsigned long& MeshSize() {
+    static unsigned long meshSize = 32;
+    return meshSize;
+  }
+
+  /*! \brief Measurements made so far. */
+  static std::vector<CResult>& Results() {
+    static std::vector<CResult> results;
+    return results;
+  }
+
+  /*!
+   * \brief Time a kernel with each number of threads (or only with one thread if the kernel is not threaded).
+   * \param[in] kernel - Name of the kernel.
+   * \param[in] items - Units processed per call on this rank.
+   * \param[in] unit - Name of the units.
+   * \param[in] func - Callable without arguments.
+   * \param[in] threaded - If false the kernel is called outside of parallel regions.
+   */
+  template <class F>
+  static void Run(const std::string& kernel, passivedouble items, const std::string& unit, const F& func,
+                  bool threaded = true) {
+    passivedouble globalItems = 0;
+    SelectMPIWrapper<passivedouble>::W::Allreduce(&items, &globalItems, 1, MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+
+    for (const int nThreads : threaded ? Threads() : std::vector<int>{1}) {
+      /*--- The warm-up call is used to estimate the number of calls. ---*/
+      passivedouble minTime = 0, avgTime = 0;
+      TimeCalls(nThreads, threaded, 1, func, minTime, avgTime);
+
+      const auto estimate = std::ceil(MinTime() / std::max(minTime, 1e-9));
+      unsigned long nCalls = std::min<passivedouble>(std::max<passivedouble>(estimate, 3), 1e6), globalCalls = 0;
+      SU2_MPI::Allreduce(&nCalls, &globalCalls, 1, MPI_UNSIGNED_LONG, MPI_MAX, SU2_MPI::GetComm());
+
+      TimeCalls(nThreads, threaded, globalCalls, func, minTime, avgTime);
+
+      passivedouble local[] = {minTime, avgTime}, global[2] = {0.0};
+      SelectMPIWrapper<passivedouble>::W::Allreduce(local, global, 2, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+      Results().push_back({kernel, unit, threaded ? nThreads : 1, globalItems, global[0], global[1]});
+    }
+  }
+
+  /*!
+   * \brief Print the throughput of the kernels and the speed-up relative to the smallest number of threads.
+   */
+  static void Print() {
+    if (SU2_MPI::GetRank() != MASTER_NODE || Results().empty()) return;
+
+    std::cout << "\nKernel benchmarks (" << SU2_MPI::GetSize() << " rank(s), " << MeshSize() << "^3 cells):"
+              << std::endl;
+    PrintingToolbox::CTablePrinter table(&std::cout);
+    table.AddColumn("Kernel", 32);
+    table.AddColumn("Threads", 8);
+    table.AddColumn("Time/call (s)", 14);
+    table.AddColumn("Throughput (1/s)", 17);
+    table.AddColumn("Unit", 12);
+    table.AddColumn("Speed-up", 9);
+    table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+    table.PrintHeader();
+
+    for (const auto& r : Results()) {
+      const auto& first = *std::find_if(Results().begin(), Results().end(),
+                                        [&r](const CResult& other) { return other.kernel == r.kernel; });
+      table << r.kernel << r.threads << r.minTime << r.items / r.minTime << r.unit << first.minTime / r.minTime;
+    }
+    table.PrintFooter();
+  }
+
+  /*!
+   * \brief Write the measurements as CSV, the format read by Compare.
+   * \param[in] filename - Name of the file.
+   */
+  static void Write(const std::string& filename) {
+    if (SU2_MPI::GetRank() != MASTER_NODE) return;
+
+    std::ofstream file(filename);
+    file << std::scientific << std::setprecision(6);
+    file << "\"Kernel\",\"Unit\",\"Ranks\",\"Threads\",\"Items\",\"Min_Time\",\"Avg_Time\",\"Throughput\"\n";
+    for (const auto& r : Results()) {
+      file << "\"" << r.kernel << "\",\"" << r.unit << "\"," << SU2_MPI::GetSize() << "," << r.threads << ","
+           << std::llround(r.items) << "," << r.minTime << "," << r.avgTime << "," << r.items / r.minTime << "\n";
+    }
+  }
+
+  /*!
+   * \brief Compare the measurements with those of a baseline file (written by Write).
+   * \note Only kernels measured with the same mesh, numbers of ranks and threads are compared.
+   * \param[in] filename - Name of the baseline file.
+   * \param[in] tolerance - Relative increase of the time above which a kernel is reported as slower.
+   * \note A baseline that cannot be read, or that has no measurements, is an error.
+   * \return Number of slower kernels (on all ranks).
+   */
+  static int Compare(const std::string& filename, passivedouble tolerance) {
+    int nSlower = 0;
+    if (SU2_MPI::GetRank() == MASTER_NODE) {
+      /*--- Read the baseline, key is the kernel, ranks, threads and items. ---*/
+      std::map<std::string, passivedouble> baseline;
+      std::ifstream file(filename);
+      if (!file.good()) {
+        SU2_MPI::Error("Could not open the benchmark baseline \"" + filename + "\".", CURRENT_FUNCTION);
+      }
+      std::string line;
+      std::getline(file, line);
+      while (std::getline(file, line)) {
+        std::vector<std::string> fields;
+        std::stringstream ss(line);
+        for (std::string field; std::getline(ss, field, ',');) {
+          fields.push_back(field);
+          fields.back().erase(std::remove(fields.back().begin(), fields.back().end(), '"'), fields.back().end());
+        }
+        if (fields.size() < 6) continue;
+        baseline[Key(fields[0], std::stoi(fields[2]), std::stoi(fields[3]), std::stod(fields[4]))] =
+            std::stod(fields[5]);
+      }
+      if (baseline.empty()) {
+        SU2_MPI::Error("The benchmark baseline \"" + filename + "\" contains no measurements.", CURRENT_FUNCTION);
+      }
+
+      std::cout << "\nComparison with the baseline \"" << filename << "\" (tolerance " << 100 * tolerance << "%):"
+                << std::endl;
+      PrintingToolbox::CTablePrinter table(&std::cout);
+      table.AddColumn("Kernel", 32);
+      table.AddColumn("Threads", 8);
+      table.AddColumn("Baseline (s)", 14);
+      table.AddColumn("Current (s)", 14);
+      table.AddColumn("Change (%)", 11);
+      table.AddColumn("Status", 8);
+      table.SetAlign(PrintingToolbox::CTablePrinter::LEFT);
+      table.PrintHeader();
+
+      for (const auto& r : Results()) {
+        const auto it = baseline.find(Key(r.kernel, SU2_MPI::GetSize(), r.threads, r.items));
+        if (it == baseline.end()) continue;
+        const passivedouble change = r.minTime / it->second - 1;
+        const bool slower = change > tolerance;
+        nSlower += slower;
+        table << r.kernel << r.threads << it->second << r.minTime << std::round(1000 * change) / 10
+              << (slower ? "SLOWER" : (change < -tolerance ? "FASTER" : "OK"));
+      }
+      table.PrintFooter();
+    }
+    SU2_MPI::Bcast(&nSlower, 1, MPI_INT, MASTER_NODE, SU2_MPI::GetComm());
+    return nSlower;
+  }
+
+ private:
+  /*!
+   * \brief Identify a measurement, the number of items identifies the size of the problem.
+   */
+  static std::string Key(const std::string& kernel, int ranks, int threads, passivedouble items) {
+    std::stringstream key;
+    key << kernel << "|" << ranks << "|" << threads << "|" << std::llround(items);
+    return key.str();
+  }
+
+  /*!
+   * \brief Call a kernel a number of times and measure the best and average time per call.
+   */
+  template <class F>
+  static void TimeCalls(int nThreads, bool threaded, unsigned long nCalls, const F& func, passivedouble& minTime,
+                        passivedouble& avgTime) {
+    minTime = std::numeric_limits<passivedouble>::max();
+    passivedouble sumTime = 0;
+
+    if (!threaded) {
+      for (auto iCall = 0ul; iCall < nCalls; ++iCall) {
+        const auto start = Clock::now();
+        func();
+        const passivedouble elapsed = std::chrono::duration<passivedouble>(Clock::now() - start).count();
+        minTime = std::min(minTime, elapsed);
+        sumTime += elapsed;
+      }
+      avgTime = sumTime / nCalls;
+      return;
+    }
+
+    SU2_OMP_PARALLEL_ON(nThreads) {
+      Clock::time_point start;
+      for (auto iCall = 0ul; iCall < nCalls; ++iCall) {
+        SU2_OMP_BARRIER
+        SU2_OMP_MASTER
+        start = Clock::now();
+        END_SU2_OMP_MASTER
+
+        func();
+
+        SU2_OMP_BARRIER
+        SU2_OMP_MASTER {
+          const passivedouble elapsed = std::chrono::duration<passivedouble>(Clock::now() - start).count();
+          minTime = std::min(minTime, elapsed);
+          sumTime += elapsed;
+        }
+        END_SU2_OMP_MASTER
+      }
+    }
+    END_SU2_OMP_PARALLEL
+
+    avgTime = sumTime / nCalls;
+  }
+};
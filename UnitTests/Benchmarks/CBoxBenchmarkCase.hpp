@@ -0,0 +1,145 @@
+/*!
+ * \file CBoxBenchmarkCase.hpp
+ * \brief Compressible flow solvers on synthetic box meshes, shared by the kernel benchmarks.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+#include "../BoxMeshTestCase.hpp"
+#include "../../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../../SU2_CFD/include/solvers/CSolverFactory.hpp"
+#include "CBenchmark.hpp"
+
+/*!
+ * \brief Euler or laminar Navier-Stokes case (Roe + MUSCL, implicit) on a box mesh generated in memory.
+ * \details The viscous case is stretched in the wall-normal direction (y) to have linelets. The free-stream
+ * solution is perturbed such that gradients, limiters and fluxes are not trivial. The cases are built once
+ * (with the maximum number of threads) and shared by all benchmarks.
+ */
+struct CBoxBenchmarkCase : BoxMeshTestCase {
+  CSolver** solvers{nullptr};
+
+  /*!
+   * \brief Config options of the case (see the constructor).
+   */
+  static std::string Options(bool viscous, unsigned long nCells) {
+    std::stringstream options;
+    options << "SOLVER= " << (viscous ? "NAVIER_STOKES" : "EULER") << "\n"
+            << "MESH_FORMAT= BOX\n"
+            << "MESH_BOX_SIZE= " << nCells << "," << nCells << "," << nCells << "\n"
+            << "MESH_BOX_LENGTH= 1," << (viscous ? "0.1" : "1") << ",1\n"
+            << "MESH_BOX_OFFSET= 0,0,0\n"
+            << "INIT_OPTION= TD_CONDITIONS\n"
+            << "MACH_NUMBER= 0.5\n"
+            << "AOA= 3.0\n"
+            << "VISCOSITY_MODEL= CONSTANT_VISCOSITY\n"
+            << "CONV_NUM_METHOD_FLOW= ROE\n"
+            << "MUSCL_FLOW= YES\n"
+            << "SLOPE_LIMITER_FLOW= VENKATAKRISHNAN\n"
+            << "NUM_METHOD_GRAD= GREEN_GAUSS\n"
+            << "NUM_METHOD_GRAD_RECON= WEIGHTED_LEAST_SQUARES\n"
+            << "TIME_DISCRE_FLOW= EULER_IMPLICIT\n"
+            << "LINEAR_SOLVER_PREC= ILU\n"
+            << "MARKER_FAR= (x_minus, x_plus, z_plus, z_minus)\n"
+            << (viscous ? "MARKER_HEATFLUX= (y_minus, 0.0, y_plus, 0.0)\n" : "MARKER_EULER= (y_minus, y_plus)\n")
+            << "REF_ORIGIN_MOMENT_X= 0.0\n"
+            << "REF_ORIGIN_MOMENT_Y= 0.0\n"
+            << "REF_ORIGIN_MOMENT_Z= 0.0\n";
+    return options.str();
+  }
+
+  /*!
+   * \brief Build the case.
+   * \param[in] viscous - Navier-Stokes or Euler.
+   * \param[in] nCells - Number of cells in each direction.
+   */
+  CBoxBenchmarkCase(bool viscous, unsigned long nCells) : BoxMeshTestCase(Options(viscous, nCells)) {
+    CScreenOutputSilencer silencer;
+
+    solvers = CSolverFactory::CreateSolverContainer(config->GetKind_Solver(), config.get(), geometry.get(), MESH_0);
+
+    /*--- Smooth perturbation of the free-stream solution. ---*/
+    auto* nodes = Flow()->GetNodes();
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      const auto* coord = geometry->nodes->GetCoord(iPoint);
+      const su2double factor = 1 + 0.05 * sin(2 * PI_NUMBER * coord[0]) * cos(2 * PI_NUMBER * coord[2]);
+      for (auto iVar = 0u; iVar < Flow()->GetnVar(); ++iVar) {
+        nodes->SetSolution(iPoint, iVar, factor * nodes->GetSolution(iPoint, iVar));
+      }
+    }
+    SU2_OMP_PARALLEL
+    AssembleJacobian();
+    END_SU2_OMP_PARALLEL
+  }
+
+  ~CBoxBenchmarkCase() {
+    if (solvers == nullptr) return;
+    for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) delete solvers[iSol];
+    delete[] solvers;
+  }
+
+  /*!
+   * \brief Flow solver of the case.
+   */
+  CSolver* Flow() const { return solvers[FLOW_SOL]; }
+
+  /*!
+   * \brief Compute primitives, gradients, limiters, time steps and the implicit system, as in one iteration of
+   * the solver (must be called by all threads of a parallel region).
+   */
+  void AssembleJacobian() {
+    Flow()->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, NO_RK_ITER, RUNTIME_FLOW_SYS, false);
+    Flow()->SetTime_Step(geometry.get(), solvers, config.get(), MESH_0, 0);
+    Flow()->Upwind_Residual(geometry.get(), solvers, nullptr, config.get(), MESH_0);
+    Flow()->PrepareImplicitIteration(geometry.get(), solvers, config.get());
+  }
+
+  /*!
+   * \brief Get the shared case, built on first use with the mesh size of CBenchmark.
+   */
+  static CBoxBenchmarkCase& Get(bool viscous) {
+    auto& instance = Instances()[viscous];
+    if (!instance) instance.reset(new CBoxBenchmarkCase(viscous, CBenchmark::MeshSize()));
+    return *instance;
+  }
+
+  /*!
+   * \brief Destroy the shared cases (before MPI is finalized).
+   */
+  static void Release() {
+    for (auto& instance : Instances()) instance.reset();
+  }
+
+ private:
+  static std::array<std::unique_ptr<CBoxBenchmarkCase>, 2>& Instances() {
+    static std::array<std::unique_ptr<CBoxBenchmarkCase>, 2> instances;
+    return instances;
+  }
+};
@@ -0,0 +1,100 @@
+/*!
+ * \file benchmark_driver.cpp
+ * \brief Main program of the kernel benchmarks, runs the "[Benchmark]" test cases with Catch2.
+ * \details Besides the usual Catch2 options (e.g. to select benchmarks by name) the following are accepted:
+ *   --bench-threads 1,2,4      numbers of threads (default: powers of 2 up to the maximum number of threads)
+ *   --bench-min-time 0.5       minimum measurement time per kernel and number of threads (s)
+ *   --bench-mesh-size 32       number of cells in each direction of the box meshes
+ *   --bench-output file.csv    where to write the results (default: benchmark_results.csv)
+ *   --bench-baseline file.csv  results of a previous run to compare with, the exit code is the number of
+ *                              kernels that are slower than the baseline by more than the tolerance
+ *   --bench-tolerance 0.1      relative tolerance for the comparison
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*--- Custom main, see test_driver.cpp. ---*/
+#define CATCH_CONFIG_RUNNER
+#include "catch.hpp"
+
+#include "CBoxBenchmarkCase.hpp"
+
+int main(int argc, char* argv[]) {
+  /*--- Startup MPI, if supported ---*/
+#if defined(HAVE_OMP) && defined(HAVE_MPI)
+  int provided;
+  SU2_MPI::Init_thread(&argc, &argv, MPI_THREAD_FUNNELED, &provided);
+#else
+  SU2_MPI::Init(&argc, &argv);
+#endif
+
+  /*--- Benchmark options. ---*/
+  std::string threads, output = "benchmark_results.csv", baseline;
+  double minTime = CBenchmark::MinTime(), tolerance = 0.1;
+  unsigned long meshSize = CBenchmark::MeshSize();
+
+  Catch::Session session;
+  using Catch::clara::Opt;
+  session.cli(session.cli() |
+              Opt(threads, "list")["--bench-threads"]("comma separated numbers of threads") |
+              Opt(minTime, "seconds")["--bench-min-time"]("minimum time measuring each kernel") |
+              Opt(meshSize, "cells")["--bench-mesh-size"]("cells in each direction of the box meshes") |
+              Opt(output, "file")["--bench-output"]("CSV file for the results") |
+              Opt(baseline, "file")["--bench-baseline"]("CSV file of a previous run to compare with") |
+              Opt(tolerance, "fraction")["--bench-tolerance"]("relative tolerance of the comparison"));
+
+  int result = session.applyCommandLine(argc, argv);
+  if (result != 0) {
+    SU2_MPI::Finalize();
+    return result;
+  }
+
+  auto& nThreads = CBenchmark::Threads();
+  nThreads.clear();
+  if (threads.empty()) {
+    for (int n = 1; n < omp_get_max_threads(); n *= 2) nThreads.push_back(n);
+    nThreads.push_back(omp_get_max_threads());
+  } else {
+    std::stringstream ss(threads);
+    for (std::string n; std::getline(ss, n, ',');) nThreads.push_back(std::max(1, std::stoi(n)));
+  }
+  CBenchmark::MinTime() = minTime;
+  CBenchmark::MeshSize() = meshSize;
+
+  /*--- The cases are built with the maximum number of threads (e.g. for the edge coloring). ---*/
+  omp_set_num_threads(*std::max_element(nThreads.begin(), nThreads.end()));
+
+  /*--- Run the benchmarks, then report. ---*/
+  result = session.run();
+
+  CBenchmark::Print();
+  CBenchmark::Write(output);
+  if (!baseline.empty()) result += CBenchmark::Compare(baseline, tolerance);
+
+  CBoxBenchmarkCase::Release();
+
+  /*--- Finalize MPI parallelization ---*/
+  SU2_MPI::Finalize();
+
+  return result;
+}
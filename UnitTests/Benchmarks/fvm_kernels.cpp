@@ -0,0 +1,84 @@
+/*!
+ * \file fvm_kernels.cpp
+ * \brief Benchmarks of the edge fluxes, gradients, limiters and halo exchange of the compressible FVM solvers.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "CBoxBenchmarkCase.hpp"
+#include "../../Common/include/linear_algebra/CSysMatrix.hpp"
+
+TEST_CASE("Edge fluxes", "[Benchmark]") {
+  /*--- Convective (Roe with MUSCL) and convective + viscous SIMD numerics, including the Jacobian update. ---*/
+  for (const bool viscous : {false, true}) {
+    auto& box = CBoxBenchmarkCase::Get(viscous);
+    auto* geometry = box.geometry.get();
+    auto* config = box.config.get();
+
+    CBenchmark::Run(viscous ? "Edge fluxes Roe+viscous" : "Edge fluxes Roe", geometry->GetnEdge(), "edges",
+                    [&]() { box.Flow()->Upwind_Residual(geometry, box.solvers, nullptr, config, MESH_0); });
+
+    CHECK(std::isfinite(SU2_TYPE::GetValue(box.Flow()->GetLinSysRes()(0, 0))));
+  }
+}
+
+TEST_CASE("Gradients and limiters", "[Benchmark]") {
+  auto& box = CBoxBenchmarkCase::Get(false);
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+  auto* flow = box.Flow();
+  const auto nPoint = geometry->GetnPointDomain();
+
+  CBenchmark::Run("Gradient Green-Gauss", nPoint, "points",
+                  [&]() { flow->SetPrimitive_Gradient_GG(geometry, config); });
+
+  CBenchmark::Run("Gradient weighted LSQ", nPoint, "points",
+                  [&]() { flow->SetPrimitive_Gradient_LS(geometry, config, true); });
+
+  CBenchmark::Run("Limiter Venkatakrishnan", nPoint, "points", [&]() { flow->SetPrimitive_Limiter(geometry, config); });
+
+  CHECK(std::isfinite(SU2_TYPE::GetValue(flow->GetNodes()->GetLimiter_Primitive(0, 0))));
+}
+
+TEST_CASE("Halo exchange", "[Benchmark]") {
+  auto& box = CBoxBenchmarkCase::Get(false);
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+  auto* flow = box.Flow();
+  const auto nHalo = geometry->GetnPoint() - geometry->GetnPointDomain();
+
+  /*--- Solution of the flow solver, and a vector of the linear solvers. ---*/
+  CBenchmark::Run("Halo exchange solution", nHalo, "halo points", [&]() {
+    flow->InitiateComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+    flow->CompleteComms(geometry, config, MPI_QUANTITIES::SOLUTION);
+  });
+
+  CSysVector<su2mixedfloat> x(geometry->GetnPoint(), geometry->GetnPointDomain(), flow->GetnVar(), 1.0);
+  CBenchmark::Run("Halo exchange linear system", nHalo, "halo points", [&]() {
+    CSysMatrixComms::Initiate(x, geometry, config);
+    CSysMatrixComms::Complete(x, geometry, config);
+  });
+
+  CHECK(x(0, 0) == 1.0);
+}
@@ -0,0 +1,66 @@
+/*!
+ * \file linear_algebra.cpp
+ * \brief Benchmarks of the sparse matrix product and preconditioners used by the linear solvers.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "CBoxBenchmarkCase.hpp"
+
+TEST_CASE("Sparse matrix and preconditioners", "[Benchmark]") {
+  /*--- Jacobian of the Navier-Stokes case, the block size is 5 and linelets exist near the walls. ---*/
+  auto& box = CBoxBenchmarkCase::Get(true);
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+  auto& jacobian = box.Flow()->Jacobian;
+
+  const auto nPoint = geometry->GetnPointDomain();
+  const auto nBlocks = geometry->GetSparsePattern(ConnectivityType::FiniteVolume).getNumNonZeros();
+
+  CSysVector<su2mixedfloat> x(geometry->GetnPoint(), nPoint, box.Flow()->GetnVar(), 1.0);
+  CSysVector<su2mixedfloat> y(geometry->GetnPoint(), nPoint, box.Flow()->GetnVar(), 0.0);
+
+  /*--- Start from a freshly assembled matrix, the edge flux benchmarks accumulate into it. ---*/
+  SU2_OMP_PARALLEL {
+    box.AssembleJacobian();
+    jacobian.BuildLineletPreconditioner(geometry, config);
+  }
+  END_SU2_OMP_PARALLEL
+
+  CBenchmark::Run("Matrix-vector product", nBlocks, "blocks",
+                  [&]() { jacobian.MatrixVectorProduct(x, y, geometry, config); });
+
+  CBenchmark::Run("ILU(0) build", nPoint, "rows", [&]() { jacobian.BuildILUPreconditioner(); });
+
+  CBenchmark::Run("ILU(0) apply", nPoint, "rows",
+                  [&]() { jacobian.ComputeILUPreconditioner(x, y, geometry, config); });
+
+  CBenchmark::Run("LU-SGS apply", nPoint, "rows",
+                  [&]() { jacobian.ComputeLU_SGSPreconditioner(x, y, geometry, config); });
+
+  CBenchmark::Run("Linelet apply", nPoint, "rows",
+                  [&]() { jacobian.ComputeLineletPreconditioner(x, y, geometry, config); });
+
+  CHECK(std::isfinite(SU2_TYPE::GetValue(y(0, 0))));
+}
@@ -0,0 +1,141 @@
+/*!
+ * \file lookup_and_output.cpp
+ * \brief Benchmarks of the look-up table interpolation and of the sorting of the output data.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include "CBoxBenchmarkCase.hpp"
+#include "../../Common/include/containers/CLookUpTable.hpp"
+#include "../../SU2_CFD/include/output/filewriter/CFVMDataSorter.hpp"
+
+namespace {
+/*!
+ * \brief Write a 2D table of n x n points (triangulated structured grid) in the format of CFileReaderLUT.
+ */
+void WriteTable(const std::string& filename, unsigned long n) {
+  std::ofstream file(filename);
+  file << std::setprecision(10);
+  file << "Dragon library\n\n<Header>\n[Version]\n1.0.1\n\n"
+       << "[Number of points]\n" << n * n << "\n\n"
+       << "[Number of triangles]\n" << 2 * (n - 1) * (n - 1) << "\n\n"
+       << "[Number of hull points]\n" << 4 * (n - 1) << "\n\n"
+       << "[Progress variable definition]\nprog var = 1*Y-CH4\n\n"
+       << "[Progress variable range]\n0.0 | 1.0\n\n"
+       << "[Enthalpy range]\n-1.0 | 1.0\n\n"
+       << "[Number of variables]\n4\n\n"
+       << "[Variable names]\nProgressVariable\nEnthalpyTot\nDensity\nViscosity\n\n</Header>\n\n<Data>\n";
+
+  for (auto j = 0ul; j < n; ++j) {
+    for (auto i = 0ul; i < n; ++i) {
+      const passivedouble x = passivedouble(i) / (n - 1), y = -1 + 2 * passivedouble(j) / (n - 1);
+      file << x << " " << y << " " << 1 + 0.2 * x * y << " " << 1e-5 * (1 + x + 0.1 * y) << "\n";
+    }
+  }
+
+  /*--- Connectivity and hull (counterclockwise) use 1-based point indices. ---*/
+  auto point = [n](unsigned long i, unsigned long j) { return j * n + i + 1; };
+
+  file << "</Data>\n\n<Connectivity>\n";
+  for (auto j = 0ul; j + 1 < n; ++j) {
+    for (auto i = 0ul; i + 1 < n; ++i) {
+      file << point(i, j) << " " << point(i + 1, j) << " " << point(i + 1, j + 1) << "\n";
+      file << point(i, j) << " " << point(i + 1, j + 1) << " " << point(i, j + 1) << "\n";
+    }
+  }
+  file << "</Connectivity>\n\n<Hull>\n";
+  for (auto i = 0ul; i + 1 < n; ++i) file << point(i, 0) << "\n";
+  for (auto j = 0ul; j + 1 < n; ++j) file << point(n - 1, j) << "\n";
+  for (auto i = n - 1; i > 0; --i) file << point(i, n - 1) << "\n";
+  for (auto j = n - 1; j > 0; --j) file << point(0, j) << "\n";
+  file << "</Hull>\n";
+}
+}  // namespace
+
+TEST_CASE("Look-up table", "[Benchmark]") {
+  const std::string filename = "benchmark_lookuptable.drg";
+  if (SU2_MPI::GetRank() == MASTER_NODE) WriteTable(filename, 256);
+  SU2_MPI::Barrier(SU2_MPI::GetComm());
+
+  CScreenOutputSilencer silencer;
+  CLookUpTable table(filename, "ProgressVariable", "EnthalpyTot");
+  silencer.Restore();
+
+  const std::vector<unsigned long> idx = {table.GetIndexOfVar("Density"), table.GetIndexOfVar("Viscosity")};
+
+  /*--- Quasi-random (low discrepancy) queries that cover the table. ---*/
+  const unsigned long nQuery = 100000;
+  std::vector<su2double> prog(nQuery), enth(nQuery);
+  for (auto k = 0ul; k < nQuery; ++k) {
+    prog[k] = std::fmod(0.6180339887 * (k + 1), 1.0);
+    enth[k] = -1 + 2 * std::fmod(0.7548776662 * (k + 1), 1.0);
+  }
+  unsigned long nInside = 0;
+
+  /*--- Output of the look-ups of each thread, allocated outside of the timed kernel. ---*/
+  std::vector<std::vector<su2double>> values(omp_get_max_threads(), std::vector<su2double>(idx.size()));
+
+  CBenchmark::Run("Look-up table 2D", nQuery, "queries", [&]() {
+    auto& threadValues = values[omp_get_thread_num()];
+    unsigned long inside = 0;
+    SU2_OMP_FOR_STAT(1024)
+    for (auto k = 0ul; k < nQuery; ++k) inside += table.LookUp_XY(idx, threadValues, prog[k], enth[k]);
+    END_SU2_OMP_FOR
+    SU2_OMP_MASTER
+    nInside = inside;
+    END_SU2_OMP_MASTER
+  });
+
+  if (SU2_MPI::GetRank() == MASTER_NODE) std::remove(filename.c_str());
+  CHECK(nInside > 0);
+}
+
+TEST_CASE("Output sorting", "[Benchmark]") {
+  /*--- Linear partitioning of the volume data and connectivity, as done before writing each solution file. ---*/
+  auto& box = CBoxBenchmarkCase::Get(false);
+  auto* geometry = box.geometry.get();
+  auto* config = box.config.get();
+  const auto* nodes = box.Flow()->GetNodes();
+
+  std::vector<std::string> fieldNames = {"x", "y", "z"};
+  for (auto iVar = 0u; iVar < box.Flow()->GetnVar(); ++iVar) fieldNames.push_back("U_" + std::to_string(iVar));
+
+  CFVMDataSorter sorter(config, geometry, fieldNames);
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+    for (auto iDim = 0u; iDim < 3; ++iDim) sorter.SetUnsortedData(iPoint, iDim, geometry->nodes->GetCoord(iPoint, iDim));
+    for (auto iVar = 0u; iVar < box.Flow()->GetnVar(); ++iVar)
+      sorter.SetUnsortedData(iPoint, 3 + iVar, nodes->GetSolution(iPoint, iVar));
+  }
+
+  CBenchmark::Run(
+      "Output sorting", geometry->GetnPointDomain(), "points",
+      [&]() {
+        sorter.SortOutputData();
+        sorter.SortConnectivity(config, geometry, true);
+      },
+      false);
+
+  CHECK(sorter.GetnElem() > 0);
+}
@@ -0,0 +1,118 @@
+/*!
+ * \file BoxMeshTestCase.hpp
+ * \brief Config and preprocessed geometry of a box mesh, to be used in unit tests and benchmarks.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../Common/include/geometry/CPhysicalGeometry.hpp"
+
+/*!
+ * \brief Silences the screen output (of the config and geometry preprocessing) while the object is alive.
+ */
+class CScreenOutputSilencer {
+  std::streambuf* orig_buf;
+
+ public:
+  CScreenOutputSilencer() : orig_buf(std::cout.rdbuf(nullptr)) {}
+  ~CScreenOutputSilencer() { Restore(); }
+
+  /*!
+   * \brief Restore the screen output before the end of the scope.
+   */
+  void Restore() {
+    if (orig_buf != nullptr) std::cout.rdbuf(orig_buf);
+    orig_buf = nullptr;
+  }
+
+  CScreenOutputSilencer(const CScreenOutputSilencer&) = delete;
+  CScreenOutputSilencer& operator=(const CScreenOutputSilencer&) = delete;
+};
+
+/*!
+ * \brief Config and geometry of a box mesh (MESH_FORMAT= BOX), partitioned over all ranks and preprocessed with
+ * the same steps as the driver.
+ */
+struct BoxMeshTestCase {
+  std::unique_ptr<CConfig> config;
+  std::unique_ptr<CGeometry> geometry;
+
+  /*!
+   * \param[in] options - Config options, including MESH_FORMAT= BOX and the MESH_BOX_ options.
+   * \param[in] dualGrid - Also build the edges and control volumes, i.e. the dual grid of finite volume solvers.
+   * \param[in] iZone - Zone of the mesh.
+   * \param[in] nZone - Number of zones.
+   */
+  explicit BoxMeshTestCase(const std::string& options, bool dualGrid = true, unsigned short iZone = 0,
+                           unsigned short nZone = 1)
+      : config(MakeConfig(options)), geometry(MakeGeometry(config.get(), dualGrid, iZone, nZone)) {}
+
+  /*!
+   * \brief Make a config from a string of options.
+   */
+  static std::unique_ptr<CConfig> MakeConfig(const std::string& options) {
+    CScreenOutputSilencer silencer;
+    std::stringstream ss(options);
+    return std::unique_ptr<CConfig>(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+  }
+
+  /*!
+   * \brief Make and preprocess the geometry of the box mesh of a config (see the constructor for the parameters).
+   */
+  static std::unique_ptr<CGeometry> MakeGeometry(CConfig* config, bool dualGrid = true, unsigned short iZone = 0,
+                                                 unsigned short nZone = 1) {
+    CScreenOutputSilencer silencer;
+    std::unique_ptr<CGeometry> geometry;
+    {
+      auto aux_geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(config, iZone, nZone));
+      aux_geometry->SetColorGrid_Parallel(config);
+      geometry = std::unique_ptr<CGeometry>(new CPhysicalGeometry(aux_geometry.get(), config));
+    }
+    geometry->SetSendReceive(config);
+    geometry->SetBoundaries(config);
+    geometry->SetPoint_Connectivity();
+    geometry->SetElement_Connectivity();
+    geometry->SetBoundVolume();
+    geometry->Check_IntElem_Orientation(config);
+    geometry->Check_BoundElem_Orientation(config);
+    if (dualGrid) geometry->SetEdges();
+    geometry->SetVertex(config);
+    if (dualGrid) {
+      geometry->SetControlVolume(config, ALLOCATE);
+      geometry->SetBoundControlVolume(config, ALLOCATE);
+      geometry->FindNormal_Neighbor(config);
+    }
+    geometry->SetGlobal_to_Local_Point();
+    geometry->SetMGLevel(MESH_0);
+    geometry->PreprocessP2PComms(geometry.get(), config);
+    if (dualGrid) geometry->SetMaxLength(config);
+    return geometry;
+  }
+};
@@ -0,0 +1,133 @@
+/*!
+ * \file CFEMStandardElement_tests.cpp
+ * \brief Unit tests for the sum factorization of the FEM standard elements.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "../../../Common/include/fem/fem_standard_element.hpp"
+#include "../../../Common/include/linear_algebra/blas_structure.hpp"
+
+namespace {
+/*--- Data of the volume terms of a tensor-product element, N columns as in the DG solver. ---*/
+struct SumFactData {
+  const unsigned short N = 8;
+  CFEMStandardElement elem;
+  unsigned short nDim, nDOFs, nInt;
+  std::vector<su2double> dofData, intData, work;
+  std::vector<su2double> gemmInt, sumFactInt, gemmDOF, sumFactDOF;
+
+  SumFactData(unsigned short VTK_Type, unsigned short nPoly)
+      : elem(VTK_Type, nPoly, false, nullptr, 2 * nPoly),
+        nDim(VTK_Type == HEXAHEDRON ? 3 : 2),
+        nDOFs(elem.GetNDOFs()),
+        nInt(elem.GetNIntegration()) {
+    dofData.resize(nDOFs * N);
+    intData.resize(nInt * nDim * N);
+    for (size_t i = 0; i < dofData.size(); ++i) dofData[i] = std::sin(0.1 * i);
+    for (size_t i = 0; i < intData.size(); ++i) intData[i] = std::cos(0.1 * i);
+
+    work.resize(elem.GetSizeWorkSumFactorization(N));
+    gemmInt.resize(nInt * (nDim + 1) * N);
+    sumFactInt.resize(gemmInt.size());
+    gemmDOF.resize(nDOFs * N);
+    sumFactDOF.resize(gemmDOF.size());
+  }
+
+  void Gemm(CBlasStructure& blas, bool derivatives) {
+    blas.gemm(nInt * (derivatives ? nDim + 1 : 1), N, nDOFs, elem.GetMatBasisFunctionsIntegration(), dofData.data(),
+              gemmInt.data(), nullptr);
+  }
+  void SumFact(bool derivatives) {
+    elem.SumFactInterpolation(N, derivatives, dofData.data(), sumFactInt.data(), work.data());
+  }
+};
+
+su2double MaxDifference(const std::vector<su2double>& a, const std::vector<su2double>& b) {
+  su2double diff = 0;
+  for (size_t i = 0; i < a.size(); ++i) diff = std::max(diff, std::abs(a[i] - b[i]));
+  return diff;
+}
+}  // namespace
+
+TEST_CASE("Sum factorization matches the dense matrix products", "[FEM]") {
+  CBlasStructure blas;
+
+  for (const unsigned short VTK_Type : {QUADRILATERAL, HEXAHEDRON}) {
+    for (unsigned short nPoly = 1; nPoly <= 5; ++nPoly) {
+      SumFactData data(VTK_Type, nPoly);
+      REQUIRE(data.elem.GetTensorProduct());
+
+      /*--- Interpolation of the solution and its parametric gradients. ---*/
+      data.Gemm(blas, true);
+      data.SumFact(true);
+      CHECK(MaxDifference(data.gemmInt, data.sumFactInt) < 1e-11);
+
+      /*--- Integration against the derivatives of the basis functions (fluxes). ---*/
+      blas.gemm(data.nDOFs, data.N, data.nInt * data.nDim, data.elem.GetDerMatBasisFunctionsIntTrans(),
+                data.intData.data(), data.gemmDOF.data(), nullptr);
+      data.elem.SumFactDerIntegration(data.N, data.intData.data(), data.sumFactDOF.data(), data.work.data());
+      CHECK(MaxDifference(data.gemmDOF, data.sumFactDOF) < 1e-11);
+
+      /*--- Integration against the basis functions (source terms). ---*/
+      blas.gemm(data.nDOFs, data.N, data.nInt, data.elem.GetBasisFunctionsIntegrationTrans(), data.intData.data(),
+                data.gemmDOF.data(), nullptr);
+      data.elem.SumFactIntegration(data.N, data.intData.data(), data.sumFactDOF.data(), data.work.data());
+      CHECK(MaxDifference(data.gemmDOF, data.sumFactDOF) < 1e-11);
+    }
+  }
+}
+
+/*--- Not run by default, select it with the tag, e.g. "test_driver [SumFactBenchmark]". ---*/
+TEST_CASE("Sum factorization benchmark", "[.][SumFactBenchmark]") {
+  using Clock = std::chrono::steady_clock;
+  CBlasStructure blas;
+
+  std::cout << "\nInterpolation of the solution and gradients to the integration points (time per element)\n"
+            << std::setw(14) << "Element" << std::setw(6) << "p" << std::setw(14) << "gemm [us]" << std::setw(14)
+            << "sum fact [us]" << std::setw(10) << "speedup" << std::endl;
+
+  for (const unsigned short VTK_Type : {QUADRILATERAL, HEXAHEDRON}) {
+    for (unsigned short nPoly = 1; nPoly <= 8; ++nPoly) {
+      SumFactData data(VTK_Type, nPoly);
+      const int nRep = std::max(10, 20000 / (data.nDOFs * data.nInt));
+
+      auto start = Clock::now();
+      for (int i = 0; i < nRep; ++i) data.Gemm(blas, true);
+      const double tGemm = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / nRep;
+
+      start = Clock::now();
+      for (int i = 0; i < nRep; ++i) data.SumFact(true);
+      const double tSumFact = std::chrono::duration<double, std::micro>(Clock::now() - start).count() / nRep;
+
+      std::cout << std::setw(14) << (VTK_Type == HEXAHEDRON ? "hexahedron" : "quadrilateral") << std::setw(6)
+                << nPoly << std::setw(14) << tGemm << std::setw(14) << tSumFact << std::setw(10)
+                << tGemm / tSumFact << std::endl;
+    }
+  }
+}
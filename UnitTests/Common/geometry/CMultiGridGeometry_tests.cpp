@@ -0,0 +1,120 @@
+/*!
+ * \file CMultiGridGeometry_tests.cpp
+ * \brief Unit tests of the agglomeration statistics of the multigrid levels.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <memory>
+#include <sstream>
+
+#include "../../BoxMeshTestCase.hpp"
+#include "../../../Common/include/geometry/CMultiGridGeometry.hpp"
+
+namespace {
+/*!
+ * \brief Box mesh of 16^3 cells with one coarse grid level, walls at y = 0 and y = height.
+ */
+struct CMultiGridBox {
+  BoxMeshTestCase fine;
+  std::unique_ptr<CGeometry> coarse;
+  CGeometry* geometry[2] = {nullptr, nullptr};
+
+  static std::string Options(su2double height, unsigned short lineSize) {
+    std::stringstream options;
+    options << "SOLVER= EULER\n"
+            << "MESH_FORMAT= BOX\n"
+            << "MESH_BOX_SIZE= 17,17,17\n"
+            << "MESH_BOX_LENGTH= 1," << height << ",1\n"
+            << "MESH_BOX_OFFSET= 0,0,0\n"
+            << "MGLEVEL= 1\n"
+            << "MG_LINE_AGGLOMERATION= " << lineSize << "\n"
+            << "MARKER_EULER= (y_minus, y_plus)\n"
+            << "MARKER_FAR= (x_minus, x_plus, z_minus, z_plus)\n";
+    return options.str();
+  }
+
+  CMultiGridBox(su2double height, unsigned short lineSize) : fine(Options(height, lineSize)) {
+    CScreenOutputSilencer silencer;
+    auto* config = fine.config.get();
+    geometry[0] = fine.geometry.get();
+
+    /*--- Same steps as the driver. ---*/
+    auto* mg = new CMultiGridGeometry(geometry[0], config, 1);
+    coarse.reset(mg);
+    geometry[1] = mg;
+    mg->SetPoint_Connectivity(geometry[0]);
+    mg->SetEdges();
+    mg->SetVertex(geometry[0], config);
+    mg->SetControlVolume(geometry[0], ALLOCATE);
+    mg->SetBoundControlVolume(geometry[0], config, ALLOCATE);
+    mg->SetCoord(geometry[0]);
+    mg->FindNormal_Neighbor(config);
+    mg->SetMGLevel(1);
+  }
+
+  vector<CMultiGridGeometry::AgglomerationStatistics> Statistics() const {
+    REQUIRE(fine.config->GetnMGLevels() == 1);
+    return CMultiGridGeometry::ComputeAgglomerationStatistics(geometry, 1);
+  }
+};
+}  // namespace
+
+TEST_CASE("Agglomeration statistics of a uniform box", "[Geometry]") {
+  const CMultiGridBox box(1.0, 0);
+  const auto stats = box.Statistics();
+  REQUIRE(stats.size() == 2);
+
+  /*--- On the fine grid the anisotropy is 1 for the corners and for the interior points that are not next to
+   *    the boundary, and 1.5 for the other points, whose control volume or some of its neighbors are smaller
+   *    (half, quarter, or eighth of the interior ones). ---*/
+
+  const unsigned long nPoint = 17 * 17 * 17, nIsotropic = 13 * 13 * 13 + 8;
+  CHECK(stats[0].nCV == nPoint);
+  CHECK(stats[0].maxChildren == 1);
+  CHECK(stats[0].nStretched == nPoint - nIsotropic);
+  CHECK(stats[0].maxAspect == Approx(1.5));
+  CHECK(stats[0].avgAspect == Approx((nIsotropic + 1.5 * (nPoint - nIsotropic)) / nPoint));
+
+  CHECK(stats[1].nCV == box.geometry[1]->GetGlobal_nPointDomain());
+  CHECK(stats[1].nCV < stats[0].nCV);
+  CHECK(stats[1].maxChildren > 1);
+}
+
+TEST_CASE("Agglomeration statistics of a stretched box", "[Geometry]") {
+  /*--- The cells are 20 times thinner in y, semi-coarsening along the wall-normal lines gives a less
+   *    anisotropic coarse grid than the isotropic agglomeration. ---*/
+
+  const auto isotropic = CMultiGridBox(0.05, 0).Statistics();
+  const auto directional = CMultiGridBox(0.05, 4).Statistics();
+
+  CHECK(isotropic[0].nStretched == isotropic[0].nCV);
+  CHECK(isotropic[0].avgAspect == Approx(directional[0].avgAspect));
+  CHECK(isotropic[0].avgAspect > 10);
+
+  CHECK(directional[1].maxChildren >= 4);
+  CHECK(directional[1].avgAspect < 0.75 * isotropic[1].avgAspect);
+  CHECK(directional[1].maxAspect < isotropic[1].maxAspect);
+}
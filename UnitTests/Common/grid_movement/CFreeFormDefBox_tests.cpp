@@ -0,0 +1,178 @@
+/*!
+ * \file CFreeFormDefBox_tests.cpp
+ * \brief Unit tests for the evaluation and point inversion of FFD boxes.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/grid_movement/CFreeFormDefBox.hpp"
+
+namespace {
+/*!
+ * \brief Skewed and curved FFD box, trilinear map of a skewed hexahedron plus a smooth perturbation.
+ */
+std::unique_ptr<CFreeFormDefBox> SkewedBox(unsigned short kindBlending) {
+  unsigned short degree[] = {3, 2, 4}, bsplineOrder[] = {3, 3, 3};
+  std::unique_ptr<CFreeFormDefBox> box(new CFreeFormDefBox(degree, bsplineOrder, kindBlending));
+
+  for (unsigned short i = 0; i <= box->lDegree; ++i) {
+    for (unsigned short j = 0; j <= box->mDegree; ++j) {
+      for (unsigned short k = 0; k <= box->nDegree; ++k) {
+        const su2double u = su2double(i) / box->lDegree, v = su2double(j) / box->mDegree;
+        const su2double w = su2double(k) / box->nDegree;
+        su2double* P = box->Coord_Control_Points[i][j][k];
+        P[0] = 2.0 * u + 0.5 * v + 0.3 * w + 0.2 * u * v;
+        P[1] = 0.4 * u + 1.0 * v - 0.2 * w + 0.1 * sin(3.0 * u) * w;
+        P[2] = -0.3 * u + 0.2 * v + 1.5 * w + 0.15 * u * v * w;
+      }
+    }
+  }
+  return box;
+}
+
+/*!
+ * \brief Gradient and Hessian of F(u, v, w) = ||X(u, v, w)-(x, y, z)||^2 evaluated control point by control point,
+ * (the formulation used before the single-pass evaluation, GetDerivative1 to GetDerivative5).
+ */
+void ReferenceGradientHessian(const CFreeFormDefBox& box, const su2double* uvw, const su2double* xyz,
+                              su2double* gradient, su2double hessian[][3]) {
+  auto* const* blending = box.BlendingFunction;
+  const unsigned short lmn[] = {box.lDegree, box.mDegree, box.nDegree};
+
+  /*--- Weight of a control point in X, or in its first or second derivative w.r.t. the given directions. ---*/
+  auto weight = [&](const unsigned short* ijk, int diff, int diff2) {
+    su2double value = 1.0;
+    for (int iDir = 0; iDir < 3; ++iDir) {
+      const int order = (iDir == diff) + (iDir == diff2);
+      value *= (order == 0) ? blending[iDir]->GetBasis(ijk[iDir], uvw[iDir])
+                            : blending[iDir]->GetDerivative(ijk[iDir], uvw[iDir], order);
+    }
+    return value;
+  };
+  auto sum = [&](int iDim, int diff, int diff2) {
+    su2double value = 0.0;
+    unsigned short ijk[3];
+    for (ijk[0] = 0; ijk[0] <= lmn[0]; ++ijk[0])
+      for (ijk[1] = 0; ijk[1] <= lmn[1]; ++ijk[1])
+        for (ijk[2] = 0; ijk[2] <= lmn[2]; ++ijk[2])
+          value += box.Coord_Control_Points[ijk[0]][ijk[1]][ijk[2]][iDim] * weight(ijk, diff, diff2);
+    return value;
+  };
+
+  for (int a = 0; a < 3; ++a) {
+    gradient[a] = 0.0;
+    for (int b = 0; b < 3; ++b) hessian[a][b] = 0.0;
+  }
+  for (int iDim = 0; iDim < 3; ++iDim) {
+    const su2double residual = 2.0 * (sum(iDim, -1, -1) - xyz[iDim]);
+    for (int a = 0; a < 3; ++a) {
+      gradient[a] += residual * sum(iDim, a, -1);
+      for (int b = 0; b < 3; ++b) {
+        hessian[a][b] += 2.0 * sum(iDim, a, -1) * sum(iDim, b, -1) + residual * sum(iDim, a, b);
+      }
+    }
+  }
+}
+
+/*!
+ * \brief Newton iterations with the reference gradient and Hessian.
+ */
+void ReferenceInversion(const CFreeFormDefBox& box, const su2double* xyz, su2double* uvw) {
+  for (int iter = 0; iter < 100; ++iter) {
+    su2double g[3], H[3][3];
+    ReferenceGradientHessian(box, uvw, xyz, g, H);
+
+    const su2double det = H[0][0] * (H[1][1] * H[2][2] - H[1][2] * H[2][1]) -
+                          H[0][1] * (H[1][0] * H[2][2] - H[1][2] * H[2][0]) +
+                          H[0][2] * (H[1][0] * H[2][1] - H[1][1] * H[2][0]);
+    su2double step[3], norm = 0.0;
+    for (int a = 0; a < 3; ++a) {
+      /*--- Cramer's rule, replace column a of H by g. ---*/
+      su2double M[3][3];
+      for (int i = 0; i < 3; ++i)
+        for (int j = 0; j < 3; ++j) M[i][j] = (j == a) ? g[i] : H[i][j];
+      step[a] = (M[0][0] * (M[1][1] * M[2][2] - M[1][2] * M[2][1]) - M[0][1] * (M[1][0] * M[2][2] - M[1][2] * M[2][0]) +
+                 M[0][2] * (M[1][0] * M[2][1] - M[1][1] * M[2][0])) / det;
+      norm += step[a] * step[a];
+    }
+    /*--- Splines are only defined in [0,1], shorten the step if needed. ---*/
+    su2double alpha = 1.0;
+    auto outside = [&]() {
+      bool out = false;
+      for (int a = 0; a < 3; ++a) out |= (uvw[a] - alpha * step[a] < 0.0) || (uvw[a] - alpha * step[a] > 1.0);
+      return out;
+    };
+    while (outside()) alpha *= 0.5;
+    for (int a = 0; a < 3; ++a) uvw[a] -= alpha * step[a];
+    if (sqrt(norm) < 1e-14) break;
+  }
+}
+
+void CheckBox(unsigned short kindBlending) {
+  std::stringstream options;
+  options << "SOLVER= EULER\nFFD_BLENDING= " << (kindBlending == BEZIER ? "BEZIER" : "BSPLINE_UNIFORM") << "\n";
+  CConfig config(options, SU2_COMPONENT::SU2_DEF, false);
+
+  auto box = SkewedBox(kindBlending);
+
+  const su2double targets[][3] = {{0.2, 0.3, 0.4}, {0.75, 0.1, 0.9}, {0.5, 0.85, 0.15}};
+
+  for (const auto* uvwExact : targets) {
+    /*--- Target point, image of known parametric coordinates. ---*/
+    su2double uvw[3] = {uvwExact[0], uvwExact[1], uvwExact[2]}, xyz[3];
+    const su2double* X = box->EvalCartesianCoord(uvw);
+    for (int iDim = 0; iDim < 3; ++iDim) xyz[iDim] = X[iDim];
+
+    /*--- Single-pass gradient and Hessian against the reference, away from the solution. ---*/
+    const su2double uvwOff[] = {0.5 * (uvw[0] + 0.5), 0.5 * (uvw[1] + 0.5), 0.5 * (uvw[2] + 0.5)};
+    su2double g[3], H[3][3], gRef[3], HRef[3][3];
+    box->GetFFDGradientHessian(uvwOff, xyz, g, H);
+    ReferenceGradientHessian(*box, uvwOff, xyz, gRef, HRef);
+    for (int a = 0; a < 3; ++a) {
+      CHECK(SU2_TYPE::GetValue(g[a]) == Approx(SU2_TYPE::GetValue(gRef[a])).margin(1e-12));
+      for (int b = 0; b < 3; ++b)
+        CHECK(SU2_TYPE::GetValue(H[a][b]) == Approx(SU2_TYPE::GetValue(HRef[a][b])).margin(1e-12));
+    }
+
+    /*--- Point inversion from the same guess. ---*/
+    const su2double guess[] = {0.5, 0.5, 0.5};
+    su2double uvwRef[] = {0.5, 0.5, 0.5};
+    ReferenceInversion(*box, xyz, uvwRef);
+    const su2double* uvwNew = box->GetParametricCoord_Iterative(0, xyz, guess, &config);
+
+    for (int a = 0; a < 3; ++a) {
+      CHECK(SU2_TYPE::GetValue(uvwNew[a]) == Approx(SU2_TYPE::GetValue(uvwRef[a])).margin(1e-9));
+      CHECK(SU2_TYPE::GetValue(uvwNew[a]) == Approx(SU2_TYPE::GetValue(uvwExact[a])).margin(1e-9));
+    }
+  }
+}
+}  // namespace
+
+TEST_CASE("FFD point inversion, Bezier", "[FFD]") { CheckBox(BEZIER); }
+
+TEST_CASE("FFD point inversion, uniform B-spline", "[FFD]") { CheckBox(BSPLINE_UNIFORM); }
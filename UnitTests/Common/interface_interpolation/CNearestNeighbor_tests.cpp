@@ -0,0 +1,102 @@
+/*!
+ * \file CNearestNeighbor_tests.cpp
+ * \brief Unit tests of the nearest neighbor interpolation.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <memory>
+#include <sstream>
+
+#include "../../BoxMeshTestCase.hpp"
+#include "../../../Common/include/interface_interpolation/CNearestNeighbor.hpp"
+
+namespace {
+std::unique_ptr<CConfig> ZoneConfig(const char* boxSize, const char* distributed) {
+  std::stringstream options;
+  options << "SOLVER= ELASTICITY\n"
+          << "MESH_FORMAT= BOX\n"
+          << "MESH_BOX_SIZE= " << boxSize << "\n"
+          << "MESH_BOX_LENGTH= 1,1,1\n"
+          << "MESH_BOX_OFFSET= 0,0,0\n"
+          << "MARKER_CLAMPED= ( x_minus )\n"
+          << "MARKER_PRESSURE= ( x_plus, 0, y_minus, 0, y_plus, 0, z_minus, 0, z_plus, 0 )\n"
+          << "MARKER_ZONE_INTERFACE= ( x_minus, x_minus )\n"
+          << "KIND_INTERPOLATION= NEAREST_NEIGHBOR\n"
+          << "NUM_NEAREST_NEIGHBORS= 4\n"
+          << "CONSERVATIVE_INTERPOLATION= NO\n"
+          << "DISTRIBUTED_DONOR_SEARCH= " << distributed << "\n";
+  return BoxMeshTestCase::MakeConfig(options.str());
+}
+
+std::unique_ptr<CGeometry> ZoneGeometry(CConfig* config, unsigned short iZone) {
+  return BoxMeshTestCase::MakeGeometry(config, false, iZone, 2);
+}
+}  // namespace
+
+TEST_CASE("Distributed nearest neighbor search matches the global search", "[Interpolation]") {
+  CScreenOutputSilencer silencer;
+
+  /*--- Two zones that share the x_minus boundary with non-matching meshes, the regular grids give many donors
+   *    at the same distance which must be broken by global index in both searches. ---*/
+
+  std::unique_ptr<CConfig> config[] = {ZoneConfig("3,5,4", "NO"), ZoneConfig("2,4,7", "NO"),
+                                       ZoneConfig("3,5,4", "YES")};
+  std::unique_ptr<CGeometry> geometry[] = {ZoneGeometry(config[0].get(), 0), ZoneGeometry(config[1].get(), 1),
+                                           ZoneGeometry(config[2].get(), 0)};
+
+  /*--- The same target zone with a donor zone that uses each search. ---*/
+
+  CGeometry* mesh[][1] = {{geometry[0].get()}, {geometry[1].get()}, {geometry[2].get()}};
+  CGeometry** inst[][1] = {{mesh[0]}, {mesh[1]}, {mesh[2]}};
+  CGeometry*** globalZones[] = {inst[0], inst[1]};
+  CGeometry*** distributedZones[] = {inst[2], inst[1]};
+  const CConfig* globalConfigs[] = {config[0].get(), config[1].get()};
+  const CConfig* distributedConfigs[] = {config[2].get(), config[1].get()};
+
+  const CNearestNeighbor global(globalZones, globalConfigs, 0, 1);
+  const CNearestNeighbor distributed(distributedZones, distributedConfigs, 0, 1);
+  silencer.Restore();
+
+  const auto markTarget = config[1]->FindInterfaceMarker(0);
+  REQUIRE(markTarget >= 0);
+
+  for (auto iVertex = 0ul; iVertex < geometry[1]->GetnVertex(markTarget); ++iVertex) {
+    const auto iPoint = geometry[1]->vertex[markTarget][iVertex]->GetNode();
+    if (!geometry[1]->nodes->GetDomain(iPoint)) continue;
+
+    const auto& expected = global.targetVertices[markTarget][iVertex];
+    const auto& donors = distributed.targetVertices[markTarget][iVertex];
+    CAPTURE(iVertex);
+    REQUIRE(expected.nDonor() == 4);
+    REQUIRE(donors.nDonor() == expected.nDonor());
+
+    for (auto iDonor = 0ul; iDonor < expected.nDonor(); ++iDonor) {
+      CHECK(donors.globalPoint[iDonor] == expected.globalPoint[iDonor]);
+      CHECK(donors.processor[iDonor] == expected.processor[iDonor]);
+      CHECK(donors.coefficient[iDonor] == expected.coefficient[iDonor]);
+    }
+  }
+}
@@ -0,0 +1,131 @@
+/*!
+ * \file CSlidingMesh_tests.cpp
+ * \brief Unit tests of the closest donor search of the sliding mesh interpolation.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <memory>
+#include <utility>
+
+#include "../../../Common/include/interface_interpolation/CSlidingMesh.hpp"
+#include "../../../Common/include/option_structure.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+
+/*!
+ * \brief Gives the tests access to the protected members of CSlidingMesh.
+ */
+struct CSlidingMeshTest {
+  template <class... Ts>
+  static unsigned long FindClosestDonor(Ts&&... args) {
+    return CSlidingMesh::FindClosestDonor(std::forward<Ts>(args)...);
+  }
+};
+
+namespace {
+/*!
+ * \brief 2D donor boundary made of two disconnected arcs of the unit circle (like the two sides of a periodic gap),
+ *        the vertices of each arc are linked to their neighbors on the arc.
+ */
+struct CTwoArcsBoundary {
+  static constexpr unsigned short nDim = 2;
+  static constexpr unsigned long nArc = 40;
+  static constexpr unsigned long nDonor = 2 * nArc;
+
+  su2activematrix coord;
+  su2vector<unsigned long> linkedNodes, startLinkedNodes, nLinkedNodes;
+
+  CTwoArcsBoundary() : coord(nDonor, nDim), startLinkedNodes(nDonor), nLinkedNodes(nDonor) {
+    /*--- The arcs span [0.1, 2.9] and [PI+0.1, PI+2.9] rad, slightly non-uniform to avoid ties. ---*/
+    for (unsigned long iArc = 0; iArc < 2; iArc++) {
+      for (unsigned long i = 0; i < nArc; i++) {
+        const auto s = su2double(i) / (nArc - 1);
+        const auto angle = iArc * PI_NUMBER + 0.1 + 2.8 * (s + 0.02 * s * (1 - s));
+        coord(iArc * nArc + i, 0) = cos(angle);
+        coord(iArc * nArc + i, 1) = sin(angle);
+      }
+    }
+    vector<unsigned long> links;
+    for (unsigned long iPoint = 0; iPoint < nDonor; iPoint++) {
+      startLinkedNodes[iPoint] = links.size();
+      const auto i = iPoint % nArc;
+      if (i > 0) links.push_back(iPoint - 1);
+      if (i + 1 < nArc) links.push_back(iPoint + 1);
+      nLinkedNodes[iPoint] = links.size() - startLinkedNodes[iPoint];
+    }
+    linkedNodes.resize(links.size());
+    for (auto i = 0ul; i < links.size(); i++) linkedNodes[i] = links[i];
+  }
+
+  unsigned long BruteForce(const su2double* point) const {
+    unsigned long closest = 0;
+    su2double minDist = GeometryToolbox::Distance(nDim, point, coord[0]);
+    for (unsigned long iPoint = 1; iPoint < nDonor; iPoint++) {
+      const su2double dist = GeometryToolbox::Distance(nDim, point, coord[iPoint]);
+      if (dist < minDist) {
+        minDist = dist;
+        closest = iPoint;
+      }
+    }
+    return closest;
+  }
+
+  unsigned long Find(const su2double* point, unsigned long guess, std::unique_ptr<CADTPointsOnlyClass>& tree) const {
+    return CSlidingMeshTest::FindClosestDonor(nDim, point, coord, linkedNodes, startLinkedNodes, nLinkedNodes,
+                                              nDonor, guess, tree);
+  }
+};
+}  // namespace
+
+TEST_CASE("Sliding mesh closest donor search", "[Interpolation]") {
+  const CTwoArcsBoundary donor;
+
+  /*--- Target vertices on a slightly larger circle, rotated a little at each step as in a sliding interface,
+   *    the closest donors of each step are the guesses of the next. ---*/
+
+  const unsigned long nTarget = 57;
+  vector<unsigned long> guess(nTarget, donor.nDonor);
+
+  for (int iStep = 0; iStep < 20; iStep++) {
+    std::unique_ptr<CADTPointsOnlyClass> tree;
+
+    for (unsigned long iTarget = 0; iTarget < nTarget; iTarget++) {
+      const su2double angle = 2 * PI_NUMBER * (iTarget + 0.37) / nTarget + 0.05 * iStep;
+      const su2double point[] = {1.01 * cos(angle), 1.01 * sin(angle)};
+
+      guess[iTarget] = donor.Find(point, guess[iTarget], tree);
+      CAPTURE(iStep, iTarget);
+      CHECK(guess[iTarget] == donor.BruteForce(point));
+    }
+  }
+
+  /*--- The walk stalls at the end of an arc when the point is closer to the other arc. ---*/
+
+  std::unique_ptr<CADTPointsOnlyClass> tree;
+  const su2double point[] = {cos(PI_NUMBER + 0.2), sin(PI_NUMBER + 0.2)};
+  CHECK(donor.Find(point, donor.nArc - 1, tree) == donor.BruteForce(point));
+  CHECK(tree != nullptr);
+}
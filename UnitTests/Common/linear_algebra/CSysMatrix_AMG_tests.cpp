@@ -0,0 +1,163 @@
+/*!
+ * \file CSysMatrix_AMG_tests.cpp
+ * \brief Unit tests of the algebraic multigrid preconditioner of CSysMatrix.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../../BoxMeshTestCase.hpp"
+#include "../../../Common/include/toolboxes/geometry_toolbox.hpp"
+#include "../../../Common/include/linear_algebra/CMatrixVectorProduct.hpp"
+#include "../../../Common/include/linear_algebra/CPreconditioner.hpp"
+#include "../../../Common/include/linear_algebra/CSysSolve.hpp"
+
+namespace {
+/*!
+ * \brief Finite volume discretization of -div(grad u) + u = f on a box mesh (MESH_FORMAT= BOX), with
+ * Dirichlet conditions imposed weakly on all boundaries. The mesh is partitioned over all ranks.
+ */
+struct CPoissonBoxCase : BoxMeshTestCase {
+  static constexpr unsigned long nCells = 24;
+
+  static std::string Options(const std::string& prec, unsigned long nCells) {
+    std::stringstream options;
+    options << "SOLVER= EULER\n"
+            << "MESH_FORMAT= BOX\n"
+            << "MESH_BOX_SIZE= " << nCells << "," << nCells << "," << nCells << "\n"
+            << "MESH_BOX_LENGTH= 1,1,1\n"
+            << "MESH_BOX_OFFSET= 0,0,0\n"
+            << "MARKER_FAR= (x_minus, x_plus, y_minus, y_plus, z_plus, z_minus)\n"
+            << "LINEAR_SOLVER_PREC= " << prec << "\n";
+    return options.str();
+  }
+
+  static std::unique_ptr<CConfig> MakeConfig(const std::string& prec, unsigned long nCells) {
+    return BoxMeshTestCase::MakeConfig(Options(prec, nCells));
+  }
+
+  CPoissonBoxCase() : BoxMeshTestCase(Options("JACOBI", nCells)) {}
+
+  /*!
+   * \brief Assemble the matrix, the sparse pattern and the type of preconditioner come from the config.
+   */
+  void Assemble(const CConfig* prec_config, CSysMatrix<su2double>& matrix) const {
+    const auto nDim = geometry->GetnDim();
+    matrix.Initialize(geometry->GetnPoint(), geometry->GetnPointDomain(), 1, 1, true, geometry.get(), prec_config);
+
+    for (auto iEdge = 0ul; iEdge < geometry->GetnEdge(); ++iEdge) {
+      const auto iPoint = geometry->edges->GetNode(iEdge, 0);
+      const auto jPoint = geometry->edges->GetNode(iEdge, 1);
+      const auto* normal = geometry->edges->GetNormal(iEdge);
+      const auto* coord_i = geometry->nodes->GetCoord(iPoint);
+      const auto* coord_j = geometry->nodes->GetCoord(jPoint);
+      su2double area2 = 0, proj = 0;
+      for (auto iDim = 0u; iDim < nDim; ++iDim) {
+        area2 += pow(normal[iDim], 2);
+        proj += normal[iDim] * (coord_j[iDim] - coord_i[iDim]);
+      }
+      const su2double weight = area2 / proj;
+      matrix.AddVal2Diag(iPoint, weight);
+      matrix.AddVal2Diag(jPoint, weight);
+      matrix.AddBlock(iPoint, jPoint, &weight, su2double(-1));
+      matrix.AddBlock(jPoint, iPoint, &weight, su2double(-1));
+    }
+    for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+      matrix.AddVal2Diag(iPoint, geometry->nodes->GetVolume(iPoint));
+    }
+    for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker) {
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        const auto* normal = geometry->vertex[iMarker][iVertex]->GetNormal();
+        /*--- The boundary point is half a cell (of the finest spacing) away from the imposed value. ---*/
+        matrix.AddVal2Diag(iPoint, 2.0 * nCells * GeometryToolbox::Norm(nDim, normal));
+      }
+    }
+  }
+};
+
+/*!
+ * \brief Solve A x = A x_exact with PCG and return the number of iterations and the max error over all ranks.
+ */
+std::pair<unsigned long, passivedouble> SolvePoisson(const CPoissonBoxCase& box, const std::string& prec) {
+  const auto* geometry = box.geometry.get();
+  auto config = CPoissonBoxCase::MakeConfig(prec, box.nCells);
+
+  CSysMatrix<su2double> matrix;
+  box.Assemble(config.get(), matrix);
+
+  const auto nPoint = geometry->GetnPoint();
+  const auto nPointDomain = geometry->GetnPointDomain();
+  CSysVector<su2double> exact(nPoint, nPointDomain, 1, 0.0), rhs(nPoint, nPointDomain, 1, 0.0),
+      sol(nPoint, nPointDomain, 1, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint) {
+    const auto* coord = geometry->nodes->GetCoord(iPoint);
+    exact(iPoint, 0) = sin(PI_NUMBER * coord[0]) * cos(10 * coord[1]) + coord[2];
+  }
+
+  CSysMatrixVectorProduct<su2double> mat_vec(matrix, box.geometry.get(), config.get());
+  mat_vec(exact, rhs);
+
+  const auto kindPrec = static_cast<ENUM_LINEAR_SOLVER_PREC>(config->GetKind_Linear_Solver_Prec());
+  std::unique_ptr<CPreconditioner<su2double>> precond(
+      CPreconditioner<su2double>::Create(kindPrec, matrix, box.geometry.get(), config.get()));
+  precond->Build();
+
+  CSysSolve<su2double> solver;
+  su2double residual = 0;
+  const auto nIter = solver.CG_LinSolver(rhs, sol, mat_vec, *precond, 1e-10, 1000, residual, false, config.get());
+
+  passivedouble error = 0, maxError = 0;
+  for (auto iPoint = 0ul; iPoint < nPointDomain; ++iPoint) {
+    error = max(error, fabs(SU2_TYPE::GetValue(sol(iPoint, 0) - exact(iPoint, 0))));
+  }
+  SU2_MPI::Allreduce(&error, &maxError, 1, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+
+  return {nIter, maxError};
+}
+}  // namespace
+
+TEST_CASE("AMG preconditioned CG on a Poisson problem", "[Linear Algebra]") {
+  /*--- The hierarchy is local to each rank, the solution must still be that of the global (partitioned) system,
+   *    run the test driver with mpirun to check it on more than one rank. ---*/
+  const CPoissonBoxCase box;
+
+  std::map<std::string, std::pair<unsigned long, passivedouble>> results;
+  for (const std::string prec : {"JACOBI", "ILU", "AMG"}) {
+    results[prec] = SolvePoisson(box, prec);
+    CAPTURE(prec, results[prec].first);
+    CHECK(results[prec].second < 1e-6);
+  }
+
+  /*--- The number of iterations of the single level preconditioners grows with the mesh size, not that of AMG. ---*/
+  CHECK(results["AMG"].first < results["ILU"].first);
+  CHECK(2 * results["AMG"].first < results["JACOBI"].first);
+}
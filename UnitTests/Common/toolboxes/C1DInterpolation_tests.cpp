@@ -72,3 +72,33 @@ TEST_CASE("C1DInterpolation", "[Toolboxes]") {
     CHECK(L(x[i]) == Approx(0.5 * (y[i] + y[i + 1])));
   }
 }
+
+TEST_CASE("CHermiteTable", "[Toolboxes]") {
+  /*--- Cubics are represented exactly, including the derivative. ---*/
+  const auto func = [](su2double x, su2double& dfdx) {
+    dfdx = -1 + x * (-2 + 3 * x);
+    return myPoly(x);
+  };
+  const CHermiteTable table(-1.5, 2.0, 8, func);
+
+  CHECK(table.InRange(-1.5));
+  CHECK(table.InRange(2.0));
+  CHECK_FALSE(table.InRange(2.1));
+
+  for (su2double x = -1.5; x <= 2.0; x += 0.13) {
+    su2double dfdx, ref;
+    const auto f = table.Evaluate(x, dfdx);
+    CHECK(f == Approx(func(x, ref)));
+    CHECK(dfdx == Approx(ref));
+  }
+
+  /*--- Smooth functions converge with the fourth power of the spacing. ---*/
+  const auto exp_func = [](su2double x, su2double& dfdx) { return dfdx = exp(x); };
+  const CHermiteTable coarse(0, 1, 11, exp_func), fine(0, 1, 21, exp_func);
+  su2double errCoarse = 0, errFine = 0;
+  for (su2double x = 0.01; x < 1; x += 0.02) {
+    errCoarse = std::max(errCoarse, abs(coarse(x) - exp(x)));
+    errFine = std::max(errFine, abs(fine(x) - exp(x)));
+  }
+  CHECK(errCoarse / errFine == Approx(16).epsilon(0.1));
+}
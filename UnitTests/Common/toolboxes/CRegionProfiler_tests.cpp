@@ -0,0 +1,153 @@
+/*!
+ * \file CRegionProfiler_tests.cpp
+ * \brief Unit tests for the built-in region timers.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#ifdef __linux__
+#include <dirent.h>
+#endif
+#include "../../../Common/include/tracy_structure.hpp"
+
+namespace {
+void InnerRegion() { SU2_ZONE_SCOPED_N("Inner"); }
+
+/*!
+ * \brief Number of file descriptors open in the process, -1 if it cannot be determined.
+ */
+int OpenFileDescriptors() {
+  int count = -1;
+#ifdef __linux__
+  if (auto* dir = opendir("/proc/self/fd")) {
+    count = 0;
+    while (readdir(dir)) ++count;
+    closedir(dir);
+  }
+#endif
+  return count;
+}
+
+/*!
+ * \brief Column of a line of the CSV report.
+ */
+std::string Column(const std::string& line, int column) {
+  std::stringstream ss(line);
+  std::string value;
+  for (int i = 0; i <= column; ++i) std::getline(ss, value, ',');
+  return value;
+}
+}  // namespace
+
+TEST_CASE("Region profiler report", "[Toolboxes]") {
+  CHECK(CRegionProfiler::Register("Inner") == CRegionProfiler::Register("Inner"));
+
+  CRegionProfiler::Enable(true);
+  {
+    SU2_ZONE_SCOPED_N("Outer");
+    for (int i = 0; i < 3; ++i) InnerRegion();
+
+    /*--- Regions of worker threads are attached under the region of the master. ---*/
+    SU2_OMP_PARALLEL
+    { InnerRegion(); }
+    END_SU2_OMP_PARALLEL
+  }
+  InnerRegion();
+
+  const std::string name = "region_profiler_test";
+  CRegionProfiler::WriteReport(name);
+  CRegionProfiler::Enable(false);
+
+  int rank = 0;
+  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
+  if (rank != 0) return;
+
+  std::ifstream csv(name + ".csv");
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(csv, line);) lines.push_back(line);
+
+  REQUIRE(lines.size() == 4);
+  CHECK(lines[1].rfind("\"Inner\",0,1,", 0) == 0);
+  CHECK(lines[2].rfind("\"Outer\",0,1,", 0) == 0);
+  CHECK(lines[3].rfind("\"Outer/Inner\",1,4,", 0) == 0);
+
+  std::remove((name + ".csv").c_str());
+  std::remove((name + ".json").c_str());
+}
+
+TEST_CASE("Region profiler flops and hardware counters", "[Toolboxes]") {
+  const int fdsBefore = OpenFileDescriptors();
+
+  /*--- The counters may not be available (e.g. in containers), opening and closing them must not fail or leak. ---*/
+  CRegionProfiler::Enable(true, true);
+  {
+    SU2_ZONE_SCOPED_N("FlopsOuter");
+    CRegionProfiler::AddFlops(10);
+    {
+      SU2_ZONE_SCOPED_N("FlopsInner");
+      CRegionProfiler::AddFlops(5);
+    }
+    SU2_OMP_PARALLEL
+    { SU2_ZONE_SCOPED_N("FlopsInner"); }
+    END_SU2_OMP_PARALLEL
+  }
+  /*--- Outside of any region the operations are not attributed. ---*/
+  CRegionProfiler::AddFlops(1000);
+
+  const std::string name = "region_profiler_flops_test";
+  auto orig_buf = std::cout.rdbuf();
+  std::cout.rdbuf(nullptr);
+  CRegionProfiler::WriteReport(name);
+  std::cout.rdbuf(orig_buf);
+  CRegionProfiler::Enable(false);
+
+  /*--- All counters of the groups of all threads are closed. ---*/
+  CHECK(OpenFileDescriptors() == fdsBefore);
+
+  int rank = 0, size = 1;
+  SU2_MPI::Comm_rank(SU2_MPI::GetComm(), &rank);
+  SU2_MPI::Comm_size(SU2_MPI::GetComm(), &size);
+  if (rank != 0) return;
+
+  std::ifstream csv(name + ".csv");
+  std::vector<std::string> lines;
+  for (std::string line; std::getline(csv, line);) lines.push_back(line);
+
+  /*--- The flops are inclusive and summed over ranks. ---*/
+  REQUIRE(lines.size() == 3);
+  CHECK(Column(lines[1], 0) == "\"FlopsOuter\"");
+  CHECK(std::stod(Column(lines[1], 7)) == Approx(15.0 * size));
+  CHECK(Column(lines[2], 0) == "\"FlopsOuter/FlopsInner\"");
+  CHECK(std::stod(Column(lines[2], 7)) == Approx(5.0 * size));
+
+  std::remove((name + ".csv").c_str());
+  std::remove((name + ".json").c_str());
+}
+
@@ -0,0 +1,158 @@
+/*!
+ * \file chemistry_split.cpp
+ * \brief Unit tests of the operator split integration of the finite rate chemistry.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <vector>
+
+#include "../BoxMeshTestCase.hpp"
+#include "../../SU2_CFD/include/numerics/NEMO/NEMO_sources.hpp"
+#include "../../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../../SU2_CFD/include/solvers/CSolverFactory.hpp"
+
+namespace {
+/*!
+ * \brief Solution of a thermal bath (uniform N2 at rest in a closed box, i.e. a 0-D reactor) after a few time steps.
+ * \param[in] split - Whether the chemistry is integrated in a separate stage or as part of the source residual.
+ * \param[in] timeStep - Physical time step.
+ * \param[in] nTimeIter - Number of time steps.
+ * \param[out] initial - Initial solution of the first point.
+ * \return Final solution of the first point.
+ */
+std::vector<su2double> ThermalBath(bool split, su2double timeStep, unsigned long nTimeIter,
+                                   std::vector<su2double>& initial) {
+  std::stringstream options;
+  options << "SOLVER= NEMO_EULER\n"
+          << "GAS_MODEL= N2\n"
+          << "GAS_COMPOSITION= (0.666667, 0.333333)\n"
+          << "FLUID_MODEL= SU2_NONEQ\n"
+          << "MESH_FORMAT= BOX\n"
+          << "MESH_BOX_SIZE= 3,3,3\n"
+          << "MESH_BOX_LENGTH= 1,1,1\n"
+          << "MESH_BOX_OFFSET= 0,0,0\n"
+          << "MACH_NUMBER= 0.0\n"
+          << "FREESTREAM_PRESSURE= 101325.0\n"
+          << "FREESTREAM_TEMPERATURE= 30000\n"
+          << "FREESTREAM_TEMPERATURE_VE= 30000\n"
+          << "CONV_NUM_METHOD_FLOW= AUSM\n"
+          << "MUSCL_FLOW= NO\n"
+          << "TIME_DOMAIN= YES\n"
+          << "TIME_MARCHING= TIME_STEPPING\n"
+          << "TIME_DISCRE_FLOW= EULER_EXPLICIT\n"
+          << "TIME_STEP= " << timeStep << "\n"
+          << "UNST_CFL_NUMBER= 0.0\n"
+          << "CHEMISTRY_OPERATOR_SPLIT= " << (split ? "YES" : "NO") << "\n"
+          << "MGLEVEL= 0\n"
+          << "MARKER_SYM= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n";
+
+  const BoxMeshTestCase box(options.str());
+  const auto& config = box.config;
+  const auto& geometry = box.geometry;
+
+  CScreenOutputSilencer silencer;
+
+  auto** solvers = CSolverFactory::CreateSolverContainer(config->GetKind_Solver(), config.get(), geometry.get(), MESH_0);
+  auto* flow = solvers[FLOW_SOL];
+  auto* nodes = flow->GetNodes();
+  const auto nVar = flow->GetnVar();
+
+  const auto nThread = omp_get_max_threads();
+  std::vector<CNumerics*> numerics(nThread * MAX_TERMS, nullptr);
+  for (auto iThread = 0; iThread < nThread; ++iThread) {
+    numerics[iThread * MAX_TERMS + SOURCE_FIRST_TERM] =
+        new CSource_NEMO(3, nVar, flow->GetnPrimVar(), flow->GetnPrimVarGrad(), config.get());
+  }
+
+  initial.assign(nodes->GetSolution(0), nodes->GetSolution(0) + nVar);
+
+  /*--- The state is uniform and at rest, the convective fluxes vanish and only the sources are integrated. ---*/
+
+  for (auto timeIter = 0ul; timeIter < nTimeIter; ++timeIter) {
+    config->SetTimeIter(timeIter);
+    config->SetGlobalParam(config->GetKind_Solver(), RUNTIME_FLOW_SYS);
+    SU2_OMP_PARALLEL {
+      auto** threadNumerics = numerics.data() + omp_get_thread_num() * MAX_TERMS;
+      flow->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, 0, RUNTIME_FLOW_SYS, false);
+      flow->Set_OldSolution();
+      flow->SetTime_Step(geometry.get(), solvers, config.get(), MESH_0, timeIter);
+      flow->Source_Residual(geometry.get(), solvers, threadNumerics, config.get(), MESH_0);
+      flow->ExplicitEuler_Iteration(geometry.get(), solvers, config.get());
+    }
+    END_SU2_OMP_PARALLEL
+  }
+  silencer.Restore();
+
+  std::vector<su2double> final(nodes->GetSolution(0), nodes->GetSolution(0) + nVar);
+
+  for (auto* num : numerics) delete num;
+  for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) delete solvers[iSol];
+  delete[] solvers;
+
+  return final;
+}
+}  // namespace
+
+TEST_CASE("Split chemistry matches the unsplit source in a 0-D reactor", "[NEMO]") {
+  std::vector<su2double> initial;
+
+  /*--- The same time interval with two time steps, the splitting error is first order. ---*/
+
+  const auto unsplit = ThermalBath(false, 1e-9, 20, initial);
+  const auto split = ThermalBath(true, 1e-9, 20, initial);
+  const auto unsplitFine = ThermalBath(false, 5e-10, 40, initial);
+  const auto splitFine = ThermalBath(true, 5e-10, 40, initial);
+  const auto nVar = initial.size();
+  const auto iEve = nVar - 1;
+
+  const su2double density = initial[0] + initial[1];
+  const su2double dissociated = unsplit[1] - initial[1];
+
+  /*--- The chemistry is not trivial, the gas dissociates noticeably. ---*/
+  CHECK(dissociated > 0.1 * density);
+
+  /*--- Mass and total energy are conserved, the momentum remains zero. ---*/
+  CHECK(split[0] + split[1] == Approx(density).epsilon(1e-12));
+  for (auto iVar = 2u; iVar < iEve; ++iVar) {
+    CAPTURE(iVar);
+    CHECK(split[iVar] == Approx(unsplit[iVar]).epsilon(1e-12).margin(1e-12));
+  }
+
+  /*--- The species densities and the vib.-el. energy (which receives the energy of the species created by the
+   *    chemistry) agree with the unsplit source, and the difference halves with the time step. ---*/
+
+  for (auto iVar : {0ul, 1ul, iEve}) {
+    CAPTURE(iVar);
+    const su2double scale = iVar < 2 ? dissociated : unsplit[iEve];
+    const su2double diff = fabs(split[iVar] - unsplit[iVar]);
+    const su2double diffFine = fabs(splitFine[iVar] - unsplitFine[iVar]);
+    CHECK(diff < 0.01 * scale);
+    CHECK(diffFine < 0.6 * diff);
+  }
+}
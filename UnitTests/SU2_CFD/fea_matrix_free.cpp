@@ -0,0 +1,146 @@
+/*!
+ * \file fea_matrix_free.cpp
+ * \brief Unit tests of the matrix-free stiffness operator of the elasticity solvers.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "../BoxMeshTestCase.hpp"
+#include "../../SU2_CFD/include/numerics/elasticity/CFEALinearElasticity.hpp"
+#include "../../SU2_CFD/include/solvers/CFEASolver.hpp"
+
+namespace {
+/*!
+ * \brief Exposes the matrix-free operator and the essential BC of the elasticity solver.
+ */
+class CFEASolverMatrixFreeTest final : public CFEASolver {
+ public:
+  using CFEASolver::CFEASolver;
+
+  void SetMatrixFree() { InitializeMatrixFree(); }
+
+  void Fix(unsigned long iPoint) {
+    const su2double zero[MAXNVAR] = {0.0};
+    EnforceSolutionAtNode(iPoint, zero);
+  }
+
+  void Slide(unsigned long iPoint, const su2double* normal) { EnforceZeroProjection(iPoint, normal); }
+
+  /*!
+   * \brief Largest difference between the matrix-free operator and the Jacobian applied to u.
+   */
+  su2double ProductDifference(CGeometry* geometry, CNumerics** numerics, CConfig* config,
+                              const CSysVector<JacobianScalarType>& u, bool constrained) {
+    MatrixFreeGeometry = geometry;
+    MatrixFreeNumerics = numerics;
+    MatrixFreeConfig = config;
+
+    CSysVector<JacobianScalarType> matrixFree(nPoint, nPointDomain, nVar, 0.0), assembled(matrixFree);
+
+    SU2_OMP_PARALLEL {
+      ApplyMatrixFreeOperator(u, matrixFree, constrained);
+      Jacobian.MatrixVectorProduct(u, assembled, geometry, config);
+    }
+    END_SU2_OMP_PARALLEL
+
+    su2double diff = 0.0;
+    for (auto i = 0ul; i < nPointDomain * nVar; ++i) diff = max(diff, su2double(fabs(matrixFree[i] - assembled[i])));
+    return diff;
+  }
+};
+}  // namespace
+
+TEST_CASE("Matrix-free stiffness operator matches the assembled Jacobian", "[FEA]") {
+  const BoxMeshTestCase box(
+      "SOLVER= ELASTICITY\n"
+      "MESH_FORMAT= BOX\n"
+      "MESH_BOX_SIZE= 5,4,3\n"
+      "MESH_BOX_LENGTH= 2,1,0.5\n"
+      "MESH_BOX_OFFSET= 0,0,0\n"
+      "ELASTICITY_MODULUS= 1000\n"
+      "POISSON_RATIO= 0.3\n"
+      "MARKER_CLAMPED= ( x_minus )\n"
+      "MARKER_PRESSURE= ( x_plus, 0, y_minus, 0, y_plus, 0, z_minus, 0, z_plus, 0 )\n",
+      false);
+  const auto& config = box.config;
+  const auto& geometry = box.geometry;
+
+  CScreenOutputSilencer silencer;
+  CFEASolverMatrixFreeTest solver(geometry.get(), config.get());
+
+  const auto nThread = omp_get_max_threads();
+  std::vector<CNumerics*> numerics(nThread * MAX_TERMS, nullptr);
+  for (auto iThread = 0; iThread < nThread; ++iThread)
+    numerics[iThread * MAX_TERMS + FEA_TERM] = new CFEALinearElasticity(3, 3, config.get());
+
+  solver.Compute_StiffMatrix(geometry.get(), numerics.data(), config.get());
+  silencer.Restore();
+
+  const auto nPoint = geometry->GetnPoint();
+  CSysVector<CSolver::JacobianScalarType> u(nPoint, geometry->GetnPointDomain(), 3, 0.0);
+  for (auto iPoint = 0ul; iPoint < nPoint; ++iPoint)
+    for (auto iDim = 0u; iDim < 3; ++iDim) u(iPoint, iDim) = sin(1.0 + iPoint + 7.0 * iDim);
+
+  /*--- Operator without essential BC. ---*/
+
+  CHECK(solver.ProductDifference(geometry.get(), numerics.data(), config.get(), u, false) < 1e-10);
+
+  /*--- Points of x_minus are fixed and points of y_minus slide on the plane. The constrained operators differ
+   *    only in the normal-normal entry of the sliding points, which does not act on vectors tangent to the
+   *    plane (as the Krylov iterates). Apply the same BC first to the Jacobian then to the matrix-free operator. ---*/
+
+  const auto xMinus = config->GetMarker_CfgFile_TagBound("x_minus");
+  const auto yMinus = config->GetMarker_CfgFile_TagBound("y_minus");
+  const su2double normal[] = {0.0, -1.0, 0.0};
+
+  for (auto matrixFree : {false, true}) {
+    if (matrixFree) solver.SetMatrixFree();
+
+    for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker) {
+      const auto tag = config->GetMarker_All_TagBound(iMarker);
+      if (config->GetMarker_CfgFile_TagBound(tag) != xMinus) continue;
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex)
+        solver.Fix(geometry->vertex[iMarker][iVertex]->GetNode());
+    }
+    for (auto iMarker = 0u; iMarker < geometry->GetnMarker(); ++iMarker) {
+      const auto tag = config->GetMarker_All_TagBound(iMarker);
+      if (config->GetMarker_CfgFile_TagBound(tag) != yMinus) continue;
+      for (auto iVertex = 0ul; iVertex < geometry->GetnVertex(iMarker); ++iVertex) {
+        const auto iPoint = geometry->vertex[iMarker][iVertex]->GetNode();
+        if (geometry->nodes->GetCoord(iPoint, 0) < 1e-8) continue;
+        solver.Slide(iPoint, normal);
+        if (!matrixFree) u(iPoint, 1) = 0.0;
+      }
+    }
+  }
+
+  CHECK(solver.ProductDifference(geometry.get(), numerics.data(), config.get(), u, true) < 1e-10);
+
+  for (auto* num : numerics) delete num;
+}
@@ -0,0 +1,155 @@
+/*!
+ * \file CSU2TCLib_tests.cpp
+ * \brief Unit tests for the tabulated thermochemistry of the SU2TCLib gas models.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include "../../../SU2_CFD/include/fluid/CSU2TCLib.hpp"
+
+namespace {
+std::unique_ptr<CConfig> MakeConfig(bool tabulate) {
+  std::stringstream ss(
+      "SOLVER= NEMO_EULER\n"
+      "FLUID_MODEL= SU2_NONEQ\n"
+      "GAS_MODEL= AIR-5\n"
+      "GAS_COMPOSITION= (0.77, 0.23, 0.0, 0.0, 0.0)\n"
+      "TABULATE_THERMOCHEMISTRY= " +
+      std::string(tabulate ? "YES" : "NO") + "\n");
+  auto* orig_buf = std::cout.rdbuf(nullptr);
+  std::unique_ptr<CConfig> config(new CConfig(ss, SU2_COMPONENT::SU2_CFD, false));
+  std::cout.rdbuf(orig_buf);
+  return config;
+}
+
+/*--- Partially dissociated air (N2, O2, NO, N, O). ---*/
+std::vector<su2double> PartialDensities() { return {0.6e-2, 0.1e-2, 0.05e-2, 0.15e-2, 0.1e-2}; }
+
+const std::vector<std::pair<su2double, su2double> > Temperatures = {
+    {300, 300}, {1200, 900}, {4000, 2500}, {9000, 6000}, {15000, 8000}, {30000, 20000}};
+}  // namespace
+
+TEST_CASE("Tabulated SU2TCLib thermochemistry", "[NEMO]") {
+  const auto configAnalytic = MakeConfig(false);
+  const auto configTable = MakeConfig(true);
+  CSU2TCLib analytic(configAnalytic.get(), 2, false), tabulated(configTable.get(), 2, false);
+  const auto nSpecies = configAnalytic->GetnSpecies();
+  const auto rhos = PartialDensities();
+  std::vector<su2double> eveRef(nSpecies), eve(nSpecies), cvveRef(nSpecies), cvve(nSpecies);
+
+  for (const auto& temps : Temperatures) {
+    const su2double T = temps.first, Tve = temps.second;
+
+    /*--- Species energies and specific heats. ---*/
+    analytic.ComputeSpeciesEve(Tve, eveRef.data());
+    tabulated.ComputeSpeciesEve(Tve, eve.data());
+    analytic.ComputeSpeciesCvVibEle(Tve, cvveRef.data());
+    tabulated.ComputeSpeciesCvVibEle(Tve, cvve.data());
+    for (auto iSpecies = 0u; iSpecies < nSpecies; ++iSpecies) {
+      CHECK(eve[iSpecies] == Approx(eveRef[iSpecies]).epsilon(1e-7).margin(1e-6));
+      CHECK(cvve[iSpecies] == Approx(cvveRef[iSpecies]).epsilon(1e-6).margin(1e-9));
+    }
+
+    /*--- Mixture energies. ---*/
+    su2double energiesRef[2], energies[2];
+    analytic.ComputeMixtureEnergies(rhos.data(), T, Tve, energiesRef);
+    tabulated.ComputeMixtureEnergies(rhos.data(), T, Tve, energies);
+    CHECK(energies[0] == Approx(energiesRef[0]).epsilon(1e-8));
+    CHECK(energies[1] == Approx(energiesRef[1]).epsilon(1e-7).margin(1e-6));
+
+    /*--- Production rates, relative to the largest. ---*/
+    analytic.SetTDStateRhosTTv(rhos.data(), T, Tve);
+    tabulated.SetTDStateRhosTTv(rhos.data(), T, Tve);
+    const auto wsRef = analytic.ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    const auto& ws = tabulated.ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr);
+    su2double wsMax = 0;
+    for (auto w : wsRef) wsMax = std::max(wsMax, abs(w));
+    for (auto iSpecies = 0u; iSpecies < nSpecies; ++iSpecies) {
+      CHECK(ws[iSpecies] == Approx(wsRef[iSpecies]).epsilon(1e-6).margin(1e-8 * wsMax));
+    }
+  }
+}
+
+TEST_CASE("SU2TCLib temperatures from energies", "[NEMO]") {
+  const auto config = MakeConfig(false);
+  const CSU2TCLib gas(config.get(), 2, false);
+  const auto rhos = PartialDensities();
+  su2double rho = 0;
+  for (auto rhoSpecies : rhos) rho += rhoSpecies;
+
+  /*--- The const interface only uses caller-owned arrays, it inverts ComputeMixtureEnergies. ---*/
+  for (const auto& temps : Temperatures) {
+    /*--- At low Tve the vib.-el. energy is too small to determine the temperature. ---*/
+    if (temps.second < 500) continue;
+    su2double energies[2], T[2];
+    gas.ComputeMixtureEnergies(rhos.data(), temps.first, temps.second, energies);
+    gas.ComputeTemperatures(rhos.data(), rho * energies[0], rho * energies[1], 0, 1000, T);
+    CHECK(T[0] == Approx(temps.first).epsilon(1e-8));
+    CHECK(T[1] == Approx(temps.second).epsilon(1e-6));
+  }
+}
+
+/*--- Not run by default, select it with the tag, e.g. "test_driver [TCLibBenchmark]". ---*/
+TEST_CASE("Tabulated SU2TCLib thermochemistry benchmark", "[.][TCLibBenchmark]") {
+  using Clock = std::chrono::steady_clock;
+  const int nRep = 20000;
+  const auto rhos = PartialDensities();
+
+  std::cout << "\nSU2TCLib AIR-5 (time per evaluation)\n"
+            << std::setw(12) << "Path" << std::setw(14) << "eve+cvve [ns]" << std::setw(14) << "rates [ns]"
+            << std::endl;
+
+  for (const bool tabulate : {false, true}) {
+    const auto config = MakeConfig(tabulate);
+    CSU2TCLib gas(config.get(), 2, false);
+    std::vector<su2double> eve(config->GetnSpecies()), cvve(config->GetnSpecies());
+    su2double sum = 0;
+
+    auto start = Clock::now();
+    for (int i = 0; i < nRep; ++i) {
+      const su2double Tve = 500 + i % 20000;
+      gas.ComputeSpeciesEve(Tve, eve.data());
+      gas.ComputeSpeciesCvVibEle(Tve, cvve.data());
+      sum += eve[0] + cvve[0];
+    }
+    const double tEnergy = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / nRep;
+
+    start = Clock::now();
+    for (int i = 0; i < nRep; ++i) {
+      const auto& temps = Temperatures[i % Temperatures.size()];
+      gas.SetTDStateRhosTTv(rhos.data(), temps.first + i % 7, temps.second);
+      sum += gas.ComputeNetProductionRates(false, nullptr, nullptr, nullptr, nullptr, nullptr, nullptr)[0];
+    }
+    const double tRates = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / nRep;
+
+    std::cout << std::setw(12) << (tabulate ? "tabulated" : "analytic") << std::setw(14) << tEnergy << std::setw(14)
+              << tRates << std::endl;
+    CHECK(std::isfinite(SU2_TYPE::GetValue(sum)));
+  }
+}
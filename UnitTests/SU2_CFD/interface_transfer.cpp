@@ -0,0 +1,136 @@
+/*!
+ * \file interface_transfer.cpp
+ * \brief Unit tests of the transfer of interface data between zones.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+#include "../BoxMeshTestCase.hpp"
+#include "../../Common/include/interface_interpolation/CInterpolator.hpp"
+#include "../../Common/include/interface_interpolation/CInterpolatorFactory.hpp"
+#include "../../SU2_CFD/include/interfaces/CInterface.hpp"
+
+namespace {
+/*!
+ * \brief Transfers a smooth function of the donor coordinates and stores the interpolated values per target vertex.
+ */
+class CCoordinateInterface final : public CInterface {
+ public:
+  su2activematrix targetValues;
+
+  CCoordinateInterface(unsigned long nVertexTarget) : CInterface(3, 0), targetValues(nVertexTarget, 3) {}
+
+ protected:
+  void GetDonor_Variable(CSolver*, CGeometry* donor_geometry, const CConfig*, unsigned long, unsigned long,
+                         unsigned long Point_Donor) override {
+    const auto* coord = donor_geometry->nodes->GetCoord(Point_Donor);
+    Donor_Variable[0] = sin(3 * coord[1]) + coord[2];
+    Donor_Variable[1] = coord[1] * coord[2];
+    Donor_Variable[2] = cos(2 * coord[2]) - coord[1];
+  }
+
+  void SetTarget_Variable(CSolver*, CGeometry*, const CConfig*, unsigned long, unsigned long Vertex_Target,
+                          unsigned long) override {
+    for (auto iVar = 0u; iVar < nVar; ++iVar) targetValues(Vertex_Target, iVar) = Target_Variable[iVar];
+  }
+};
+
+std::unique_ptr<CConfig> ZoneConfig(const char* boxSize) {
+  std::stringstream options;
+  options << "SOLVER= ELASTICITY\n"
+          << "MESH_FORMAT= BOX\n"
+          << "MESH_BOX_SIZE= " << boxSize << "\n"
+          << "MESH_BOX_LENGTH= 1,1,1\n"
+          << "MESH_BOX_OFFSET= 0,0,0\n"
+          << "MARKER_CLAMPED= ( x_minus )\n"
+          << "MARKER_PRESSURE= ( x_plus, 0, y_minus, 0, y_plus, 0, z_minus, 0, z_plus, 0 )\n"
+          << "MARKER_ZONE_INTERFACE= ( x_minus, x_minus )\n"
+          << "KIND_INTERPOLATION= NEAREST_NEIGHBOR\n"
+          << "NUM_NEAREST_NEIGHBORS= 4\n"
+          << "CONSERVATIVE_INTERPOLATION= NO\n";
+  return BoxMeshTestCase::MakeConfig(options.str());
+}
+
+std::unique_ptr<CGeometry> ZoneGeometry(CConfig* config, unsigned short iZone) {
+  return BoxMeshTestCase::MakeGeometry(config, false, iZone, 2);
+}
+}  // namespace
+
+TEST_CASE("Point to point interface transfer matches the gather of all donors", "[Interpolation]") {
+  CScreenOutputSilencer silencer;
+
+  /*--- Two zones that share the x_minus boundary with non-matching meshes. ---*/
+
+  std::unique_ptr<CConfig> config[] = {ZoneConfig("3,5,4"), ZoneConfig("2,4,7")};
+  std::unique_ptr<CGeometry> geometry[] = {ZoneGeometry(config[0].get(), 0), ZoneGeometry(config[1].get(), 1)};
+
+  CGeometry* mesh[][1] = {{geometry[0].get()}, {geometry[1].get()}};
+  CGeometry** inst[][1] = {{mesh[0]}, {mesh[1]}};
+  CGeometry*** zones[] = {inst[0], inst[1]};
+  const CConfig* configs[] = {config[0].get(), config[1].get()};
+
+  std::unique_ptr<CInterpolator> interpolator(
+      CInterpolatorFactory::CreateInterpolator(zones, configs, nullptr, 0, 1, false));
+  silencer.Restore();
+
+  REQUIRE(interpolator->transferPattern.size() == 1);
+  REQUIRE(interpolator->transferPattern[0].valid);
+
+  const auto markTarget = config[1]->FindInterfaceMarker(0);
+  REQUIRE(markTarget >= 0);
+  const auto nVertex = geometry[1]->GetnVertex(markTarget);
+
+  CCoordinateInterface sparse(nVertex), gathered(nVertex);
+
+  sparse.BroadcastData(*interpolator, nullptr, nullptr, geometry[0].get(), geometry[1].get(), configs[0], configs[1]);
+
+  /*--- Without a valid pattern the donor data of all ranks is gathered. ---*/
+
+  interpolator->transferPattern[0].valid = false;
+  gathered.BroadcastData(*interpolator, nullptr, nullptr, geometry[0].get(), geometry[1].get(), configs[0],
+                         configs[1]);
+
+  for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+    const auto iPoint = geometry[1]->vertex[markTarget][iVertex]->GetNode();
+    if (!geometry[1]->nodes->GetDomain(iPoint)) continue;
+    for (auto iVar = 0u; iVar < 3; ++iVar) {
+      CAPTURE(iVertex, iVar);
+      CHECK(sparse.targetValues(iVertex, iVar) == gathered.targetValues(iVertex, iVar));
+    }
+  }
+
+  /*--- The transfer is not trivial, the interpolated values vary over the interface. ---*/
+
+  su2double minValue = sparse.targetValues(0, 0), maxValue = minValue;
+  for (auto iVertex = 0ul; iVertex < nVertex; ++iVertex) {
+    minValue = min(minValue, sparse.targetValues(iVertex, 0));
+    maxValue = max(maxValue, sparse.targetValues(iVertex, 0));
+  }
+  CHECK(maxValue - minValue > 0.5);
+}
@@ -0,0 +1,179 @@
+/*!
+ * \file multirate.cpp
+ * \brief Unit tests of the multirate explicit time stepping of the finite volume flow solvers.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../BoxMeshTestCase.hpp"
+#include "../../SU2_CFD/include/solvers/CSolver.hpp"
+#include "../../SU2_CFD/include/solvers/CSolverFactory.hpp"
+
+namespace {
+/*!
+ * \brief Total of each conserved variable over the domain, the sum of volume x solution.
+ */
+std::vector<su2double> Totals(const CGeometry& geometry, const CSolver& solver) {
+  std::vector<su2double> totals(solver.GetnVar(), 0.0);
+  for (auto iPoint = 0ul; iPoint < geometry.GetnPointDomain(); ++iPoint) {
+    const su2double volume = geometry.nodes->GetVolume(iPoint);
+    for (auto iVar = 0u; iVar < solver.GetnVar(); ++iVar)
+      totals[iVar] += volume * solver.GetNodes()->GetSolution(iPoint, iVar);
+  }
+  std::vector<su2double> globalTotals(totals.size());
+  SU2_MPI::Allreduce(totals.data(), globalTotals.data(), totals.size(), MPI_DOUBLE, MPI_SUM, SU2_MPI::GetComm());
+  return globalTotals;
+}
+
+/*!
+ * \brief Runs two multirate cycles on a box with two time levels and checks that the totals of the conserved
+ *        variables are unchanged, i.e. that the fluxes between time levels are conservative.
+ * \param[in] scheme - Explicit TIME_DISCRE_FLOW.
+ * \param[in] nStages - Number of stages of the scheme.
+ */
+void CheckMultirateConservation(const std::string& scheme, unsigned short nStages) {
+  std::stringstream options;
+  options << "SOLVER= EULER\n"
+          << "MESH_FORMAT= BOX\n"
+          << "MESH_BOX_SIZE= 9,5,5\n"
+          << "MESH_BOX_LENGTH= 1,0.5,0.5\n"
+          << "MESH_BOX_OFFSET= 0,0,0\n"
+          << "INIT_OPTION= TD_CONDITIONS\n"
+          << "MACH_NUMBER= 0.1\n"
+          << "CONV_NUM_METHOD_FLOW= ROE\n"
+          << "MUSCL_FLOW= NO\n"
+          << "TIME_DOMAIN= YES\n"
+          << "TIME_MARCHING= TIME_STEPPING\n"
+          << "TIME_DISCRE_FLOW= " << scheme << "\n"
+          << "RK_ALPHA_COEFF= (0.66667, 0.66667, 1.000000)\n"
+          << "UNST_CFL_NUMBER= 0.5\n"
+          << "LEVELS_TIME_ACCURATE_LTS= 2\n"
+          << "MGLEVEL= 0\n"
+          << "MARKER_EULER= (x_minus, x_plus, y_minus, y_plus, z_minus, z_plus)\n"
+          << "REF_ORIGIN_MOMENT_X= 0.0\n"
+          << "REF_ORIGIN_MOMENT_Y= 0.0\n"
+          << "REF_ORIGIN_MOMENT_Z= 0.0\n";
+
+  const BoxMeshTestCase box(options.str());
+  const auto& config = box.config;
+  const auto& geometry = box.geometry;
+
+  CScreenOutputSilencer silencer;
+
+  auto** solvers = CSolverFactory::CreateSolverContainer(config->GetKind_Solver(), config.get(), geometry.get(), MESH_0);
+  auto* flow = solvers[FLOW_SOL];
+  auto* nodes = flow->GetNodes();
+  const auto nVar = flow->GetnVar();
+
+  /*--- The internal energy is 9 times larger for x < 0.5, the speed of sound is 3 times larger and the local time
+   *    step at least 2 times smaller than for x > 0.5, i.e. there are two time levels. ---*/
+
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPoint(); ++iPoint) {
+    if (geometry->nodes->GetCoord(iPoint, 0) > 0.5) continue;
+    const su2double density = nodes->GetSolution(iPoint, 0);
+    su2double kinetic = 0.0;
+    for (auto iDim = 0u; iDim < geometry->GetnDim(); ++iDim) kinetic += pow(nodes->GetSolution(iPoint, iDim + 1), 2);
+    kinetic *= 0.5 / density;
+    nodes->SetSolution(iPoint, nVar - 1, 9 * (nodes->GetSolution(iPoint, nVar - 1) - kinetic) + kinetic);
+  }
+
+  const auto initial = Totals(*geometry, *flow);
+  const su2activematrix initialSolution = nodes->GetSolution();
+
+  /*--- Two cycles of 2 time iterations, without boundary conditions (the domain is closed) the total of all
+   *    conserved variables only changes with the fluxes between time levels. ---*/
+
+  su2double deltaTime[] = {0.0, 0.0};
+
+  for (auto timeIter = 0ul; timeIter < 4; ++timeIter) {
+    config->SetTimeIter(timeIter);
+    config->SetGlobalParam(config->GetKind_Solver(), RUNTIME_FLOW_SYS);
+    /*--- The stages as done by CMultiGridIntegration. ---*/
+    SU2_OMP_PARALLEL {
+      for (unsigned short iRKStep = 0; iRKStep < nStages; ++iRKStep) {
+        flow->Preprocessing(geometry.get(), solvers, config.get(), MESH_0, iRKStep, RUNTIME_FLOW_SYS, false);
+        if (iRKStep == 0) {
+          flow->Set_OldSolution();
+          if (config->GetKind_TimeIntScheme() == CLASSICAL_RK4_EXPLICIT) flow->Set_NewSolution();
+          flow->SetTime_Step(geometry.get(), solvers, config.get(), MESH_0, timeIter);
+        }
+        flow->Upwind_Residual(geometry.get(), solvers, nullptr, config.get(), MESH_0);
+        switch (config->GetKind_TimeIntScheme()) {
+          case RUNGE_KUTTA_EXPLICIT:
+            flow->ExplicitRK_Iteration(geometry.get(), solvers, config.get(), iRKStep);
+            break;
+          case CLASSICAL_RK4_EXPLICIT:
+            flow->ClassicalRK4_Iteration(geometry.get(), solvers, config.get(), iRKStep);
+            break;
+          default:
+            flow->ExplicitEuler_Iteration(geometry.get(), solvers, config.get());
+            break;
+        }
+      }
+    }
+    END_SU2_OMP_PARALLEL
+
+    /*--- Smallest and largest time steps (the smallest is stored negated to reduce both with MPI_MAX). ---*/
+    if (timeIter == 0) {
+      su2double localDeltaTime[] = {-nodes->GetDelta_Time(0), nodes->GetDelta_Time(0)};
+      for (auto iPoint = 1ul; iPoint < geometry->GetnPointDomain(); ++iPoint) {
+        localDeltaTime[0] = max(localDeltaTime[0], -nodes->GetDelta_Time(iPoint));
+        localDeltaTime[1] = max(localDeltaTime[1], nodes->GetDelta_Time(iPoint));
+      }
+      SU2_MPI::Allreduce(localDeltaTime, deltaTime, 2, MPI_DOUBLE, MPI_MAX, SU2_MPI::GetComm());
+    }
+  }
+  silencer.Restore();
+
+  CHECK(deltaTime[1] == Approx(-2 * deltaTime[0]));
+
+  const auto totals = Totals(*geometry, *flow);
+  for (auto iVar = 0u; iVar < nVar; ++iVar) {
+    CAPTURE(iVar);
+    CHECK(totals[iVar] == Approx(initial[iVar]).epsilon(1e-12).margin(1e-12));
+  }
+
+  /*--- The solution changed, otherwise the test is trivial. ---*/
+  su2double change = 0.0;
+  for (auto iPoint = 0ul; iPoint < geometry->GetnPointDomain(); ++iPoint)
+    change = max(change, fabs(nodes->GetSolution(iPoint, 0) - initialSolution(iPoint, 0)));
+  CHECK(change > 1e-6 * initialSolution(0, 0));
+
+  for (auto iSol = 0u; iSol < MAX_SOLS; ++iSol) delete solvers[iSol];
+  delete[] solvers;
+}
+}  // namespace
+
+TEST_CASE("Multirate time stepping is conservative", "[Multirate]") {
+  SECTION("Forward Euler") { CheckMultirateConservation("EULER_EXPLICIT", 1); }
+  SECTION("Runge-Kutta") { CheckMultirateConservation("RUNGE-KUTTA_EXPLICIT", 3); }
+  SECTION("Classical RK4") { CheckMultirateConservation("CLASSICAL_RK4_EXPLICIT", 4); }
+}
@@ -0,0 +1,203 @@
+/*!
+ * \file CFEAElasticity_batch_tests.cpp
+ * \brief Unit tests of the batched (SIMD) element terms of the elasticity numerics.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+
+#include <cmath>
+#include <memory>
+#include <sstream>
+
+#include "../../../Common/include/CConfig.hpp"
+#include "../../../Common/include/geometry/elements/CElement.hpp"
+#include "../../../Common/include/geometry/elements/CElementProperty.hpp"
+#include "../../../SU2_CFD/include/numerics/elasticity/CFEALinearElasticity.hpp"
+#include "../../../SU2_CFD/include/numerics/elasticity/nonlinear_models.hpp"
+
+namespace {
+using Double = simd::Array<su2double>;
+
+std::unique_ptr<CConfig> ElasticityConfig(const char* geometricConditions, const char* materialModel) {
+  std::stringstream options;
+  options << "SOLVER= ELASTICITY\n"
+          << "GEOMETRIC_CONDITIONS= " << geometricConditions << "\n"
+          << "MATERIAL_MODEL= " << materialModel << "\n"
+          << "ELASTICITY_MODULUS= 1000\n"
+          << "POISSON_RATIO= 0.3\n"
+          << "MATERIAL_THERMAL_EXPANSION_COEFF= 1e-4\n"
+          << "MATERIAL_REFERENCE_TEMPERATURE= 290\n";
+
+  auto orig_buf = cout.rdbuf();
+  cout.rdbuf(nullptr);
+  auto config = std::unique_ptr<CConfig>(new CConfig(options, SU2_COMPONENT::SU2_CFD, false));
+  cout.rdbuf(orig_buf);
+  return config;
+}
+
+/*!
+ * \brief Distorted and deformed copies of a standard element, a different one per SIMD lane.
+ */
+template <class ElementType>
+struct CElementBatch {
+  static constexpr unsigned short NNODE = ElementType::nNodeBatch;
+  static constexpr unsigned short NDIM = ElementType::nDimBatch;
+
+  Double Coord[NNODE][NDIM], Disp[NNODE][NDIM], CurrCoord[NNODE][NDIM], Temperature[NNODE];
+
+  explicit CElementBatch(const su2double (&standard)[NNODE][NDIM]) {
+    for (size_t iLane = 0; iLane < Double::Size; ++iLane) {
+      for (unsigned short iNode = 0; iNode < NNODE; ++iNode) {
+        for (unsigned short iDim = 0; iDim < NDIM; ++iDim) {
+          const su2double seed = 1 + 3 * iNode + 7 * iDim + 11 * iLane;
+          Coord[iNode][iDim][iLane] = standard[iNode][iDim] + 0.1 * sin(seed);
+          Disp[iNode][iDim][iLane] = 0.05 * cos(seed);
+          CurrCoord[iNode][iDim][iLane] = Coord[iNode][iDim][iLane] + Disp[iNode][iDim][iLane];
+        }
+        Temperature[iNode][iLane] = 300 + 10 * sin(5 + 2 * iNode + 13 * iLane);
+      }
+    }
+  }
+
+  /*!
+   * \brief Load one lane into a scalar element.
+   */
+  void SetElement(ElementType& element, size_t iLane) const {
+    for (unsigned short iNode = 0; iNode < NNODE; ++iNode) {
+      for (unsigned short iDim = 0; iDim < NDIM; ++iDim) {
+        element.SetRef_Coord(iNode, iDim, Coord[iNode][iDim][iLane]);
+        element.SetCurr_Coord(iNode, iDim, CurrCoord[iNode][iDim][iLane]);
+      }
+      element.SetTemperature(iNode, Temperature[iNode][iLane]);
+    }
+  }
+};
+
+/*!
+ * \brief Compare the batched tangent matrix and stress term of linear elasticity with the scalar ones.
+ */
+template <class ElementType>
+void CheckLinearElasticity(const su2double (&standard)[ElementType::nNodeBatch][ElementType::nDimBatch]) {
+  constexpr auto NNODE = ElementType::nNodeBatch;
+  constexpr auto NDIM = ElementType::nDimBatch;
+
+  const auto config = ElasticityConfig("SMALL_DEFORMATIONS", "LINEAR_ELASTIC");
+  CFEALinearElasticity numerics(NDIM, NDIM, config.get());
+  const CElementProperty property(0, 0, 0, 0);
+  ElementType element;
+  element.Set_ElProperties(&property);
+
+  const CElementBatch<ElementType> batch(standard);
+
+  Double lambda, mu, thermal, tempRef;
+  for (size_t iLane = 0; iLane < Double::Size; ++iLane)
+    numerics.GetElementParameters(&element, config.get(), lambda[iLane], mu[iLane], thermal[iLane], tempRef[iLane]);
+
+  Double Kab[NNODE][NNODE][NDIM * NDIM], Kt_a[NNODE][NDIM];
+  CFEALinearElasticity::ComputeBatchTangentMatrix(element, batch.Coord, batch.Disp, batch.Temperature, lambda, mu,
+                                                  thermal, tempRef, Kab, Kt_a);
+
+  for (size_t iLane = 0; iLane < Double::Size; ++iLane) {
+    batch.SetElement(element, iLane);
+    numerics.Compute_Tangent_Matrix(&element, config.get());
+
+    for (unsigned short iNode = 0; iNode < NNODE; ++iNode) {
+      for (unsigned short iDim = 0; iDim < NDIM; ++iDim)
+        CHECK(Kt_a[iNode][iDim][iLane] == Approx(element.Get_Kt_a(iNode)[iDim]).margin(1e-9));
+
+      for (unsigned short jNode = 0; jNode < NNODE; ++jNode)
+        for (unsigned short iVar = 0; iVar < NDIM * NDIM; ++iVar)
+          CHECK(Kab[iNode][jNode][iVar][iLane] == Approx(element.Get_Kab(iNode, jNode)[iVar]).margin(1e-9));
+    }
+  }
+}
+
+/*!
+ * \brief Compare the batched tangent matrix and nodal stress term of the neo-Hookean model with the scalar ones.
+ */
+template <class ElementType>
+void CheckNeoHookean(const su2double (&standard)[ElementType::nNodeBatch][ElementType::nDimBatch]) {
+  constexpr auto NNODE = ElementType::nNodeBatch;
+  constexpr auto NDIM = ElementType::nDimBatch;
+
+  const auto config = ElasticityConfig("LARGE_DEFORMATIONS", "NEO_HOOKEAN");
+  CFEM_NeoHookean_Comp numerics(NDIM, NDIM, config.get());
+  REQUIRE(numerics.BatchSupported());
+  const CElementProperty property(0, 0, 0, 0);
+  ElementType element;
+  element.Set_ElProperties(&property);
+
+  const CElementBatch<ElementType> batch(standard);
+
+  Double lambda, mu, thermal, tempRef;
+  for (size_t iLane = 0; iLane < Double::Size; ++iLane)
+    numerics.GetElementParameters(&element, config.get(), lambda[iLane], mu[iLane], thermal[iLane], tempRef[iLane]);
+
+  Double Kab[NNODE][NNODE][NDIM * NDIM], Ks_ab[NNODE][NNODE], Kt_a[NNODE][NDIM], Kt_a_Res[NNODE][NDIM];
+  CFEM_NeoHookean_Comp::ComputeBatchTerms<true>(element, batch.Coord, batch.CurrCoord, batch.Temperature, lambda,
+                                                mu, thermal, tempRef, Kab, Ks_ab, Kt_a);
+  CFEM_NeoHookean_Comp::ComputeBatchTerms<false>(element, batch.Coord, batch.CurrCoord, batch.Temperature, lambda,
+                                                 mu, thermal, tempRef, Kab, Ks_ab, Kt_a_Res);
+
+  for (size_t iLane = 0; iLane < Double::Size; ++iLane) {
+    batch.SetElement(element, iLane);
+    numerics.Compute_Tangent_Matrix(&element, config.get());
+
+    for (unsigned short iNode = 0; iNode < NNODE; ++iNode) {
+      for (unsigned short iDim = 0; iDim < NDIM; ++iDim)
+        CHECK(Kt_a[iNode][iDim][iLane] == Approx(element.Get_Kt_a(iNode)[iDim]).margin(1e-9));
+
+      for (unsigned short jNode = 0; jNode < NNODE; ++jNode) {
+        CHECK(Ks_ab[iNode][jNode][iLane] == Approx(element.Get_Ks_ab(iNode, jNode)).margin(1e-9));
+        for (unsigned short iVar = 0; iVar < NDIM * NDIM; ++iVar)
+          CHECK(Kab[iNode][jNode][iVar][iLane] == Approx(element.Get_Kab(iNode, jNode)[iVar]).margin(1e-9));
+      }
+    }
+
+    numerics.Compute_NodalStress_Term(&element, config.get());
+
+    for (unsigned short iNode = 0; iNode < NNODE; ++iNode)
+      for (unsigned short iDim = 0; iDim < NDIM; ++iDim)
+        CHECK(Kt_a_Res[iNode][iDim][iLane] == Approx(element.Get_Kt_a(iNode)[iDim]).margin(1e-9));
+  }
+}
+
+const su2double quad[4][2] = {{0, 0}, {1, 0}, {1, 1}, {0, 1}};
+const su2double tetra[4][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}};
+const su2double hexa[8][3] = {{0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 1, 0},
+                              {0, 0, 1}, {1, 0, 1}, {1, 1, 1}, {0, 1, 1}};
+}  // namespace
+
+TEST_CASE("Batched linear elasticity matches the scalar element terms", "[FEA]") {
+  CheckLinearElasticity<CQUAD4>(quad);
+  CheckLinearElasticity<CTETRA1>(tetra);
+  CheckLinearElasticity<CHEXA8>(hexa);
+}
+
+TEST_CASE("Batched neo-Hookean model matches the scalar element terms", "[FEA]") {
+  CheckNeoHookean<CQUAD4>(quad);
+  CheckNeoHookean<CTETRA1>(tetra);
+  CheckNeoHookean<CHEXA8>(hexa);
+}
@@ -0,0 +1,85 @@
+/*!
+ * \file CNumericsSIMD_adjoint_tests.cpp
+ * \brief Unit tests for the hand-written adjoints of the SIMD numerics kernels.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include <cmath>
+#include "../../../SU2_CFD/include/numerics_simd/flow/convection/common.hpp"
+
+/*!
+ * \brief Dot product test of the hand-written tangent and adjoint of the central inviscid flux:
+ * y_b^T (J dx), with J dx from central finite differences, must match y_b^T y_d and (J^T y_b)^T dx.
+ */
+template<size_t nDim>
+void TestCentralInviscidFluxAdjoint() {
+  constexpr size_t nIn = 3*nDim+6, nOut = nDim+2;
+
+  /*--- Two reasonable states (velocity, pressure, density, enthalpy) and a normal. ---*/
+  passivedouble x[nIn], dx[nIn], y_b[nOut], x_b[nIn];
+  for (size_t i = 0; i < nDim; ++i) {
+    x[i] = 50.0 + 10.0*i;
+    x[nDim+3+i] = 40.0 - 5.0*i;
+    x[2*nDim+6+i] = 0.1 + 0.05*i;
+  }
+  x[nDim] = 1.0e5;    x[2*nDim+3] = 0.9e5;
+  x[nDim+1] = 1.2;    x[2*nDim+4] = 1.1;
+  x[nDim+2] = 3.0e5;  x[2*nDim+5] = 2.8e5;
+
+  for (size_t i = 0; i < nIn; ++i) dx[i] = std::abs(x[i]) * (0.3 + 0.01*i);
+  for (size_t i = 0; i < nOut; ++i) y_b[i] = 1.0 - 0.2*i;
+
+  centralInviscidFlux_b<nDim>(x, y_b, x_b);
+
+  const passivedouble eps = 1e-6;
+  passivedouble xp[nIn], xm[nIn], yp[nOut], ym[nOut];
+  for (size_t i = 0; i < nIn; ++i) {
+    xp[i] = x[i] + eps*dx[i];
+    xm[i] = x[i] - eps*dx[i];
+  }
+  centralInviscidFlux_p<nDim>(xp, yp);
+  centralInviscidFlux_p<nDim>(xm, ym);
+
+  passivedouble y[nOut], y_d[nOut], y_ref[nOut];
+  centralInviscidFlux_d<nDim>(x, dx, y, y_d);
+  centralInviscidFlux_p<nDim>(x, y_ref);
+
+  passivedouble finiteDiff = 0.0, tangent = 0.0, reverse = 0.0;
+  for (size_t i = 0; i < nOut; ++i) finiteDiff += y_b[i] * (yp[i]-ym[i]) / (2*eps);
+  for (size_t i = 0; i < nOut; ++i) tangent += y_b[i] * y_d[i];
+  for (size_t i = 0; i < nIn; ++i) reverse += x_b[i] * dx[i];
+
+  for (size_t i = 0; i < nOut; ++i) CHECK(y[i] == y_ref[i]);
+  CHECK(tangent == Approx(finiteDiff).epsilon(1e-6));
+  CHECK(reverse == Approx(tangent).epsilon(1e-12));
+}
+
+TEST_CASE("Central inviscid flux adjoint 2D", "[AD external functions]") {
+  TestCentralInviscidFluxAdjoint<2>();
+}
+
+TEST_CASE("Central inviscid flux adjoint 3D", "[AD external functions]") {
+  TestCentralInviscidFluxAdjoint<3>();
+}
@@ -0,0 +1,188 @@
+/*!
+ * \file CNumericsSIMD_adjoint_tests_AD.cpp
+ * \brief AD unit tests for the hand-written adjoints (external functions) of the SIMD numerics kernels.
+ * \author The SU2 Developers
+ * \version 8.3.0 "Harrier"
+ *
+ * SU2 Project Website: https://su2code.github.io
+ *
+ * The SU2 Project is maintained by the SU2 Foundation
+ * (http://su2foundation.org)
+ *
+ * Copyright 2012-2025, SU2 Contributors (cf. AUTHORS.md)
+ *
+ * SU2 is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU Lesser General Public
+ * License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ *
+ * SU2 is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the GNU
+ * Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with SU2. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "catch.hpp"
+#include "../../../SU2_CFD/include/numerics_simd/flow/convection/common.hpp"
+
+namespace {
+/*!
+ * \brief How the central inviscid flux is recorded.
+ */
+enum class FluxRecording { STATEMENTS, EXTERNAL, EXTERNAL_PREACC };
+
+/*!
+ * \brief Record the central inviscid flux, as statements or with centralInviscidFlux as used by the centered schemes
+ * with AD_EXTERNAL_FLUX= YES (with or without preaccumulation).
+ */
+template<size_t nDim>
+void RecordCentralInviscidFlux(FluxRecording recording, su2double* x, su2double* y) {
+  constexpr size_t nState = nDim+3, nIn = 3*nDim+6, nOut = nDim+2;
+
+  if (recording == FluxRecording::STATEMENTS) {
+    centralInviscidFlux_p<nDim>(x, y);
+    return;
+  }
+  const bool preacc = (recording == FluxRecording::EXTERNAL_PREACC);
+  if (preacc) {
+    AD::StartPreacc();
+    AD::SetPreaccIn(x, nIn);
+  }
+
+  CPair<CCompressiblePrimitives<nDim,nDim+4> > V;
+  VectorDbl<nDim> normal;
+  V.i.temperature() = 300.0;
+  V.j.temperature() = 300.0;
+  for (size_t iVar = 0; iVar < nState; ++iVar) {
+    V.i.all(iVar+1) = x[iVar];
+    V.j.all(iVar+1) = x[nState+iVar];
+  }
+  for (size_t iDim = 0; iDim < nDim; ++iDim) normal(iDim) = x[2*nState+iDim];
+
+  const auto f = centralInviscidFlux(V, normal);
+  for (size_t i = 0; i < nOut; ++i) y[i] = f(i)[0];
+
+  if (preacc) {
+    AD::SetPreaccOut(y, nOut);
+    AD::EndPreacc();
+  }
+}
+
+/*!
+ * \brief Two reasonable states (velocity, pressure, density, enthalpy) and a normal.
+ */
+template<size_t nDim>
+void CentralInviscidFluxInputs(passivedouble* x) {
+  constexpr size_t nState = nDim+3;
+  for (size_t i = 0; i < nDim; ++i) {
+    x[i] = 50.0 + 10.0*i;
+    x[nState+i] = 40.0 - 5.0*i;
+    x[2*nState+i] = 0.1 + 0.05*i;
+  }
+  x[nDim] = 1.0e5;    x[nState+nDim] = 0.9e5;
+  x[nDim+1] = 1.2;    x[nState+nDim+1] = 1.1;
+  x[nDim+2] = 3.0e5;  x[nState+nDim+2] = 2.8e5;
+}
+}  // namespace
+
+/*!
+ * \brief Reverse sweep of the central inviscid flux recorded as an external function, without and inside a
+ * preaccumulation region, compared with the recorded statements of the primal.
+ */
+template<size_t nDim>
+void TestCentralInviscidFluxTape() {
+  constexpr size_t nIn = 3*nDim+6, nOut = nDim+2;
+
+  passivedouble x0[nIn], y_b[nOut];
+  CentralInviscidFluxInputs<nDim>(x0);
+  for (size_t i = 0; i < nOut; ++i) y_b[i] = 1.0 - 0.2*i;
+
+  const bool preaccEnabled = AD::PreaccEnabled;
+  AD::PreaccEnabled = true;
+
+  passivedouble gradient[3][nIn], flux[3][nOut];
+
+  for (const auto recording : {FluxRecording::STATEMENTS, FluxRecording::EXTERNAL, FluxRecording::EXTERNAL_PREACC}) {
+    const auto iRec = static_cast<int>(recording);
+    su2double x[nIn], y[nOut];
+    for (size_t i = 0; i < nIn; ++i) x[i] = x0[i];
+
+    AD::Reset();
+    AD::StartRecording();
+    for (auto& xi : x) AD::RegisterInput(xi);
+
+    RecordCentralInviscidFlux<nDim>(recording, x, y);
+
+    for (auto& yi : y) AD::RegisterOutput(yi);
+    AD::StopRecording();
+
+    for (size_t i = 0; i < nOut; ++i) {
+      SU2_TYPE::SetDerivative(y[i], y_b[i]);
+      flux[iRec][i] = SU2_TYPE::GetValue(y[i]);
+    }
+    AD::ComputeAdjoint();
+
+    for (size_t i = 0; i < nIn; ++i) gradient[iRec][i] = SU2_TYPE::GetDerivative(x[i]);
+  }
+  AD::Reset();
+  AD::PreaccEnabled = preaccEnabled;
+
+  for (int iRec = 1; iRec < 3; ++iRec) {
+    for (size_t i = 0; i < nOut; ++i) CHECK(flux[iRec][i] == Approx(flux[0][i]));
+    for (size_t i = 0; i < nIn; ++i) CHECK(gradient[iRec][i] == Approx(gradient[0][i]).margin(1e-12));
+  }
+}
+
+/*!
+ * \brief Memory of the tape (plus the primal values and identifiers kept by the external function helper) for many
+ * fluxes, without preaccumulation the external function must be smaller than the recorded statements.
+ */
+template<size_t nDim>
+void TestCentralInviscidFluxTapeMemory() {
+  constexpr size_t nIn = 3*nDim+6, nOut = nDim+2, nFlux = 1000;
+  using Real = su2double::Real;
+
+  passivedouble x0[nIn];
+  CentralInviscidFluxInputs<nDim>(x0);
+
+  const bool preaccEnabled = AD::PreaccEnabled;
+  AD::PreaccEnabled = false;
+
+  double memory[2] = {0.0, 0.0};
+
+  for (const auto recording : {FluxRecording::STATEMENTS, FluxRecording::EXTERNAL}) {
+    const auto iRec = static_cast<int>(recording);
+    su2double x[nIn], y[nOut];
+    for (size_t i = 0; i < nIn; ++i) x[i] = x0[i];
+
+    AD::Reset();
+    AD::StartRecording();
+    for (auto& xi : x) AD::RegisterInput(xi);
+    for (size_t iFlux = 0; iFlux < nFlux; ++iFlux) RecordCentralInviscidFlux<nDim>(recording, x, y);
+    AD::StopRecording();
+
+    memory[iRec] = AD::getTape().getTapeValues().getUsedMemorySize();
+    if (recording == FluxRecording::EXTERNAL) {
+      memory[iRec] += nFlux * (nIn * (sizeof(Real) + sizeof(AD::Identifier)) +
+                               nOut * (sizeof(Real) + sizeof(AD::Identifier)));
+    }
+  }
+  AD::Reset();
+  AD::PreaccEnabled = preaccEnabled;
+
+  INFO("Tape memory of " << nFlux << " fluxes, statements: " << memory[0] << ", external: " << memory[1]);
+  CHECK(memory[1] < memory[0]);
+}
+
+TEST_CASE("Central inviscid flux external function 2D", "[AD tests]") {
+  TestCentralInviscidFluxTape<2>();
+  TestCentralInviscidFluxTapeMemory<2>();
+}
+
+TEST_CASE("Central inviscid flux external function 3D", "[AD tests]") {
+  TestCentralInviscidFluxTape<3>();
+  TestCentralInviscidFluxTapeMemory<3>();
+}